@@ -0,0 +1,51 @@
+/**
+ *******************************************************************************
+ * @file avxecc.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Public header file of the library.
+ *
+ * @details
+ * This is the only header that a program which links libavxecc.a or
+ * libavxecc.so needs. It exposes the batched API: the X25519 dispatcher and
+ * batches (x25519.h), Ed25519 signing and verification (ed25519.h, needs
+ * AVX2), the Elligator 2 maps (elligator.h, needs AVX2), X448 (x448.h,
+ * needs AVX2; the three are declared on x86-64 only), the batch engine
+ * (engine.h), the cache of per-peer tables (peercache.h) and, in a build
+ * with PROF=1, the per-phase cycle counters (prof.h, the program defines
+ * PROF=1 as well). All of them take byte strings and plain C types, no vector
+ * types. The shared library exports these functions and nothing else, with
+ * the symbol version AVXECC_1.0 (src/libavxecc.map); the structs of the
+ * headers are part of that ABI, so a change of their layout needs a new
+ * major version.
+ *******************************************************************************
+ */
+
+#ifndef _AVXECC_H
+#define _AVXECC_H
+
+#define AVXECC_VERSION_MAJOR 1
+#define AVXECC_VERSION_MINOR 0
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "x25519.h"
+#if defined(__x86_64__)
+#include "ed25519.h"
+#include "elligator.h"
+#include "x448.h"
+#endif
+#include "engine.h"
+#include "peercache.h"
+#include "prof.h"
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
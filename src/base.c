@@ -0,0 +1,64 @@
+/**
+ *******************************************************************************
+ * @file base.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the look-up table of the base point.
+ * 
+ * @details 
+ * This file contains the conversion of LUT points (in Duif representation) 
+ * and the look-up tables of the base points (containing the multiples of 
+ * base points), which tools/gentable generates at build time for the 
+ * configured geometry. It is the only translation unit that defines the 
+ * tables and the per-thread pointers to them, the other files see their 
+ * declarations in tedcurve.h.
+ *******************************************************************************
+ */
+
+#include "base.h"
+
+
+/**
+ * @brief Convert the coordinates of LUT point to mpi29 format.
+ *
+ * @details
+ * Convert the coordinate of a LUT point (4*64-bit) to 9*29-bit.
+ *
+ * @param r Mpi29 integer 
+ * @param a LUT coordinate
+ */
+void lut_conv_coor2mpi29_avx2(__m256i *r, const __m256i *a)
+{
+  const __m256i mask = VSET164(MASK29);
+
+  r[0] = VAND(a[0], mask); 
+  r[1] = VAND(VSHR(a[0], 29), mask);
+  r[2] = VSHR(a[0], 58);
+  r[2] = VOR(r[2], VSHL(a[1], 6));
+  r[2] = VAND(r[2], mask);
+  r[3] = VAND(VSHR(a[1], 23), mask);
+  r[4] = VSHR(a[1], 52);
+  r[4] = VOR(r[4], VSHL(a[2], 12));
+  r[4] = VAND(r[4], mask);
+  r[5] = VAND(VSHR(a[2], 17), mask);
+  r[6] = VSHR(a[2], 46);
+  r[6] = VOR(r[6], VSHL(a[3], 18));
+  r[6] = VAND(r[6], mask);
+  r[7] = VAND(VSHR(a[3], 11), mask);
+  r[8] = VAND(VSHR(a[3], 40), mask);
+}
+
+
+// table in 29-bit limbs, generated at build time for every geometry
+#include "fixbase_limbs.h"
+
+// table of the multiples in Duif representation, generated at build time
+#include "fixbase_table.h"
+
+// the tables of the calling thread, the global ones by default (numa.c points
+// them at the replicas of the node)
+__thread const LutPoint (*fixbase)[FIXBASE_K] = base;
+__thread const uint32_t (*fixbase29)[3][NWORDS][FIXBASE_K] = base29;
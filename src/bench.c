@@ -0,0 +1,772 @@
+/**
+ *******************************************************************************
+ * @file bench.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the benchmark program.
+ *
+ * @details
+ * The benchmark of the library (make bench), apart from the one of test_bench.
+ * It has three suites:
+ * - latency: every call of the keygen and shared-secret kernels of each
+ *   supported implementation is timed on its own, between fenced reads of the
+ *   TSC (lfence; rdtsc; lfence and rdtscp; lfence), the median of the empty
+ *   measurement is subtracted; the min, median, p90, p99 and mean cycles of a
+ *   call are reported (the p99 only with at least MINSAMPLES samples)
+ * - batch: the same for the batch functions of x25519.h, swept over the batch
+ *   size n
+ * - scaling: 1, 2, 4, ..., N threads pinned to CPUs 0, 1, ... compute batches
+ *   for a fixed time, the throughput is compared to N times the one of a
+ *   single thread
+ * -i selects the implementation of the latency suite; the batch and scaling
+ * suites measure the one of the dispatcher, which is chosen at load time
+ * (AVXECC_IMPL selects it), so -i with another one only prints a warning.
+ * Before the suites the ratio of the core clock to the TSC is measured with a
+ * chain of dependent additions, and the turbo and governor settings are read
+ * from sysfs; a warning is printed if the cycle counts (TSC ticks) are not
+ * core cycles. The results are printed as text, JSON or CSV (-f), e.g. to
+ * compare hosts and kernel variants in a regression tracker.
+ *******************************************************************************
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "x25519.h"
+#include "ecdh.h"
+#include <math.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// maximum number of records and of samples of an operation
+#define MAXRECORDS 1024
+#define MAXSAMPLES 100000
+// samples of a record with a p99 (the p99 of fewer samples is the maximum or
+// close to it), the batch suite takes at least as many if -n allows it
+#define MINSAMPLES 100
+// batch sizes of the batch suite
+static const size_t batch_sizes[] = { 1, 2, 3, 4, 8, 16, 32, 64, 128, 256, 1024 };
+#define NBATCHSIZES (sizeof(batch_sizes)/sizeof(batch_sizes[0]))
+// keys of a batch of the scaling suite
+#define SCALE_BATCH 64
+// the core clock may differ from the TSC by this fraction without a warning
+#define CLOCK_TOLERANCE 0.03
+
+// result of one operation, the cycles are per call (or per batch)
+typedef struct bench_record {
+  const char *suite;
+  char op[40];
+  char impl[16];
+  long param;             // lanes (latency), n (batch) or threads (scaling)
+  size_t samples;
+  double min, median, p90, p99, mean;
+  double per_key;         // median cycles per key
+  double ops_per_sec;     // keys per second (TSC frequency / per_key)
+  double efficiency;      // scaling only: throughput / (threads * single)
+} BenchRecord;
+
+static BenchRecord records[MAXRECORDS];
+static int nrecords;
+static char warnings[8][160];
+static int nwarnings;
+static uint64_t overhead;
+static double tsc_hz, clock_ratio[2];
+static uint64_t samples[MAXSAMPLES];
+
+
+/**
+ * @brief Read the TSC at the start of a measurement.
+ *
+ * @details
+ * The first lfence waits for the preceding instructions, the second keeps the
+ * measured ones from starting before rdtsc.
+ *
+ * @return TSC
+ */
+static inline uint64_t tsc_start(void)
+{
+  uint32_t lo, hi;
+
+  __asm__ volatile ("lfence\n\trdtsc\n\tlfence" : "=a"(lo), "=d"(hi) :: "memory");
+  return ((uint64_t)hi << 32) | lo;
+}
+
+
+/**
+ * @brief Read the TSC at the end of a measurement.
+ *
+ * @details
+ * rdtscp waits for the measured instructions, the lfence keeps the following
+ * ones from starting before it.
+ *
+ * @return TSC
+ */
+static inline uint64_t tsc_stop(void)
+{
+  uint32_t lo, hi, aux;
+
+  __asm__ volatile ("rdtscp\n\tlfence" : "=a"(lo), "=d"(hi), "=c"(aux) :: "memory");
+  return ((uint64_t)hi << 32) | lo;
+}
+
+
+/**
+ * @brief Monotonic time in seconds.
+ *
+ * @return Seconds
+ */
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + 1e-9*ts.tv_nsec;
+}
+
+
+static int cmp_u64(const void *a, const void *b)
+{
+  uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+
+  return (x > y) - (x < y);
+}
+
+
+/**
+ * @brief Pin the calling thread to a CPU.
+ *
+ * @param cpu CPU
+ */
+static void pin_cpu(int cpu)
+{
+#if defined(__linux__)
+  cpu_set_t set;
+
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+#else
+  (void)cpu;
+#endif
+}
+
+
+static void warn(const char *msg)
+{
+  if (nwarnings < 8) {
+    snprintf(warnings[nwarnings++], sizeof(warnings[0]), "%s", msg);
+  }
+  fprintf(stderr, "WARNING: %s\n", msg);
+}
+
+
+/**
+ * @brief Read the first line of a sysfs file.
+ *
+ * @param buf Line without the newline (empty if the file is missing)
+ * @param len Size of buf
+ * @param path File
+ * @return 1 if the file was read
+ */
+static int read_line(char *buf, size_t len, const char *path)
+{
+  FILE *f = fopen(path, "r");
+
+  buf[0] = 0;
+  if (f == NULL) return 0;
+  if (fgets(buf, (int)len, f) == NULL) buf[0] = 0;
+  fclose(f);
+  buf[strcspn(buf, "\n")] = 0;
+  return 1;
+}
+
+
+/**
+ * @brief Ratio of the core clock to the TSC.
+ *
+ * @details
+ * A chain of dependent additions takes one core cycle per addition, so the
+ * additions per TSC tick are the core frequency over the TSC frequency; it is
+ * 1 if the cycle counts of the suites are core cycles. The addend is a
+ * register, recent cores fold additions of immediates at renaming.
+ *
+ * @return Core cycles per TSC tick
+ */
+static double core_clock_ratio(void)
+{
+  const long iterations = 20000000;
+  uint64_t x = 0, y = 1, start, end;
+  long i;
+
+  start = tsc_start();
+  for (i = 0; i < iterations; i++) {
+    __asm__ volatile ("add %1, %0\n\tadd %1, %0\n\tadd %1, %0\n\tadd %1, %0\n\t"
+      "add %1, %0\n\tadd %1, %0\n\tadd %1, %0\n\tadd %1, %0\n\t"
+      "add %1, %0\n\tadd %1, %0" : "+r"(x) : "r"(y));
+  }
+  end = tsc_stop();
+  return (10.0*iterations) / (double)(end - start);
+}
+
+
+/**
+ * @brief Check the clocks before the measurements.
+ *
+ * @details
+ * Calibrate the TSC against the monotonic clock and the overhead of an empty
+ * measurement, compare the core clock to the TSC, and read the turbo and
+ * governor settings (intel_pstate, acpi-cpufreq).
+ */
+static void check_clocks(void)
+{
+  char buf[64], msg[160];
+  uint64_t start, end;
+  double t0, t1;
+  int i;
+
+  t0 = now(); start = tsc_start();
+  while ((t1 = now()) - t0 < 0.1);
+  end = tsc_stop();
+  tsc_hz = (double)(end - start) / (t1 - t0);
+
+  for (i = 0; i < 1001; i++) {
+    start = tsc_start();
+    end = tsc_stop();
+    samples[i] = end - start;
+  }
+  qsort(samples, 1001, sizeof(uint64_t), cmp_u64);
+  overhead = samples[500];
+
+  clock_ratio[0] = core_clock_ratio();
+  if (fabs(clock_ratio[0] - 1.0) > CLOCK_TOLERANCE) {
+    snprintf(msg, sizeof(msg), "the core clock is %.2fx the TSC (turbo or "
+      "frequency scaling), cycle counts are TSC ticks", clock_ratio[0]);
+    warn(msg);
+  }
+  if (read_line(buf, sizeof(buf), "/sys/devices/system/cpu/intel_pstate/no_turbo")
+      && !strcmp(buf, "0")) {
+    warn("turbo is enabled (intel_pstate/no_turbo = 0)");
+  }
+  if (read_line(buf, sizeof(buf), "/sys/devices/system/cpu/cpufreq/boost")
+      && !strcmp(buf, "1")) {
+    warn("turbo is enabled (cpufreq/boost = 1)");
+  }
+  if (read_line(buf, sizeof(buf), "/sys/devices/system/cpu/cpu0/cpufreq/scaling_governor")
+      && strcmp(buf, "performance")) {
+    snprintf(msg, sizeof(msg), "the scaling governor is \"%s\", not \"performance\"", buf);
+    warn(msg);
+  }
+}
+
+
+/**
+ * @brief Add a record with the statistics of samples.
+ *
+ * @param suite Suite
+ * @param op Operation
+ * @param impl Implementation
+ * @param param Lanes, batch size or threads
+ * @param keys Keys per sample
+ * @param s Samples (sorted in place)
+ * @param n Number of samples
+ * @return Record
+ */
+static BenchRecord *add_record(const char *suite, const char *op, const char *impl,
+  long param, size_t keys, uint64_t *s, size_t n)
+{
+  BenchRecord *r;
+  double sum = 0;
+  size_t i;
+
+  if (nrecords == MAXRECORDS) return NULL;
+  r = &records[nrecords++];
+  memset(r, 0, sizeof(*r));
+  r->suite = suite;
+  snprintf(r->op, sizeof(r->op), "%s", op);
+  snprintf(r->impl, sizeof(r->impl), "%s", impl);
+  r->param = param;
+  r->samples = n;
+
+  // nearest-rank percentiles
+  qsort(s, n, sizeof(uint64_t), cmp_u64);
+  for (i = 0; i < n; i++) sum += (double)s[i];
+  r->min = (double)s[0];
+  r->median = (double)s[(n - 1)/2];
+  r->p90 = (double)s[(size_t)ceil(0.90*n) - 1];
+  r->p99 = (n >= MINSAMPLES) ? (double)s[(size_t)ceil(0.99*n) - 1] : NAN;
+  r->mean = sum / n;
+  r->per_key = r->median / keys;
+  r->ops_per_sec = tsc_hz / r->per_key;
+  return r;
+}
+
+
+static uint64_t elapsed(uint64_t start, uint64_t end)
+{
+  uint64_t d = end - start;
+
+  return (d > overhead) ? d - overhead : 0;
+}
+
+
+/**
+ * @brief Latency suite.
+ *
+ * @details
+ * Time every call of the kernels of the supported implementations, and the
+ * calls with a shared inversion of X25519_MAXGROUPS calls.
+ *
+ * @param n Number of samples
+ * @param only Name of the implementation to measure (all if NULL)
+ */
+static void bench_latency(size_t n, const char *only)
+{
+  static uint8_t sk[8*X25519_MAXGROUPS][32], pk[8*X25519_MAXGROUPS][32];
+  static uint8_t out[8*X25519_MAXGROUPS][32];
+  const X25519Impl *impl;
+  uint64_t start;
+  size_t i, j;
+  int id, m = X25519_MAXGROUPS;
+
+  for (i = 0; i < sizeof(sk); i++) {
+    sk[i/32][i%32] = (uint8_t)random();
+    pk[i/32][i%32] = (uint8_t)random();
+  }
+
+  for (id = 0; id < X25519_NIMPLS; id++) {
+    if ((impl = x25519_impl_by_id(id)) == NULL) continue;
+    if ((only != NULL) && strcmp(only, impl->name)) continue;
+
+    for (i = 0; i < n/10; i++) impl->keygen(out, (const uint8_t (*)[32])sk);
+    for (i = 0; i < n; i++) {
+      start = tsc_start();
+      impl->keygen(out, (const uint8_t (*)[32])sk);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("latency", "keygen", impl->name, impl->lanes, impl->lanes, samples, n);
+
+    for (i = 0; i < n/10; i++)
+      impl->sharedsecret(out, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+    for (i = 0; i < n; i++) {
+      start = tsc_start();
+      impl->sharedsecret(out, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("latency", "sharedsecret", impl->name, impl->lanes, impl->lanes, samples, n);
+
+    // m calls with one inversion, fewer samples as a sample is m calls
+    if (impl->sharedsecret_n != NULL) {
+      j = (n/m > MINSAMPLES) ? n/m : (n < MINSAMPLES) ? n : MINSAMPLES;
+      for (i = 0; i < j; i++) {
+        start = tsc_start();
+        impl->sharedsecret_n(out, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, m);
+        samples[i] = elapsed(start, tsc_stop());
+      }
+      add_record("latency", "sharedsecret_n", impl->name, impl->lanes,
+        (size_t)impl->lanes*m, samples, j);
+    }
+  }
+}
+
+
+/**
+ * @brief Batch suite.
+ *
+ * @details
+ * Time the batch functions of x25519.h with the implementation selected by
+ * the dispatcher, for every batch size; the number of samples decreases with
+ * the batch size (at least MINSAMPLES, or n if it is smaller).
+ *
+ * @param n Number of samples of the smallest batches
+ */
+static void bench_batch(size_t n)
+{
+  const size_t maxn = batch_sizes[NBATCHSIZES-1];
+  const char *name = x25519_impl()->name;
+  uint8_t (*sk)[32] = malloc(maxn*32), (*pk)[32] = malloc(maxn*32);
+  uint8_t (*out)[32] = malloc(maxn*32), *ok = malloc(maxn);
+  X25519Group *gsk = x25519_soa_alloc(maxn), *gpk = x25519_soa_alloc(maxn);
+  X25519Group *gout = x25519_soa_alloc(maxn);
+  uint64_t start;
+  size_t i, b, k, reps;
+
+  for (i = 0; i < maxn*32; i++) {
+    sk[i/32][i%32] = (uint8_t)random();
+    pk[i/32][i%32] = (uint8_t)random();
+  }
+  for (i = 0; i < maxn; i++) {
+    x25519_soa_put(gsk, i, sk[i]);
+    x25519_soa_put(gpk, i, pk[i]);
+  }
+
+  for (b = 0; b < NBATCHSIZES; b++) {
+    k = batch_sizes[b];
+    reps = n*4/k;
+    if (reps > n) reps = n;
+    if (reps < MINSAMPLES) reps = (n < MINSAMPLES) ? n : MINSAMPLES;
+
+    x25519_keygen_batch(out, (const uint8_t (*)[32])sk, k);
+    for (i = 0; i < reps; i++) {
+      start = tsc_start();
+      x25519_keygen_batch(out, (const uint8_t (*)[32])sk, k);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("batch", "keygen_batch", name, (long)k, k, samples, reps);
+
+    x25519_sharedsecret_batch(out, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, k);
+    for (i = 0; i < reps; i++) {
+      start = tsc_start();
+      x25519_sharedsecret_batch(out, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, k);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("batch", "sharedsecret_batch", name, (long)k, k, samples, reps);
+
+    for (i = 0; i < reps; i++) {
+      start = tsc_start();
+      x25519_sharedsecret_batch_checked(out, ok, (const uint8_t (*)[32])sk,
+        (const uint8_t (*)[32])pk, k);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("batch", "sharedsecret_batch_checked", name, (long)k, k, samples, reps);
+
+    for (i = 0; i < reps; i++) {
+      start = tsc_start();
+      x25519_keygen_soa(gout, gsk, k);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("batch", "keygen_soa", name, (long)k, k, samples, reps);
+
+    for (i = 0; i < reps; i++) {
+      start = tsc_start();
+      x25519_sharedsecret_soa(gout, gsk, gpk, k);
+      samples[i] = elapsed(start, tsc_stop());
+    }
+    add_record("batch", "sharedsecret_soa", name, (long)k, k, samples, reps);
+  }
+
+  free(sk); free(pk); free(out); free(ok);
+  x25519_soa_free(gsk); x25519_soa_free(gpk); x25519_soa_free(gout);
+}
+
+
+// a thread of the scaling suite
+typedef struct scale_thread {
+  pthread_t thread;
+  pthread_barrier_t *barrier;
+  const int *stop;
+  int cpu, op;
+  uint64_t keys, ticks;
+} ScaleThread;
+
+
+/**
+ * @brief Thread of the scaling suite.
+ *
+ * @details
+ * Pin the thread, wait for the others and compute batches of SCALE_BATCH
+ * keys until stop is set; count the keys and the TSC ticks of the loop.
+ *
+ * @param arg ScaleThread
+ * @return NULL
+ */
+static void *scale_main(void *arg)
+{
+  ScaleThread *t = (ScaleThread *)arg;
+  uint8_t sk[SCALE_BATCH][32], pk[SCALE_BATCH][32], out[SCALE_BATCH][32];
+  uint64_t start;
+  size_t i;
+
+  pin_cpu(t->cpu);
+  x25519_numa_bind();
+  for (i = 0; i < sizeof(sk); i++) {
+    sk[i/32][i%32] = (uint8_t)(i*7 + t->cpu);
+    pk[i/32][i%32] = (uint8_t)(i*13 + t->cpu);
+  }
+  t->keys = 0;
+
+  pthread_barrier_wait(t->barrier);
+  start = tsc_start();
+  while (!__atomic_load_n(t->stop, __ATOMIC_RELAXED)) {
+    if (t->op) x25519_sharedsecret_batch(out, (const uint8_t (*)[32])sk,
+      (const uint8_t (*)[32])pk, SCALE_BATCH);
+    else x25519_keygen_batch(out, (const uint8_t (*)[32])sk, SCALE_BATCH);
+    t->keys += SCALE_BATCH;
+  }
+  t->ticks = tsc_stop() - start;
+  return NULL;
+}
+
+
+/**
+ * @brief Scaling suite.
+ *
+ * @details
+ * Run 1, 2, 4, ... and maxthreads threads for the given time per point; the
+ * statistics of a record are the cycles per key of its threads, the
+ * throughput is the sum of the threads.
+ *
+ * @param maxthreads Largest number of threads
+ * @param seconds Duration of a point
+ */
+static void bench_scaling(int maxthreads, double seconds)
+{
+  const char *name = x25519_impl()->name;
+  ScaleThread *t = malloc(maxthreads*sizeof(ScaleThread));
+  uint64_t *cpk = malloc(maxthreads*sizeof(uint64_t));
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  pthread_barrier_t barrier;
+  struct timespec ts;
+  double single = 0, total;
+  BenchRecord *r;
+  int n, i, op, stop;
+
+  if (ncpu < 1) ncpu = 1;
+  ts.tv_sec = (time_t)seconds;
+  ts.tv_nsec = (long)((seconds - (double)ts.tv_sec)*1e9);
+
+  for (op = 0; op < 2; op++) {
+    for (n = 1; n <= maxthreads; n = ((2*n > maxthreads) && (n < maxthreads)) ? maxthreads : 2*n) {
+      stop = 0;
+      pthread_barrier_init(&barrier, NULL, n + 1);
+      for (i = 0; i < n; i++) {
+        t[i].barrier = &barrier;
+        t[i].stop = &stop;
+        t[i].cpu = (int)(i % ncpu);
+        t[i].op = op;
+        pthread_create(&t[i].thread, NULL, scale_main, &t[i]);
+      }
+      pthread_barrier_wait(&barrier);
+      nanosleep(&ts, NULL);
+      __atomic_store_n(&stop, 1, __ATOMIC_RELAXED);
+      total = 0;
+      for (i = 0; i < n; i++) {
+        pthread_join(t[i].thread, NULL);
+        cpk[i] = t[i].ticks / t[i].keys;
+        total += tsc_hz*t[i].keys/t[i].ticks;
+      }
+      pthread_barrier_destroy(&barrier);
+
+      r = add_record("scaling", op ? "sharedsecret_batch" : "keygen_batch", name,
+        n, 1, cpk, n);
+      if (r == NULL) continue;
+      r->ops_per_sec = total;
+      if (n == 1) single = total;
+      r->efficiency = total / (n*single);
+    }
+  }
+  free(t);
+  free(cpk);
+}
+
+
+/**
+ * @brief p99 of a record as a string.
+ *
+ * @param buf Buffer
+ * @param len Length of the buffer
+ * @param r Record
+ * @param none String of a record without p99 (fewer than MINSAMPLES samples)
+ * @return buf or none
+ */
+static const char *p99_str(char *buf, size_t len, const BenchRecord *r,
+  const char *none)
+{
+  if (isnan(r->p99)) return none;
+  snprintf(buf, len, "%.0f", r->p99);
+  return buf;
+}
+
+
+/**
+ * @brief Print the records as text.
+ *
+ * @param f Output
+ */
+static void print_text(FILE *f)
+{
+  const char *suite = "";
+  char p99[32];
+  int i;
+
+  fprintf(f, "TSC: %.3f GHz, core/TSC clock: %.3f (start) %.3f (end), "
+    "overhead %llu ticks\n", tsc_hz/1e9, clock_ratio[0], clock_ratio[1],
+    (unsigned long long)overhead);
+  for (i = 0; i < nrecords; i++) {
+    const BenchRecord *r = &records[i];
+    if (strcmp(suite, r->suite)) {
+      suite = r->suite;
+      fprintf(f, "\n%-8s %-28s %-9s %6s %10s %10s %10s %10s %10s %12s%s\n", suite,
+        "op", "impl", !strcmp(suite, "latency") ? "lanes" :
+        !strcmp(suite, "batch") ? "n" : "thr", "min", "median", "p90", "p99",
+        "per key", "keys/s", !strcmp(suite, "scaling") ? "   eff." : "");
+    }
+    fprintf(f, "         %-28s %-9s %6ld %10.0f %10.0f %10.0f %10s %10.0f %12.0f",
+      r->op, r->impl, r->param, r->min, r->median, r->p90,
+      p99_str(p99, sizeof(p99), r, "-"), r->per_key, r->ops_per_sec);
+    if (!strcmp(suite, "scaling")) fprintf(f, " %6.2f", r->efficiency);
+    fprintf(f, "\n");
+  }
+}
+
+
+/**
+ * @brief Print the host and the records as JSON.
+ *
+ * @param f Output
+ * @param cpu Model name of the CPU
+ */
+static void print_json(FILE *f, const char *cpu)
+{
+  char p99[32];
+  int i;
+
+  fprintf(f, "{\n  \"host\": {\"cpu\": \"%s\", \"impl\": \"%s\", \"tsc_hz\": %.0f, "
+    "\"clock_ratio\": [%.4f, %.4f], \"overhead\": %llu},\n", cpu,
+    x25519_impl()->name, tsc_hz, clock_ratio[0], clock_ratio[1],
+    (unsigned long long)overhead);
+  fprintf(f, "  \"warnings\": [");
+  for (i = 0; i < nwarnings; i++) {
+    fprintf(f, "%s\"%s\"", i ? ", " : "", warnings[i]);
+  }
+  fprintf(f, "],\n  \"results\": [\n");
+  for (i = 0; i < nrecords; i++) {
+    const BenchRecord *r = &records[i];
+    fprintf(f, "    {\"suite\": \"%s\", \"op\": \"%s\", \"impl\": \"%s\", "
+      "\"param\": %ld, \"samples\": %zu, \"min\": %.0f, \"median\": %.0f, "
+      "\"p90\": %.0f, \"p99\": %s, \"mean\": %.1f, \"per_key\": %.1f, "
+      "\"ops_per_sec\": %.1f, \"efficiency\": %.3f}%s\n", r->suite, r->op,
+      r->impl, r->param, r->samples, r->min, r->median, r->p90,
+      p99_str(p99, sizeof(p99), r, "null"), r->mean, r->per_key, r->ops_per_sec,
+      r->efficiency, (i + 1 < nrecords) ? "," : "");
+  }
+  fprintf(f, "  ]\n}\n");
+}
+
+
+/**
+ * @brief Print the records as CSV, the host and the warnings are comments.
+ *
+ * @param f Output
+ * @param cpu Model name of the CPU
+ */
+static void print_csv(FILE *f, const char *cpu)
+{
+  char p99[32];
+  int i;
+
+  fprintf(f, "# cpu=%s impl=%s tsc_hz=%.0f clock_ratio=%.4f/%.4f overhead=%llu\n",
+    cpu, x25519_impl()->name, tsc_hz, clock_ratio[0], clock_ratio[1],
+    (unsigned long long)overhead);
+  for (i = 0; i < nwarnings; i++) fprintf(f, "# warning: %s\n", warnings[i]);
+  fprintf(f, "suite,op,impl,param,samples,min,median,p90,p99,mean,per_key,"
+    "ops_per_sec,efficiency\n");
+  for (i = 0; i < nrecords; i++) {
+    const BenchRecord *r = &records[i];
+    fprintf(f, "%s,%s,%s,%ld,%zu,%.0f,%.0f,%.0f,%s,%.1f,%.1f,%.1f,%.3f\n",
+      r->suite, r->op, r->impl, r->param, r->samples, r->min, r->median, r->p90,
+      p99_str(p99, sizeof(p99), r, ""), r->mean, r->per_key, r->ops_per_sec,
+      r->efficiency);
+  }
+}
+
+
+/**
+ * @brief Model name of the CPU (from /proc/cpuinfo), without quotes.
+ */
+static void cpu_model(char *buf, size_t len)
+{
+  FILE *f = fopen("/proc/cpuinfo", "r");
+  char line[256], *p;
+
+  snprintf(buf, len, "unknown");
+  if (f == NULL) return;
+  while (fgets(line, sizeof(line), f) != NULL) {
+    if (!strncmp(line, "model name", 10) && ((p = strchr(line, ':')) != NULL)) {
+      for (p++; *p == ' '; p++);
+      p[strcspn(p, "\n\"")] = 0;
+      snprintf(buf, len, "%s", p);
+      break;
+    }
+  }
+  fclose(f);
+}
+
+
+static void usage(const char *prog)
+{
+  fprintf(stderr, "usage: %s [-n samples] [-t threads] [-d seconds] [-i impl] "
+    "[-f text|json|csv] [-o file] [latency] [batch] [scaling]\n", prog);
+  exit(1);
+}
+
+
+int main(int argc, char **argv)
+{
+  size_t n = 1000;
+  int maxthreads = (int)sysconf(_SC_NPROCESSORS_ONLN), suites = 0, c, i;
+  double seconds = 0.5;
+  const char *only = NULL, *format = "text";
+  char cpu[128];
+  FILE *f = stdout;
+
+  while ((c = getopt(argc, argv, "n:t:d:i:f:o:")) != -1) {
+    switch (c) {
+      case 'n': n = (size_t)atol(optarg); break;
+      case 't': maxthreads = atoi(optarg); break;
+      case 'd': seconds = atof(optarg); break;
+      case 'i': only = optarg; break;
+      case 'f': format = optarg; break;
+      case 'o':
+        if ((f = fopen(optarg, "w")) == NULL) { perror(optarg); return 1; }
+        break;
+      default: usage(argv[0]);
+    }
+  }
+  for (i = optind; i < argc; i++) {
+    if (!strcmp(argv[i], "latency")) suites |= 1;
+    else if (!strcmp(argv[i], "batch")) suites |= 2;
+    else if (!strcmp(argv[i], "scaling")) suites |= 4;
+    else usage(argv[0]);
+  }
+  if (suites == 0) suites = 7;
+  if ((n < 11) || (n > MAXSAMPLES) || (maxthreads < 1) || (seconds <= 0)) usage(argv[0]);
+  if (strcmp(format, "text") && strcmp(format, "json") && strcmp(format, "csv")) usage(argv[0]);
+
+  // the single-threaded suites run on the current CPU
+  srandom((unsigned)time(NULL));
+  x25519_init();
+#if defined(__linux__)
+  pin_cpu(sched_getcpu());
+#endif
+  cpu_model(cpu, sizeof(cpu));
+  check_clocks();
+
+  if ((only != NULL) && (suites & 6) && strcmp(only, x25519_impl()->name)) {
+    warn("-i only applies to the latency suite, the batch and scaling suites "
+      "measure the dispatched implementation (set AVXECC_IMPL)");
+  }
+  if (suites & 1) bench_latency(n, only);
+  if (suites & 2) bench_batch(n);
+  if (suites & 4) bench_scaling(maxthreads, seconds);
+
+  // a drift of the clock during the run (e.g. thermal throttling)
+  clock_ratio[1] = core_clock_ratio();
+  if (fabs(clock_ratio[1] - clock_ratio[0]) > CLOCK_TOLERANCE*clock_ratio[0]) {
+    warn("the core clock changed during the run (throttling?)");
+  }
+
+  if (!strcmp(format, "json")) print_json(f, cpu);
+  else if (!strcmp(format, "csv")) print_csv(f, cpu);
+  else print_text(f);
+  if (f != stdout) fclose(f);
+  return 0;
+}
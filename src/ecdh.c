@@ -15,12 +15,17 @@
 
 #include "moncurve.h"
 #include "tedcurve.h"
+#include "ecdh.h"
+#include "prof.h"
+#include <string.h>
 
 /**
  * @brief The final step to reduce pk or ss by modulo p 
  *
  * @details
- * Perform modulo-p reduction for the integer to make it in [0, 2^255-19)
+ * Perform modulo-p reduction for the integer to make it in [0, 2^255-19).
+ * The bits above 2^255 are folded twice, then p is subtracted (by adding 19
+ * and clearing bit 255) in those lanes where the element is not below p.
  * 
  * @param r Field element
  * @param a Field element
@@ -34,6 +39,7 @@ static void final_modp (__m256i *a)
   const __m256i VMASK23 = VSET164(0x7FFFFFUL);
   const __m256i VMASK29 = VSET164(MASK29);
   const __m256i V19 = VSET164(19);
+  PROF_START(t_modp);
 
   // current r is 9*29-bit, we will convert it to 8*29-bit + 23-bit
   temp = VSHR(a8, 23); a8 = VAND(a8, VMASK23);
@@ -61,9 +67,34 @@ static void final_modp (__m256i *a)
   a7 = VADD(a7, VSHR(a6, BITS29)); a6 = VAND(a6, VMASK29);
   a8 = VADD(a8, VSHR(a7, BITS29)); a7 = VAND(a7, VMASK29);
 
+  // now a < 2^255, and a+19 has bit 255 set iff a >= p
+  temp = VADD(a0, V19); 
+  temp = VADD(a1, VSHR(temp, BITS29));
+  temp = VADD(a2, VSHR(temp, BITS29));
+  temp = VADD(a3, VSHR(temp, BITS29));
+  temp = VADD(a4, VSHR(temp, BITS29));
+  temp = VADD(a5, VSHR(temp, BITS29));
+  temp = VADD(a6, VSHR(temp, BITS29));
+  temp = VADD(a7, VSHR(temp, BITS29));
+  temp = VADD(a8, VSHR(temp, BITS29));
+  temp = VSHR(temp, 23);
+
+  // add 19*q and remove 2^255*q
+  a0 = VADD(a0, VMUL(temp, V19));  
+  a1 = VADD(a1, VSHR(a0, BITS29)); a0 = VAND(a0, VMASK29);
+  a2 = VADD(a2, VSHR(a1, BITS29)); a1 = VAND(a1, VMASK29);
+  a3 = VADD(a3, VSHR(a2, BITS29)); a2 = VAND(a2, VMASK29);
+  a4 = VADD(a4, VSHR(a3, BITS29)); a3 = VAND(a3, VMASK29);
+  a5 = VADD(a5, VSHR(a4, BITS29)); a4 = VAND(a4, VMASK29);
+  a6 = VADD(a6, VSHR(a5, BITS29)); a5 = VAND(a5, VMASK29);
+  a7 = VADD(a7, VSHR(a6, BITS29)); a6 = VAND(a6, VMASK29);
+  a8 = VADD(a8, VSHR(a7, BITS29)); a7 = VAND(a7, VMASK29);
+  a8 = VAND(a8, VMASK23);
+
   a[0] = a0; a[1] = a1; a[2] = a2; 
   a[3] = a3; a[4] = a4; a[5] = a5;
   a[6] = a6; a[7] = a7; a[8] = a8;
+  PROF_STOP(PROF_MODP, t_modp);
 }
 
 
@@ -99,3 +130,664 @@ void sharedsecret(__m256i *ss, const __m256i *ska, const __m256i *pkb)
   mon_mul_varbase_avx2(ss, ska, pkb);
   final_modp(ss);
 }
+
+/**
+ * @brief Shared secret computation with validation.
+ *
+ * @details
+ * The same as sharedsecret, and the all-zero shared secrets are detected in 
+ * the vector registers. Since the scalars are multiples of the cofactor 8, a
+ * shared secret is 0 iff the public key is a point of small order (or 0), 
+ * so this one test rejects all the low-order inputs of RFC 7748, section 6.1.
+ * 
+ * @param ss  Shared secret
+ * @param ska Own private key
+ * @param pkb Public key of the other side
+ * @return Mask that is all-ones in the lanes with a valid shared secret
+ */
+__m256i sharedsecret_checked(__m256i *ss, const __m256i *ska, const __m256i *pkb)
+{
+  sharedsecret(ss, ska, pkb);
+  return _mm256_andnot_si256(mpi29_gfp_iszero_avx2(ss), VSET164(-1));
+}
+
+
+/**
+ * @brief Conversion from byte strings to a private key vector.
+ *
+ * @details
+ * Load four 32-byte little-endian private keys into the 32-bit words of the 
+ * AVX2 vectors (the i-th key is in the i-th 64-bit lane). The 8x4 matrix of 
+ * 32-bit words is transposed with unpack instructions.
+ * 
+ * @param r Private key vector
+ * @param a Four private keys
+ */
+void conv_bytes2key_avx2(__m256i *r, const uint8_t (*a)[32])
+{
+  const __m256i a0 = VLOADU(a[0]), a1 = VLOADU(a[1]);
+  const __m256i a2 = VLOADU(a[2]), a3 = VLOADU(a[3]);
+  __m256i t0, t1, t2, t3, u0, u1, u2, u3;
+
+  // t0 = (a0w0 a1w0 a0w1 a1w1 | a0w4 a1w4 a0w5 a1w5), etc.
+  t0 = _mm256_unpacklo_epi32(a0, a1);
+  t1 = _mm256_unpackhi_epi32(a0, a1);
+  t2 = _mm256_unpacklo_epi32(a2, a3);
+  t3 = _mm256_unpackhi_epi32(a2, a3);
+  // u0 = (a0w0 a1w0 a2w0 a3w0 | a0w4 a1w4 a2w4 a3w4), etc.
+  u0 = _mm256_unpacklo_epi64(t0, t2);
+  u1 = _mm256_unpackhi_epi64(t0, t2);
+  u2 = _mm256_unpacklo_epi64(t1, t3);
+  u3 = _mm256_unpackhi_epi64(t1, t3);
+
+  r[0] = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(u0));
+  r[1] = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(u1));
+  r[2] = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(u2));
+  r[3] = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(u3));
+  r[4] = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(u0, 1));
+  r[5] = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(u1, 1));
+  r[6] = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(u2, 1));
+  r[7] = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(u3, 1));
+}
+
+
+/**
+ * @brief Conversion from 64-bit words to a field element vector.
+ *
+ * @details
+ * wj holds the j-th little-endian 64-bit word of four 32-byte strings, the 
+ * limbs are extracted with shifts and the most significant bit of each string
+ * is masked (RFC 7748).
+ * 
+ * @param r Field element
+ * @param w Words of the four strings
+ */
+static void mpi29_conv_words2mpi29_avx2(__m256i *r, const __m256i *w)
+{
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VMASK23 = VSET164(0x7FFFFFUL);
+
+  r[0] = VAND(w[0], VMASK29);
+  r[1] = VAND(VSHR(w[0], 29), VMASK29);
+  r[2] = VAND(VOR(VSHR(w[0], 58), VSHL(w[1], 6)), VMASK29);
+  r[3] = VAND(VSHR(w[1], 23), VMASK29);
+  r[4] = VAND(VOR(VSHR(w[1], 52), VSHL(w[2], 12)), VMASK29);
+  r[5] = VAND(VSHR(w[2], 17), VMASK29);
+  r[6] = VAND(VOR(VSHR(w[2], 46), VSHL(w[3], 18)), VMASK29);
+  r[7] = VAND(VSHR(w[3], 11), VMASK29);
+  r[8] = VAND(VSHR(w[3], 40), VMASK23);
+}
+
+
+/**
+ * @brief Conversion from a field element vector to 64-bit words.
+ *
+ * @details
+ * Reduce four radix-2^29 field elements to [0, 2^255-19) and join the limbs 
+ * to 64-bit words, i.e. the inverse of the conversion above.
+ * 
+ * @param w Words of the four strings
+ * @param a Field element
+ */
+static void mpi29_conv_mpi292words_avx2(__m256i *w, const __m256i *a)
+{
+  __m256i b[NWORDS];
+  int i;
+
+  for (i = 0; i < NWORDS; i++) b[i] = a[i];
+  final_modp(b);
+
+  w[0] = VOR(VOR(b[0], VSHL(b[1], 29)), VSHL(b[2], 58));
+  w[1] = VOR(VOR(VSHR(b[2], 6), VSHL(b[3], 23)), VSHL(b[4], 52));
+  w[2] = VOR(VOR(VSHR(b[4], 12), VSHL(b[5], 17)), VSHL(b[6], 46));
+  w[3] = VOR(VOR(VSHR(b[6], 18), VSHL(b[7], 11)), VSHL(b[8], 40));
+}
+
+
+/**
+ * @brief Conversion from byte strings to a field element vector.
+ *
+ * @details
+ * Load four 32-byte little-endian u-coordinates into radix-2^29 field 
+ * elements, the most significant bit of each string is masked (RFC 7748). 
+ * The 4x4 matrix of 64-bit words is transposed first, so that each vector 
+ * holds the same word of the four strings, then the limbs are extracted with 
+ * shifts.
+ * 
+ * @param r Field element
+ * @param a Four u-coordinates
+ */
+void mpi29_conv_bytes2mpi29_avx2(__m256i *r, const uint8_t (*a)[32])
+{
+  const __m256i a0 = VLOADU(a[0]), a1 = VLOADU(a[1]);
+  const __m256i a2 = VLOADU(a[2]), a3 = VLOADU(a[3]);
+  __m256i t0, t1, t2, t3, w[4];
+
+  // transpose: w[j] holds the j-th 64-bit word of the four strings
+  t0 = _mm256_unpacklo_epi64(a0, a1);
+  t1 = _mm256_unpackhi_epi64(a0, a1);
+  t2 = _mm256_unpacklo_epi64(a2, a3);
+  t3 = _mm256_unpackhi_epi64(a2, a3);
+  w[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+  w[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+  w[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+  w[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+
+  mpi29_conv_words2mpi29_avx2(r, w);
+}
+
+
+/**
+ * @brief Conversion from a field element vector to byte strings.
+ *
+ * @details
+ * Reduce four radix-2^29 field elements to [0, 2^255-19) and store them as 
+ * 32-byte little-endian strings, i.e. the inverse of the conversion above.
+ * 
+ * @param r Four byte strings
+ * @param a Field element
+ */
+void mpi29_conv_mpi292bytes_avx2(uint8_t (*r)[32], const __m256i *a)
+{
+  __m256i t0, t1, t2, t3, w[4];
+
+  mpi29_conv_mpi292words_avx2(w, a);
+
+  // transpose back: the i-th vector holds the four words of the i-th string
+  t0 = _mm256_unpacklo_epi64(w[0], w[1]);
+  t1 = _mm256_unpackhi_epi64(w[0], w[1]);
+  t2 = _mm256_unpacklo_epi64(w[2], w[3]);
+  t3 = _mm256_unpackhi_epi64(w[2], w[3]);
+  VSTOREU(r[0], _mm256_permute2x128_si256(t0, t2, 0x20));
+  VSTOREU(r[1], _mm256_permute2x128_si256(t1, t3, 0x20));
+  VSTOREU(r[2], _mm256_permute2x128_si256(t0, t2, 0x31));
+  VSTOREU(r[3], _mm256_permute2x128_si256(t1, t3, 0x31));
+}
+
+
+/**
+ * @brief Conversion from an interleaved group to a private key vector.
+ *
+ * @details
+ * The rows of the group are the 64-bit words of the four keys, so the 32-bit
+ * words of the keys are their low and high halves (no transposition).
+ * 
+ * @param r Private key vector
+ * @param a Group of four private keys
+ */
+static void conv_group2key_avx2(__m256i *r, const X25519Group *a)
+{
+  const __m256i VMASK32 = VSET164(0xFFFFFFFFUL);
+  __m256i w;
+  int j;
+
+  for (j = 0; j < 4; j++) {
+    w = _mm256_load_si256((const __m256i *)a->w[j]);
+    r[2*j]   = VAND(w, VMASK32);
+    r[2*j+1] = VSHR(w, 32);
+  }
+}
+
+
+/**
+ * @brief Conversion from an interleaved group to a field element vector.
+ *
+ * @param r Field element
+ * @param a Group of four u-coordinates
+ */
+static void mpi29_conv_group2mpi29_avx2(__m256i *r, const X25519Group *a)
+{
+  __m256i w[4];
+  int j;
+
+  for (j = 0; j < 4; j++) w[j] = _mm256_load_si256((const __m256i *)a->w[j]);
+  mpi29_conv_words2mpi29_avx2(r, w);
+}
+
+
+/**
+ * @brief Conversion from a field element vector to an interleaved group.
+ *
+ * @param r Group of four strings
+ * @param a Field element
+ */
+static void mpi29_conv_mpi292group_avx2(X25519Group *r, const __m256i *a)
+{
+  __m256i w[4];
+  int j;
+
+  mpi29_conv_mpi292words_avx2(w, a);
+  for (j = 0; j < 4; j++) _mm256_store_si256((__m256i *)r->w[j], w[j]);
+}
+
+
+/**
+ * @brief Key generation on byte strings.
+ *
+ * @details
+ * Generate four public keys based on the given private keys. 
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ */
+void x25519_keygen_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  __m256i k[8], r[NWORDS];
+
+  conv_bytes2key_avx2(k, sk);
+  mon_mul_fixbase_avx2(r, k);
+  mpi29_conv_mpi292bytes_avx2(pk, r);
+}
+
+
+/**
+ * @brief Shared secret computation on byte strings.
+ *
+ * @details
+ * Generate four shared secrets based on own private keys and the public keys 
+ * of the other sides.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ */
+void x25519_sharedsecret_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32])
+{
+  __m256i k[8], u[NWORDS], r[NWORDS];
+
+  conv_bytes2key_avx2(k, ska);
+  mpi29_conv_bytes2mpi29_avx2(u, pkb);
+  mon_mul_varbase_avx2(r, k, u);
+  mpi29_conv_mpi292bytes_avx2(ss, r);
+}
+
+
+/**
+ * @brief Hybrid shared secret computation on byte strings.
+ *
+ * @details
+ * Generate 4+ns shared secrets in one ladder loop: the first four on the 
+ * AVX2 lanes and the last ns (at most MON_HYBRID_MAXSCALAR) with the scalar 
+ * radix-2^64 arithmetic, see mon_mul_varbase_hybrid_avx2 (needs BMI2/ADX).
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param ns Number of scalar instances
+ */
+void x25519_sharedsecret_hybrid_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32], int ns)
+{
+  __m256i k[8], u[NWORDS], r[NWORDS];
+  uint64_t ks[MON_HYBRID_MAXSCALAR][NWORDS64], us[MON_HYBRID_MAXSCALAR][NWORDS64];
+  uint64_t rs[MON_HYBRID_MAXSCALAR][NWORDS64];
+  int j;
+
+  if (ns > MON_HYBRID_MAXSCALAR) ns = MON_HYBRID_MAXSCALAR;
+  for (j = 0; j < ns; j++) {
+    memcpy(ks[j], ska[4+j], 32);
+    memcpy(us[j], pkb[4+j], 32);
+    us[j][3] &= 0x7FFFFFFFFFFFFFFFULL;
+  }
+  conv_bytes2key_avx2(k, ska);
+  mpi29_conv_bytes2mpi29_avx2(u, pkb);
+  mon_mul_varbase_hybrid_avx2(r, k, u, rs, (const uint64_t (*)[NWORDS64])ks, 
+    (const uint64_t (*)[NWORDS64])us, ns);
+  mpi29_conv_mpi292bytes_avx2(ss, r);
+  for (j = 0; j < ns; j++) memcpy(ss[4+j], rs[j], 32);
+}
+
+
+/**
+ * @brief (1*4)-way key generation on byte strings.
+ *
+ * @details
+ * Generate a single public key with the lower-latency (1*4)-way fixed-base 
+ * scalar multiplication.
+ * 
+ * @param pk Public key
+ * @param sk Private key
+ */
+void x25519_keygen_1x4_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  __m256i r[NWORDS];
+  uint8_t t[4][32];
+  int i;
+
+  mon_mul_fixbase_1x4_avx2(r, sk[0]);
+  mpi29_conv_mpi292bytes_avx2(t, r);
+  for (i = 0; i < 32; i++) pk[0][i] = t[0][i];
+}
+
+
+/**
+ * @brief (1*4)-way shared secret computation on byte strings.
+ *
+ * @details
+ * Generate a single shared secret with the lower-latency (1*4)-way ladder.
+ * 
+ * @param ss  Shared secret
+ * @param ska Own private key
+ * @param pkb Public key of the other side
+ */
+void x25519_sharedsecret_1x4_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32])
+{
+  __m256i u[NWORDS], r[NWORDS];
+  uint8_t t[4][32];
+  int i;
+
+  for (i = 0; i < 32; i++) t[0][i] = t[1][i] = t[2][i] = t[3][i] = pkb[0][i];
+  mpi29_conv_bytes2mpi29_avx2(u, (const uint8_t (*)[32])t);
+  mon_mul_varbase_1x4_avx2(r, ska[0], u);
+  mpi29_conv_mpi292bytes_avx2(t, r);
+  for (i = 0; i < 32; i++) ss[0][i] = t[0][i];
+}
+
+
+/**
+ * @brief (2*2)-way key generation on byte strings.
+ *
+ * @details
+ * Generate two public keys with the (2*2)-way fixed-base scalar 
+ * multiplication, each private key is loaded into two lanes.
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ */
+void x25519_keygen_2x2_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  __m256i k[8], r[NWORDS];
+  uint8_t t[4][32];
+
+  memcpy(t[0], sk[0], 32); memcpy(t[1], sk[0], 32);
+  memcpy(t[2], sk[1], 32); memcpy(t[3], sk[1], 32);
+  conv_bytes2key_avx2(k, (const uint8_t (*)[32])t);
+  mon_mul_fixbase_2x2_avx2(r, k);
+  mpi29_conv_mpi292bytes_avx2(t, r);
+  memcpy(pk[0], t[0], 32);
+  memcpy(pk[1], t[2], 32);
+}
+
+
+/**
+ * @brief (2*2)-way shared secret computation on byte strings.
+ *
+ * @details
+ * Generate two shared secrets with the (2*2)-way ladder, each instance uses 
+ * two lanes.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ */
+void x25519_sharedsecret_2x2_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32])
+{
+  __m256i k[8], u[NWORDS], r[NWORDS];
+  uint8_t t[4][32];
+
+  memcpy(t[0], ska[0], 32); memcpy(t[1], ska[0], 32);
+  memcpy(t[2], ska[1], 32); memcpy(t[3], ska[1], 32);
+  conv_bytes2key_avx2(k, (const uint8_t (*)[32])t);
+  memcpy(t[0], pkb[0], 32); memcpy(t[1], pkb[0], 32);
+  memcpy(t[2], pkb[1], 32); memcpy(t[3], pkb[1], 32);
+  mpi29_conv_bytes2mpi29_avx2(u, (const uint8_t (*)[32])t);
+  mon_mul_varbase_2x2_avx2(r, k, u);
+  mpi29_conv_mpi292bytes_avx2(t, r);
+  memcpy(ss[0], t[0], 32);
+  memcpy(ss[1], t[2], 32);
+}
+
+
+/**
+ * @brief Key generation of several calls on byte strings.
+ *
+ * @details
+ * Generate m*4 public keys, the z-coordinates of all m calls are inverted 
+ * at once with mpi29_gfp_batchinv_avx2.
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_keygen_n_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32], int m)
+{
+  __m256i k[8], x[X25519_MAXGROUPS][NWORDS], z[X25519_MAXGROUPS][NWORDS];
+  __m256i zi[X25519_MAXGROUPS][NWORDS];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_bytes2key_avx2(k, sk + 4*i);
+    mon_mul_fixbase_proj_avx2(x[i], z[i], k);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    mpi29_conv_mpi292bytes_avx2(pk + 4*i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of several calls on byte strings.
+ *
+ * @details
+ * Generate m*4 shared secrets, the z-coordinates of all m calls are inverted 
+ * at once with mpi29_gfp_batchinv_avx2.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_sharedsecret_n_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32], int m)
+{
+  __m256i k[8], u[NWORDS], x[X25519_MAXGROUPS][NWORDS], z[X25519_MAXGROUPS][NWORDS];
+  __m256i zi[X25519_MAXGROUPS][NWORDS];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_bytes2key_avx2(k, ska + 4*i);
+    mpi29_conv_bytes2mpi29_avx2(u, pkb + 4*i);
+    mon_mul_varbase_proj_avx2(x[i], z[i], k, u);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    mpi29_conv_mpi292bytes_avx2(ss + 4*i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of several calls with validation.
+ *
+ * @details
+ * The same as x25519_sharedsecret_n_avx2, and the all-zero shared secrets 
+ * (the public keys of small order, see sharedsecret_checked) are detected on
+ * the field elements before they are stored, which costs a zero test per 
+ * call instead of a pass over the 32-byte strings.
+ * 
+ * @param ss  Shared secrets
+ * @param ok  Flags (1 if the shared secret is valid, 0 if it is all-zero)
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ * @return Number of valid shared secrets
+ */
+int x25519_sharedsecret_checked_n_avx2(uint8_t (*ss)[32], uint8_t *ok, 
+  const uint8_t (*ska)[32], const uint8_t (*pkb)[32], int m)
+{
+  __m256i k[8], u[NWORDS], x[X25519_MAXGROUPS][NWORDS], z[X25519_MAXGROUPS][NWORDS];
+  __m256i zi[X25519_MAXGROUPS][NWORDS];
+  uint64_t w[4];
+  int i, j, cnt = 4*m;
+
+  for (i = 0; i < m; i++) {
+    conv_bytes2key_avx2(k, ska + 4*i);
+    mpi29_conv_bytes2mpi29_avx2(u, pkb + 4*i);
+    mon_mul_varbase_proj_avx2(x[i], z[i], k, u);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    VSTOREU(w, mpi29_gfp_iszero_avx2(x[i]));
+    mpi29_conv_mpi292bytes_avx2(ss + 4*i, x[i]);
+    for (j = 0; j < 4; j++) {
+      ok[4*i+j] = (uint8_t)(~w[j] & 1);
+      cnt -= (int)(w[j] & 1);
+    }
+  }
+
+  return cnt;
+}
+
+
+/**
+ * @brief Key generation of several calls on interleaved buffers.
+ *
+ * @details
+ * The same as x25519_keygen_n_avx2, on m groups of an interleaved buffer, 
+ * which are loaded and stored without transposition; pk may be sk.
+ * 
+ * @param pk Public keys (m groups)
+ * @param sk Private keys (m groups)
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_keygen_soa_n_avx2(X25519Group *pk, const X25519Group *sk, int m)
+{
+  __m256i k[8], x[X25519_MAXGROUPS][NWORDS], z[X25519_MAXGROUPS][NWORDS];
+  __m256i zi[X25519_MAXGROUPS][NWORDS];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_group2key_avx2(k, sk + i);
+    mon_mul_fixbase_proj_avx2(x[i], z[i], k);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    mpi29_conv_mpi292group_avx2(pk + i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of several calls on interleaved buffers.
+ *
+ * @details
+ * The same as x25519_sharedsecret_n_avx2, on m groups of interleaved buffers,
+ * which are loaded and stored without transposition; ss may be ska or pkb.
+ * 
+ * @param ss  Shared secrets (m groups)
+ * @param ska Own private keys (m groups)
+ * @param pkb Public keys of the other sides (m groups)
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_sharedsecret_soa_n_avx2(X25519Group *ss, const X25519Group *ska, 
+  const X25519Group *pkb, int m)
+{
+  __m256i k[8], u[NWORDS], x[X25519_MAXGROUPS][NWORDS], z[X25519_MAXGROUPS][NWORDS];
+  __m256i zi[X25519_MAXGROUPS][NWORDS];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_group2key_avx2(k, ska + i);
+    mpi29_conv_group2mpi29_avx2(u, pkb + i);
+    mon_mul_varbase_proj_avx2(x[i], z[i], k, u);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    mpi29_conv_mpi292group_avx2(ss + i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Precomputation of the tables of four public keys.
+ *
+ * @details
+ * Convert four u-coordinates (RFC 7748) to points (x, y) on the twisted Edwards
+ * curve, y = (u-1)/(u+1) (x is chosen even, -P gives the same u-coordinates), 
+ * and compute their tables with ted_peer_table_avx2. A u-coordinate of a point 
+ * on the twist (or u = -1) has no such point, the shared secrets of its lane 
+ * must be computed with the ladder. Not constant-time (for public keys only).
+ * 
+ * @param t Tables of the four lanes
+ * @param pk Public keys
+ * @return Bit l is set if the table of the l-th key is valid, or -1 if there 
+ * is not enough memory
+ */
+int x25519_peer_table_avx2(struct peer_table *const *t, const uint8_t (*pk)[32])
+{
+  __m256i u[NWORDS], y[NWORDS], w[NWORDS], one[NWORDS];
+  ExtPoint p;
+  uint8_t yb[4][32];
+  int64_t lane[4];
+  int i, l, valid;
+
+  for (i = 0; i < NWORDS; i++) one[i] = VZERO;
+  one[0] = VSET164(1);
+
+  // y = (u-1)/(u+1), u = -1 is invalid
+  mpi29_conv_bytes2mpi29_avx2(u, pk);
+  mpi29_gfp_sbc_avx2(y, u, one);
+  mpi29_gfp_add_avx2(w, u, one);
+  VSTOREU(lane, mpi29_gfp_iszero_avx2(w));
+  mpi29_gfp_inv_avx2(w, w);
+  mpi29_gfp_mul_avx2(y, y, w);
+  mpi29_conv_mpi292bytes_avx2(yb, y);
+
+  valid = ted_point_decode_vartime_avx2(&p, (const uint8_t (*)[32])yb);
+  for (l = 0; l < 4; l++) if (lane[l] != 0) valid &= ~(1 << l);
+  if (ted_peer_table_avx2(t, &p)) return -1;
+
+  return valid;
+}
+
+
+/**
+ * @brief Shared secret computation with the tables of public keys.
+ *
+ * @details
+ * Generate m*4 shared secrets based on own private keys and the (valid) tables 
+ * of the public keys of the other sides, t[i] is the table of the i-th public
+ * key. The scalar multiplications are done on the twisted Edwards curve with 
+ * ted_mul_peer_avx2, the u-coordinates u = (z+y)/(z-y) of the m calls share 
+ * one inversion.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param t Tables of the public keys of the other sides
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_sharedsecret_peer_n_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const struct peer_table *const *t, int m)
+{
+  __m256i k[8], n[X25519_MAXGROUPS][NWORDS], d[X25519_MAXGROUPS][NWORDS];
+  __m256i di[X25519_MAXGROUPS][NWORDS];
+  const __m256i t0 = VSET164(0xFFFFFFF8U);
+  const __m256i t1 = VSET164(0x7FFFFFFFU);
+  const __m256i t2 = VSET164(0x40000000U);
+  ExtPoint h;
+  int i;
+
+  for (i = 0; i < m; i++) {
+    // prune the scalars
+    conv_bytes2key_avx2(k, ska + 4*i);
+    k[0] = VAND(k[0], t0);
+    k[7] = VOR(VAND(k[7], t1), t2);
+    ted_mul_peer_avx2(&h, t + 4*i, k);
+    mpi29_gfp_add_avx2(n[i], h.z, h.y);
+    mpi29_gfp_sbc_avx2(d[i], h.z, h.y);
+  }
+  mpi29_gfp_batchinv_avx2(di, (const __m256i (*)[NWORDS])d, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(n[i], n[i], di[i]);
+    mpi29_conv_mpi292bytes_avx2(ss + 4*i, n[i]);
+  }
+}
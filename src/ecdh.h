@@ -16,11 +16,99 @@
 #ifndef _KEM_H
 #define _KEM_H
 
-#include "gfparith.h"
+#include "x25519.h"
 
 // function prototypes
 
+// the kernels on vectors and the AVX2/AVX-512 kernels only exist on x86-64,
+// the NEON kernels only on aarch64, c64 on both
+#if defined(__x86_64__)
+#include "gfparith.h"
+
 void keygen(__m256i *pk, const __m256i *sk);
 void sharedsecret(__m256i *ss, const __m256i *ska, const __m256i *pkb);
+// the same, returns the mask of the lanes with a non-zero shared secret
+__m256i sharedsecret_checked(__m256i *ss, const __m256i *ska, const __m256i *pkb);
+
+// (8*1)-way version with radix-2^52 field elements (AVX-512IFMA)
+void keygen_avx512(__m512i *pk, const __m512i *sk);
+void sharedsecret_avx512(__m512i *ss, const __m512i *ska, const __m512i *pkb);
+__mmask8 sharedsecret_checked_avx512(__m512i *ss, const __m512i *ska, 
+  const __m512i *pkb);
+
+// conversion of 32-byte strings to scalars (the 32-bit words of 4 lanes) and
+// between 32-byte strings and field elements (4 or 8 lanes), the load masks
+// bit 255 and the store reduces the elements to [0, p)
+void conv_bytes2key_avx2(__m256i *r, const uint8_t (*a)[32]);
+void mpi29_conv_bytes2mpi29_avx2(__m256i *r, const uint8_t (*a)[32]);
+void mpi29_conv_mpi292bytes_avx2(uint8_t (*r)[32], const __m256i *a);
+void mpi52_conv_bytes2mpi52_avx512(__m512i *r, const uint8_t (*a)[32]);
+void mpi52_conv_mpi522bytes_avx512(uint8_t (*r)[32], const __m512i *a);
+
+#endif
+
+// kernels on 32-byte strings (RFC 7748), each call computes exactly as many 
+// instances as the kernel has lanes: 1 (c64), 2 (neon), 4 (avx2) or 8 (avx512)
+void x25519_keygen_c64(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void x25519_sharedsecret_c64(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32]);
+void x25519_keygen_neon(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void x25519_sharedsecret_neon(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32]);
+
+// maximum number of calls of a batch that share one inversion
+#define X25519_MAXGROUPS 16
+
+#if defined(__x86_64__)
+void x25519_keygen_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void x25519_sharedsecret_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32]);
+void x25519_keygen_1x4_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void x25519_sharedsecret_1x4_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32]);
+// two instances with two lanes each
+void x25519_keygen_2x2_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void x25519_sharedsecret_2x2_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32]);
+// 4+ns instances, the last ns <= 2 on the scalar multiplier (BMI2 and ADX,
+// see x25519_has_hybrid in x25519.c), internal to the test program
+int x25519_has_hybrid(void);
+void x25519_sharedsecret_hybrid_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32], int ns);
+
+// kernels of m <= X25519_MAXGROUPS calls (m*4 or m*8 instances) that share one
+// inversion of the z-coordinates (Montgomery's trick)
+void x25519_keygen_n_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32], int m);
+void x25519_sharedsecret_n_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32], int m);
+void x25519_keygen_n_avx512(uint8_t (*pk)[32], const uint8_t (*sk)[32], int m);
+void x25519_sharedsecret_n_avx512(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32], int m);
+// the same with in-vector validation: ok[i] = 0 for an all-zero shared secret
+// (a public key of small order), the number of valid ones is returned
+int x25519_sharedsecret_checked_n_avx2(uint8_t (*ss)[32], uint8_t *ok, 
+  const uint8_t (*ska)[32], const uint8_t (*pkb)[32], int m);
+int x25519_sharedsecret_checked_n_avx512(uint8_t (*ss)[32], uint8_t *ok, 
+  const uint8_t (*ska)[32], const uint8_t (*pkb)[32], int m);
+void x25519_keygen_avx512(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void x25519_sharedsecret_avx512(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32]);
+
+// the same kernels on interleaved buffers (X25519Group of x25519.h): m groups 
+// for AVX2, 2*m groups for AVX-512; the outputs may be the inputs
+void x25519_keygen_soa_n_avx2(X25519Group *pk, const X25519Group *sk, int m);
+void x25519_sharedsecret_soa_n_avx2(X25519Group *ss, const X25519Group *ska, 
+  const X25519Group *pkb, int m);
+void x25519_keygen_soa_n_avx512(X25519Group *pk, const X25519Group *sk, int m);
+void x25519_sharedsecret_soa_n_avx512(X25519Group *ss, const X25519Group *ska, 
+  const X25519Group *pkb, int m);
+
+// shared secrets with the precomputed tables of the public keys (see 
+// src/peercache.h), the tables of four keys are computed at once
+struct peer_table;
+int x25519_peer_table_avx2(struct peer_table *const *t, const uint8_t (*pk)[32]);
+void x25519_sharedsecret_peer_n_avx2(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const struct peer_table *const *t, int m);
+#endif
 
 #endif
@@ -0,0 +1,211 @@
+/**
+ *******************************************************************************
+ * @file ecdh448.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of X448 Diffie-Hellman key exchange functions.
+ *
+ * @details
+ * This file contains the X448 key generation and the computation of shared
+ * secret on 56-byte strings, four at a time.
+ *******************************************************************************
+ */
+
+#include "moncurve448.h"
+#include "ecdh448.h"
+#include <string.h>
+
+
+/**
+ * @brief Little-endian 32-bit word of a byte string.
+ *
+ * @param a Byte string
+ * @return The word at a
+ */
+static inline uint32_t load32(const uint8_t *a)
+{
+  uint32_t w;
+
+  memcpy(&w, a, 4);
+  return w;
+}
+
+
+/**
+ * @brief Conversion from byte strings to a private key vector.
+ *
+ * @details
+ * Load four 56-byte little-endian private keys into the 32-bit words of the
+ * AVX2 vectors (the i-th key is in the i-th 64-bit lane).
+ *
+ * @param r Private key vector
+ * @param a Four private keys
+ */
+void conv_bytes2key448_avx2(__m256i *r, const uint8_t (*a)[X448_BYTES])
+{
+  int j;
+
+  for (j = 0; j < NKWORDS448; j++)
+    r[j] = VSET64(load32(a[3]+4*j), load32(a[2]+4*j), load32(a[1]+4*j),
+      load32(a[0]+4*j));
+}
+
+
+/**
+ * @brief Conversion from byte strings to a field element vector.
+ *
+ * @details
+ * Load four 56-byte little-endian u-coordinates into radix-2^28 field
+ * elements: the limbs 2j and 2j+1 are the 56 bits at byte 7j, i.e. the low 28
+ * bits of the word at byte 7j and the word at byte 7j+3 shifted by 4. Unlike
+ * X25519 no bit is masked, an input >= p is reduced by the arithmetic.
+ *
+ * @param r Field element
+ * @param a Four u-coordinates
+ */
+void mpi28_conv_bytes2mpi28_avx2(__m256i *r, const uint8_t (*a)[X448_BYTES])
+{
+  const __m256i VMASK28 = VSET164(MASK28);
+  int j;
+
+  for (j = 0; j < NWORDS448/2; j++) {
+    r[2*j] = VSET64(load32(a[3]+7*j), load32(a[2]+7*j), load32(a[1]+7*j),
+      load32(a[0]+7*j));
+    r[2*j] = VAND(r[2*j], VMASK28);
+    r[2*j+1] = VSET64(load32(a[3]+7*j+3), load32(a[2]+7*j+3),
+      load32(a[1]+7*j+3), load32(a[0]+7*j+3));
+    r[2*j+1] = VSHR(r[2*j+1], 4);
+  }
+}
+
+
+/**
+ * @brief Conversion from a field element vector to byte strings.
+ *
+ * @details
+ * Reduce four radix-2^28 field elements to [0, p) and store them as 56-byte
+ * little-endian strings, i.e. the inverse of the conversion above.
+ *
+ * @param r Four byte strings
+ * @param a Field element
+ */
+void mpi28_conv_mpi282bytes_avx2(uint8_t (*r)[X448_BYTES], const __m256i *a)
+{
+  __m256i b[NWORDS448];
+  uint64_t w[4];
+  int i, j, l;
+
+  mpi28_copy448_avx2(b, a);
+  mpi28_gfp448_final_avx2(b);
+
+  for (j = 0; j < NWORDS448/2; j++) {
+    VSTOREU(w, VOR(b[2*j], VSHL(b[2*j+1], BITS28)));
+    for (i = 0; i < 4; i++)
+      for (l = 0; l < 7; l++) r[i][7*j+l] = (uint8_t)(w[i] >> (8*l));
+  }
+}
+
+
+/**
+ * @brief Key generation on byte strings.
+ *
+ * @details
+ * Generate four public keys from the private keys with the fixed-base scalar
+ * multiplication (the comb on Ed448).
+ *
+ * @param pk Public keys
+ * @param sk Private keys
+ */
+void x448_keygen_avx2(uint8_t (*pk)[X448_BYTES], const uint8_t (*sk)[X448_BYTES])
+{
+  __m256i k[NKWORDS448], r[NWORDS448];
+
+  conv_bytes2key448_avx2(k, sk);
+  mon448_mul_fixbase_avx2(r, k);
+  mpi28_conv_mpi282bytes_avx2(pk, r);
+}
+
+
+/**
+ * @brief Shared secret computation on byte strings.
+ *
+ * @details
+ * Generate four shared secrets based on own private keys and the public keys
+ * of the other sides (Montgomery ladder).
+ *
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ */
+void x448_sharedsecret_avx2(uint8_t (*ss)[X448_BYTES],
+  const uint8_t (*ska)[X448_BYTES], const uint8_t (*pkb)[X448_BYTES])
+{
+  __m256i k[NKWORDS448], u[NWORDS448], r[NWORDS448];
+
+  conv_bytes2key448_avx2(k, ska);
+  mpi28_conv_bytes2mpi28_avx2(u, pkb);
+  mon448_mul_varbase_avx2(r, k, u);
+  mpi28_conv_mpi282bytes_avx2(ss, r);
+}
+
+
+/**
+ * @brief Key generation of a batch.
+ *
+ * @details
+ * Compute the public keys of n private keys with the 4-way kernel, the last
+ * call is padded with copies of the last key.
+ *
+ * @param pk Public keys
+ * @param sk Private keys
+ * @param n Number of keys
+ */
+void x448_keygen_batch(uint8_t (*pk)[X448_BYTES], const uint8_t (*sk)[X448_BYTES],
+  size_t n)
+{
+  uint8_t tpk[4][X448_BYTES], tsk[4][X448_BYTES];
+  size_t i, j;
+
+  for (i = 0; i + 4 <= n; i += 4) x448_keygen_avx2(pk + i, sk + i);
+
+  if (i < n) {
+    for (j = 0; j < 4; j++) memcpy(tsk[j], sk[(i+j < n) ? i+j : n-1], X448_BYTES);
+    x448_keygen_avx2(tpk, (const uint8_t (*)[X448_BYTES])tsk);
+    for (j = 0; i+j < n; j++) memcpy(pk[i+j], tpk[j], X448_BYTES);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of a batch.
+ *
+ * @details
+ * Compute the shared secrets of n pairs of keys with the 4-way kernel, the
+ * last call is padded with copies of the last pair.
+ *
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param n Number of keys
+ */
+void x448_sharedsecret_batch(uint8_t (*ss)[X448_BYTES],
+  const uint8_t (*ska)[X448_BYTES], const uint8_t (*pkb)[X448_BYTES], size_t n)
+{
+  uint8_t tss[4][X448_BYTES], tsk[4][X448_BYTES], tpk[4][X448_BYTES];
+  size_t i, j;
+
+  for (i = 0; i + 4 <= n; i += 4) x448_sharedsecret_avx2(ss + i, ska + i, pkb + i);
+
+  if (i < n) {
+    for (j = 0; j < 4; j++) {
+      memcpy(tsk[j], ska[(i+j < n) ? i+j : n-1], X448_BYTES);
+      memcpy(tpk[j], pkb[(i+j < n) ? i+j : n-1], X448_BYTES);
+    }
+    x448_sharedsecret_avx2(tss, (const uint8_t (*)[X448_BYTES])tsk,
+      (const uint8_t (*)[X448_BYTES])tpk);
+    for (j = 0; i+j < n; j++) memcpy(ss[i+j], tss[j], X448_BYTES);
+  }
+}
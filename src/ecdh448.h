@@ -0,0 +1,31 @@
+/**
+ *******************************************************************************
+ * @file ecdh448.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of X448 Diffie-Hellman key exchange functions.
+ *
+ * @details
+ * This file contains the function prototypes of the conversions of the 4-way
+ * X448 (RFC 7748) functions, the kernels on 56-byte strings are in x448.h
+ * (needs AVX2).
+ *******************************************************************************
+ */
+
+#ifndef _ECDH448_H
+#define _ECDH448_H
+
+#include <stdint.h>
+#include "intrin.h"
+#include "x448.h"
+
+// conversion of 56-byte strings to scalars (14 32-bit words per lane) and
+// between 56-byte strings and field elements, the store reduces to [0, p)
+void conv_bytes2key448_avx2(__m256i *r, const uint8_t (*a)[X448_BYTES]);
+void mpi28_conv_bytes2mpi28_avx2(__m256i *r, const uint8_t (*a)[X448_BYTES]);
+void mpi28_conv_mpi282bytes_avx2(uint8_t (*r)[X448_BYTES], const __m256i *a);
+
+#endif
@@ -0,0 +1,57 @@
+/**
+ *******************************************************************************
+ * @file ecdh51.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of portable Diffie-Hellman key exchange functions
+ *
+ * @details 
+ * This file contains (1*1)-way key generation and the computation of shared 
+ * secret on 32-byte strings (RFC 7748). 
+ *******************************************************************************
+ */
+
+#include "moncurve51.h"
+#include "ecdh.h"
+
+/**
+ * @brief Key generation.
+ *
+ * @details
+ * Generate public key based on the given private key. There is no table of 
+ * the fixed-base in this version, the ladder is performed with u = 9.
+ * 
+ * @param pk Public key
+ * @param sk Private key
+ */
+void x25519_keygen_c64(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  uint64_t u[NWORDS51] = { 9, 0, 0, 0, 0 }, r[NWORDS51];
+
+  mon_mul_varbase_c64(r, sk[0], u);
+  mpi51_to_bytes_c64(pk[0], r);
+}
+
+/**
+ * @brief Shared secret computation.
+ *
+ * @details
+ * Generate a shared secret (session key) based on own private key and the public 
+ * key of the other side.
+ * 
+ * @param ss  Shared secret
+ * @param ska Own private key
+ * @param pkb Public key of the other side
+ */
+void x25519_sharedsecret_c64(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32])
+{
+  uint64_t u[NWORDS51], r[NWORDS51];
+
+  mpi51_from_bytes_c64(u, pkb[0]);
+  mon_mul_varbase_c64(r, ska[0], u);
+  mpi51_to_bytes_c64(ss[0], r);
+}
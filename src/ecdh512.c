@@ -0,0 +1,528 @@
+/**
+ *******************************************************************************
+ * @file ecdh512.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of AVX-512IFMA Diffie-Hellman key exchange functions
+ *
+ * @details 
+ * This file contains (8*1)-way key generation and the computation of shared 
+ * secret.
+ *******************************************************************************
+ */
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__)
+
+#include "moncurve512.h"
+#include "tedcurve512.h"
+#include "ecdh.h"
+
+/**
+ * @brief The final step to reduce pk or ss by modulo p 
+ *
+ * @details
+ * Perform modulo-p reduction for the integer to make it in [0, 2^255-19).
+ * The bits above 2^255 are folded first, then p is subtracted (by adding 19
+ * and clearing bit 255) in those lanes where the element is not below p.
+ * 
+ * @param a Field element
+ */
+static void final_modp_avx512(__m512i *a)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i t0, t1, t2, t3, t4, temp;
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i V19 = ZSET164(19);
+
+  // current a is at most slightly above 2^255, make it smaller than 2^255
+  temp = ZSHR(a4, BITS47); a4 = ZAND(a4, VMASK47);
+  a0 = ZMADDLO(a0, temp, V19);
+  a1 = ZADD(a1, ZSHR(a0, BITS52)); a0 = ZAND(a0, VMASK52);
+  a2 = ZADD(a2, ZSHR(a1, BITS52)); a1 = ZAND(a1, VMASK52);
+  a3 = ZADD(a3, ZSHR(a2, BITS52)); a2 = ZAND(a2, VMASK52);
+  a4 = ZADD(a4, ZSHR(a3, BITS52)); a3 = ZAND(a3, VMASK52);
+
+  // a+19 has bit 255 set iff a >= p (a < 2p holds here)
+  t0 = ZADD(a0, V19);
+  t1 = ZADD(a1, ZSHR(t0, BITS52)); t0 = ZAND(t0, VMASK52);
+  t2 = ZADD(a2, ZSHR(t1, BITS52)); t1 = ZAND(t1, VMASK52);
+  t3 = ZADD(a3, ZSHR(t2, BITS52)); t2 = ZAND(t2, VMASK52);
+  t4 = ZADD(a4, ZSHR(t3, BITS52)); t3 = ZAND(t3, VMASK52);
+  temp = ZSHR(t4, BITS47);
+
+  // add 19*q and remove 2^255*q
+  a0 = ZMADDLO(a0, temp, V19);
+  a1 = ZADD(a1, ZSHR(a0, BITS52)); a0 = ZAND(a0, VMASK52);
+  a2 = ZADD(a2, ZSHR(a1, BITS52)); a1 = ZAND(a1, VMASK52);
+  a3 = ZADD(a3, ZSHR(a2, BITS52)); a2 = ZAND(a2, VMASK52);
+  a4 = ZADD(a4, ZSHR(a3, BITS52)); a3 = ZAND(a3, VMASK52);
+  a4 = ZAND(a4, VMASK47);
+
+  a[0] = a0; a[1] = a1; a[2] = a2; a[3] = a3; a[4] = a4;
+}
+
+
+/**
+ * @brief Key generation.
+ *
+ * @details
+ * Generate public key based on the given private key for eight instances. 
+ * 
+ * @param pk Public key
+ * @param sk Private key
+ */
+void keygen_avx512(__m512i *pk, const __m512i *sk)
+{
+  mon_mul_fixbase_avx512(pk, sk);
+  final_modp_avx512(pk);
+}
+
+/**
+ * @brief Shared secret computation.
+ *
+ * @details
+ * Generate a shared secret (session key) based on own private key and the public 
+ * key of the other side for eight instances.
+ * 
+ * @param ss  Shared secret
+ * @param ska Own private key
+ * @param pkb Public key of the other side
+ */
+void sharedsecret_avx512(__m512i *ss, const __m512i *ska, const __m512i *pkb)
+{
+  // Variable-base point scalar multiplication on Montgomery curve
+  mon_mul_varbase_avx512(ss, ska, pkb);
+  final_modp_avx512(ss);
+}
+
+/**
+ * @brief Shared secret computation with validation.
+ *
+ * @details
+ * The same as sharedsecret_avx512, and the all-zero shared secrets (the 
+ * public keys of small order, see sharedsecret_checked) are detected in the 
+ * vector registers.
+ * 
+ * @param ss  Shared secret
+ * @param ska Own private key
+ * @param pkb Public key of the other side
+ * @return Mask with the bits set of the lanes with a valid shared secret
+ */
+__mmask8 sharedsecret_checked_avx512(__m512i *ss, const __m512i *ska, 
+  const __m512i *pkb)
+{
+  sharedsecret_avx512(ss, ska, pkb);
+  return (__mmask8)~mpi52_gfp_iszero_avx512(ss);
+}
+
+/**
+ * @brief Conversion from byte strings to a private key vector.
+ *
+ * @details
+ * Load eight 32-byte little-endian private keys into the 32-bit words of the 
+ * AVX-512 vectors (the i-th key is in the i-th 64-bit lane). Each half of 
+ * four keys is transposed with unpack instructions.
+ * 
+ * @param r Private key vector
+ * @param a Eight private keys
+ */
+static void conv_bytes2key_avx512(__m512i *r, const uint8_t (*a)[32])
+{
+  __m256i t0, t1, t2, t3, u[2][4];
+  int h;
+
+  for (h = 0; h < 2; h++) {
+    const __m256i a0 = VLOADU(a[4*h]), a1 = VLOADU(a[4*h+1]);
+    const __m256i a2 = VLOADU(a[4*h+2]), a3 = VLOADU(a[4*h+3]);
+    t0 = _mm256_unpacklo_epi32(a0, a1);
+    t1 = _mm256_unpackhi_epi32(a0, a1);
+    t2 = _mm256_unpacklo_epi32(a2, a3);
+    t3 = _mm256_unpackhi_epi32(a2, a3);
+    // u[h][0] = (w0 of the four keys | w4 of the four keys), etc.
+    u[h][0] = _mm256_unpacklo_epi64(t0, t2);
+    u[h][1] = _mm256_unpackhi_epi64(t0, t2);
+    u[h][2] = _mm256_unpacklo_epi64(t1, t3);
+    u[h][3] = _mm256_unpackhi_epi64(t1, t3);
+  }
+
+  for (h = 0; h < 4; h++) {
+    // word h (low halves) and word h+4 (high halves) of the eight keys
+    t0 = _mm256_permute2x128_si256(u[0][h], u[1][h], 0x20);
+    t1 = _mm256_permute2x128_si256(u[0][h], u[1][h], 0x31);
+    r[h]   = _mm512_cvtepu32_epi64(t0);
+    r[h+4] = _mm512_cvtepu32_epi64(t1);
+  }
+}
+
+
+/**
+ * @brief Conversion from byte strings to a field element vector.
+ *
+ * @details
+ * Load eight 32-byte little-endian u-coordinates into radix-2^52 field 
+ * elements, the most significant bit of each string is masked (RFC 7748). 
+ * The 8x4 matrix of 64-bit words is transposed with two rounds of two-source 
+ * permutations, then the limbs are extracted with shifts.
+ * 
+ * @param r Field element
+ * @param a Eight u-coordinates
+ */
+void mpi52_conv_bytes2mpi52_avx512(__m512i *r, const uint8_t (*a)[32])
+{
+  const __m512i z0 = ZLOADU(a[0]), z1 = ZLOADU(a[2]);
+  const __m512i z2 = ZLOADU(a[4]), z3 = ZLOADU(a[6]);
+  const __m512i I0 = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+  const __m512i I1 = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+  const __m512i ILO = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+  const __m512i IHI = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  __m512i a01, b01, a23, b23, w0, w1, w2, w3;
+
+  // a01 = (word 0 of strings 0-3, word 1 of strings 0-3), b01 = words 2, 3
+  a01 = _mm512_permutex2var_epi64(z0, I0, z1);
+  b01 = _mm512_permutex2var_epi64(z0, I1, z1);
+  a23 = _mm512_permutex2var_epi64(z2, I0, z3);
+  b23 = _mm512_permutex2var_epi64(z2, I1, z3);
+  // wj holds the j-th 64-bit word of the eight strings
+  w0 = _mm512_permutex2var_epi64(a01, ILO, a23);
+  w1 = _mm512_permutex2var_epi64(a01, IHI, a23);
+  w2 = _mm512_permutex2var_epi64(b01, ILO, b23);
+  w3 = _mm512_permutex2var_epi64(b01, IHI, b23);
+
+  r[0] = ZAND(w0, VMASK52);
+  r[1] = ZAND(ZOR(ZSHR(w0, 52), ZSHL(w1, 12)), VMASK52);
+  r[2] = ZAND(ZOR(ZSHR(w1, 40), ZSHL(w2, 24)), VMASK52);
+  r[3] = ZAND(ZOR(ZSHR(w2, 28), ZSHL(w3, 36)), VMASK52);
+  r[4] = ZAND(ZSHR(w3, 16), VMASK47);
+}
+
+
+/**
+ * @brief Conversion from two interleaved groups to a field element vector.
+ *
+ * @details
+ * Row j of the two groups (four strings each) is the j-th 64-bit word of the 
+ * eight strings, so no transposition is needed.
+ * 
+ * @param r Field element
+ * @param a Two groups of four u-coordinates
+ */
+static void mpi52_conv_group2mpi52_avx512(__m512i *r, const X25519Group *a)
+{
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  __m512i w[4];
+  int j;
+
+  for (j = 0; j < 4; j++)
+    w[j] = _mm512_inserti64x4(_mm512_castsi256_si512(
+      _mm256_load_si256((const __m256i *)a[0].w[j])), 
+      _mm256_load_si256((const __m256i *)a[1].w[j]), 1);
+
+  r[0] = ZAND(w[0], VMASK52);
+  r[1] = ZAND(ZOR(ZSHR(w[0], 52), ZSHL(w[1], 12)), VMASK52);
+  r[2] = ZAND(ZOR(ZSHR(w[1], 40), ZSHL(w[2], 24)), VMASK52);
+  r[3] = ZAND(ZOR(ZSHR(w[2], 28), ZSHL(w[3], 36)), VMASK52);
+  r[4] = ZAND(ZSHR(w[3], 16), VMASK47);
+}
+
+
+/**
+ * @brief Conversion from two interleaved groups to a private key vector.
+ *
+ * @param r Private key vector
+ * @param a Two groups of four private keys
+ */
+static void conv_group2key_avx512(__m512i *r, const X25519Group *a)
+{
+  const __m512i VMASK32 = ZSET164(0xFFFFFFFFUL);
+  __m512i w;
+  int j;
+
+  for (j = 0; j < 4; j++) {
+    w = _mm512_inserti64x4(_mm512_castsi256_si512(
+      _mm256_load_si256((const __m256i *)a[0].w[j])), 
+      _mm256_load_si256((const __m256i *)a[1].w[j]), 1);
+    r[2*j]   = ZAND(w, VMASK32);
+    r[2*j+1] = ZSHR(w, 32);
+  }
+}
+
+
+/**
+ * @brief Conversion from a field element vector to byte strings.
+ *
+ * @details
+ * Reduce eight radix-2^52 field elements to [0, 2^255-19) and store them as 
+ * 32-byte little-endian strings, i.e. the inverse of the conversion above.
+ * 
+ * @param r Eight byte strings
+ * @param a Field element
+ */
+void mpi52_conv_mpi522bytes_avx512(uint8_t (*r)[32], const __m512i *a)
+{
+  const __m512i I0 = _mm512_set_epi64(13, 9, 5, 1, 12, 8, 4, 0);
+  const __m512i I1 = _mm512_set_epi64(15, 11, 7, 3, 14, 10, 6, 2);
+  const __m512i ILO = _mm512_set_epi64(11, 10, 9, 8, 3, 2, 1, 0);
+  const __m512i IHI = _mm512_set_epi64(15, 14, 13, 12, 7, 6, 5, 4);
+  __m512i b[NWORDS52], a01, b01, a23, b23, w0, w1, w2, w3;
+  int i;
+
+  for (i = 0; i < NWORDS52; i++) b[i] = a[i];
+  final_modp_avx512(b);
+
+  w0 = ZOR(b[0], ZSHL(b[1], 52));
+  w1 = ZOR(ZSHR(b[1], 12), ZSHL(b[2], 40));
+  w2 = ZOR(ZSHR(b[2], 24), ZSHL(b[3], 28));
+  w3 = ZOR(ZSHR(b[3], 36), ZSHL(b[4], 16));
+
+  // transpose back with the two rounds in reverse order
+  a01 = _mm512_permutex2var_epi64(w0, ILO, w1);
+  a23 = _mm512_permutex2var_epi64(w0, IHI, w1);
+  b01 = _mm512_permutex2var_epi64(w2, ILO, w3);
+  b23 = _mm512_permutex2var_epi64(w2, IHI, w3);
+  ZSTOREU(r[0], _mm512_permutex2var_epi64(a01, I0, b01));
+  ZSTOREU(r[2], _mm512_permutex2var_epi64(a01, I1, b01));
+  ZSTOREU(r[4], _mm512_permutex2var_epi64(a23, I0, b23));
+  ZSTOREU(r[6], _mm512_permutex2var_epi64(a23, I1, b23));
+}
+
+
+/**
+ * @brief Conversion from a field element vector to two interleaved groups.
+ *
+ * @param r Two groups of four strings
+ * @param a Field element
+ */
+static void mpi52_conv_mpi522group_avx512(X25519Group *r, const __m512i *a)
+{
+  __m512i b[NWORDS52], w[4];
+  int i, j;
+
+  for (i = 0; i < NWORDS52; i++) b[i] = a[i];
+  final_modp_avx512(b);
+
+  w[0] = ZOR(b[0], ZSHL(b[1], 52));
+  w[1] = ZOR(ZSHR(b[1], 12), ZSHL(b[2], 40));
+  w[2] = ZOR(ZSHR(b[2], 24), ZSHL(b[3], 28));
+  w[3] = ZOR(ZSHR(b[3], 36), ZSHL(b[4], 16));
+
+  for (j = 0; j < 4; j++) {
+    _mm256_store_si256((__m256i *)r[0].w[j], _mm512_castsi512_si256(w[j]));
+    _mm256_store_si256((__m256i *)r[1].w[j], _mm512_extracti64x4_epi64(w[j], 1));
+  }
+}
+
+
+/**
+ * @brief Key generation on byte strings.
+ *
+ * @details
+ * Generate eight public keys based on the given private keys. 
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ */
+void x25519_keygen_avx512(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  __m512i k[8], r[NWORDS52];
+
+  conv_bytes2key_avx512(k, sk);
+  mon_mul_fixbase_avx512(r, k);
+  mpi52_conv_mpi522bytes_avx512(pk, r);
+}
+
+
+/**
+ * @brief Shared secret computation on byte strings.
+ *
+ * @details
+ * Generate eight shared secrets based on own private keys and the public keys 
+ * of the other sides.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ */
+void x25519_sharedsecret_avx512(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32])
+{
+  __m512i k[8], u[NWORDS52], r[NWORDS52];
+
+  conv_bytes2key_avx512(k, ska);
+  mpi52_conv_bytes2mpi52_avx512(u, pkb);
+  mon_mul_varbase_avx512(r, k, u);
+  mpi52_conv_mpi522bytes_avx512(ss, r);
+}
+
+
+/**
+ * @brief Key generation of several calls on byte strings.
+ *
+ * @details
+ * Generate m*8 public keys, the z-coordinates of all m calls are inverted 
+ * at once with mpi52_gfp_batchinv_avx512.
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_keygen_n_avx512(uint8_t (*pk)[32], const uint8_t (*sk)[32], int m)
+{
+  __m512i k[8], x[X25519_MAXGROUPS][NWORDS52], z[X25519_MAXGROUPS][NWORDS52];
+  __m512i zi[X25519_MAXGROUPS][NWORDS52];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_bytes2key_avx512(k, sk + 8*i);
+    mon_mul_fixbase_proj_avx512(x[i], z[i], k);
+  }
+  mpi52_gfp_batchinv_avx512(zi, (const __m512i (*)[NWORDS52])z, m);
+  for (i = 0; i < m; i++) {
+    mpi52_gfp_mul_avx512(x[i], x[i], zi[i]);
+    mpi52_conv_mpi522bytes_avx512(pk + 8*i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of several calls on byte strings.
+ *
+ * @details
+ * Generate m*8 shared secrets, the z-coordinates of all m calls are inverted 
+ * at once with mpi52_gfp_batchinv_avx512.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_sharedsecret_n_avx512(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+  const uint8_t (*pkb)[32], int m)
+{
+  __m512i k[8], u[NWORDS52], x[X25519_MAXGROUPS][NWORDS52], z[X25519_MAXGROUPS][NWORDS52];
+  __m512i zi[X25519_MAXGROUPS][NWORDS52];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_bytes2key_avx512(k, ska + 8*i);
+    mpi52_conv_bytes2mpi52_avx512(u, pkb + 8*i);
+    mon_mul_varbase_proj_avx512(x[i], z[i], k, u);
+  }
+  mpi52_gfp_batchinv_avx512(zi, (const __m512i (*)[NWORDS52])z, m);
+  for (i = 0; i < m; i++) {
+    mpi52_gfp_mul_avx512(x[i], x[i], zi[i]);
+    mpi52_conv_mpi522bytes_avx512(ss + 8*i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of several calls with validation.
+ *
+ * @details
+ * The same as x25519_sharedsecret_n_avx512, and the all-zero shared secrets 
+ * are detected on the field elements before they are stored (see 
+ * x25519_sharedsecret_checked_n_avx2).
+ * 
+ * @param ss  Shared secrets
+ * @param ok  Flags (1 if the shared secret is valid, 0 if it is all-zero)
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ * @return Number of valid shared secrets
+ */
+int x25519_sharedsecret_checked_n_avx512(uint8_t (*ss)[32], uint8_t *ok, 
+  const uint8_t (*ska)[32], const uint8_t (*pkb)[32], int m)
+{
+  __m512i k[8], u[NWORDS52], x[X25519_MAXGROUPS][NWORDS52], z[X25519_MAXGROUPS][NWORDS52];
+  __m512i zi[X25519_MAXGROUPS][NWORDS52];
+  __mmask8 zero;
+  int i, j, cnt = 8*m;
+
+  for (i = 0; i < m; i++) {
+    conv_bytes2key_avx512(k, ska + 8*i);
+    mpi52_conv_bytes2mpi52_avx512(u, pkb + 8*i);
+    mon_mul_varbase_proj_avx512(x[i], z[i], k, u);
+  }
+  mpi52_gfp_batchinv_avx512(zi, (const __m512i (*)[NWORDS52])z, m);
+  for (i = 0; i < m; i++) {
+    mpi52_gfp_mul_avx512(x[i], x[i], zi[i]);
+    zero = mpi52_gfp_iszero_avx512(x[i]);
+    mpi52_conv_mpi522bytes_avx512(ss + 8*i, x[i]);
+    for (j = 0; j < 8; j++) {
+      ok[8*i+j] = (uint8_t)(~zero >> j & 1);
+      cnt -= (zero >> j) & 1;
+    }
+  }
+
+  return cnt;
+}
+
+
+/**
+ * @brief Key generation of several calls on interleaved buffers.
+ *
+ * @details
+ * The same as x25519_keygen_n_avx512, on 2*m groups of an interleaved buffer;
+ * pk may be sk.
+ * 
+ * @param pk Public keys (2*m groups)
+ * @param sk Private keys (2*m groups)
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_keygen_soa_n_avx512(X25519Group *pk, const X25519Group *sk, int m)
+{
+  __m512i k[8], x[X25519_MAXGROUPS][NWORDS52], z[X25519_MAXGROUPS][NWORDS52];
+  __m512i zi[X25519_MAXGROUPS][NWORDS52];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_group2key_avx512(k, sk + 2*i);
+    mon_mul_fixbase_proj_avx512(x[i], z[i], k);
+  }
+  mpi52_gfp_batchinv_avx512(zi, (const __m512i (*)[NWORDS52])z, m);
+  for (i = 0; i < m; i++) {
+    mpi52_gfp_mul_avx512(x[i], x[i], zi[i]);
+    mpi52_conv_mpi522group_avx512(pk + 2*i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Shared secret computation of several calls on interleaved buffers.
+ *
+ * @details
+ * The same as x25519_sharedsecret_n_avx512, on 2*m groups of interleaved 
+ * buffers; ss may be ska or pkb.
+ * 
+ * @param ss  Shared secrets (2*m groups)
+ * @param ska Own private keys (2*m groups)
+ * @param pkb Public keys of the other sides (2*m groups)
+ * @param m Number of calls (1 <= m <= X25519_MAXGROUPS)
+ */
+void x25519_sharedsecret_soa_n_avx512(X25519Group *ss, const X25519Group *ska, 
+  const X25519Group *pkb, int m)
+{
+  __m512i k[8], u[NWORDS52], x[X25519_MAXGROUPS][NWORDS52], z[X25519_MAXGROUPS][NWORDS52];
+  __m512i zi[X25519_MAXGROUPS][NWORDS52];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_group2key_avx512(k, ska + 2*i);
+    mpi52_conv_group2mpi52_avx512(u, pkb + 2*i);
+    mon_mul_varbase_proj_avx512(x[i], z[i], k, u);
+  }
+  mpi52_gfp_batchinv_avx512(zi, (const __m512i (*)[NWORDS52])z, m);
+  for (i = 0; i < m; i++) {
+    mpi52_gfp_mul_avx512(x[i], x[i], zi[i]);
+    mpi52_conv_mpi522group_avx512(ss + 2*i, x[i]);
+  }
+}
+
+#endif
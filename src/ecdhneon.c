@@ -0,0 +1,215 @@
+/**
+ *******************************************************************************
+ * @file ecdhneon.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of NEON Diffie-Hellman key exchange functions
+ *
+ * @details
+ * This file contains (2*1)-way key generation and the computation of shared
+ * secret on 32-byte strings (RFC 7748) with the NEON field arithmetic.
+ *******************************************************************************
+ */
+
+#if defined(__ARM_NEON)
+
+#include "moncurveneon.h"
+#include "ecdh.h"
+
+
+/**
+ * @brief The final step to reduce pk or ss by modulo p
+ *
+ * @details
+ * Perform modulo-p reduction for the integer to make it in [0, 2^255-19).
+ * The bits above 2^255 are folded twice, then p is subtracted (by adding 19
+ * and clearing bit 255) in those lanes where the element is not below p, as
+ * in the AVX2 version.
+ *
+ * @param a Field element
+ */
+static void final_modp_neon(uint64x2_t *a)
+{
+  const uint64x2_t VMASK23 = NSET164(0x7FFFFFUL);
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  const uint64x2_t V19 = NSET164(19);
+  uint64x2_t temp;
+  int i, j;
+
+  // current r is 9*29-bit, we will convert it to 8*29-bit + 23-bit (twice, it
+  // is possible that r8 is still longer than 23-bit after the first round)
+  for (j = 0; j < 2; j++) {
+    temp = NSHR(a[8], 23); a[8] = NAND(a[8], VMASK23);
+    a[0] = NMAC(a[0], NNARROW(temp), NNARROW(V19));
+    for (i = 0; i < NWORDS-1; i++) {
+      a[i+1] = NADD(a[i+1], NSHR(a[i], BITS29));
+      a[i] = NAND(a[i], VMASK29);
+    }
+  }
+
+  // now a < 2^255, and a+19 has bit 255 set iff a >= p
+  temp = NADD(a[0], V19);
+  for (i = 1; i < NWORDS; i++) temp = NADD(a[i], NSHR(temp, BITS29));
+  temp = NSHR(temp, 23);
+
+  // add 19*q and remove 2^255*q
+  a[0] = NMAC(a[0], NNARROW(temp), NNARROW(V19));
+  for (i = 0; i < NWORDS-1; i++) {
+    a[i+1] = NADD(a[i+1], NSHR(a[i], BITS29));
+    a[i] = NAND(a[i], VMASK29);
+  }
+  a[8] = NAND(a[8], VMASK23);
+}
+
+
+/**
+ * @brief Conversion from byte strings to 64-bit words.
+ *
+ * @details
+ * w[j] holds the j-th little-endian 64-bit word of the two strings, the 2x2
+ * blocks of words are transposed with zip instructions.
+ *
+ * @param w Words of the two strings
+ * @param a Two 32-byte strings
+ */
+static void conv_bytes2words_neon(uint64x2_t *w, const uint8_t (*a)[32])
+{
+  const uint64x2_t a0 = NLOADU(a[0]), a1 = NLOADU(a[1]);
+  const uint64x2_t a2 = NLOADU(a[0] + 16), a3 = NLOADU(a[1] + 16);
+
+  w[0] = NUNPACKLO(a0, a1);
+  w[1] = NUNPACKHI(a0, a1);
+  w[2] = NUNPACKLO(a2, a3);
+  w[3] = NUNPACKHI(a2, a3);
+}
+
+
+/**
+ * @brief Conversion from byte strings to a private key vector.
+ *
+ * @details
+ * The 32-bit words of the two private keys are the low and high halves of
+ * their 64-bit words.
+ *
+ * @param r Private key vector
+ * @param a Two private keys
+ */
+static void conv_bytes2key_neon(uint64x2_t *r, const uint8_t (*a)[32])
+{
+  const uint64x2_t VMASK32 = NSET164(0xFFFFFFFFUL);
+  uint64x2_t w[4];
+  int j;
+
+  conv_bytes2words_neon(w, a);
+  for (j = 0; j < 4; j++) {
+    r[2*j]   = NAND(w[j], VMASK32);
+    r[2*j+1] = NSHR(w[j], 32);
+  }
+}
+
+
+/**
+ * @brief Conversion from byte strings to a field element vector.
+ *
+ * @details
+ * Load two 32-byte little-endian u-coordinates into radix-2^29 field
+ * elements, the most significant bit of each string is masked (RFC 7748).
+ *
+ * @param r Field element
+ * @param a Two u-coordinates
+ */
+static void mpi29_conv_bytes2mpi29_neon(uint64x2_t *r, const uint8_t (*a)[32])
+{
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  const uint64x2_t VMASK23 = NSET164(0x7FFFFFUL);
+  uint64x2_t w[4];
+
+  conv_bytes2words_neon(w, a);
+  r[0] = NAND(w[0], VMASK29);
+  r[1] = NAND(NSHR(w[0], 29), VMASK29);
+  r[2] = NAND(NOR(NSHR(w[0], 58), NSHL(w[1], 6)), VMASK29);
+  r[3] = NAND(NSHR(w[1], 23), VMASK29);
+  r[4] = NAND(NOR(NSHR(w[1], 52), NSHL(w[2], 12)), VMASK29);
+  r[5] = NAND(NSHR(w[2], 17), VMASK29);
+  r[6] = NAND(NOR(NSHR(w[2], 46), NSHL(w[3], 18)), VMASK29);
+  r[7] = NAND(NSHR(w[3], 11), VMASK29);
+  r[8] = NAND(NSHR(w[3], 40), VMASK23);
+}
+
+
+/**
+ * @brief Conversion from a field element vector to byte strings.
+ *
+ * @details
+ * Reduce two radix-2^29 field elements to [0, 2^255-19) and store them as
+ * 32-byte little-endian strings, i.e. the inverse of the conversion above.
+ *
+ * @param r Two byte strings
+ * @param a Field element
+ */
+static void mpi29_conv_mpi292bytes_neon(uint8_t (*r)[32], const uint64x2_t *a)
+{
+  uint64x2_t b[NWORDS], w[4];
+  int i;
+
+  for (i = 0; i < NWORDS; i++) b[i] = a[i];
+  final_modp_neon(b);
+
+  w[0] = NOR(NOR(b[0], NSHL(b[1], 29)), NSHL(b[2], 58));
+  w[1] = NOR(NOR(NSHR(b[2], 6), NSHL(b[3], 23)), NSHL(b[4], 52));
+  w[2] = NOR(NOR(NSHR(b[4], 12), NSHL(b[5], 17)), NSHL(b[6], 46));
+  w[3] = NOR(NOR(NSHR(b[6], 18), NSHL(b[7], 11)), NSHL(b[8], 40));
+
+  // transpose back: the i-th vector holds two words of the i-th string
+  NSTOREU(r[0],      NUNPACKLO(w[0], w[1]));
+  NSTOREU(r[1],      NUNPACKHI(w[0], w[1]));
+  NSTOREU(r[0] + 16, NUNPACKLO(w[2], w[3]));
+  NSTOREU(r[1] + 16, NUNPACKHI(w[2], w[3]));
+}
+
+
+/**
+ * @brief Key generation on byte strings.
+ *
+ * @details
+ * Generate two public keys based on the given private keys.
+ *
+ * @param pk Public keys
+ * @param sk Private keys
+ */
+void x25519_keygen_neon(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  uint64x2_t k[8], r[NWORDS];
+
+  conv_bytes2key_neon(k, sk);
+  mon_mul_fixbase_neon(r, k);
+  mpi29_conv_mpi292bytes_neon(pk, r);
+}
+
+
+/**
+ * @brief Shared secret computation on byte strings.
+ *
+ * @details
+ * Generate two shared secrets based on own private keys and the public keys
+ * of the other sides.
+ *
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ */
+void x25519_sharedsecret_neon(uint8_t (*ss)[32], const uint8_t (*ska)[32],
+  const uint8_t (*pkb)[32])
+{
+  uint64x2_t k[8], u[NWORDS], r[NWORDS];
+
+  conv_bytes2key_neon(k, ska);
+  mpi29_conv_bytes2mpi29_neon(u, pkb);
+  mon_mul_varbase_neon(r, k, u);
+  mpi29_conv_mpi292bytes_neon(ss, r);
+}
+
+#endif
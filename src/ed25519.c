@@ -0,0 +1,344 @@
+/**
+ *******************************************************************************
+ * @file ed25519.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of Ed25519 signatures.
+ *
+ * @details
+ * This file contains Ed25519 key generation, signing and batch verification.
+ * The hashing and the arithmetic modulo l are done for each message, the 
+ * scalar multiplications k * B of four messages are computed by 
+ * ted_mul_fixbase_ext_avx2, and the points of several groups are encoded with
+ * a single inversion. A batch of signatures is verified with one 
+ * multi-scalar multiplication.
+ *******************************************************************************
+ */
+
+#include "tedcurve.h"
+#include "ecdh.h"
+#include "ed25519.h"
+#include "sha512.h"
+#include "sc25519.h"
+#include <stdlib.h>
+#include <string.h>
+
+// l - 1, multiplying by it negates a scalar modulo l
+static const uint8_t lm1[32] = { 0xEC, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58,
+  0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14, 0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0x10 };
+
+
+/**
+ * @brief Point encoding.
+ *
+ * @details
+ * Encode the points of m groups (4*m points) as 32-byte strings, i.e. the
+ * y-coordinate y = Y/Z with the least significant bit of x = X/Z in bit 255.
+ * The inverses of all z-coordinates are computed with one inversion.
+ *
+ * @param r Encoded points (4*m strings)
+ * @param h Points of the groups
+ * @param m Number of groups
+ */
+static void ted_encode_n_avx2(uint8_t (*r)[32], const ExtPoint *h, int m)
+{
+  __m256i z[ED25519_MAXGROUPS][NWORDS], zi[ED25519_MAXGROUPS][NWORDS];
+  __m256i x[NWORDS], y[NWORDS];
+  uint8_t xb[4][32];
+  int g, l;
+
+  for (g = 0; g < m; g++) mpi29_copy_avx2(z[g], h[g].z);
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+
+  for (g = 0; g < m; g++) {
+    mpi29_gfp_mul_avx2(x, h[g].x, zi[g]);
+    mpi29_gfp_mul_avx2(y, h[g].y, zi[g]);
+    mpi29_conv_mpi292bytes_avx2(xb, x);
+    mpi29_conv_mpi292bytes_avx2(r + 4*g, y);
+    for (l = 0; l < 4; l++) r[4*g+l][31] |= (uint8_t)(xb[l][0] << 7);
+  }
+}
+
+
+/**
+ * @brief Expansion of a private key.
+ *
+ * @details
+ * Hash the seed with SHA-512, the lower half is pruned to the secret scalar
+ * a, the upper half is the prefix of the nonce derivation.
+ *
+ * @param a Secret scalar (32 bytes)
+ * @param prefix Prefix (32 bytes)
+ * @param sk Private key (32-byte seed)
+ */
+static void ed25519_expand(uint8_t *a, uint8_t *prefix, const uint8_t *sk)
+{
+  uint8_t h[64];
+
+  sha512(h, sk, 32);
+  memcpy(a, h, 32);
+  a[0]  &= 0xF8;
+  a[31] &= 0x7F;
+  a[31] |= 0x40;
+  if (prefix != NULL) memcpy(prefix, h + 32, 32);
+}
+
+
+/**
+ * @brief Key generation.
+ *
+ * @details
+ * Generate four public keys A = a * B based on the given private keys.
+ *
+ * @param pk Public keys
+ * @param sk Private keys (32-byte seeds)
+ */
+void ed25519_pubkey_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32])
+{
+  ExtPoint h;
+  __m256i k[8];
+  uint8_t a[4][32];
+  int l;
+
+  for (l = 0; l < 4; l++) ed25519_expand(a[l], NULL, sk[l]);
+  conv_bytes2key_avx2(k, (const uint8_t (*)[32])a);
+  ted_mul_fixbase_ext_avx2(&h, k);
+  ted_encode_n_avx2(pk, &h, 1);
+}
+
+
+/**
+ * @brief Signing of m groups of four messages.
+ *
+ * @details
+ * For each message, derive the nonce r = SHA-512(prefix || M) mod l, compute
+ * R = r * B four at a time, and then S = r + SHA-512(R || A || M) * a mod l.
+ * The signature is R || S.
+ *
+ * @param sig Signatures (64 bytes each)
+ * @param msg Messages (4*m pointers)
+ * @param len Lengths of the messages in bytes
+ * @param sk Private keys (32-byte seeds)
+ * @param pk Public keys of the private keys
+ * @param m Number of groups (1 <= m <= ED25519_MAXGROUPS)
+ */
+void ed25519_sign_n_avx2(uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*sk)[32], const uint8_t (*pk)[32], int m)
+{
+  ExtPoint h[ED25519_MAXGROUPS];
+  __m256i k[8];
+  uint8_t a[4*ED25519_MAXGROUPS][32], r[4*ED25519_MAXGROUPS][32];
+  uint8_t rb[4*ED25519_MAXGROUPS][32], prefix[32], d[64];
+  Sha512Ctx c;
+  int g, i;
+
+  // the secret scalars and the nonces
+  for (i = 0; i < 4*m; i++) {
+    ed25519_expand(a[i], prefix, sk[i]);
+    sha512_init(&c);
+    sha512_update(&c, prefix, 32);
+    sha512_update(&c, msg[i], len[i]);
+    sha512_final(&c, d);
+    sc25519_reduce(r[i], d);
+  }
+
+  // R = r * B of each group, a common inversion for the encoding
+  for (g = 0; g < m; g++) {
+    conv_bytes2key_avx2(k, (const uint8_t (*)[32])(r + 4*g));
+    ted_mul_fixbase_ext_avx2(&h[g], k);
+  }
+  ted_encode_n_avx2(rb, h, m);
+
+  // S = r + SHA-512(R || A || M) * a
+  for (i = 0; i < 4*m; i++) {
+    sha512_init(&c);
+    sha512_update(&c, rb[i], 32);
+    sha512_update(&c, pk[i], 32);
+    sha512_update(&c, msg[i], len[i]);
+    sha512_final(&c, d);
+    sc25519_reduce(d, d);
+    memcpy(sig[i], rb[i], 32);
+    sc25519_muladd(sig[i] + 32, d, a[i], r[i]);
+  }
+}
+
+
+/**
+ * @brief Signing of four messages.
+ *
+ * @param sig Signatures (64 bytes each)
+ * @param msg Messages (4 pointers)
+ * @param len Lengths of the messages in bytes
+ * @param sk Private keys (32-byte seeds)
+ * @param pk Public keys of the private keys
+ */
+void ed25519_sign_avx2(uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*sk)[32], const uint8_t (*pk)[32])
+{
+  ed25519_sign_n_avx2(sig, msg, len, sk, pk, 1);
+}
+
+
+/**
+ * @brief Signing of n messages.
+ *
+ * @details
+ * Sign ED25519_MAXGROUPS groups of four messages per call as long as there
+ * are enough messages, then the remaining groups, and finally the last n % 4
+ * messages padded to a full group (the padding lanes repeat the last message).
+ *
+ * @param sig Signatures (64 bytes each)
+ * @param msg Messages (n pointers)
+ * @param len Lengths of the messages in bytes
+ * @param sk Private keys (32-byte seeds)
+ * @param pk Public keys of the private keys
+ * @param n Number of messages
+ */
+void ed25519_sign_batch(uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*sk)[32], const uint8_t (*pk)[32],
+  size_t n)
+{
+  const uint8_t *tm[4];
+  uint8_t ts[4][64], tsk[4][32], tpk[4][32];
+  size_t tl[4], i, j;
+  int m;
+
+  for (i = 0; i + 4 <= n; i += 4*(size_t)m) {
+    m = (int)((n - i) / 4);
+    if (m > ED25519_MAXGROUPS) m = ED25519_MAXGROUPS;
+    ed25519_sign_n_avx2(sig + i, msg + i, len + i, sk + i, pk + i, m);
+  }
+
+  if (i < n) {
+    for (j = 0; j < 4; j++) {
+      tm[j] = msg[(i+j < n) ? i+j : n-1];
+      tl[j] = len[(i+j < n) ? i+j : n-1];
+      memcpy(tsk[j], sk[(i+j < n) ? i+j : n-1], 32);
+      memcpy(tpk[j], pk[(i+j < n) ? i+j : n-1], 32);
+    }
+    ed25519_sign_avx2(ts, tm, tl, (const uint8_t (*)[32])tsk,
+      (const uint8_t (*)[32])tpk);
+    for (j = 0; i+j < n; j++) memcpy(sig[i+j], ts[j], 64);
+  }
+}
+
+
+/**
+ * @brief Batch verification of n signatures.
+ *
+ * @details
+ * Check the cofactored equation 8*(sum z_i*S_i)*B = 8*(sum z_i*R_i + sum 
+ * z_i*k_i*A_i) with k_i = SHA-512(R_i || A_i || M_i) mod l and 128-bit 
+ * coefficients z_i. The coefficients are derived by hashing k_i and the 
+ * signatures of the whole batch, so a forged signature cannot be chosen to 
+ * cancel out. The R_i and the A_i are decoded four at a time, the 2*n terms 
+ * are summed with one multi-scalar multiplication (ted_msm_vartime_avx2) and 
+ * the term of B with the variable-time comb (ted_mul_fixbase_vartime_avx2). A 
+ * batch is rejected as a whole, the single signatures can be checked with 
+ * ed25519_verify.
+ *
+ * @param sig Signatures (64 bytes each)
+ * @param msg Messages (n pointers)
+ * @param len Lengths of the messages in bytes
+ * @param pk Public keys
+ * @param n Number of signatures
+ * @return 1 if all signatures are valid, 0 if not, -1 if out of memory
+ */
+int ed25519_verify_batch(const uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*pk)[32], size_t n)
+{
+  const uint8_t neutral[32] = { 1 };
+  const size_t nq = (n + 3) / 4;
+  ExtPoint *p, h;
+  __m256i k[8], t[NWORDS];
+  uint8_t (*s)[32], (*enc)[32], kh[64], seed[72], z[64], sb[4][32];
+  Sha512Ctx c, ck;
+  int64_t lane[4];
+  size_t i, j;
+  int valid = 1, ret;
+
+  if (n == 0) return 1;
+  p = (ExtPoint *)aligned_alloc(32, 2*nq*sizeof(ExtPoint));
+  s = (uint8_t (*)[32])calloc(8*nq, 32);
+  enc = (uint8_t (*)[32])malloc(8*nq*32);
+  if ((p == NULL) || (s == NULL) || (enc == NULL)) {
+    free(p); free(s); free(enc);
+    return -1;
+  }
+
+  // k_i (in s[4*nq+i] for now) and the seed of the coefficients
+  sha512_init(&c);
+  for (i = 0; i < n; i++) {
+    if (!sc25519_iscanonical(sig[i] + 32)) valid = 0;
+    sha512_init(&ck);
+    sha512_update(&ck, sig[i], 32);
+    sha512_update(&ck, pk[i], 32);
+    sha512_update(&ck, msg[i], len[i]);
+    sha512_final(&ck, kh);
+    sc25519_reduce(s[4*nq+i], kh);
+    sha512_update(&c, s[4*nq+i], 32);
+    sha512_update(&c, sig[i], 64);
+  }
+  sha512_final(&c, seed);
+
+  // scalars z_i of R_i, z_i*k_i of A_i and -sum z_i*S_i of B (in lane 0), 
+  // z_i is the lower half of SHA-512(seed || i)
+  memset(sb, 0, sizeof(sb));
+  for (i = 0; i < n; i++) {
+    for (j = 0; j < 8; j++) seed[64+j] = (uint8_t)((uint64_t)i >> (8*j));
+    sha512(z, seed, 72);
+    memset(z + 16, 0, 48);
+    memcpy(s[i], z, 32);
+    sc25519_muladd(s[4*nq+i], z, s[4*nq+i], sb[1]);
+    sc25519_muladd(sb[0], z, sig[i] + 32, sb[0]);
+  }
+  sc25519_muladd(sb[0], sb[0], lm1, sb[1]);
+
+  // decode R_i to p[0..nq-1] and A_i to p[nq..2*nq-1], padding is neutral
+  for (i = 0; i < 4*nq; i++) {
+    memcpy(enc[i], (i < n) ? sig[i] : neutral, 32);
+    memcpy(enc[4*nq+i], (i < n) ? pk[i] : neutral, 32);
+  }
+  for (i = 0; i < 2*nq; i++) 
+    if (ted_point_decode_vartime_avx2(&p[i], (const uint8_t (*)[32])(enc + 4*i)) != 0xF) valid = 0;
+
+  ret = 0;
+  if (valid) {
+    ret = ted_msm_vartime_avx2(&h, p, (const uint8_t (*)[32])s, (int)(2*nq));
+    if (ret == 0) {
+      // add (-sum z_i*S_i)*B (lane 0), multiply by the cofactor
+      ExtPoint q;
+      conv_bytes2key_avx2(k, (const uint8_t (*)[32])sb);
+      ted_mul_fixbase_vartime_avx2(&q, k);
+      ted_point_add_ext_avx2(&h, &h, &q);
+      for (j = 0; j < 3; j++) ted_point_dbl_avx2(&h, &h);
+      mpi29_gfp_sbc_avx2(t, h.y, h.z);
+      VSTOREU(lane, VAND(mpi29_gfp_iszero_avx2(h.x), mpi29_gfp_iszero_avx2(t)));
+      ret = (lane[0] != 0);
+    }
+  }
+
+  free(p); free(s); free(enc);
+  return ret;
+}
+
+
+/**
+ * @brief Verification of a single signature.
+ *
+ * @param sig Signature (64 bytes)
+ * @param msg Message
+ * @param len Length of the message in bytes
+ * @param pk Public key
+ * @return 1 if the signature is valid, 0 if not, -1 if out of memory
+ */
+int ed25519_verify(const uint8_t *sig, const uint8_t *msg, size_t len, 
+  const uint8_t *pk)
+{
+  return ed25519_verify_batch((const uint8_t (*)[64])sig, &msg, &len, 
+    (const uint8_t (*)[32])pk, 1);
+}
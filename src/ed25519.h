@@ -0,0 +1,45 @@
+/**
+ *******************************************************************************
+ * @file ed25519.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of Ed25519 signatures.
+ *
+ * @details
+ * This file contains function prototypes of Ed25519 (RFC 8032) key generation
+ * and signing based on the (4*1)-way fixed-base scalar multiplication on the
+ * twisted Edwards curve, and of the (batch) verification based on a 
+ * multi-scalar multiplication. The private keys are 32-byte seeds, the 
+ * messages are given by pointers and lengths. The functions require AVX2.
+ *******************************************************************************
+ */
+
+#ifndef _ED25519_H
+#define _ED25519_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// a call of ed25519_sign_n_avx2 signs m <= ED25519_MAXGROUPS groups of four
+// messages, the points of all groups share one inversion (Montgomery's trick)
+#define ED25519_MAXGROUPS 16
+
+// function prototypes
+
+void ed25519_pubkey_avx2(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+void ed25519_sign_avx2(uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*sk)[32], const uint8_t (*pk)[32]);
+void ed25519_sign_n_avx2(uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*sk)[32], const uint8_t (*pk)[32], int m);
+void ed25519_sign_batch(uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*sk)[32], const uint8_t (*pk)[32],
+  size_t n);
+int ed25519_verify(const uint8_t *sig, const uint8_t *msg, size_t len, 
+  const uint8_t *pk);
+int ed25519_verify_batch(const uint8_t (*sig)[64], const uint8_t *const *msg,
+  const size_t *len, const uint8_t (*pk)[32], size_t n);
+
+#endif
@@ -0,0 +1,336 @@
+/**
+ *******************************************************************************
+ * @file elligator.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the Elligator 2 maps on Curve25519.
+ *
+ * @details
+ * This file contains the Elligator 2 map and its inverse on 32-byte strings,
+ * four at a time, and the generation of X25519 key pairs with a
+ * representative. The map needs no inversion of its own, so the points of
+ * several groups are converted to affine with a single inversion, and the
+ * inverse map is one square root (a ratio, no inversion either). Only about
+ * half of the keys have a representative; the batch key generation keeps the
+ * lanes busy by refilling the lanes of the rejected keys with new candidates.
+ *******************************************************************************
+ */
+
+#include "moncurve.h"
+#include "ecdh.h"
+#include "elligator.h"
+#include "sha512.h"
+#include <string.h>
+
+
+/**
+ * @brief Conversion from representatives to a field element vector.
+ *
+ * @details
+ * Load four representatives and clear their two top bits (the random bits
+ * that are not part of the field element).
+ *
+ * @param r Field element
+ * @param a Four representatives
+ */
+static void conv_rep2mpi29_avx2(__m256i *r, const uint8_t (*a)[32])
+{
+  uint8_t t[4][32];
+  int j;
+
+  for (j = 0; j < 4; j++) {
+    memcpy(t[j], a[j], 32);
+    t[j][31] &= 0x3F;
+  }
+  mpi29_conv_bytes2mpi29_avx2(r, (const uint8_t (*)[32])t);
+}
+
+
+/**
+ * @brief Conversion from a field element vector to representatives.
+ *
+ * @details
+ * Store four representatives in [0, (p-1)/2] with the bits 6 and 7 of the
+ * tweak bytes as their two top bits; the strings of the lanes that are not
+ * set in the mask are cleared.
+ *
+ * @param r Four representatives
+ * @param a Field element
+ * @param tweak Tweak bytes of the four lanes
+ * @param ok Mask of the valid lanes
+ * @return Bitmask of the valid lanes (bit j for lane j)
+ */
+static int conv_mpi292rep_avx2(uint8_t (*r)[32], const __m256i *a,
+  const uint8_t *tweak, const __m256i ok)
+{
+  uint64_t w[4];
+  int j, mask = 0;
+
+  mpi29_conv_mpi292bytes_avx2(r, a);
+  VSTOREU(w, ok);
+  for (j = 0; j < 4; j++) {
+    if (w[j] & 1) mask |= 1 << j;
+    else memset(r[j], 0, 32);
+    r[j][31] |= tweak[j] & 0xC0;
+  }
+
+  return mask;
+}
+
+
+/**
+ * @brief Elligator 2 map of several calls.
+ *
+ * @details
+ * Map the m*4 representatives to the u-coordinates of their points, the
+ * z-coordinates of all m calls are inverted at once with
+ * mpi29_gfp_batchinv_avx2.
+ *
+ * @param u u-coordinates (32-byte strings)
+ * @param r Representatives (the two top bits are ignored)
+ * @param m Number of calls (1 <= m <= ELLIGATOR_MAXGROUPS)
+ */
+void elligator_map_n_avx2(uint8_t (*u)[32], const uint8_t (*r)[32], int m)
+{
+  __m256i t[NWORDS], x[ELLIGATOR_MAXGROUPS][NWORDS];
+  __m256i z[ELLIGATOR_MAXGROUPS][NWORDS], zi[ELLIGATOR_MAXGROUPS][NWORDS];
+  int i;
+
+  for (i = 0; i < m; i++) {
+    conv_rep2mpi29_avx2(t, r + 4*i);
+    mon_elligator_map_proj_avx2(x[i], z[i], t);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    mpi29_conv_mpi292bytes_avx2(u + 4*i, x[i]);
+  }
+}
+
+
+/**
+ * @brief Elligator 2 map.
+ *
+ * @details
+ * Map four representatives to the u-coordinates of their points.
+ *
+ * @param u u-coordinates (32-byte strings)
+ * @param r Representatives (the two top bits are ignored)
+ */
+void elligator_map_avx2(uint8_t (*u)[32], const uint8_t (*r)[32])
+{
+  elligator_map_n_avx2(u, r, 1);
+}
+
+
+/**
+ * @brief Elligator 2 map of n representatives.
+ *
+ * @details
+ * The full groups are mapped in calls of up to ELLIGATOR_MAXGROUPS groups,
+ * the lanes of a partial group are filled with copies of the last
+ * representative.
+ *
+ * @param u u-coordinates (32-byte strings)
+ * @param r Representatives (the two top bits are ignored)
+ * @param n Number of representatives
+ */
+void elligator_map_batch(uint8_t (*u)[32], const uint8_t (*r)[32], size_t n)
+{
+  uint8_t tu[4][32], tr[4][32];
+  size_t i, j;
+  int m;
+
+  for (i = 0; i + 4 <= n; i += 4*(size_t)m) {
+    m = (int)((n - i) / 4);
+    if (m > ELLIGATOR_MAXGROUPS) m = ELLIGATOR_MAXGROUPS;
+    elligator_map_n_avx2(u + i, r + i, m);
+  }
+
+  if (i < n) {
+    for (j = 0; j < 4; j++) memcpy(tr[j], r[(i+j < n) ? i+j : n-1], 32);
+    elligator_map_avx2(tu, (const uint8_t (*)[32])tr);
+    for (j = 0; i+j < n; j++) memcpy(u[i+j], tu[j], 32);
+  }
+}
+
+
+/**
+ * @brief Inverse Elligator 2 map.
+ *
+ * @details
+ * Compute the representatives of four u-coordinates (bit 255 is masked as in
+ * X25519). Bit 0 of the tweak byte selects which of the two representatives
+ * is returned, its bits 6 and 7 become the top bits; a u-coordinate without
+ * representative gives a string of zeros (plus the tweak bits). Constant-time
+ * in the u-coordinates and the tweaks.
+ *
+ * @param r Representatives
+ * @param u u-coordinates (32-byte strings)
+ * @param tweak Random tweak bytes of the four lanes
+ * @return Bitmask of the representable lanes (bit j for lane j)
+ */
+int elligator_rev_avx2(uint8_t (*r)[32], const uint8_t (*u)[32],
+  const uint8_t *tweak)
+{
+  __m256i x[NWORDS], t[NWORDS], b, ok;
+
+  b = VSET64(tweak[3] & 1, tweak[2] & 1, tweak[1] & 1, tweak[0] & 1);
+  mpi29_conv_bytes2mpi29_avx2(x, u);
+  ok = mon_elligator_rev_avx2(t, x, b);
+
+  return conv_mpi292rep_avx2(r, t, tweak, ok);
+}
+
+
+/**
+ * @brief Inverse Elligator 2 map of n u-coordinates.
+ *
+ * @param r Representatives
+ * @param ok Flags (1 if the u-coordinate has a representative, 0 otherwise)
+ * @param u u-coordinates (32-byte strings)
+ * @param tweak Random tweak bytes
+ * @param n Number of u-coordinates
+ * @return Number of the representable u-coordinates
+ */
+size_t elligator_rev_batch(uint8_t (*r)[32], uint8_t *ok,
+  const uint8_t (*u)[32], const uint8_t *tweak, size_t n)
+{
+  uint8_t tr[4][32], tu[4][32], tw[4];
+  size_t i, j, k, cnt = 0;
+  int mask;
+
+  for (i = 0; i < n; i += 4) {
+    for (j = 0; j < 4; j++) {
+      k = (i+j < n) ? i+j : n-1;
+      memcpy(tu[j], u[k], 32);
+      tw[j] = tweak[k];
+    }
+    mask = elligator_rev_avx2(tr, (const uint8_t (*)[32])tu, tw);
+    for (j = 0; j < 4 && i+j < n; j++) {
+      memcpy(r[i+j], tr[j], 32);
+      ok[i+j] = (uint8_t)((mask >> j) & 1);
+      cnt += ok[i+j];
+    }
+  }
+
+  return cnt;
+}
+
+
+/**
+ * @brief Key generation with representatives of several calls.
+ *
+ * @details
+ * Compute the m*4 public keys of the private keys with the fixed-base scalar
+ * multiplication (one shared inversion) and their representatives. A key
+ * without representative has ok = 0 and a cleared representative; its
+ * public key is still valid.
+ * The public keys are "dirty": the point of the 8-torsion subgroup selected
+ * by the bits 1-3 of the tweak byte is added to k * B. A key k * B alone is
+ * always in the subgroup of prime order, so the representatives would be
+ * distinguishable from random strings (map them to points and multiply by
+ * the order of the subgroup); with a uniform secret low-order point they
+ * are not. The pruned private keys are multiples of 8, so the X25519 shared
+ * secrets with a dirty key are those with the clean key.
+ *
+ * @param pk Public keys
+ * @param rep Representatives of the public keys
+ * @param ok Flags (1 if the key has a representative, 0 otherwise)
+ * @param sk Private keys
+ * @param tweak Random tweak bytes (secret, as the low-order point)
+ * @param m Number of calls (1 <= m <= ELLIGATOR_MAXGROUPS)
+ * @return Number of the keys with representative
+ */
+int elligator_keygen_n_avx2(uint8_t (*pk)[32], uint8_t (*rep)[32], uint8_t *ok,
+  const uint8_t (*sk)[32], const uint8_t *tweak, int m)
+{
+  __m256i k[8], t[NWORDS], b, c, x[ELLIGATOR_MAXGROUPS][NWORDS];
+  __m256i z[ELLIGATOR_MAXGROUPS][NWORDS], zi[ELLIGATOR_MAXGROUPS][NWORDS];
+  const uint8_t *tw;
+  int i, j, mask, cnt = 0;
+
+  for (i = 0; i < m; i++) {
+    tw = tweak + 4*i;
+    conv_bytes2key_avx2(k, sk + 4*i);
+    c = VSET64((tw[3] >> 1) & 7, (tw[2] >> 1) & 7, (tw[1] >> 1) & 7,
+      (tw[0] >> 1) & 7);
+    mon_mul_fixbase_dirty_proj_avx2(x[i], z[i], k, c);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, m);
+  for (i = 0; i < m; i++) {
+    tw = tweak + 4*i;
+    mpi29_gfp_mul_avx2(x[i], x[i], zi[i]);
+    mpi29_conv_mpi292bytes_avx2(pk + 4*i, x[i]);
+    b = VSET64(tw[3] & 1, tw[2] & 1, tw[1] & 1, tw[0] & 1);
+    mask = conv_mpi292rep_avx2(rep + 4*i, t, tw,
+      mon_elligator_rev_avx2(t, x[i], b));
+    for (j = 0; j < 4; j++) {
+      ok[4*i+j] = (uint8_t)((mask >> j) & 1);
+      cnt += ok[4*i+j];
+    }
+  }
+
+  return cnt;
+}
+
+
+/**
+ * @brief Generation of n key pairs with representatives.
+ *
+ * @details
+ * The private keys are random 32-byte seeds on input; a seed whose public key
+ * has no representative is replaced by SHA-512(seed)[0..31] until it has one,
+ * so sk holds the final private keys on output. The candidates are computed
+ * in up to 4*ELLIGATOR_MAXGROUPS lanes at once: the lanes of the accepted
+ * keys take the next seeds of the batch, the rejected keys stay in their
+ * lanes with the new candidate. A key pair has a representative with a
+ * probability of 1/2, so about two candidates are needed per key. Only the
+ * acceptance of a key, not the key itself, is leaked by the timing. The
+ * public keys are dirty (see elligator_keygen_n_avx2), a rejected key keeps
+ * its tweak byte.
+ *
+ * @param pk Public keys
+ * @param rep Representatives of the public keys
+ * @param sk Random seeds on input, private keys on output
+ * @param tweak Random tweak bytes
+ * @param n Number of key pairs
+ */
+void elligator_keygen_batch(uint8_t (*pk)[32], uint8_t (*rep)[32],
+  uint8_t (*sk)[32], const uint8_t *tweak, size_t n)
+{
+  uint8_t tsk[4*ELLIGATOR_MAXGROUPS][32], tpk[4*ELLIGATOR_MAXGROUPS][32];
+  uint8_t trep[4*ELLIGATOR_MAXGROUPS][32], tw[4*ELLIGATOR_MAXGROUPS];
+  uint8_t ok[4*ELLIGATOR_MAXGROUPS], h[64];
+  size_t pend[4*ELLIGATOR_MAXGROUPS], next = 0, k;
+  int np = 0, nq, m, j;
+
+  for (;;) {
+    // refill the free lanes
+    while (np < 4*ELLIGATOR_MAXGROUPS && next < n) pend[np++] = next++;
+    if (np == 0) break;
+    m = (np + 3) / 4;
+    for (j = 0; j < 4*m; j++) {
+      k = pend[(j < np) ? j : np-1];
+      memcpy(tsk[j], sk[k], 32);
+      tw[j] = tweak[k];
+    }
+    elligator_keygen_n_avx2(tpk, trep, ok, (const uint8_t (*)[32])tsk, tw, m);
+    // accepted keys leave, rejected keys get a new candidate
+    for (j = 0, nq = 0; j < np; j++) {
+      k = pend[j];
+      if (ok[j]) {
+        memcpy(pk[k], tpk[j], 32);
+        memcpy(rep[k], trep[j], 32);
+      } else {
+        sha512(h, sk[k], 32);
+        memcpy(sk[k], h, 32);
+        pend[nq++] = k;
+      }
+    }
+    np = nq;
+  }
+}
@@ -0,0 +1,49 @@
+/**
+ *******************************************************************************
+ * @file elligator.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the Elligator 2 maps on Curve25519.
+ *
+ * @details
+ * This file contains function prototypes of the Elligator 2 map from 32-byte
+ * representatives to X25519 public keys, of the inverse map, and of a key
+ * generation that only returns keys with a representative, so that a
+ * handshake can send uniform random strings instead of public keys. A
+ * representative is a field element in [0, (p-1)/2] in its 254 low bits, the
+ * two top bits are random (taken from the tweak byte). The functions require
+ * AVX2.
+ *******************************************************************************
+ */
+
+#ifndef _ELLIGATOR_H
+#define _ELLIGATOR_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// a call of elligator_map_n_avx2 or elligator_keygen_n_avx2 computes m <=
+// ELLIGATOR_MAXGROUPS groups of four, which share one inversion
+#define ELLIGATOR_MAXGROUPS 16
+
+// function prototypes
+
+// the tweak byte of each key: bit 0 selects one of the two representatives,
+// bits 1-3 the low-order point added to the public key by the key generation,
+// bits 6 and 7 are the top bits of the representative (bits 4 and 5 are unused)
+void elligator_map_avx2(uint8_t (*u)[32], const uint8_t (*r)[32]);
+void elligator_map_n_avx2(uint8_t (*u)[32], const uint8_t (*r)[32], int m);
+void elligator_map_batch(uint8_t (*u)[32], const uint8_t (*r)[32], size_t n);
+int elligator_rev_avx2(uint8_t (*r)[32], const uint8_t (*u)[32],
+  const uint8_t *tweak);
+size_t elligator_rev_batch(uint8_t (*r)[32], uint8_t *ok,
+  const uint8_t (*u)[32], const uint8_t *tweak, size_t n);
+int elligator_keygen_n_avx2(uint8_t (*pk)[32], uint8_t (*rep)[32], uint8_t *ok,
+  const uint8_t (*sk)[32], const uint8_t *tweak, int m);
+void elligator_keygen_batch(uint8_t (*pk)[32], uint8_t (*rep)[32],
+  uint8_t (*sk)[32], const uint8_t *tweak, size_t n);
+
+#endif
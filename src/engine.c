@@ -0,0 +1,627 @@
+/**
+ *******************************************************************************
+ * @file engine.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the multi-threaded batch engine.
+ *
+ * @details
+ * This file contains the worker threads of the engine. Each worker owns a
+ * queue per operation; it takes up to BATCH jobs of one operation at a time
+ * and computes them with the batch API of the dispatcher (full groups of 4 or
+ * 8 lanes and a planned tail). An idle worker steals half of the jobs of the
+ * fullest other queue. If a deadline is set, a queue with fewer jobs than 
+ * lanes is only served when its oldest job has waited for the deadline, so 
+ * that a lightly loaded engine coalesces the jobs into fuller batches; a single 
+ * remaining job is computed by the cheapest kernel (the portable one for the 
+ * shared secret) as planned by the dispatcher.
+ *******************************************************************************
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "engine.h"
+#include "x25519.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+// maximum number of jobs of a batch (a multiple of the lanes)
+#define BATCH 32
+// an idle worker looks for jobs to steal every IDLE_NS nanoseconds
+#define IDLE_NS 1000000L
+// buckets of the latency histogram: four per power of two nanoseconds
+#define NHIST 256
+
+// queue of jobs of one operation
+typedef struct job_queue {
+  EngineJob *head, *tail;
+  int count;    // written under the lock with atomics, steal() reads it without
+} JobQueue;
+
+// worker thread with its own queues
+typedef struct worker {
+  Engine *e;
+  int id;
+  pthread_t thread;
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  JobQueue q[2];
+  // statistics (only written by the worker)
+  uint64_t jobs, batches, stolen, busy_ns;
+  uint64_t lanes, wait_ns, wait_max;
+  uint64_t hist[NHIST];
+} Worker;
+
+struct engine {
+  int nthreads, pin;
+  int stop;                   // set by engine_free, read without the locks
+  uint64_t deadline;          // coalescing deadline in nanoseconds (0: none)
+  unsigned int next;          // round-robin queue of the next job
+  Worker *workers;
+  // completion queue and number of jobs that are not done
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+  EngineJob *head, *tail;
+  uint64_t pending;
+};
+
+
+/**
+ * @brief Current time.
+ *
+ * @return Monotonic time in nanoseconds
+ */
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec*1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+
+/**
+ * @brief Absolute time for a timed wait.
+ *
+ * @param ts Time (monotonic clock of the condition variables)
+ * @param t Time in nanoseconds
+ */
+static void ns_to_timespec(struct timespec *ts, uint64_t t)
+{
+  ts->tv_sec = (time_t)(t / 1000000000ULL);
+  ts->tv_nsec = (long)(t % 1000000000ULL);
+}
+
+
+/**
+ * @brief Bucket of the latency histogram.
+ *
+ * @details
+ * Latencies below 4 ns have their own bucket, larger latencies in [2^b, 
+ * 2^(b+1)) are split into four buckets.
+ *
+ * @param x Latency in nanoseconds
+ * @return Index of the bucket
+ */
+static int hist_bucket(uint64_t x)
+{
+  int b = 63;
+
+  if (x < 4) return (int)x;
+  while (!(x >> b)) b--;
+  return 4*b + (int)((x >> (b-2)) & 3);
+}
+
+
+/**
+ * @brief Upper bound of a bucket of the latency histogram.
+ *
+ * @param i Index of the bucket
+ * @return Latency in nanoseconds
+ */
+static double hist_bound(int i)
+{
+  if (i < 8) return (double)((i < 4) ? i+1 : 4);
+  return (double)(4 + (i & 3) + 1) * (double)(1ULL << (i/4 - 2));
+}
+
+
+/**
+ * @brief Append a job to a queue.
+ *
+ * @param q Queue
+ * @param job Job
+ */
+static void queue_push(JobQueue *q, EngineJob *job)
+{
+  job->next = NULL;
+  if (q->tail != NULL) q->tail->next = job;
+  else q->head = job;
+  q->tail = job;
+  __atomic_fetch_add(&q->count, 1, __ATOMIC_RELAXED);
+}
+
+
+/**
+ * @brief Remove up to max jobs from the head of a queue.
+ *
+ * @param jobs Removed jobs
+ * @param q Queue
+ * @param max Maximum number of jobs
+ * @return Number of removed jobs
+ */
+static int queue_take(EngineJob **jobs, JobQueue *q, int max)
+{
+  int n = 0;
+
+  while ((n < max) && (q->head != NULL)) {
+    jobs[n++] = q->head;
+    q->head = q->head->next;
+  }
+  if (q->head == NULL) q->tail = NULL;
+  __atomic_fetch_sub(&q->count, n, __ATOMIC_RELAXED);
+  return n;
+}
+
+
+/**
+ * @brief Select a queue that is ready to be served.
+ *
+ * @details
+ * A queue is ready if it has jobs for all lanes, if there is no deadline (or 
+ * the engine stops), or if its oldest job has waited for the deadline. The 
+ * fuller of the ready queues is returned. 
+ *
+ * @param wake Earliest time (ns) when a queue that is not ready gets ready
+ * @param w Worker (locked)
+ * @return Operation of the queue, or -1 if no queue is ready
+ */
+static int ready_queue(uint64_t *wake, const Worker *w)
+{
+  const Engine *e = w->e;
+  const uint64_t deadline = __atomic_load_n(&e->deadline, __ATOMIC_RELAXED);
+  const int lanes = x25519_impl()->lanes;
+  uint64_t now = 0, t;
+  int k, op = -1, ready;
+
+  *wake = UINT64_MAX;
+  for (k = 0; k < 2; k++) {
+    const JobQueue *q = &w->q[k];
+    if (q->count == 0) continue;
+    ready = (q->count >= lanes) || (deadline == 0) ||
+      __atomic_load_n(&e->stop, __ATOMIC_RELAXED);
+    if (!ready) {
+      if (now == 0) now = now_ns();
+      t = q->head->submitted + deadline;
+      ready = (t <= now);
+      if (!ready && (t < *wake)) *wake = t;
+    }
+    if (ready && ((op < 0) || (q->count > w->q[op].count))) op = k;
+  }
+  return op;
+}
+
+
+/**
+ * @brief Steal jobs from the other workers.
+ *
+ * @details
+ * Take half of the jobs (at least one, at most BATCH) of the fullest queue
+ * of the other workers.
+ *
+ * @param jobs Stolen jobs
+ * @param op Operation of the stolen jobs
+ * @param w Worker that steals
+ * @return Number of stolen jobs
+ */
+static int steal(EngineJob **jobs, int *op, Worker *w)
+{
+  Engine *e = w->e;
+  Worker *v, *victim = NULL;
+  int i, k, n = 0, best = 0;
+
+  // find the fullest queue without locking, the counts are only a hint; with
+  // a deadline, partially filled queues are left to their owner to coalesce
+  if (__atomic_load_n(&e->deadline, __ATOMIC_RELAXED) > 0) best = x25519_impl()->lanes - 1;
+  for (i = 1; i < e->nthreads; i++) {
+    v = &e->workers[(w->id+i) % e->nthreads];
+    for (k = 0; k < 2; k++) {
+      int c = __atomic_load_n(&v->q[k].count, __ATOMIC_RELAXED);
+      if (c > best) { best = c; victim = v; *op = k; }
+    }
+  }
+  if (victim == NULL) return 0;
+
+  pthread_mutex_lock(&victim->lock);
+  k = (victim->q[*op].count + 1) / 2;
+  n = queue_take(jobs, &victim->q[*op], (k < BATCH) ? k : BATCH);
+  pthread_mutex_unlock(&victim->lock);
+  return n;
+}
+
+
+/**
+ * @brief Compute a batch of jobs.
+ *
+ * @details
+ * Gather the keys of the jobs, run the batch kernel, scatter the results and
+ * complete the jobs.
+ *
+ * @param w Worker
+ * @param jobs Jobs
+ * @param n Number of jobs
+ * @param op Operation of all jobs
+ */
+static void run_batch(Worker *w, EngineJob **jobs, int n, int op)
+{
+  Engine *e = w->e;
+  uint8_t sk[BATCH][32], pk[BATCH][32], r[BATCH][32];
+  EngineJob *head = NULL, *tail = NULL;
+  uint64_t start, wait, wait_sum = 0, wait_max = 0;
+  int i;
+
+  start = now_ns();
+  for (i = 0; i < n; i++) {
+    memcpy(sk[i], jobs[i]->sk, 32);
+    if (op == ENGINE_SHAREDSECRET) memcpy(pk[i], jobs[i]->pk, 32);
+    // queueing latency from submission to the start of the batch
+    wait = (start > jobs[i]->submitted) ? start - jobs[i]->submitted : 0;
+    wait_sum += wait;
+    if (wait > wait_max) wait_max = wait;
+    __atomic_add_fetch(&w->hist[hist_bucket(wait)], 1, __ATOMIC_RELAXED);
+  }
+  __atomic_add_fetch(&w->wait_ns, wait_sum, __ATOMIC_RELAXED);
+  if (wait_max > __atomic_load_n(&w->wait_max, __ATOMIC_RELAXED))
+    __atomic_store_n(&w->wait_max, wait_max, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&w->lanes, 
+    (uint64_t)x25519_batch_lanes((size_t)n, op == ENGINE_SHAREDSECRET), __ATOMIC_RELAXED);
+
+  if (op == ENGINE_KEYGEN) x25519_keygen_batch(r, (const uint8_t (*)[32])sk, (size_t)n);
+  else x25519_sharedsecret_batch(r, (const uint8_t (*)[32])sk,
+    (const uint8_t (*)[32])pk, (size_t)n);
+  __atomic_add_fetch(&w->busy_ns, now_ns()-start, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&w->jobs, (uint64_t)n, __ATOMIC_RELAXED);
+  __atomic_add_fetch(&w->batches, 1, __ATOMIC_RELAXED);
+
+  // jobs with callback are completed directly, the others are collected
+  for (i = 0; i < n; i++) {
+    memcpy(jobs[i]->out, r[i], 32);
+    if (jobs[i]->done != NULL) jobs[i]->done(jobs[i], jobs[i]->arg);
+    else {
+      jobs[i]->next = NULL;
+      if (tail != NULL) tail->next = jobs[i];
+      else head = jobs[i];
+      tail = jobs[i];
+    }
+  }
+
+  pthread_mutex_lock(&e->lock);
+  if (head != NULL) {
+    if (e->tail != NULL) e->tail->next = head;
+    else e->head = head;
+    e->tail = tail;
+  }
+  e->pending -= (uint64_t)n;
+  pthread_cond_broadcast(&e->cond);
+  pthread_mutex_unlock(&e->lock);
+}
+
+
+/**
+ * @brief Main loop of a worker thread.
+ *
+ * @param arg Worker
+ * @return NULL
+ */
+static void *worker_main(void *arg)
+{
+  Worker *w = (Worker *)arg;
+  Engine *e = w->e;
+  EngineJob *jobs[BATCH];
+  struct timespec ts;
+  uint64_t wake;
+  int n, op;
+
+#if defined(__linux__)
+  if (e->pin) {
+    cpu_set_t set;
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    CPU_ZERO(&set);
+    CPU_SET((int)(w->id % ((ncpu > 0) ? ncpu : 1)), &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    // read the replicas of the fixed-base tables on the node of the core
+    x25519_numa_bind();
+  }
+#endif
+
+  for (;;) {
+    n = 0;
+    pthread_mutex_lock(&w->lock);
+    for (;;) {
+      op = ready_queue(&wake, w);
+      if (op >= 0) {
+        n = queue_take(jobs, &w->q[op], BATCH);
+        break;
+      }
+      if (__atomic_load_n(&e->stop, __ATOMIC_RELAXED)) break;
+      // partially filled queue: wait for more jobs or for the deadline
+      if (wake != UINT64_MAX) {
+        ns_to_timespec(&ts, wake);
+        pthread_cond_timedwait(&w->cond, &w->lock, &ts);
+        continue;
+      }
+      pthread_mutex_unlock(&w->lock);
+      n = steal(jobs, &op, w);
+      pthread_mutex_lock(&w->lock);
+      if (n > 0) {
+        __atomic_add_fetch(&w->stolen, (uint64_t)n, __ATOMIC_RELAXED);
+        break;
+      }
+      if ((w->q[0].count == 0) && (w->q[1].count == 0) && 
+          !__atomic_load_n(&e->stop, __ATOMIC_RELAXED)) {
+        ns_to_timespec(&ts, now_ns() + IDLE_NS);
+        pthread_cond_timedwait(&w->cond, &w->lock, &ts);
+      }
+    }
+    pthread_mutex_unlock(&w->lock);
+    if (n == 0) break;
+    run_batch(w, jobs, n, op);
+  }
+  return NULL;
+}
+
+
+/**
+ * @brief Create an engine.
+ *
+ * @param nthreads Number of worker threads (0: one per online CPU)
+ * @param pin Pin the i-th worker to the i-th CPU if nonzero
+ * @return Engine, or NULL if the threads cannot be created
+ */
+Engine *engine_create(int nthreads, int pin)
+{
+  Engine *e;
+  pthread_condattr_t attr;
+  int i;
+
+  if (nthreads <= 0) {
+    long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+    nthreads = (ncpu > 0) ? (int)ncpu : 1;
+  }
+  e = (Engine *)calloc(1, sizeof(Engine));
+  if (e == NULL) return NULL;
+  e->workers = (Worker *)calloc((size_t)nthreads, sizeof(Worker));
+  if (e->workers == NULL) { free(e); return NULL; }
+  e->nthreads = nthreads;
+  e->pin = pin;
+  pthread_mutex_init(&e->lock, NULL);
+  pthread_cond_init(&e->cond, NULL);
+
+  // resolve the dispatcher before any worker uses it
+  x25519_init();
+  // the timed waits of the workers use the monotonic clock of now_ns()
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  for (i = 0; i < nthreads; i++) {
+    Worker *w = &e->workers[i];
+    w->e = e;
+    w->id = i;
+    pthread_mutex_init(&w->lock, NULL);
+    pthread_cond_init(&w->cond, &attr);
+  }
+  pthread_condattr_destroy(&attr);
+  for (i = 0; i < nthreads; i++) {
+    if (pthread_create(&e->workers[i].thread, NULL, worker_main, &e->workers[i])) {
+      e->nthreads = i;
+      engine_destroy(e);
+      return NULL;
+    }
+  }
+  return e;
+}
+
+
+/**
+ * @brief Destroy an engine.
+ *
+ * @details
+ * Wait until all submitted jobs are done, then stop the worker threads. Jobs
+ * that are still in the completion queue are not touched.
+ *
+ * @param e Engine
+ */
+void engine_destroy(Engine *e)
+{
+  int i;
+
+  if (e == NULL) return;
+  engine_flush(e);
+  for (i = 0; i < e->nthreads; i++) {
+    pthread_mutex_lock(&e->workers[i].lock);
+    __atomic_store_n(&e->stop, 1, __ATOMIC_RELAXED);
+    pthread_cond_signal(&e->workers[i].cond);
+    pthread_mutex_unlock(&e->workers[i].lock);
+  }
+  for (i = 0; i < e->nthreads; i++) {
+    pthread_join(e->workers[i].thread, NULL);
+    pthread_mutex_destroy(&e->workers[i].lock);
+    pthread_cond_destroy(&e->workers[i].cond);
+  }
+  pthread_mutex_destroy(&e->lock);
+  pthread_cond_destroy(&e->cond);
+  free(e->workers);
+  free(e);
+}
+
+
+/**
+ * @brief Number of worker threads.
+ *
+ * @param e Engine
+ * @return Number of worker threads
+ */
+int engine_nthreads(const Engine *e)
+{
+  return e->nthreads;
+}
+
+
+/**
+ * @brief Submit a job.
+ *
+ * @details
+ * The jobs are distributed round-robin over the queues of the workers, in 
+ * groups of as many jobs as lanes so that each group can fill a batch. The 
+ * job must not be modified until it is done.
+ *
+ * @param e Engine
+ * @param job Job
+ */
+void engine_submit(Engine *e, EngineJob *job)
+{
+  const unsigned int lanes = (unsigned int)x25519_impl()->lanes;
+  unsigned int i = __atomic_fetch_add(&e->next, 1, __ATOMIC_RELAXED);
+  Worker *w = &e->workers[(i / lanes) % (unsigned int)e->nthreads];
+
+  pthread_mutex_lock(&e->lock);
+  e->pending++;
+  pthread_mutex_unlock(&e->lock);
+
+  job->submitted = now_ns();
+  pthread_mutex_lock(&w->lock);
+  queue_push(&w->q[job->op], job);
+  pthread_cond_signal(&w->cond);
+  pthread_mutex_unlock(&w->lock);
+}
+
+
+/**
+ * @brief Take a job from the completion queue without blocking.
+ *
+ * @param e Engine
+ * @return Finished job, or NULL if the completion queue is empty
+ */
+EngineJob *engine_poll(Engine *e)
+{
+  EngineJob *job;
+
+  pthread_mutex_lock(&e->lock);
+  job = e->head;
+  if (job != NULL) {
+    e->head = job->next;
+    if (e->head == NULL) e->tail = NULL;
+  }
+  pthread_mutex_unlock(&e->lock);
+  return job;
+}
+
+
+/**
+ * @brief Take a job from the completion queue.
+ *
+ * @details
+ * Block until a job is in the completion queue, or until no job is pending.
+ *
+ * @param e Engine
+ * @return Finished job, or NULL if no job can arrive
+ */
+EngineJob *engine_wait(Engine *e)
+{
+  EngineJob *job;
+
+  pthread_mutex_lock(&e->lock);
+  while ((e->head == NULL) && (e->pending > 0)) pthread_cond_wait(&e->cond, &e->lock);
+  job = e->head;
+  if (job != NULL) {
+    e->head = job->next;
+    if (e->head == NULL) e->tail = NULL;
+  }
+  pthread_mutex_unlock(&e->lock);
+  return job;
+}
+
+
+/**
+ * @brief Wait until all submitted jobs are done.
+ *
+ * @param e Engine
+ */
+void engine_flush(Engine *e)
+{
+  pthread_mutex_lock(&e->lock);
+  while (e->pending > 0) pthread_cond_wait(&e->cond, &e->lock);
+  pthread_mutex_unlock(&e->lock);
+}
+
+
+/**
+ * @brief Set the coalescing deadline.
+ *
+ * @details
+ * A batch with fewer jobs than lanes is only computed when its oldest job 
+ * has waited for ns nanoseconds (e.g. 20000), 0 disables the coalescing.
+ *
+ * @param e Engine
+ * @param ns Deadline in nanoseconds
+ */
+void engine_set_deadline(Engine *e, uint64_t ns)
+{
+  int i;
+
+  __atomic_store_n(&e->deadline, ns, __ATOMIC_RELAXED);
+  for (i = 0; i < e->nthreads; i++) {
+    pthread_mutex_lock(&e->workers[i].lock);
+    pthread_cond_signal(&e->workers[i].cond);
+    pthread_mutex_unlock(&e->workers[i].lock);
+  }
+}
+
+
+/**
+ * @brief Statistics of a worker thread.
+ *
+ * @param e Engine
+ * @param t Index of the worker thread, or -1 for the sum of all workers
+ * @param s Statistics
+ */
+void engine_stats(const Engine *e, int t, EngineStats *s)
+{
+  uint64_t busy = 0, lanes = 0, wait = 0, wmax = 0, hist[NHIST], c, total;
+  int i, j, first = (t < 0) ? 0 : t, last = (t < 0) ? e->nthreads-1 : t;
+
+  memset(s, 0, sizeof(EngineStats));
+  memset(hist, 0, sizeof(hist));
+  for (i = first; i <= last; i++) {
+    const Worker *w = &e->workers[i];
+    s->jobs += __atomic_load_n(&w->jobs, __ATOMIC_RELAXED);
+    s->batches += __atomic_load_n(&w->batches, __ATOMIC_RELAXED);
+    s->stolen += __atomic_load_n(&w->stolen, __ATOMIC_RELAXED);
+    busy += __atomic_load_n(&w->busy_ns, __ATOMIC_RELAXED);
+    lanes += __atomic_load_n(&w->lanes, __ATOMIC_RELAXED);
+    wait += __atomic_load_n(&w->wait_ns, __ATOMIC_RELAXED);
+    c = __atomic_load_n(&w->wait_max, __ATOMIC_RELAXED);
+    if (c > wmax) wmax = c;
+    for (j = 0; j < NHIST; j++) hist[j] += __atomic_load_n(&w->hist[j], __ATOMIC_RELAXED);
+  }
+
+  s->busy = 1e-9*(double)busy;
+  s->throughput = (busy > 0) ? 1e9*(double)s->jobs/(double)busy : 0.0;
+  s->fill = (lanes > 0) ? (double)s->jobs/(double)lanes : 0.0;
+  s->wait_avg = (s->jobs > 0) ? 1e-3*(double)wait/(double)s->jobs : 0.0;
+  s->wait_max = 1e-3*(double)wmax;
+  // smallest bucket bound below which at least 99% of the jobs are
+  for (j = 0, total = 0; j < NHIST; j++) total += hist[j];
+  for (j = 0, c = 0; (j < NHIST) && (total > 0); j++) {
+    c += hist[j];
+    if (100*c >= 99*total) { s->wait_p99 = 1e-3*hist_bound(j); break; }
+  }
+}
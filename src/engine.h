@@ -0,0 +1,74 @@
+/**
+ *******************************************************************************
+ * @file engine.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the multi-threaded batch engine.
+ *
+ * @details
+ * This file defines the job and statistics structs and contains function
+ * prototypes of the engine. Jobs are submitted to per-worker queues, every
+ * worker (pinned to a core) groups the jobs of its queue into batches for the
+ * SIMD kernels and steals jobs from the other queues when its own is empty.
+ * A finished job is either passed to its callback or put into the completion
+ * queue of the engine. With a deadline, a worker that has fewer jobs than 
+ * lanes waits until the oldest job is as old as the deadline before it 
+ * computes a partially filled batch.
+ *******************************************************************************
+ */
+
+#ifndef _ENGINE_H
+#define _ENGINE_H
+
+#include <stdint.h>
+
+// operations of a job
+#define ENGINE_KEYGEN       0
+#define ENGINE_SHAREDSECRET 1
+
+// a keygen or shared-secret job, the key buffers must stay valid until done
+typedef struct engine_job {
+  int op;                 // ENGINE_KEYGEN or ENGINE_SHAREDSECRET
+  const uint8_t *sk;      // own private key (32 bytes)
+  const uint8_t *pk;      // public key of the other side (shared secret only)
+  uint8_t *out;           // public key or shared secret (32 bytes)
+  // called by the worker thread when the job is done, if NULL the job is put
+  // into the completion queue (see engine_poll and engine_wait)
+  void (*done)(struct engine_job *job, void *arg);
+  void *arg;
+  struct engine_job *next;  // internal
+  uint64_t submitted;       // internal (submission time in nanoseconds)
+} EngineJob;
+
+// statistics of a worker thread
+typedef struct engine_stats {
+  uint64_t jobs;          // number of finished jobs
+  uint64_t batches;       // number of batches
+  uint64_t stolen;        // number of jobs stolen from other workers
+  double busy;            // seconds spent in the kernels
+  double throughput;      // jobs per busy second
+  // coalescing: used / computed lanes and the time from submission to batch
+  double fill;            // lane-fill ratio in (0, 1]
+  double wait_avg;        // average queueing latency in microseconds
+  double wait_p99;        // 99th percentile (upper bound) in microseconds
+  double wait_max;        // maximum queueing latency in microseconds
+} EngineStats;
+
+typedef struct engine Engine;
+
+// function prototypes
+
+Engine *engine_create(int nthreads, int pin);
+void engine_destroy(Engine *e);
+int engine_nthreads(const Engine *e);
+void engine_submit(Engine *e, EngineJob *job);
+EngineJob *engine_poll(Engine *e);
+EngineJob *engine_wait(Engine *e);
+void engine_flush(Engine *e);
+void engine_set_deadline(Engine *e, uint64_t ns);
+void engine_stats(const Engine *e, int t, EngineStats *s);
+
+#endif
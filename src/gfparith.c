@@ -19,6 +19,8 @@
  */
 
 #include "gfparith.h"
+#include "gfpinline.h"
+#include "prof.h"
 
 
 /**
@@ -85,21 +87,7 @@ void mpi29_cswap_avx2(__m256i *r, __m256i *a, const __m256i b)
  */
 void mpi29_gfp_add_avx2(__m256i *r, const __m256i *a, const __m256i *b)
 {
-  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
-  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
-  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
-  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
-  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
-  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
-  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
-
-  r0 = VADD(a0, b0); r1 = VADD(a1, b1); r2 = VADD(a2, b2);
-  r3 = VADD(a3, b3); r4 = VADD(a4, b4); r5 = VADD(a5, b5);
-  r6 = VADD(a6, b6); r7 = VADD(a7, b7); r8 = VADD(a8, b8);
-
-  r[0] = r0; r[1] = r1; r[2] = r2; 
-  r[3] = r3; r[4] = r4; r[5] = r5;
-  r[6] = r6; r[7] = r7; r[8] = r8;
+  mpi29_gfp_add_inl_avx2(r, a, b);
 }
 
 
@@ -118,30 +106,7 @@ void mpi29_gfp_add_avx2(__m256i *r, const __m256i *a, const __m256i *b)
  */
 void mpi29_gfp_sub_avx2(__m256i *r, const __m256i *a, const __m256i *b)
 {
-  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
-  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
-  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
-  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
-  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
-  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
-  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
-  const __m256i VDLSWP = VSET164(LSWP29*2);
-  const __m256i VDWRDP = VSET164(MASK29*2);
-
-  // NOTE: if put (a[i]-b[i]) at the latter position, it is faster.
-  r0 = VADD(VDLSWP, VSUB(a0, b0));
-  r1 = VADD(VDWRDP, VSUB(a1, b1));
-  r2 = VADD(VDWRDP, VSUB(a2, b2));
-  r3 = VADD(VDWRDP, VSUB(a3, b3));
-  r4 = VADD(VDWRDP, VSUB(a4, b4));
-  r5 = VADD(VDWRDP, VSUB(a5, b5));
-  r6 = VADD(VDWRDP, VSUB(a6, b6));
-  r7 = VADD(VDWRDP, VSUB(a7, b7));
-  r8 = VADD(VDWRDP, VSUB(a8, b8));
-
-  r[0] = r0; r[1] = r1; r[2] = r2; 
-  r[3] = r3; r[4] = r4; r[5] = r5;
-  r[6] = r6; r[7] = r7; r[8] = r8;
+  mpi29_gfp_sub_inl_avx2(r, a, b);
 }
 
 
@@ -159,49 +124,29 @@ void mpi29_gfp_sub_avx2(__m256i *r, const __m256i *a, const __m256i *b)
  */
 void mpi29_gfp_sbc_avx2(__m256i *r, const __m256i *a, const __m256i *b)
 {
-  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
-  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
-  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
-  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
-  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
-  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
-  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8, temp;
-  const __m256i VDLSWP  = VSET164(LSWP29*2);
-  const __m256i VDWRDP  = VSET164(MASK29*2);
-  const __m256i VMASK29 = VSET164(MASK29);
-  const __m256i VCONSTC = VSET164(CONSTC);
-
-  // subtraction loop
-  // NOTE: if put (a[i]-b[i]) at the latter position, it is faster.
-  r0 = VADD(VDLSWP, VSUB(a0, b0));
-  r1 = VADD(VDWRDP, VSUB(a1, b1));
-  r2 = VADD(VDWRDP, VSUB(a2, b2));
-  r3 = VADD(VDWRDP, VSUB(a3, b3));
-  r4 = VADD(VDWRDP, VSUB(a4, b4));
-  r5 = VADD(VDWRDP, VSUB(a5, b5));
-  r6 = VADD(VDWRDP, VSUB(a6, b6));
-  r7 = VADD(VDWRDP, VSUB(a7, b7));
-  r8 = VADD(VDWRDP, VSUB(a8, b8));
-
-  // carry propagation loop
-  r1 = VADD(r1, VSHR(r0, BITS29)); r0 = VAND(r0, VMASK29);
-  r2 = VADD(r2, VSHR(r1, BITS29)); r1 = VAND(r1, VMASK29);
-  r3 = VADD(r3, VSHR(r2, BITS29)); r2 = VAND(r2, VMASK29);
-  r4 = VADD(r4, VSHR(r3, BITS29)); r3 = VAND(r3, VMASK29);
-  r5 = VADD(r5, VSHR(r4, BITS29)); r4 = VAND(r4, VMASK29);
-  r6 = VADD(r6, VSHR(r5, BITS29)); r5 = VAND(r5, VMASK29);
-  r7 = VADD(r7, VSHR(r6, BITS29)); r6 = VAND(r6, VMASK29);
-  r8 = VADD(r8, VSHR(r7, BITS29)); r7 = VAND(r7, VMASK29);
-
-  // the final step to compute r0 and r8
-  temp = VSHR(r8, BITS29); 
-  temp = VMUL(temp, VCONSTC);
-  r0   = VADD(r0, temp); 
-  r8   = VAND(r8, VMASK29);
+  mpi29_gfp_sbc_inl_avx2(r, a, b);
+}
 
-  r[0] = r0; r[1] = r1; r[2] = r2; 
-  r[3] = r3; r[4] = r4; r[5] = r5;
-  r[6] = r6; r[7] = r7; r[8] = r8;
+
+/**
+ * @brief Field subtraction (with a parallel carry propagation).
+ *
+ * @details
+ * r = 2p + a - b mod p.
+ * The same subtraction as mpi29_gfp_sbc_avx2, but the carries of all limbs are
+ * propagated at once (one round) instead of from the least to the most 
+ * significant limb. This has the same number of instructions and a much 
+ * shorter dependency chain. For a < 2^31 and a reduced b, the limbs of r are 
+ * below 2^29+2^3 (the first below 2^29+2^13), which is enough for any operand 
+ * of a multiplication, see gfparith.h.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_sbp_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  mpi29_gfp_sbp_inl_avx2(r, a, b);
 }
 
 
@@ -210,8 +155,7 @@ void mpi29_gfp_sbc_avx2(__m256i *r, const __m256i *a, const __m256i *b)
  *
  * @details
  * r = a * b mod p.
- * This is a modular multiplication. It performs a product-scanning and modulo-p 
- * reduction separately. It uses local variables to store intermediate values.  
+ * The multiplication that is selected by GFP_MUL, see gfparith.h.
  * 
  * @param r Field element
  * @param a Field element
@@ -219,128 +163,46 @@ void mpi29_gfp_sbc_avx2(__m256i *r, const __m256i *a, const __m256i *b)
  */
 void mpi29_gfp_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b)
 {
-  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
-  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
-  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
-  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
-  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
-  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
-  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
-  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, accu;
-  const __m256i VMASK29 = VSET164(MASK29);
-  const __m256i VCONSTC = VSET164(CONSTC);
-
-  // 1st loop of the product-scanning multiplication
-  t0 = VMUL(    a0, b0);
-
-  t1 = VMUL(    a0, b1); t1 = VMAC(t1, a1, b0);
-
-  t2 = VMUL(    a0, b2); t2 = VMAC(t2, a1, b1); t2 = VMAC(t2, a2, b0);
-
-  t3 = VMUL(    a0, b3); t3 = VMAC(t3, a1, b2); t3 = VMAC(t3, a2, b1);
-  t3 = VMAC(t3, a3, b0);
-
-  t4 = VMUL(    a0, b4); t4 = VMAC(t4, a1, b3); t4 = VMAC(t4, a2, b2);
-  t4 = VMAC(t4, a3, b1); t4 = VMAC(t4, a4, b0);
-
-  t5 = VMUL(    a0, b5); t5 = VMAC(t5, a1, b4); t5 = VMAC(t5, a2, b3);
-  t5 = VMAC(t5, a3, b2); t5 = VMAC(t5, a4, b1); t5 = VMAC(t5, a5, b0);
-
-  t6 = VMUL(    a0, b6); t6 = VMAC(t6, a1, b5); t6 = VMAC(t6, a2, b4);
-  t6 = VMAC(t6, a3, b3); t6 = VMAC(t6, a4, b2); t6 = VMAC(t6, a5, b1);
-  t6 = VMAC(t6, a6, b0);
-
-  t7 = VMUL(    a0, b7); t7 = VMAC(t7, a1, b6); t7 = VMAC(t7, a2, b5);
-  t7 = VMAC(t7, a3, b4); t7 = VMAC(t7, a4, b3); t7 = VMAC(t7, a5, b2);
-  t7 = VMAC(t7, a6, b1); t7 = VMAC(t7, a7, b0);
-
-  t8 = VMUL(    a0, b8); t8 = VMAC(t8, a1, b7); t8 = VMAC(t8, a2, b6);
-  t8 = VMAC(t8, a3, b5); t8 = VMAC(t8, a4, b4); t8 = VMAC(t8, a5, b3);
-  t8 = VMAC(t8, a6, b2); t8 = VMAC(t8, a7, b1); t8 = VMAC(t8, a8, b0);
-
-  accu = VSHR(t8, BITS29);
-  t8   = VAND(t8, VMASK29);
-
-  // 2nd loop of the product-scanning multiplication
-  accu = VMAC(accu, a1, b8); accu = VMAC(accu, a2, b7);
-  accu = VMAC(accu, a3, b6); accu = VMAC(accu, a4, b5);
-  accu = VMAC(accu, a5, b4); accu = VMAC(accu, a6, b3);
-  accu = VMAC(accu, a7, b2); accu = VMAC(accu, a8, b1);
-  r0   = VAND(accu, VMASK29); 
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a2, b8); accu = VMAC(accu, a3, b7);
-  accu = VMAC(accu, a4, b6); accu = VMAC(accu, a5, b5);
-  accu = VMAC(accu, a6, b4); accu = VMAC(accu, a7, b3);
-  accu = VMAC(accu, a8, b2);
-  r1   = VAND(accu, VMASK29);
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a3, b8); accu = VMAC(accu, a4, b7);
-  accu = VMAC(accu, a5, b6); accu = VMAC(accu, a6, b5);
-  accu = VMAC(accu, a7, b4); accu = VMAC(accu, a8, b3);
-  r2   = VAND(accu, VMASK29);
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a4, b8); accu = VMAC(accu, a5, b7);
-  accu = VMAC(accu, a6, b6); accu = VMAC(accu, a7, b5);
-  accu = VMAC(accu, a8, b4);
-  r3   = VAND(accu, VMASK29);
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a5, b8); accu = VMAC(accu, a6, b7);
-  accu = VMAC(accu, a7, b6); accu = VMAC(accu, a8, b5);
-  r4   = VAND(accu, VMASK29);
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a6, b8); accu = VMAC(accu, a7, b7);
-  accu = VMAC(accu, a8, b6);
-  r5   = VAND(accu, VMASK29);
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a7, b8); accu = VMAC(accu, a8, b7);
-  r6   = VAND(accu, VMASK29);
-  accu = VSHR(accu, BITS29);
-
-  accu = VMAC(accu, a8, b8);
-  r7   = VAND(accu, VMASK29);
-
-  r8   = VSHR(accu, BITS29);
-
-  // modulo-p reduction and conversion to 29-bit limbs
-  accu = VMAC(t0, r0, VCONSTC);
-  r0   = VAND(accu, VMASK29);
-
-  accu = VADD(t1, VSHR(accu, BITS29)); accu = VMAC(accu, r1, VCONSTC);
-  r1   = VAND(accu, VMASK29);
-
-  accu = VADD(t2, VSHR(accu, BITS29)); accu = VMAC(accu, r2, VCONSTC);
-  r2   = VAND(accu, VMASK29);
-
-  accu = VADD(t3, VSHR(accu, BITS29)); accu = VMAC(accu, r3, VCONSTC);
-  r3   = VAND(accu, VMASK29);
-
-  accu = VADD(t4, VSHR(accu, BITS29)); accu = VMAC(accu, r4, VCONSTC);
-  r4   = VAND(accu, VMASK29);
-
-  accu = VADD(t5, VSHR(accu, BITS29)); accu = VMAC(accu, r5, VCONSTC);
-  r5   = VAND(accu, VMASK29);
-
-  accu = VADD(t6, VSHR(accu, BITS29)); accu = VMAC(accu, r6, VCONSTC);
-  r6   = VAND(accu, VMASK29);
+  mpi29_gfp_mul_inl_avx2(r, a, b);
+}
 
-  accu = VADD(t7, VSHR(accu, BITS29)); accu = VMAC(accu, r7, VCONSTC);
-  r7   = VAND(accu, VMASK29);
 
-  accu = VADD(t8, VSHR(accu, BITS29)); accu = VMAC(accu, r8, VCONSTC);
-  r8   = VAND(accu, VMASK29);
+/**
+ * @brief Field multiplication (product scanning).
+ *
+ * @details
+ * r = a * b mod p.
+ * This is a modular multiplication. It performs a product-scanning and modulo-p 
+ * reduction separately. It uses local variables to store intermediate values.  
+ * 
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_mul_ps_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  mpi29_gfp_mul_ps_inl_avx2(r, a, b);
+}
 
-  accu = VSHR(accu, BITS29);
-  r0   = VMAC(r0, accu, VCONSTC);
 
-  r[0] = r0; r[1] = r1; r[2] = r2; 
-  r[3] = r3; r[4] = r4; r[5] = r5;
-  r[6] = r6; r[7] = r7; r[8] = r8;
+/**
+ * @brief Field multiplication (one-level Karatsuba).
+ *
+ * @details
+ * r = a * b mod p.
+ * The operands are split into the limbs 0 to 4 and 5 to 8, the three half 
+ * products take 25+16+25 instead of 81 multiplications. The middle columns 
+ * are computed modulo 2^64, which is exact since they are the cross products
+ * of the product scanning. The reduction is the one of the product scanning.
+ * The limbs of a and b must be below 2^31.
+ * 
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_mul_kara_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  mpi29_gfp_mul_kara_inl_avx2(r, a, b);
 }
 
 
@@ -357,31 +219,7 @@ void mpi29_gfp_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b)
  */
 void mpi29_gfp_mul29_avx2(__m256i *r, const __m256i *a, const uint32_t b)
 {
-  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
-  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
-  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
-  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8, accu;
-  const __m256i vb = VSET164(b);
-  const __m256i VMASK29 = VSET164(MASK29);
-  const __m256i VCONSTC = VSET164(CONSTC);
-
-  accu = VMUL(a0, vb); r0 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a1, vb); r1 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a2, vb); r2 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a3, vb); r3 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a4, vb); r4 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a5, vb); r5 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a6, vb); r6 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a7, vb); r7 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
-  accu = VMAC(accu, a8, vb); r8 = VAND(accu, VMASK29); 
-
-  accu = VMUL(VCONSTC, VSHR(accu, BITS29));
-  r0   = VADD(r0, VAND(accu, VMASK29));
-  r1   = VADD(r1, VSHR(accu, BITS29));
-
-  r[0] = r0; r[1] = r1; r[2] = r2; 
-  r[3] = r3; r[4] = r4; r[5] = r5;
-  r[6] = r6; r[7] = r7; r[8] = r8;
+  mpi29_gfp_mul29_inl_avx2(r, a, b);
 }
 
 
@@ -390,132 +228,333 @@ void mpi29_gfp_mul29_avx2(__m256i *r, const __m256i *a, const uint32_t b)
  *
  * @details
  * r = a^2 mod p.
- * This is a modular squaring. It performs a product-scanning and modulo-p 
- * reduction separately. It uses local variables to store intermediate values.  
+ * The squaring that is selected by GFP_SQR, see gfparith.h.
  * 
  * @param r Field element
  * @param a Field element
  */
 void mpi29_gfp_sqr_avx2(__m256i *r, const __m256i *a)
 {
-  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
-  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
-  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
-  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
-  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, accu, temp;
-  const __m256i VMASK29 = VSET164(MASK29);
-  const __m256i VCONSTC = VSET164(CONSTC);
-
-  // 1st loop of the product-scanning squaring
-  t0   = VMUL(a0, a0);
-
-  accu = VMUL(a0, a1); 
-  t1   = VSHL(accu, 1);
-
-  accu = VMUL(a0, a2); 
-  t2   = VSHL(accu, 1); t2 = VMAC(t2, a1, a1);
-
-  accu = VMUL(a0, a3); 
-  accu = VMAC(accu, a1, a2); 
-  t3   = VSHL(accu, 1);
-
-  accu = VMUL(a0, a4); accu = VMAC(accu, a1, a3);
-  t4   = VSHL(accu, 1); t4  = VMAC(t4, a2, a2);
-
-  accu = VMUL(a0, a5); accu = VMAC(accu, a1, a4); accu = VMAC(accu, a2, a3);
-  t5   = VSHL(accu, 1);
-
-  accu = VMUL(a0, a6); accu = VMAC(accu, a1, a5); accu = VMAC(accu, a2, a4);
-  t6   = VSHL(accu, 1); t6  = VMAC(t6, a3, a3);
-
-  accu = VMUL(a0, a7); accu = VMAC(accu, a1, a6); accu = VMAC(accu, a2, a5);
-  accu = VMAC(accu, a3, a4);
-  t7   = VSHL(accu, 1);
-
-  accu = VMUL(a0, a8); accu = VMAC(accu, a1, a7); accu = VMAC(accu, a2, a6);
-  accu = VMAC(accu, a3, a5);
-  t8   = VSHL(accu, 1); t8  = VMAC(t8, a4, a4);
-
-  temp = VSHR(t8, BITS29); t8 = VAND(t8, VMASK29);
+  mpi29_gfp_sqr_inl_avx2(r, a);
+}
 
-  // 2nd loop of the product-scanning squaring
-  accu = VMUL(a1, a8); accu = VMAC(accu, a2, a7); accu = VMAC(accu, a3, a6);
-  accu = VMAC(accu, a4, a5);
-  temp = VADD(temp, VSHL(accu, 1));
-  r0   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
 
-  accu = VMUL(a2, a8); accu = VMAC(accu, a3, a7); accu = VMAC(accu, a4, a6);
-  temp = VADD(temp, VSHL(accu, 1));
-  temp = VMAC(temp, a5, a5);
-  r1   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
+/**
+ * @brief Field squaring (product scanning).
+ *
+ * @details
+ * r = a^2 mod p.
+ * This is a modular squaring. It performs a product-scanning and modulo-p 
+ * reduction separately. It uses local variables to store intermediate values.  
+ * 
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_sqr_ps_avx2(__m256i *r, const __m256i *a)
+{
+  mpi29_gfp_sqr_ps_inl_avx2(r, a);
+}
 
-  accu = VMUL(a3, a8); accu = VMAC(accu, a4, a7); accu = VMAC(accu, a5, a6);
-  temp = VADD(temp, VSHL(accu, 1));
-  r2   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
 
-  accu = VMUL(a4, a8); accu = VMAC(accu, a5, a7);
-  temp = VADD(temp, VSHL(accu, 1));
-  temp = VMAC(temp, a6, a6);
-  r3   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
+/**
+ * @brief Field squaring (pre-doubled limbs).
+ *
+ * @details
+ * r = a^2 mod p.
+ * The product scanning of mpi29_gfp_sqr_ps_avx2, but the cross products are 
+ * taken with the doubled limbs 2*a[1], ..., 2*a[8] (8 additions) instead of 
+ * shifting the sums of the cross products of each column (16 shifts). The 
+ * limbs of a must be below 2^31.
+ * 
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_sqr_dbl_avx2(__m256i *r, const __m256i *a)
+{
+  mpi29_gfp_sqr_dbl_inl_avx2(r, a);
+}
 
-  accu = VMUL(a5, a8); accu = VMAC(accu, a6, a7);
-  temp = VADD(temp, VSHL(accu, 1));
-  r4   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
 
-  accu = VMUL(a6, a8);
-  temp = VADD(temp, VSHL(accu, 1));
-  temp = VMAC(temp, a7, a7);
-  r5   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
+/**
+ * @brief Field multiplicative inversion (Fermat).
+ *
+ * @details
+ * r = a^-1 = a^(p-2) mod p.
+ * This function computes the multiplicative inverse of an element with an 
+ * addition chain of 254 squarings and 11 multiplications.
+ * 
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_inv_fermat_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS];
+  int i;
 
-  accu = VMUL(a7, a8);
-  temp = VADD(temp, VSHL(accu, 1));
-  r6   = VAND(temp, VMASK29);
-  temp = VSHR(temp, BITS29);
+  mpi29_gfp_sqr_avx2(t0, a);
+  mpi29_gfp_sqr_avx2(t1, t0);
+  mpi29_gfp_sqr_avx2(t1, t1);
+  mpi29_gfp_mul_avx2(t1, a, t1);
+  mpi29_gfp_mul_avx2(t0, t0, t1);
+  mpi29_gfp_sqr_avx2(t2, t0);
+  mpi29_gfp_mul_avx2(t1, t1, t2);
+  mpi29_gfp_sqr_avx2(t2, t1);
+  for (i = 0; i < 4; i++) mpi29_gfp_sqr_avx2(t2, t2);
+  mpi29_gfp_mul_avx2(t1, t2, t1);
+  mpi29_gfp_sqr_avx2(t2, t1);
+  for (i = 0; i < 9; i++) mpi29_gfp_sqr_avx2(t2, t2);
+  mpi29_gfp_mul_avx2(t2, t2, t1);
+  mpi29_gfp_sqr_avx2(t3, t2);
+  for (i = 0; i < 19; i++) mpi29_gfp_sqr_avx2(t3, t3);   
+  mpi29_gfp_mul_avx2(t2, t3, t2);
+  mpi29_gfp_sqr_avx2(t2, t2);
+  for (i = 0; i < 9; i++) mpi29_gfp_sqr_avx2(t2, t2);
+  mpi29_gfp_mul_avx2(t1, t2, t1);
+  mpi29_gfp_sqr_avx2(t2, t1);
+  for (i = 0; i < 49; i++) mpi29_gfp_sqr_avx2(t2, t2);
+  mpi29_gfp_mul_avx2(t2, t2, t1);
+  mpi29_gfp_sqr_avx2(t3, t2);
+  for (i = 0; i < 99; i++) mpi29_gfp_sqr_avx2(t3, t3);
+  mpi29_gfp_mul_avx2(t2, t3, t2);
+  mpi29_gfp_sqr_avx2(t2, t2);
+  for (i = 0; i < 49; i++) mpi29_gfp_sqr_avx2(t2, t2);
+  mpi29_gfp_mul_avx2(t1, t2, t1);
+  mpi29_gfp_sqr_avx2(t1, t1);
+  for (i = 0; i < 4; i++) mpi29_gfp_sqr_avx2(t1, t1);
+  mpi29_gfp_mul_avx2(r, t1, t0);
+}
 
-  temp = VMAC(temp, a8, a8);
-  r7   = VAND(temp, VMASK29);
-  r8   = VSHR(temp, BITS29);
+// safegcd inversion: signed 30-bit limbs, 9 of them for the integers f, g, d 
+// and e of the algorithm (the last limb is signed and holds the rest), in the
+// 64-bit lanes; p = 2^255-19 = [2^30-19, 2^30-1, ..., 2^30-1, 2^15-1]
+#define MASK30 0x3FFFFFFFUL
+#define LSWP30 0x3FFFFFEDUL
+#define MSWP30 0x7FFFUL
+// p^-1 mod 2^30
+#define PINV30 0x179435E5UL
+// arithmetic right shift of the 64-bit lanes (AVX2 has no VPSRAQ)
+#define VSRA64(X, N) VOR(VSHR(X, N), VSHL(_mm256_cmpgt_epi64(VZERO, X), 64-(N)))
 
-  // modulo reduction and conversion to 29-bit limbs
-  accu = VADD(t0, VMUL(r0, VCONSTC));
-  r0   = VAND(accu, VMASK29);
 
-  accu = VADD(t1, VSHR(accu, BITS29)); accu = VMAC(accu, r1, VCONSTC);
-  r1   = VAND(accu, VMASK29);
+/**
+ * @brief 30 divsteps of the safegcd inversion.
+ *
+ * @details
+ * Constant-time divsteps on the low 30 bits of f and g (as in the modinv32 of
+ * libsecp256k1, with zeta = -(delta+1/2)), the transition matrix t = [u, v, 
+ * q, r] is scaled by 2^30: (f', g') = (u*f + v*g, q*f + r*g)/2^30.
+ *
+ * @param t Transition matrix
+ * @param zeta Zeta
+ * @param f Low limb of f
+ * @param g Low limb of g
+ * @return New zeta
+ */
+static __m256i mpi30_divsteps_avx2(__m256i *t, __m256i zeta, __m256i f, __m256i g)
+{
+  __m256i u = VSET164(1), v = VZERO, q = VZERO, r = VSET164(1);
+  __m256i c1, c2, x, y, z;
+  const __m256i one = VSET164(1);
+  int i;
 
-  accu = VADD(t2, VSHR(accu, BITS29)); accu = VMAC(accu, r2, VCONSTC);
-  r2   = VAND(accu, VMASK29);
+  for (i = 0; i < 30; i++) {
+    // c1 = zeta < 0, c2 = g is odd
+    c1 = _mm256_cmpgt_epi64(VZERO, zeta);
+    c2 = VSUB(VZERO, VAND(g, one));
+    // (x, y, z) = (f, u, v), negated if zeta < 0
+    x = VSUB(VXOR(f, c1), c1);
+    y = VSUB(VXOR(u, c1), c1);
+    z = VSUB(VXOR(v, c1), c1);
+    // add them to (g, q, r) if g is odd
+    g = VADD(g, VAND(x, c2));
+    q = VADD(q, VAND(y, c2));
+    r = VADD(r, VAND(z, c2));
+    // if zeta < 0 and g was odd: zeta = -zeta-2 and (f, u, v) += (g, q, r)
+    c1 = VAND(c1, c2);
+    zeta = VSUB(VXOR(zeta, c1), one);
+    f = VADD(f, VAND(g, c1));
+    u = VADD(u, VAND(q, c1));
+    v = VADD(v, VAND(r, c1));
+    // g is even now
+    g = VSHR(g, 1);
+    u = VSHL(u, 1);
+    v = VSHL(v, 1);
+  }
+
+  t[0] = u; t[1] = v; t[2] = q; t[3] = r;
+  return zeta;
+}
 
-  accu = VADD(t3, VSHR(accu, BITS29)); accu = VMAC(accu, r3, VCONSTC);
-  r3   = VAND(accu, VMASK29);
 
-  accu = VADD(t4, VSHR(accu, BITS29)); accu = VMAC(accu, r4, VCONSTC);
-  r4   = VAND(accu, VMASK29);
+/**
+ * @brief Apply a transition matrix to d and e of the safegcd inversion.
+ *
+ * @details
+ * (d, e) = (u*d + v*e, q*d + r*e)/2^30 mod p, for d and e in (-2p, p); the 
+ * multiples of p that make the sums divisible by 2^30 are added in the same
+ * pass, and p is added to d and e in advance if they are negative, so they 
+ * stay in (-2p, p). |u|+|v| and |q|+|r| are at most 2^30, so the factors m
+ * of p fit into signed 32 bits, which is what VPMULDQ takes.
+ *
+ * @param d Element d (signed 30-bit limbs)
+ * @param e Element e (signed 30-bit limbs)
+ * @param t Transition matrix
+ */
+static void mpi30_update_de_avx2(__m256i *d, __m256i *e, const __m256i *t)
+{
+  const __m256i u = t[0], v = t[1], q = t[2], r = t[3];
+  const __m256i VMASK30 = VSET164(MASK30), VPINV30 = VSET164(PINV30);
+  const __m256i VLSWP30 = VSET164(LSWP30), VMSWP30 = VSET164(MSWP30);
+  __m256i sd, se, md, me, cd, ce, mp;
+  int i;
 
-  accu = VADD(t5, VSHR(accu, BITS29)); accu = VMAC(accu, r5, VCONSTC);
-  r5   = VAND(accu, VMASK29);
+  sd = _mm256_cmpgt_epi64(VZERO, d[8]);
+  se = _mm256_cmpgt_epi64(VZERO, e[8]);
+  md = VADD(VAND(u, sd), VAND(v, se));
+  me = VADD(VAND(q, sd), VAND(r, se));
+  cd = VADD(_mm256_mul_epi32(u, d[0]), _mm256_mul_epi32(v, e[0]));
+  ce = VADD(_mm256_mul_epi32(q, d[0]), _mm256_mul_epi32(r, e[0]));
+  // make the low 30 bits of cd + md*p and ce + me*p zero
+  md = VSUB(md, VAND(VADD(VMUL(VPINV30, cd), md), VMASK30));
+  me = VSUB(me, VAND(VADD(VMUL(VPINV30, ce), me), VMASK30));
+  cd = VADD(cd, _mm256_mul_epi32(VLSWP30, md));
+  ce = VADD(ce, _mm256_mul_epi32(VLSWP30, me));
+  cd = VSRA64(cd, 30);
+  ce = VSRA64(ce, 30);
+
+  for (i = 1; i < NWORDS; i++) {
+    mp = (i < 8) ? VMASK30 : VMSWP30;
+    cd = VADD(cd, _mm256_mul_epi32(u, d[i]));
+    cd = VADD(cd, _mm256_mul_epi32(v, e[i]));
+    cd = VADD(cd, _mm256_mul_epi32(mp, md));
+    ce = VADD(ce, _mm256_mul_epi32(q, d[i]));
+    ce = VADD(ce, _mm256_mul_epi32(r, e[i]));
+    ce = VADD(ce, _mm256_mul_epi32(mp, me));
+    d[i-1] = VAND(cd, VMASK30); cd = VSRA64(cd, 30);
+    e[i-1] = VAND(ce, VMASK30); ce = VSRA64(ce, 30);
+  }
+  d[8] = cd;
+  e[8] = ce;
+}
 
-  accu = VADD(t6, VSHR(accu, BITS29)); accu = VMAC(accu, r6, VCONSTC);
-  r6   = VAND(accu, VMASK29);
 
-  accu = VADD(t7, VSHR(accu, BITS29)); accu = VMAC(accu, r7, VCONSTC);
-  r7   = VAND(accu, VMASK29);
+/**
+ * @brief Apply a transition matrix to f and g of the safegcd inversion.
+ *
+ * @details
+ * (f, g) = (u*f + v*g, q*f + r*g)/2^30, the divisions are exact.
+ *
+ * @param f Integer f (signed 30-bit limbs)
+ * @param g Integer g (signed 30-bit limbs)
+ * @param t Transition matrix
+ */
+static void mpi30_update_fg_avx2(__m256i *f, __m256i *g, const __m256i *t)
+{
+  const __m256i u = t[0], v = t[1], q = t[2], r = t[3];
+  const __m256i VMASK30 = VSET164(MASK30);
+  __m256i cf, cg;
+  int i;
 
-  accu = VADD(t8, VSHR(accu, BITS29)); accu = VMAC(accu, r8, VCONSTC);
-  r8   = VAND(accu, VMASK29);
+  cf = VADD(_mm256_mul_epi32(u, f[0]), _mm256_mul_epi32(v, g[0]));
+  cg = VADD(_mm256_mul_epi32(q, f[0]), _mm256_mul_epi32(r, g[0]));
+  cf = VSRA64(cf, 30);
+  cg = VSRA64(cg, 30);
+
+  for (i = 1; i < NWORDS; i++) {
+    cf = VADD(cf, _mm256_mul_epi32(u, f[i]));
+    cf = VADD(cf, _mm256_mul_epi32(v, g[i]));
+    cg = VADD(cg, _mm256_mul_epi32(q, f[i]));
+    cg = VADD(cg, _mm256_mul_epi32(r, g[i]));
+    f[i-1] = VAND(cf, VMASK30); cf = VSRA64(cf, 30);
+    g[i-1] = VAND(cg, VMASK30); cg = VSRA64(cg, 30);
+  }
+  f[8] = cf;
+  g[8] = cg;
+}
 
-  accu = VSHR(accu, BITS29);
-  r0   = VADD(r0, VMUL(accu, VCONSTC));
 
-  r[0] = r0; r[1] = r1; r[2] = r2; 
-  r[3] = r3; r[4] = r4; r[5] = r5;
-  r[6] = r6; r[7] = r7; r[8] = r8;
+/**
+ * @brief Field multiplicative inversion (safegcd).
+ *
+ * @details
+ * r = a^-1 mod p, and r = 0 for a = 0 mod p (as a^(p-2)).
+ * Bernstein-Yang's constant-time extended gcd: a is reduced modulo p and 
+ * converted to signed 30-bit limbs, 20 rounds of 30 divsteps (590 suffice for
+ * 256-bit inputs) are applied to (f, g) = (p, a) and to (d, e) = (0, 1), then
+ * f = +-1 and d = +-a^-1.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_inv_safegcd_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i x[NWORDS], f[NWORDS], g[NWORDS], d[NWORDS], e[NWORDS], t[4];
+  __m256i zeta, temp, neg;
+  const __m256i VMASK23 = VSET164(0x7FFFFFUL);
+  const __m256i VMASK29 = VSET164(MASK29), VMASK30 = VSET164(MASK30);
+  const __m256i V19 = VSET164(19);
+  int i, j;
+
+  // a mod p in [0, p): the bits above 2^255 are folded twice (a < 2^255), 
+  // then p is subtracted if a+19 has bit 255 set
+  for (i = 0; i < NWORDS; i++) x[i] = a[i];
+  for (j = 0; j < 2; j++) {
+    temp = VSHR(x[8], 23); x[8] = VAND(x[8], VMASK23);
+    x[0] = VADD(x[0], VMUL(temp, V19));
+    for (i = 0; i < NWORDS-1; i++) {
+      x[i+1] = VADD(x[i+1], VSHR(x[i], BITS29)); x[i] = VAND(x[i], VMASK29);
+    }
+  }
+  temp = VADD(x[0], V19);
+  for (i = 1; i < NWORDS; i++) temp = VADD(x[i], VSHR(temp, BITS29));
+  x[0] = VADD(x[0], VMUL(VSHR(temp, 23), V19));
+  for (i = 0; i < NWORDS-1; i++) {
+    x[i+1] = VADD(x[i+1], VSHR(x[i], BITS29)); x[i] = VAND(x[i], VMASK29);
+  }
+  x[8] = VAND(x[8], VMASK23);
+
+  // 29-bit limbs -> 30-bit limbs
+  for (i = 0; i < NWORDS-1; i++)
+    g[i] = VAND(VOR(VSHR(x[i], i), VSHL(x[i+1], 29-i)), VMASK30);
+  g[8] = VSHR(x[8], 8);
+
+  // f = p, d = 0, e = 1, zeta = -1 (delta = 1/2)
+  f[0] = VSET164(LSWP30);
+  for (i = 1; i < NWORDS-1; i++) f[i] = VMASK30;
+  f[8] = VSET164(MSWP30);
+  for (i = 0; i < NWORDS; i++) d[i] = e[i] = VZERO;
+  e[0] = VSET164(1);
+  zeta = VSET164(-1);
+
+  for (i = 0; i < 20; i++) {
+    zeta = mpi30_divsteps_avx2(t, zeta, f[0], g[0]);
+    mpi30_update_de_avx2(d, e, t);
+    mpi30_update_fg_avx2(f, g, t);
+  }
+
+  // d in (-2p, p) -> d*f in [0, p): add p if d < 0, negate if f = -1, 
+  // add p if d < 0 (carry the signed limbs in between)
+  neg = _mm256_cmpgt_epi64(VZERO, f[8]);
+  temp = _mm256_cmpgt_epi64(VZERO, d[8]);
+  d[0] = VADD(d[0], VAND(temp, VSET164(LSWP30)));
+  for (i = 1; i < NWORDS-1; i++) d[i] = VADD(d[i], VAND(temp, VMASK30));
+  d[8] = VADD(d[8], VAND(temp, VSET164(MSWP30)));
+  for (i = 0; i < NWORDS; i++) d[i] = VSUB(VXOR(d[i], neg), neg);
+  for (i = 0; i < NWORDS-1; i++) {
+    d[i+1] = VADD(d[i+1], VSRA64(d[i], 30)); d[i] = VAND(d[i], VMASK30);
+  }
+  temp = _mm256_cmpgt_epi64(VZERO, d[8]);
+  d[0] = VADD(d[0], VAND(temp, VSET164(LSWP30)));
+  for (i = 1; i < NWORDS-1; i++) d[i] = VADD(d[i], VAND(temp, VMASK30));
+  d[8] = VADD(d[8], VAND(temp, VSET164(MSWP30)));
+  for (i = 0; i < NWORDS-1; i++) {
+    d[i+1] = VADD(d[i+1], VSRA64(d[i], 30)); d[i] = VAND(d[i], VMASK30);
+  }
+
+  // 30-bit limbs -> 29-bit limbs
+  r[0] = VAND(d[0], VMASK29);
+  for (i = 1; i < NWORDS; i++)
+    r[i] = VAND(VOR(VSHR(d[i-1], 30-i), VSHL(d[i], i)), VMASK29);
 }
 
 
@@ -524,12 +563,34 @@ void mpi29_gfp_sqr_avx2(__m256i *r, const __m256i *a)
  *
  * @details
  * r = a^-1 mod p.
- * This function computes the multiplicative inverse of an element.
+ * This function computes the multiplicative inverse of an element with the
+ * inversion that is selected with GFP_INV (Fermat or safegcd).
  * 
  * @param r Field element
  * @param a Field element
  */
 void mpi29_gfp_inv_avx2(__m256i *r, const __m256i *a)
+{
+  PROF_START(t_inv);
+#if GFP_INV == GFP_INV_SAFEGCD
+  mpi29_gfp_inv_safegcd_avx2(r, a);
+#else
+  mpi29_gfp_inv_fermat_avx2(r, a);
+#endif
+  PROF_STOP(PROF_INV, t_inv);
+}
+
+/**
+ * @brief Field exponentiation by (p-5)/8.
+ *
+ * @details
+ * r = a^(2^252-3) mod p, used for the square root of the point decoding. 
+ * The addition chain is the one of mpi29_gfp_inv_fermat_avx2 up to a^(2^250-1).
+ * 
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_pow22523_avx2(__m256i *r, const __m256i *a)
 {
   __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS];
   int i;
@@ -563,8 +624,238 @@ void mpi29_gfp_inv_avx2(__m256i *r, const __m256i *a)
   for (i = 0; i < 49; i++) mpi29_gfp_sqr_avx2(t2, t2);
   mpi29_gfp_mul_avx2(t1, t2, t1);
   mpi29_gfp_sqr_avx2(t1, t1);
-  for (i = 0; i < 4; i++) mpi29_gfp_sqr_avx2(t1, t1);
-  mpi29_gfp_mul_avx2(r, t1, t0);
+  mpi29_gfp_sqr_avx2(t1, t1);
+  mpi29_gfp_mul_avx2(r, t1, a);
+}
+
+// sqrt(-1) in the field
+static const uint32_t sqrtm1[NWORDS] = { 0x0A0EA0B0, 0x0770D93A, 0x0BF91E31,
+  0x06300D5A, 0x1D7A72F4, 0x004C9EFD, 0x1C2CAD34, 0x1009F83B, 0x002B8324 };
+
+/**
+ * @brief Partial reduction to [0, 2^255).
+ *
+ * @details
+ * Fold the bits above 2^255 twice (2^255 = 19 mod p) and propagate the 
+ * carries, so that the limbs are 29 bits (the last one 23 bits) and a < 2^255,
+ * i.e. a is canonical unless it is in [p, 2^255).
+ *
+ * @param a Field element
+ */
+static inline void mpi29_fold255_avx2(__m256i *a)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i temp;
+  const __m256i VMASK23 = VSET164(0x7FFFFFUL);
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i V19 = VSET164(19);
+  int i;
+
+  for (i = 0; i < 2; i++) {
+    temp = VSHR(a8, 23); a8 = VAND(a8, VMASK23);
+    a0 = VADD(a0, VMUL(temp, V19));
+    a1 = VADD(a1, VSHR(a0, BITS29)); a0 = VAND(a0, VMASK29);
+    a2 = VADD(a2, VSHR(a1, BITS29)); a1 = VAND(a1, VMASK29);
+    a3 = VADD(a3, VSHR(a2, BITS29)); a2 = VAND(a2, VMASK29);
+    a4 = VADD(a4, VSHR(a3, BITS29)); a3 = VAND(a3, VMASK29);
+    a5 = VADD(a5, VSHR(a4, BITS29)); a4 = VAND(a4, VMASK29);
+    a6 = VADD(a6, VSHR(a5, BITS29)); a5 = VAND(a5, VMASK29);
+    a7 = VADD(a7, VSHR(a6, BITS29)); a6 = VAND(a6, VMASK29);
+    a8 = VADD(a8, VSHR(a7, BITS29)); a7 = VAND(a7, VMASK29);
+  }
+
+  a[0] = a0; a[1] = a1; a[2] = a2;
+  a[3] = a3; a[4] = a4; a[5] = a5;
+  a[6] = a6; a[7] = a7; a[8] = a8;
+}
+
+/**
+ * @brief Test of the range [p, 2^255).
+ *
+ * @param a Field element after mpi29_fold255_avx2
+ * @return Mask of the lanes where a >= p
+ */
+static inline __m256i mpi29_gep_avx2(const __m256i *a)
+{
+  const __m256i VMASK23 = VSET164(0x7FFFFFUL);
+  const __m256i VMASK29 = VSET164(MASK29);
+  __m256i full;
+
+  // p = [2^29-19, 2^29-1, ..., 2^29-1, 2^23-1], the lowest limb >= 2^29-19
+  full = VAND(VAND(VAND(a[1], a[2]), VAND(a[3], a[4])), VAND(VAND(a[5], a[6]), a[7]));
+  full = _mm256_cmpeq_epi64(full, VMASK29);
+  full = VAND(full, _mm256_cmpgt_epi64(a[0], VSET164(0x1FFFFFECUL)));
+  return VAND(full, _mm256_cmpeq_epi64(a[8], VMASK23));
+}
+
+/**
+ * @brief Zero test.
+ *
+ * @details
+ * Return a mask that is all-ones in those lanes where a = 0 mod p. The bits of 
+ * a above 2^255 are folded twice, so a < 2^255 and a = 0 mod p iff a is 0 or p.
+ *
+ * @param a Field element
+ * @return Mask of the zero lanes
+ */
+__m256i mpi29_gfp_iszero_avx2(const __m256i *a)
+{
+  __m256i b[NWORDS], zero, full;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) b[i] = a[i];
+  mpi29_fold255_avx2(b);
+
+  // a = 0 or a = p = [2^29-19, 2^29-1, ..., 2^29-1, 2^23-1]
+  zero = VOR(VOR(VOR(b[0], b[1]), VOR(b[2], b[3])), VOR(VOR(b[4], b[5]), VOR(b[6], b[7])));
+  zero = _mm256_cmpeq_epi64(VOR(zero, b[8]), VZERO);
+  full = VAND(mpi29_gep_avx2(b), _mm256_cmpeq_epi64(b[0], VSET164(0x1FFFFFEDUL)));
+
+  return VOR(zero, full);
+}
+
+/**
+ * @brief Parity test.
+ *
+ * @details
+ * Return a mask that is all-ones in those lanes where the canonical 
+ * representative of a in [0, p) is odd. After the folding a < 2^255, and a-p 
+ * has the other parity than a (p is odd).
+ *
+ * @param a Field element
+ * @return Mask of the odd lanes
+ */
+__m256i mpi29_gfp_isodd_avx2(const __m256i *a)
+{
+  const __m256i one = VSET164(1);
+  __m256i b[NWORDS], odd;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) b[i] = a[i];
+  mpi29_fold255_avx2(b);
+
+  odd = VXOR(VAND(b[0], one), VAND(mpi29_gep_avx2(b), one));
+  return _mm256_cmpeq_epi64(odd, one);
+}
+
+/**
+ * @brief Quadratic residue test (Legendre symbol).
+ *
+ * @details
+ * Compute a^((p-1)/2) = (a^((p-5)/8))^4 * a^2, which is 1 if a is a nonzero
+ * square, p-1 if it is not a square and 0 if a = 0, and return a mask that is 
+ * all-ones in those lanes where a is a square (including 0). Constant-time.
+ *
+ * @param a Field element
+ * @return Mask of the square lanes
+ */
+__m256i mpi29_gfp_issquare_avx2(const __m256i *a)
+{
+  __m256i t0[NWORDS], t1[NWORDS];
+  int i;
+
+  mpi29_gfp_pow22523_avx2(t0, a);
+  mpi29_gfp_sqr_avx2(t0, t0);
+  mpi29_gfp_sqr_avx2(t0, t0);
+  mpi29_gfp_sqr_avx2(t1, a);
+  mpi29_gfp_mul_avx2(t0, t0, t1);
+  // a^((p-1)/2) - 1 = 0 or a = 0
+  for (i = 0; i < NWORDS; i++) t1[i] = VZERO;
+  t1[0] = VSET164(1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+
+  return VOR(mpi29_gfp_iszero_avx2(t0), mpi29_gfp_iszero_avx2(a));
+}
+
+/**
+ * @brief Square root of a fraction.
+ *
+ * @details
+ * r = sqrt(u/v) = u*v^3*(u*v^7)^((p-5)/8) without an inversion (RFC 8032, 
+ * 5.1.3), multiplied by sqrt(-1) if v*r^2 = -u. The mask is all-ones in those
+ * lanes where u/v is a square (or u = 0), r is undefined in the other lanes, 
+ * and r is not normalized to one of the two roots. Constant-time.
+ *
+ * @param r Field element
+ * @param u Numerator
+ * @param v Denominator
+ * @return Mask of the lanes where v*r^2 = u
+ */
+__m256i mpi29_gfp_sqrt_ratio_avx2(__m256i *r, const __m256i *u, const __m256i *v)
+{
+  __m256i v3[NWORDS], t[NWORDS], w[NWORDS];
+  __m256i ok1, ok2;
+  int i;
+
+  // r = u*v^3*(u*v^7)^((p-5)/8)
+  mpi29_gfp_sqr_avx2(v3, v);
+  mpi29_gfp_mul_avx2(v3, v3, v);
+  mpi29_gfp_sqr_avx2(t, v3);
+  mpi29_gfp_mul_avx2(t, t, v);
+  mpi29_gfp_mul_avx2(t, t, u);
+  mpi29_gfp_pow22523_avx2(t, t);
+  mpi29_gfp_mul_avx2(t, t, v3);
+  mpi29_gfp_mul_avx2(r, t, u);
+
+  // v*r^2 = u or v*r^2 = -u
+  mpi29_gfp_sqr_avx2(t, r);
+  mpi29_gfp_mul_avx2(t, t, v);
+  mpi29_gfp_sbc_avx2(w, t, u);
+  ok1 = mpi29_gfp_iszero_avx2(w);
+  mpi29_gfp_add_avx2(w, t, u);
+  ok2 = mpi29_gfp_iszero_avx2(w);
+  for (i = 0; i < NWORDS; i++) w[i] = VSET164(sqrtm1[i]);
+  mpi29_gfp_mul_avx2(t, r, w);
+  mpi29_cswap_avx2(r, t, VSHR(_mm256_andnot_si256(ok1, ok2), 63));
+
+  return VOR(ok1, ok2);
+}
+
+/**
+ * @brief Simultaneous inversion of n elements.
+ *
+ * @details
+ * r[i] = a[i]^-1 mod p for i = 0, ..., n-1.
+ * Montgomery's trick replaces n inversions by a single one and 3*(n-1) 
+ * multiplications. An element a[i] = 0 is replaced by 1 in the products (so 
+ * that it does not spoil the other elements of its lane) and r[i] is set to 0 
+ * as in mpi29_gfp_inv_avx2. The arrays r and a must not overlap.
+ *
+ * @param r Field elements
+ * @param a Field elements
+ * @param n Number of elements (n >= 1)
+ */
+void mpi29_gfp_batchinv_avx2(__m256i (*r)[NWORDS], const __m256i (*a)[NWORDS], 
+  const int n)
+{
+  __m256i t0[NWORDS], t1[NWORDS], mask;
+  const __m256i one = VSET164(1);
+  int i, j;
+
+  // r[i] = a[0]*a[1]*...*a[i]
+  mpi29_copy_avx2(r[0], a[0]);
+  r[0][0] = VADD(r[0][0], VAND(mpi29_gfp_iszero_avx2(a[0]), one));
+  for (i = 1; i < n; i++) {
+    mpi29_copy_avx2(t0, a[i]);
+    t0[0] = VADD(t0[0], VAND(mpi29_gfp_iszero_avx2(a[i]), one));
+    mpi29_gfp_mul_avx2(r[i], r[i-1], t0);
+  }
+
+  mpi29_gfp_inv_avx2(t1, r[n-1]);
+
+  // t1 = (a[0]*...*a[i])^-1 in the i-th iteration
+  for (i = n-1; i > 0; i--) {
+    mask = mpi29_gfp_iszero_avx2(a[i]);
+    mpi29_copy_avx2(t0, a[i]);
+    t0[0] = VADD(t0[0], VAND(mask, one));
+    mpi29_gfp_mul_avx2(r[i], r[i-1], t1);
+    mpi29_gfp_mul_avx2(t1, t1, t0);
+    for (j = 0; j < NWORDS; j++) r[i][j] = _mm256_andnot_si256(mask, r[i][j]);
+  }
+  mask = mpi29_gfp_iszero_avx2(a[0]);
+  for (j = 0; j < NWORDS; j++) r[0][j] = _mm256_andnot_si256(mask, t1[j]);
 }
 
 /**
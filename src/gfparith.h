@@ -28,15 +28,84 @@
 // least significant 29-bit word of p = 64*(2^255 - 19) = 2^261 - 1216
 #define LSWP29 0x1FFFFB40UL
 
+// multiplication and squaring that are used by mpi29_gfp_mul/sqr_avx2 (and 
+// the inlined field arithmetic), selected at compile time with the GFP_MUL 
+// and GFP_SQR variables of the Makefile; all of them are available under 
+// their own names for timing_fp_arith
+#define GFP_MUL_PS 0        // product scanning (81 multiplications)
+#define GFP_MUL_KARATSUBA 1 // one-level Karatsuba on 5+4 limbs (66)
+#define GFP_SQR_PS 0        // product scanning, cross products shifted (45)
+#define GFP_SQR_DOUBLED 1   // product scanning on pre-doubled limbs (45)
+#ifndef GFP_MUL
+#define GFP_MUL GFP_MUL_PS
+#endif
+#ifndef GFP_SQR
+#define GFP_SQR GFP_SQR_PS
+#endif
+// inversion that is used by mpi29_gfp_inv_avx2 (and thus by the scalar 
+// multiplications on the Montgomery curve), GFP_INV of the Makefile
+#define GFP_INV_FERMAT 0    // exponentiation by p-2 (254 sqr + 11 mul)
+#define GFP_INV_SAFEGCD 1   // Bernstein-Yang, 20*30 divsteps on 30-bit limbs
+#ifndef GFP_INV
+#define GFP_INV GFP_INV_SAFEGCD
+#endif
+
+// bounds of the limbs (the results with carried limbs are "reduced"): 
+// - mul, sqr, mul29, sbc: limbs < 2^29, except the first < 2^29 + 2^23
+// - sbp: limbs < 2^29 + 2^3, except the first < 2^29 + 2^13 (for a < 2^31)
+// - add: the sum of the bounds of a and b
+// - sub: 2^30 plus the bound of a (b must be reduced, i.e. < 2^30 - 2^12)
+// the operands of mul/sqr need limbs < 2^32 (VMUL takes the low 32 bits) and
+// the products of their bounds must stay below 2^64/10 = 1.6*2^60, since a 
+// column sums up 9 products and the carry of the previous one; e.g.:
+// - reduced * add of two reduced (2^30), reduced * sub of reduced (1.5*2^30)
+// - add * sub of two reduced (1.5*2^60), but NOT sub * sub (2.25*2^60) and
+//   NOT sqr(sub) of reduced, so a difference that is squared or multiplied by
+//   another difference must be carried with sbc or (faster) sbp
+// - Karatsuba and the doubled squaring add two limbs before multiplying, so 
+//   their operands need limbs < 2^31 (the columns are exact mod 2^64)
+// - inv_safegcd reduces its operand first, it takes any limbs < 2^32 (the 
+//   Fermat inversion squares it, so it takes the operands of sqr)
+// - the lazy variants (add, sub, and add instead of mul29 by 2) are used where
+//   the following multiplication can absorb them
+
+// (1*4)-way: permute the lanes of a field element, or blend two of them 
+// (the blending mask has two bits per 64-bit lane)
+#define MPI29_PERM(R, A, I)                                   \
+  do { int i_; for (i_ = 0; i_ < NWORDS; i_++)                \
+    (R)[i_] = VPERM64((A)[i_], I); } while (0)
+#define MPI29_BLEND(R, A, B, I)                               \
+  do { int i_; for (i_ = 0; i_ < NWORDS; i_++)                \
+    (R)[i_] = VBLEND32((A)[i_], (B)[i_], I); } while (0)
+// (2*2)-way: shuffle the 64-bit lanes within the 128-bit halves (with the 
+// immediate of vpshufd, e.g. 0x44 and 0xEE broadcast the low and high lane)
+#define MPI29_SHUF(R, A, I)                                   \
+  do { int i_; for (i_ = 0; i_ < NWORDS; i_++)                \
+    (R)[i_] = VSHUF32((A)[i_], I); } while (0)
+
 // function prototypes
 
 void mpi29_gfp_add_avx2(__m256i *r, const __m256i *a, const __m256i *b);
 void mpi29_gfp_sub_avx2(__m256i *r, const __m256i *a, const __m256i *b);
 void mpi29_gfp_sbc_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi29_gfp_sbp_avx2(__m256i *r, const __m256i *a, const __m256i *b);
 void mpi29_gfp_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi29_gfp_mul_ps_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi29_gfp_mul_kara_avx2(__m256i *r, const __m256i *a, const __m256i *b);
 void mpi29_gfp_mul29_avx2(__m256i *r, const __m256i *a, const uint32_t b);
 void mpi29_gfp_sqr_avx2(__m256i *r, const __m256i *a);
+void mpi29_gfp_sqr_ps_avx2(__m256i *r, const __m256i *a);
+void mpi29_gfp_sqr_dbl_avx2(__m256i *r, const __m256i *a);
 void mpi29_gfp_inv_avx2(__m256i *r, const __m256i *a);
+void mpi29_gfp_inv_fermat_avx2(__m256i *r, const __m256i *a);
+void mpi29_gfp_inv_safegcd_avx2(__m256i *r, const __m256i *a);
+void mpi29_gfp_pow22523_avx2(__m256i *r, const __m256i *a);
 void mpi29_cswap_avx2(__m256i *r, __m256i *a, const __m256i b);
 void mpi29_copy_avx2(__m256i *r, const __m256i *a);
+__m256i mpi29_gfp_iszero_avx2(const __m256i *a);
+__m256i mpi29_gfp_isodd_avx2(const __m256i *a);
+__m256i mpi29_gfp_issquare_avx2(const __m256i *a);
+__m256i mpi29_gfp_sqrt_ratio_avx2(__m256i *r, const __m256i *u, const __m256i *v);
+void mpi29_gfp_batchinv_avx2(__m256i (*r)[NWORDS], const __m256i (*a)[NWORDS], 
+  const int n);
 #endif
@@ -0,0 +1,287 @@
+/**
+ *******************************************************************************
+ * @file gfparith25.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of field arithmetic in radix 2^25.5.
+ *
+ * @details 
+ * This file contains (4*1)-way field multiplication and squaring modulo 
+ * p = 2^255-19 with ten limbs of alternately 26 and 25 bits. The reduction is
+ * merged into the products (the limbs of b are multiplied by 19 beforehand), 
+ * at the cost of 100 instead of 81 multiplications. The curve arithmetic uses 
+ * radix 2^29; this representation is only used to compare the multipliers 
+ * (see timing_fp_arith).
+ *******************************************************************************
+ */
+
+#include "gfparith25.h"
+
+
+/**
+ * @brief Field multiplication.
+ *
+ * @details
+ * r = a * b mod p.
+ * The products of two odd limbs are doubled (their weights add up to one bit 
+ * more than the weight of the column), the products that wrap around are 
+ * multiplied by 19. The limbs of a and b must be below 2^27.
+ * 
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi25_gfp_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m256i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  __m256i b5 = b[5], b6 = b[6], b7 = b[7], b8 = b[8], b9 = b[9];
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, c;
+  __m256i e1, e3, e5, e7, e9;
+  __m256i g1, g2, g3, g4, g5, g6, g7, g8, g9;
+  const __m256i VMASK25 = VSET164(MASK25);
+  const __m256i VMASK26 = VSET164(MASK26);
+  const __m256i V19 = VSET164(19);
+
+  // the odd limbs of a doubled (2^25.5 * 2^25.5 = 2 * 2^51), the limbs of b 
+  // multiplied by 19 for the products that wrap around (2^255 = 19 mod p)
+  e1 = VADD(a1, a1); e3 = VADD(a3, a3); e5 = VADD(a5, a5); e7 = VADD(a7, a7);
+  e9 = VADD(a9, a9);
+  g1 = VMUL(b1, V19); g2 = VMUL(b2, V19); g3 = VMUL(b3, V19);
+  g4 = VMUL(b4, V19); g5 = VMUL(b5, V19); g6 = VMUL(b6, V19);
+  g7 = VMUL(b7, V19); g8 = VMUL(b8, V19); g9 = VMUL(b9, V19);
+
+  t0 = VMUL(a0, b0); t0 = VMAC(t0, e1, g9); t0 = VMAC(t0, a2, g8);
+  t0 = VMAC(t0, e3, g7); t0 = VMAC(t0, a4, g6); t0 = VMAC(t0, e5, g5);
+  t0 = VMAC(t0, a6, g4); t0 = VMAC(t0, e7, g3); t0 = VMAC(t0, a8, g2);
+  t0 = VMAC(t0, e9, g1);
+  t1 = VMUL(a0, b1); t1 = VMAC(t1, a1, b0); t1 = VMAC(t1, a2, g9);
+  t1 = VMAC(t1, a3, g8); t1 = VMAC(t1, a4, g7); t1 = VMAC(t1, a5, g6);
+  t1 = VMAC(t1, a6, g5); t1 = VMAC(t1, a7, g4); t1 = VMAC(t1, a8, g3);
+  t1 = VMAC(t1, a9, g2);
+  t2 = VMUL(a0, b2); t2 = VMAC(t2, e1, b1); t2 = VMAC(t2, a2, b0);
+  t2 = VMAC(t2, e3, g9); t2 = VMAC(t2, a4, g8); t2 = VMAC(t2, e5, g7);
+  t2 = VMAC(t2, a6, g6); t2 = VMAC(t2, e7, g5); t2 = VMAC(t2, a8, g4);
+  t2 = VMAC(t2, e9, g3);
+  t3 = VMUL(a0, b3); t3 = VMAC(t3, a1, b2); t3 = VMAC(t3, a2, b1);
+  t3 = VMAC(t3, a3, b0); t3 = VMAC(t3, a4, g9); t3 = VMAC(t3, a5, g8);
+  t3 = VMAC(t3, a6, g7); t3 = VMAC(t3, a7, g6); t3 = VMAC(t3, a8, g5);
+  t3 = VMAC(t3, a9, g4);
+  t4 = VMUL(a0, b4); t4 = VMAC(t4, e1, b3); t4 = VMAC(t4, a2, b2);
+  t4 = VMAC(t4, e3, b1); t4 = VMAC(t4, a4, b0); t4 = VMAC(t4, e5, g9);
+  t4 = VMAC(t4, a6, g8); t4 = VMAC(t4, e7, g7); t4 = VMAC(t4, a8, g6);
+  t4 = VMAC(t4, e9, g5);
+  t5 = VMUL(a0, b5); t5 = VMAC(t5, a1, b4); t5 = VMAC(t5, a2, b3);
+  t5 = VMAC(t5, a3, b2); t5 = VMAC(t5, a4, b1); t5 = VMAC(t5, a5, b0);
+  t5 = VMAC(t5, a6, g9); t5 = VMAC(t5, a7, g8); t5 = VMAC(t5, a8, g7);
+  t5 = VMAC(t5, a9, g6);
+  t6 = VMUL(a0, b6); t6 = VMAC(t6, e1, b5); t6 = VMAC(t6, a2, b4);
+  t6 = VMAC(t6, e3, b3); t6 = VMAC(t6, a4, b2); t6 = VMAC(t6, e5, b1);
+  t6 = VMAC(t6, a6, b0); t6 = VMAC(t6, e7, g9); t6 = VMAC(t6, a8, g8);
+  t6 = VMAC(t6, e9, g7);
+  t7 = VMUL(a0, b7); t7 = VMAC(t7, a1, b6); t7 = VMAC(t7, a2, b5);
+  t7 = VMAC(t7, a3, b4); t7 = VMAC(t7, a4, b3); t7 = VMAC(t7, a5, b2);
+  t7 = VMAC(t7, a6, b1); t7 = VMAC(t7, a7, b0); t7 = VMAC(t7, a8, g9);
+  t7 = VMAC(t7, a9, g8);
+  t8 = VMUL(a0, b8); t8 = VMAC(t8, e1, b7); t8 = VMAC(t8, a2, b6);
+  t8 = VMAC(t8, e3, b5); t8 = VMAC(t8, a4, b4); t8 = VMAC(t8, e5, b3);
+  t8 = VMAC(t8, a6, b2); t8 = VMAC(t8, e7, b1); t8 = VMAC(t8, a8, b0);
+  t8 = VMAC(t8, e9, g9);
+  t9 = VMUL(a0, b9); t9 = VMAC(t9, a1, b8); t9 = VMAC(t9, a2, b7);
+  t9 = VMAC(t9, a3, b6); t9 = VMAC(t9, a4, b5); t9 = VMAC(t9, a5, b4);
+  t9 = VMAC(t9, a6, b3); t9 = VMAC(t9, a7, b2); t9 = VMAC(t9, a8, b1);
+  t9 = VMAC(t9, a9, b0);
+
+  // carry propagation in two interleaved chains (from t0 and from t4), the
+  // carry of t9 (up to 2^36) is multiplied by 19 with shifts
+  c = VSHR(t0, 26); t1 = VADD(t1, c); t0 = VAND(t0, VMASK26);
+  c = VSHR(t4, 26); t5 = VADD(t5, c); t4 = VAND(t4, VMASK26);
+  c = VSHR(t1, 25); t2 = VADD(t2, c); t1 = VAND(t1, VMASK25);
+  c = VSHR(t5, 25); t6 = VADD(t6, c); t5 = VAND(t5, VMASK25);
+  c = VSHR(t2, 26); t3 = VADD(t3, c); t2 = VAND(t2, VMASK26);
+  c = VSHR(t6, 26); t7 = VADD(t7, c); t6 = VAND(t6, VMASK26);
+  c = VSHR(t3, 25); t4 = VADD(t4, c); t3 = VAND(t3, VMASK25);
+  c = VSHR(t7, 25); t8 = VADD(t8, c); t7 = VAND(t7, VMASK25);
+  c = VSHR(t4, 26); t5 = VADD(t5, c); t4 = VAND(t4, VMASK26);
+  c = VSHR(t8, 26); t9 = VADD(t9, c); t8 = VAND(t8, VMASK26);
+  c = VSHR(t9, 25); t0 = VADD(t0, VADD(c, VADD(VSHL(c, 1), VSHL(c, 4))));
+  t9 = VAND(t9, VMASK25);
+  c = VSHR(t0, 26); t1 = VADD(t1, c); t0 = VAND(t0, VMASK26);
+
+  r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3; r[4] = t4;
+  r[5] = t5; r[6] = t6; r[7] = t7; r[8] = t8; r[9] = t9;
+}
+
+
+/**
+ * @brief Field squaring.
+ *
+ * @details
+ * r = a^2 mod p.
+ * The 55 products of the squaring, with doubled limbs for the cross products. 
+ * The limbs of a must be below 2^27.
+ * 
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi25_gfp_sqr_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m256i a5 = a[5], a6 = a[6], a7 = a[7], a8 = a[8], a9 = a[9];
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, t9, c;
+  __m256i d0, d1, d2, d3, d4, d5, d6, d7, d8;
+  __m256i f5, f6, f7, f8, f9, q7, q9;
+  const __m256i VMASK25 = VSET164(MASK25);
+  const __m256i VMASK26 = VSET164(MASK26);
+  const __m256i V19 = VSET164(19);
+
+  // doubled limbs for the cross products, and the limbs multiplied by 19 
+  // (38 for the odd ones) for the products that wrap around
+  d0 = VADD(a0, a0); d1 = VADD(a1, a1); d2 = VADD(a2, a2); d3 = VADD(a3, a3);
+  d4 = VADD(a4, a4); d5 = VADD(a5, a5); d6 = VADD(a6, a6); d7 = VADD(a7, a7);
+  d8 = VADD(a8, a8);
+  f5 = VMUL(a5, V19); f6 = VMUL(a6, V19); f7 = VMUL(a7, V19); 
+  f8 = VMUL(a8, V19); f9 = VMUL(a9, V19);
+  q7 = VADD(f7, f7); q9 = VADD(f9, f9);
+
+  t0 = VMUL(a0, a0); t0 = VMAC(t0, d1, q9); t0 = VMAC(t0, d2, f8);
+  t0 = VMAC(t0, d3, q7); t0 = VMAC(t0, d4, f6); t0 = VMAC(t0, d5, f5);
+  t1 = VMUL(d0, a1); t1 = VMAC(t1, d2, f9); t1 = VMAC(t1, d3, f8);
+  t1 = VMAC(t1, d4, f7); t1 = VMAC(t1, d5, f6);
+  t2 = VMUL(d0, a2); t2 = VMAC(t2, d1, a1); t2 = VMAC(t2, d3, q9);
+  t2 = VMAC(t2, d4, f8); t2 = VMAC(t2, d5, q7); t2 = VMAC(t2, a6, f6);
+  t3 = VMUL(d0, a3); t3 = VMAC(t3, d1, a2); t3 = VMAC(t3, d4, f9);
+  t3 = VMAC(t3, d5, f8); t3 = VMAC(t3, d6, f7);
+  t4 = VMUL(d0, a4); t4 = VMAC(t4, d1, d3); t4 = VMAC(t4, a2, a2);
+  t4 = VMAC(t4, d5, q9); t4 = VMAC(t4, d6, f8); t4 = VMAC(t4, d7, f7);
+  t5 = VMUL(d0, a5); t5 = VMAC(t5, d1, a4); t5 = VMAC(t5, d2, a3);
+  t5 = VMAC(t5, d6, f9); t5 = VMAC(t5, d7, f8);
+  t6 = VMUL(d0, a6); t6 = VMAC(t6, d1, d5); t6 = VMAC(t6, d2, a4);
+  t6 = VMAC(t6, d3, a3); t6 = VMAC(t6, d7, q9); t6 = VMAC(t6, a8, f8);
+  t7 = VMUL(d0, a7); t7 = VMAC(t7, d1, a6); t7 = VMAC(t7, d2, a5);
+  t7 = VMAC(t7, d3, a4); t7 = VMAC(t7, d8, f9);
+  t8 = VMUL(d0, a8); t8 = VMAC(t8, d1, d7); t8 = VMAC(t8, d2, a6);
+  t8 = VMAC(t8, d3, d5); t8 = VMAC(t8, a4, a4); t8 = VMAC(t8, a9, q9);
+  t9 = VMUL(d0, a9); t9 = VMAC(t9, d1, a8); t9 = VMAC(t9, d2, a7);
+  t9 = VMAC(t9, d3, a6); t9 = VMAC(t9, d4, a5);
+
+  // carry propagation in two interleaved chains (from t0 and from t4), the
+  // carry of t9 (up to 2^36) is multiplied by 19 with shifts
+  c = VSHR(t0, 26); t1 = VADD(t1, c); t0 = VAND(t0, VMASK26);
+  c = VSHR(t4, 26); t5 = VADD(t5, c); t4 = VAND(t4, VMASK26);
+  c = VSHR(t1, 25); t2 = VADD(t2, c); t1 = VAND(t1, VMASK25);
+  c = VSHR(t5, 25); t6 = VADD(t6, c); t5 = VAND(t5, VMASK25);
+  c = VSHR(t2, 26); t3 = VADD(t3, c); t2 = VAND(t2, VMASK26);
+  c = VSHR(t6, 26); t7 = VADD(t7, c); t6 = VAND(t6, VMASK26);
+  c = VSHR(t3, 25); t4 = VADD(t4, c); t3 = VAND(t3, VMASK25);
+  c = VSHR(t7, 25); t8 = VADD(t8, c); t7 = VAND(t7, VMASK25);
+  c = VSHR(t4, 26); t5 = VADD(t5, c); t4 = VAND(t4, VMASK26);
+  c = VSHR(t8, 26); t9 = VADD(t9, c); t8 = VAND(t8, VMASK26);
+  c = VSHR(t9, 25); t0 = VADD(t0, VADD(c, VADD(VSHL(c, 1), VSHL(c, 4))));
+  t9 = VAND(t9, VMASK25);
+  c = VSHR(t0, 26); t1 = VADD(t1, c); t0 = VAND(t0, VMASK26);
+
+  r[0] = t0; r[1] = t1; r[2] = t2; r[3] = t3; r[4] = t4;
+  r[5] = t5; r[6] = t6; r[7] = t7; r[8] = t8; r[9] = t9;
+}
+
+
+/**
+ * @brief Conversion from byte strings to a field element vector.
+ *
+ * @details
+ * Convert four 32-byte little-endian strings to radix-2^25.5 field elements. 
+ * The most significant bit is ignored.
+ * 
+ * @param r Field element
+ * @param a Four byte strings
+ */
+void mpi25_conv_bytes2mpi25_avx2(__m256i *r, const uint8_t (*a)[32])
+{
+  const __m256i a0 = VLOADU(a[0]), a1 = VLOADU(a[1]);
+  const __m256i a2 = VLOADU(a[2]), a3 = VLOADU(a[3]);
+  const __m256i VMASK25 = VSET164(MASK25);
+  const __m256i VMASK26 = VSET164(MASK26);
+  __m256i t0, t1, t2, t3, w0, w1, w2, w3;
+
+  // transpose: wj holds the j-th 64-bit word of the four strings
+  t0 = _mm256_unpacklo_epi64(a0, a1);
+  t1 = _mm256_unpackhi_epi64(a0, a1);
+  t2 = _mm256_unpacklo_epi64(a2, a3);
+  t3 = _mm256_unpackhi_epi64(a2, a3);
+  w0 = _mm256_permute2x128_si256(t0, t2, 0x20);
+  w1 = _mm256_permute2x128_si256(t1, t3, 0x20);
+  w2 = _mm256_permute2x128_si256(t0, t2, 0x31);
+  w3 = _mm256_permute2x128_si256(t1, t3, 0x31);
+
+  r[0] = VAND(w0, VMASK26);
+  r[1] = VAND(VSHR(w0, 26), VMASK25);
+  r[2] = VAND(VOR(VSHR(w0, 51), VSHL(w1, 13)), VMASK26);
+  r[3] = VAND(VSHR(w1, 13), VMASK25);
+  r[4] = VAND(VSHR(w1, 38), VMASK26);
+  r[5] = VAND(w2, VMASK25);
+  r[6] = VAND(VSHR(w2, 25), VMASK26);
+  r[7] = VAND(VOR(VSHR(w2, 51), VSHL(w3, 13)), VMASK25);
+  r[8] = VAND(VSHR(w3, 12), VMASK26);
+  r[9] = VAND(VSHR(w3, 38), VMASK25);
+}
+
+
+/**
+ * @brief Conversion from a field element vector to byte strings.
+ *
+ * @details
+ * Reduce four radix-2^25.5 field elements to [0, 2^255-19) and store them as 
+ * 32-byte little-endian strings. The limbs of a must be below 2^27.
+ * 
+ * @param r Four byte strings
+ * @param a Field element
+ */
+void mpi25_conv_mpi252bytes_avx2(uint8_t (*r)[32], const __m256i *a)
+{
+  __m256i h[NWORDS25], q, t0, t1, t2, t3, w0, w1, w2, w3;
+  const __m256i VMASK25 = VSET164(MASK25);
+  const __m256i VMASK26 = VSET164(MASK26);
+  const __m256i V19 = VSET164(19);
+  int i, k;
+
+  // carry twice, the limbs are then within their widths and a < 2^255+2^26
+  for (i = 0; i < NWORDS25; i++) h[i] = a[i];
+  for (k = 0; k < 2; k++) {
+    for (i = 0; i < NWORDS25-1; i++) {
+      h[i+1] = VADD(h[i+1], VSHR(h[i], (i & 1) ? 25 : 26));
+      h[i] = VAND(h[i], (i & 1) ? VMASK25 : VMASK26);
+    }
+    h[0] = VMAC(h[0], VSHR(h[9], 25), V19);
+    h[9] = VAND(h[9], VMASK25);
+  }
+
+  // q = 1 iff a >= p, i.e. a+19 >= 2^255; then a = a+19*q mod 2^255
+  q = V19;
+  for (i = 0; i < NWORDS25; i++) q = VSHR(VADD(h[i], q), (i & 1) ? 25 : 26);
+  h[0] = VMAC(h[0], q, V19);
+  for (i = 0; i < NWORDS25-1; i++) {
+    h[i+1] = VADD(h[i+1], VSHR(h[i], (i & 1) ? 25 : 26));
+    h[i] = VAND(h[i], (i & 1) ? VMASK25 : VMASK26);
+  }
+  h[9] = VAND(h[9], VMASK25);
+
+  w0 = VOR(VOR(h[0], VSHL(h[1], 26)), VSHL(h[2], 51));
+  w1 = VOR(VOR(VSHR(h[2], 13), VSHL(h[3], 13)), VSHL(h[4], 38));
+  w2 = VOR(VOR(h[5], VSHL(h[6], 25)), VSHL(h[7], 51));
+  w3 = VOR(VOR(VSHR(h[7], 13), VSHL(h[8], 12)), VSHL(h[9], 38));
+
+  // transpose back: the i-th vector holds the four words of the i-th string
+  t0 = _mm256_unpacklo_epi64(w0, w1);
+  t1 = _mm256_unpackhi_epi64(w0, w1);
+  t2 = _mm256_unpacklo_epi64(w2, w3);
+  t3 = _mm256_unpackhi_epi64(w2, w3);
+  VSTOREU(r[0], _mm256_permute2x128_si256(t0, t2, 0x20));
+  VSTOREU(r[1], _mm256_permute2x128_si256(t1, t3, 0x20));
+  VSTOREU(r[2], _mm256_permute2x128_si256(t0, t2, 0x31));
+  VSTOREU(r[3], _mm256_permute2x128_si256(t1, t3, 0x31));
+}
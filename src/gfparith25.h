@@ -0,0 +1,35 @@
+/**
+ *******************************************************************************
+ * @file gfparith25.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of field arithmetic in radix 2^25.5.
+ *
+ * @details 
+ * This file contains some constants and function prototypes of the (4*1)-way 
+ * radix-2^25.5 multiplication and squaring (for comparison with radix 2^29).
+ *******************************************************************************
+ */
+
+#ifndef _GFPARITH25_H
+#define _GFPARITH25_H
+
+#include "intrin.h"
+#include <stdint.h>
+
+// ten limbs of 26, 25, 26, ..., 25 bits, modulo p = 2^255-19
+#define NWORDS25 10
+#define MASK25 0x1FFFFFFUL
+#define MASK26 0x3FFFFFFUL
+
+// function prototypes
+
+void mpi25_gfp_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi25_gfp_sqr_avx2(__m256i *r, const __m256i *a);
+void mpi25_conv_bytes2mpi25_avx2(__m256i *r, const uint8_t (*a)[32]);
+void mpi25_conv_mpi252bytes_avx2(uint8_t (*r)[32], const __m256i *a);
+
+#endif
@@ -0,0 +1,391 @@
+/**
+ *******************************************************************************
+ * @file gfparith448.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of field arithmetic modulo p = 2^448 - 2^224 - 1.
+ *
+ * @details
+ * This file contains (4*1)-way parallel field operations of X448 in radix
+ * 2^28. The prime is a "golden-ratio" trinomial, so the multiplication is a
+ * one-level Karatsuba on the two halves of 8 limbs, whose reduction is the
+ * same: (a0 + a1*t)(b0 + b1*t) = a0*b0 + a1*b1 + ((a0+a1)(b0+b1) - a0*b0)*t
+ * mod p with t = 2^224 (three 8x8 products instead of four). The carries of
+ * the two halves are propagated in two parallel chains.
+ *******************************************************************************
+ */
+
+#include "gfparith448.h"
+
+
+/**
+ * @brief Carry propagation of a field element.
+ *
+ * @details
+ * Propagate the carries of 16 columns < 2^63 to get a reduced element (limbs
+ * < 2^28 + 2^10). The chains of the limbs 0-7 and 8-15 run in parallel, the
+ * carry out of limb 15 (weight 2^448) is added to the limbs 0 and 8.
+ *
+ * @param r Field element
+ * @param c Columns
+ */
+static void mpi28_carry448_avx2(__m256i *r, __m256i *c)
+{
+  const __m256i VMASK28 = VSET164(MASK28);
+  __m256i t;
+  int i;
+
+  for (i = 0; i < 7; i++) {
+    c[i+1] = VADD(c[i+1], VSHR(c[i], BITS28));
+    c[i]   = VAND(c[i], VMASK28);
+    c[i+9] = VADD(c[i+9], VSHR(c[i+8], BITS28));
+    c[i+8] = VAND(c[i+8], VMASK28);
+  }
+  c[8] = VADD(c[8], VSHR(c[7], BITS28));
+  c[7] = VAND(c[7], VMASK28);
+  t = VSHR(c[15], BITS28);
+  c[15] = VAND(c[15], VMASK28);
+  c[0] = VADD(c[0], t);
+  c[8] = VADD(c[8], t);
+  c[1] = VADD(c[1], VSHR(c[0], BITS28));
+  c[0] = VAND(c[0], VMASK28);
+  c[9] = VADD(c[9], VSHR(c[8], BITS28));
+  c[8] = VAND(c[8], VMASK28);
+
+  for (i = 0; i < NWORDS448; i++) r[i] = c[i];
+}
+
+
+/**
+ * @brief Conditional swap (cswap).
+ *
+ * @details
+ * Replace (r,a) with (a,r) if b == 1;
+ * replace (r,a) with (r,a) if b == 0.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Swapping flag
+ */
+void mpi28_cswap448_avx2(__m256i *r, __m256i *a, const __m256i b)
+{
+  const __m256i mask = VSUB(VZERO, b);
+  __m256i x;
+  int i;
+
+  for (i = 0; i < NWORDS448; i++) {
+    x = VAND(VXOR(r[i], a[i]), mask);
+    r[i] = VXOR(r[i], x);
+    a[i] = VXOR(a[i], x);
+  }
+}
+
+
+/**
+ * @brief Copy.
+ *
+ * @details
+ * Copy a to r.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi28_copy448_avx2(__m256i *r, const __m256i *a)
+{
+  int i;
+
+  for (i = 0; i < NWORDS448; i++) r[i] = a[i];
+}
+
+
+/**
+ * @brief Field addition.
+ *
+ * @details
+ * r = a + b mod p, the sum is carried.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi28_gfp448_add_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i c[NWORDS448];
+  int i;
+
+  for (i = 0; i < NWORDS448; i++) c[i] = VADD(a[i], b[i]);
+  mpi28_carry448_avx2(r, c);
+}
+
+
+/**
+ * @brief Field subtraction.
+ *
+ * @details
+ * r = a - b mod p, computed as a + 2p - b (b must be reduced) and carried.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi28_gfp448_sub_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  const __m256i twop = VSET164(2*MASK28);
+  const __m256i twop8 = VSET164(2*MASK28 - 2);
+  __m256i c[NWORDS448];
+  int i;
+
+  for (i = 0; i < NWORDS448; i++) c[i] = VSUB(VADD(a[i], twop), b[i]);
+  c[8] = VSUB(VADD(a[8], twop8), b[8]);
+  mpi28_carry448_avx2(r, c);
+}
+
+
+/**
+ * @brief 8x8-limb product.
+ *
+ * @details
+ * The 15 columns c = a * b of two halves (product scanning).
+ *
+ * @param c Columns
+ * @param a Half of a field element
+ * @param b Half of a field element
+ */
+static inline void mpi28_mul8_avx2(__m256i *c, const __m256i *a, const __m256i *b)
+{
+  int i, j;
+
+  for (i = 0; i < 15; i++) c[i] = VZERO;
+  for (i = 0; i < 8; i++)
+    for (j = 0; j < 8; j++) c[i+j] = VMAC(c[i+j], a[i], b[j]);
+}
+
+
+/**
+ * @brief 8-limb square.
+ *
+ * @details
+ * The 15 columns c = a^2 of a half, the cross products are multiplied by the
+ * pre-doubled limbs (36 multiplications).
+ *
+ * @param c Columns
+ * @param a Half of a field element
+ */
+static inline void mpi28_sqr8_avx2(__m256i *c, const __m256i *a)
+{
+  __m256i d[8];
+  int i, j;
+
+  for (i = 0; i < 8; i++) d[i] = VADD(a[i], a[i]);
+  for (i = 0; i < 15; i++) c[i] = VZERO;
+  for (i = 0; i < 8; i++) {
+    c[2*i] = VMAC(c[2*i], a[i], a[i]);
+    for (j = i+1; j < 8; j++) c[i+j] = VMAC(c[i+j], d[i], a[j]);
+  }
+}
+
+
+/**
+ * @brief Reduction of the three Karatsuba products.
+ *
+ * @details
+ * r = p0 + p1 + (p2 - p0)*2^224 mod p, where the columns 16+i of the sum are
+ * folded into the columns i and 8+i (2^448 = 2^224 + 1), then carried. All
+ * columns of p2 are at least those of p0, so the columns stay unsigned.
+ *
+ * @param r Field element
+ * @param p0 Columns of a0*b0
+ * @param p1 Columns of a1*b1
+ * @param p2 Columns of (a0+a1)*(b0+b1)
+ */
+static inline void mpi28_kara_reduce448_avx2(__m256i *r, const __m256i *p0,
+  const __m256i *p1, const __m256i *p2)
+{
+  __m256i c[23];
+  int i;
+
+  for (i = 0; i < 8; i++) c[i] = VADD(p0[i], p1[i]);
+  for (i = 8; i < 15; i++) c[i] = VADD(VADD(p0[i], p1[i]), VSUB(p2[i-8], p0[i-8]));
+  c[15] = VSUB(p2[7], p0[7]);
+  for (i = 8; i < 15; i++) c[i+8] = VSUB(p2[i], p0[i]);
+  for (i = 0; i < 7; i++) {
+    c[i]   = VADD(c[i], c[i+16]);
+    c[i+8] = VADD(c[i+8], c[i+16]);
+  }
+  mpi28_carry448_avx2(r, c);
+}
+
+
+/**
+ * @brief Field multiplication.
+ *
+ * @details
+ * r = a * b mod p, one-level Karatsuba (192 multiplications).
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi28_gfp448_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i as[8], bs[8], p0[15], p1[15], p2[15];
+  int i;
+
+  for (i = 0; i < 8; i++) {
+    as[i] = VADD(a[i], a[i+8]);
+    bs[i] = VADD(b[i], b[i+8]);
+  }
+  mpi28_mul8_avx2(p0, a, b);
+  mpi28_mul8_avx2(p1, a+8, b+8);
+  mpi28_mul8_avx2(p2, as, bs);
+  mpi28_kara_reduce448_avx2(r, p0, p1, p2);
+}
+
+
+/**
+ * @brief Field squaring.
+ *
+ * @details
+ * r = a^2 mod p, the Karatsuba of the multiplication with three squares of
+ * halves (108 multiplications).
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi28_gfp448_sqr_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i as[8], p0[15], p1[15], p2[15];
+  int i;
+
+  for (i = 0; i < 8; i++) as[i] = VADD(a[i], a[i+8]);
+  mpi28_sqr8_avx2(p0, a);
+  mpi28_sqr8_avx2(p1, a+8);
+  mpi28_sqr8_avx2(p2, as);
+  mpi28_kara_reduce448_avx2(r, p0, p1, p2);
+}
+
+
+/**
+ * @brief Multiplication by a small constant.
+ *
+ * @details
+ * r = a * b mod p, where b < 2^28 (e.g. (A+2)/4 = 39081).
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b 28-bit integer
+ */
+void mpi28_gfp448_mul28_avx2(__m256i *r, const __m256i *a, const uint32_t b)
+{
+  const __m256i vb = VSET164(b);
+  __m256i c[NWORDS448];
+  int i;
+
+  for (i = 0; i < NWORDS448; i++) c[i] = VMUL(a[i], vb);
+  mpi28_carry448_avx2(r, c);
+}
+
+
+/**
+ * @brief Repeated squaring.
+ *
+ * @details
+ * r = a^(2^n) mod p.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param n Number of squarings, n >= 1
+ */
+static void mpi28_gfp448_sqrn_avx2(__m256i *r, const __m256i *a, int n)
+{
+  mpi28_gfp448_sqr_avx2(r, a);
+  while (--n > 0) mpi28_gfp448_sqr_avx2(r, r);
+}
+
+
+/**
+ * @brief Field inversion.
+ *
+ * @details
+ * r = a^(p-2) mod p (447 squarings and 13 multiplications), where x_k denotes
+ * a^(2^k - 1); the inverse of 0 is 0.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi28_gfp448_inv_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i x3[NWORDS448], x6[NWORDS448], x24[NWORDS448], x222[NWORDS448];
+  __m256i t[NWORDS448], u[NWORDS448];
+
+  mpi28_gfp448_sqr_avx2(t, a);
+  mpi28_gfp448_mul_avx2(t, t, a);             // x2
+  mpi28_gfp448_sqr_avx2(t, t);
+  mpi28_gfp448_mul_avx2(x3, t, a);            // x3
+  mpi28_gfp448_sqrn_avx2(t, x3, 3);
+  mpi28_gfp448_mul_avx2(x6, t, x3);           // x6
+  mpi28_gfp448_sqrn_avx2(t, x6, 6);
+  mpi28_gfp448_mul_avx2(u, t, x6);            // x12
+  mpi28_gfp448_sqrn_avx2(t, u, 12);
+  mpi28_gfp448_mul_avx2(x24, t, u);           // x24
+  mpi28_gfp448_sqrn_avx2(t, x24, 24);
+  mpi28_gfp448_mul_avx2(u, t, x24);           // x48
+  mpi28_gfp448_sqrn_avx2(t, u, 48);
+  mpi28_gfp448_mul_avx2(u, t, u);             // x96
+  mpi28_gfp448_sqrn_avx2(t, u, 96);
+  mpi28_gfp448_mul_avx2(u, t, u);             // x192
+  mpi28_gfp448_sqrn_avx2(t, u, 24);
+  mpi28_gfp448_mul_avx2(u, t, x24);           // x216
+  mpi28_gfp448_sqrn_avx2(t, u, 6);
+  mpi28_gfp448_mul_avx2(x222, t, x6);         // x222
+  mpi28_gfp448_sqr_avx2(t, x222);
+  mpi28_gfp448_mul_avx2(u, t, a);             // x223
+  mpi28_gfp448_sqrn_avx2(t, u, 223);
+  mpi28_gfp448_mul_avx2(u, t, x222);          // 2^446 - 2^223 - 1
+  mpi28_gfp448_sqrn_avx2(t, u, 2);
+  mpi28_gfp448_mul_avx2(r, t, a);             // p - 2
+}
+
+
+/**
+ * @brief The final reduction to [0, p).
+ *
+ * @details
+ * Three sequential carry passes bring a reduced element to [0, 2^448) with
+ * limbs < 2^28, then p is subtracted (by adding 2^224 + 1 and dropping the
+ * carry out of 2^448) in those lanes where the element is not below p.
+ *
+ * @param a Field element
+ */
+void mpi28_gfp448_final_avx2(__m256i *a)
+{
+  const __m256i VMASK28 = VSET164(MASK28);
+  const __m256i one = VSET164(1);
+  __m256i b[NWORDS448], t, mask;
+  int i, k;
+
+  for (k = 0; k < 3; k++) {
+    for (i = 0; i < NWORDS448-1; i++) {
+      a[i+1] = VADD(a[i+1], VSHR(a[i], BITS28));
+      a[i]   = VAND(a[i], VMASK28);
+    }
+    t = VSHR(a[15], BITS28);
+    a[15] = VAND(a[15], VMASK28);
+    a[0] = VADD(a[0], t);
+    a[8] = VADD(a[8], t);
+  }
+
+  for (i = 0; i < NWORDS448; i++) b[i] = a[i];
+  b[0] = VADD(b[0], one);
+  b[8] = VADD(b[8], one);
+  for (i = 0; i < NWORDS448-1; i++) {
+    b[i+1] = VADD(b[i+1], VSHR(b[i], BITS28));
+    b[i]   = VAND(b[i], VMASK28);
+  }
+  mask = VSUB(VZERO, VSHR(b[15], BITS28));
+  b[15] = VAND(b[15], VMASK28);
+  for (i = 0; i < NWORDS448; i++) a[i] = VXOR(a[i], VAND(VXOR(a[i], b[i]), mask));
+}
@@ -0,0 +1,51 @@
+/**
+ *******************************************************************************
+ * @file gfparith448.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of field arithmetic modulo p = 2^448 - 2^224 - 1.
+ *
+ * @details
+ * This file contains some constants and function prototypes of the field
+ * arithmetic of X448 (Goldilocks prime), with 4-way radix-2^28 elements.
+ *******************************************************************************
+ */
+
+#ifndef _GFPARITH448_H
+#define _GFPARITH448_H
+
+#include "intrin.h"
+#include <stdint.h>
+
+// we use a radix-2^28 for the field elements, 16 limbs in two halves of 8:
+// limb 8 has the weight 2^224, so 2^448 = 2^224 + 1 (mod p) folds a limb
+// 16+i into the limbs i and 8+i
+#define NWORDS448 16
+#define BITS28 28
+#define MASK28 0xFFFFFFFUL
+#define CONSTA24_448 39081  // (A+2)/4 of curve448, A = 156326
+
+// bounds of the limbs ("reduced" means limbs < 2^28 + 2^10):
+// - every function carries its result, so all results are reduced
+// - sub takes a reduced subtrahend (it adds 2p, whose limbs are 2^29 - 4)
+// - mul/sqr take reduced operands: a column of the reduced product adds up
+//   at most 16 products of limbs (< 2^56) and 16 products of the sums of two
+//   limbs of the Karatsuba middle product (< 2^58), i.e. it is < 1.25*2^62
+// - the conversion to bytes reduces to [0, p)
+
+// function prototypes
+
+void mpi28_gfp448_add_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi28_gfp448_sub_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi28_gfp448_mul_avx2(__m256i *r, const __m256i *a, const __m256i *b);
+void mpi28_gfp448_mul28_avx2(__m256i *r, const __m256i *a, const uint32_t b);
+void mpi28_gfp448_sqr_avx2(__m256i *r, const __m256i *a);
+void mpi28_gfp448_inv_avx2(__m256i *r, const __m256i *a);
+void mpi28_gfp448_final_avx2(__m256i *a);
+void mpi28_cswap448_avx2(__m256i *r, __m256i *a, const __m256i b);
+void mpi28_copy448_avx2(__m256i *r, const __m256i *a);
+
+#endif
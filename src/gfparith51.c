@@ -0,0 +1,339 @@
+/**
+ *******************************************************************************
+ * @file gfparith51.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of portable 64-bit field arithmetic.
+ *
+ * @details 
+ * This file contains (1*1)-way field operations in plain C. A field element 
+ * consists of five 51-bit limbs, the products of two limbs are accumulated in 
+ * 128-bit integers. Additions and subtractions leave the limbs unreduced (up 
+ * to 53 bits), which is absorbed by the following multiplication.
+ *******************************************************************************
+ */
+
+#include "gfparith51.h"
+
+
+/**
+ * @brief Conditional swap.
+ *
+ * @details
+ * Replace (r,a) with (a,r) if b == 1;
+ * replace (r,a) with (r,a) if b == 0.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Swapping flag
+ */
+void mpi51_cswap_c64(uint64_t *r, uint64_t *a, const uint64_t b)
+{
+  const uint64_t mask = 0 - b;
+  uint64_t x;
+  int i;
+
+  for (i = 0; i < NWORDS51; i++) {
+    x = (r[i] ^ a[i]) & mask;
+    r[i] ^= x;
+    a[i] ^= x;
+  }
+}
+
+
+/**
+ * @brief Field addition.
+ *
+ * @details
+ * r = a + b.
+ * This is an ordinary addtion without reduction operation.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi51_gfp_add_c64(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  r[0] = a[0] + b[0];
+  r[1] = a[1] + b[1];
+  r[2] = a[2] + b[2];
+  r[3] = a[3] + b[3];
+  r[4] = a[4] + b[4];
+}
+
+
+/**
+ * @brief Field subtraction (no carry propagation and modular recution).
+ *
+ * @details
+ * r = 2p + a - b.
+ * It adds 2p to avoid any negative intermediate values, the operand b must 
+ * have limbs of (at most) 51 bits plus a small carry.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi51_gfp_sub_c64(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  r[0] = (a[0] + LSWP51) - b[0];
+  r[1] = (a[1] + WRDP51) - b[1];
+  r[2] = (a[2] + WRDP51) - b[2];
+  r[3] = (a[3] + WRDP51) - b[3];
+  r[4] = (a[4] + WRDP51) - b[4];
+}
+
+
+/**
+ * @brief Field multiplication.
+ *
+ * @details
+ * r = a * b mod p.
+ * The limbs of the upper half of the product are multiplied by 19 in advance 
+ * (operand scanning with 2^255 = 19 mod p), followed by a carry propagation.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi51_gfp_mul_c64(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  const uint64_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  const uint64_t b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  const uint64_t c1 = 19*b1, c2 = 19*b2, c3 = 19*b3, c4 = 19*b4;
+  uint128_t t0, t1, t2, t3, t4;
+  uint64_t r0, r1, r2, r3, r4, carry;
+
+  t0 = (uint128_t)a0*b0 + (uint128_t)a1*c4 + (uint128_t)a2*c3 + (uint128_t)a3*c2 + (uint128_t)a4*c1;
+  t1 = (uint128_t)a0*b1 + (uint128_t)a1*b0 + (uint128_t)a2*c4 + (uint128_t)a3*c3 + (uint128_t)a4*c2;
+  t2 = (uint128_t)a0*b2 + (uint128_t)a1*b1 + (uint128_t)a2*b0 + (uint128_t)a3*c4 + (uint128_t)a4*c3;
+  t3 = (uint128_t)a0*b3 + (uint128_t)a1*b2 + (uint128_t)a2*b1 + (uint128_t)a3*b0 + (uint128_t)a4*c4;
+  t4 = (uint128_t)a0*b4 + (uint128_t)a1*b3 + (uint128_t)a2*b2 + (uint128_t)a3*b1 + (uint128_t)a4*b0;
+
+  // carry propagation
+  r0 = (uint64_t)t0 & MASK51; t1 += (uint64_t)(t0 >> BITS51);
+  r1 = (uint64_t)t1 & MASK51; t2 += (uint64_t)(t1 >> BITS51);
+  r2 = (uint64_t)t2 & MASK51; t3 += (uint64_t)(t2 >> BITS51);
+  r3 = (uint64_t)t3 & MASK51; t4 += (uint64_t)(t3 >> BITS51);
+  r4 = (uint64_t)t4 & MASK51; carry = (uint64_t)(t4 >> BITS51);
+  r0 += 19*carry; 
+  r1 += r0 >> BITS51; r0 &= MASK51;
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
+}
+
+
+/**
+ * @brief Field scalar multiplication.
+ *
+ * @details
+ * r = b * a mod p.
+ * The modular multiplication between a field element "a" and a 32-bit integer 
+ * "b". 
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b 32-bit integer
+ */
+void mpi51_gfp_mul51_c64(uint64_t *r, const uint64_t *a, const uint64_t b)
+{
+  uint128_t t0, t1, t2, t3, t4;
+  uint64_t r0, r1, r2, r3, r4, carry;
+
+  t0 = (uint128_t)a[0]*b; t1 = (uint128_t)a[1]*b; t2 = (uint128_t)a[2]*b;
+  t3 = (uint128_t)a[3]*b; t4 = (uint128_t)a[4]*b;
+
+  r0 = (uint64_t)t0 & MASK51; t1 += (uint64_t)(t0 >> BITS51);
+  r1 = (uint64_t)t1 & MASK51; t2 += (uint64_t)(t1 >> BITS51);
+  r2 = (uint64_t)t2 & MASK51; t3 += (uint64_t)(t2 >> BITS51);
+  r3 = (uint64_t)t3 & MASK51; t4 += (uint64_t)(t3 >> BITS51);
+  r4 = (uint64_t)t4 & MASK51; carry = (uint64_t)(t4 >> BITS51);
+  r0 += 19*carry; 
+  r1 += r0 >> BITS51; r0 &= MASK51;
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
+}
+
+
+/**
+ * @brief Field squaring.
+ *
+ * @details
+ * r = a^2 mod p.
+ * The cross products are computed once with a doubled operand.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi51_gfp_sqr_c64(uint64_t *r, const uint64_t *a)
+{
+  const uint64_t a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  const uint64_t d0 = 2*a0, d1 = 2*a1, d2 = 2*a2, d3 = 2*a3;
+  const uint64_t c3 = 19*a3, c4 = 19*a4;
+  uint128_t t0, t1, t2, t3, t4;
+  uint64_t r0, r1, r2, r3, r4, carry;
+
+  t0 = (uint128_t)a0*a0 + (uint128_t)d1*c4 + (uint128_t)d2*c3;
+  t1 = (uint128_t)d0*a1 + (uint128_t)d2*c4 + (uint128_t)a3*c3;
+  t2 = (uint128_t)d0*a2 + (uint128_t)a1*a1 + (uint128_t)d3*c4;
+  t3 = (uint128_t)d0*a3 + (uint128_t)d1*a2 + (uint128_t)a4*c4;
+  t4 = (uint128_t)d0*a4 + (uint128_t)d1*a3 + (uint128_t)a2*a2;
+
+  r0 = (uint64_t)t0 & MASK51; t1 += (uint64_t)(t0 >> BITS51);
+  r1 = (uint64_t)t1 & MASK51; t2 += (uint64_t)(t1 >> BITS51);
+  r2 = (uint64_t)t2 & MASK51; t3 += (uint64_t)(t2 >> BITS51);
+  r3 = (uint64_t)t3 & MASK51; t4 += (uint64_t)(t3 >> BITS51);
+  r4 = (uint64_t)t4 & MASK51; carry = (uint64_t)(t4 >> BITS51);
+  r0 += 19*carry; 
+  r1 += r0 >> BITS51; r0 &= MASK51;
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
+}
+
+
+/**
+ * @brief Field multiplicative inversion.
+ *
+ * @details
+ * r = a^-1 mod p.
+ * This function computes the multiplicative inverse of an element with the 
+ * same addition chain as the vectorized versions.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi51_gfp_inv_c64(uint64_t *r, const uint64_t *a)
+{
+  uint64_t t0[NWORDS51], t1[NWORDS51], t2[NWORDS51], t3[NWORDS51];
+  int i;
+
+  mpi51_gfp_sqr_c64(t0, a);
+  mpi51_gfp_sqr_c64(t1, t0);
+  mpi51_gfp_sqr_c64(t1, t1);
+  mpi51_gfp_mul_c64(t1, a, t1);
+  mpi51_gfp_mul_c64(t0, t0, t1);
+  mpi51_gfp_sqr_c64(t2, t0);
+  mpi51_gfp_mul_c64(t1, t1, t2);
+  mpi51_gfp_sqr_c64(t2, t1);
+  for (i = 0; i < 4; i++) mpi51_gfp_sqr_c64(t2, t2);
+  mpi51_gfp_mul_c64(t1, t2, t1);
+  mpi51_gfp_sqr_c64(t2, t1);
+  for (i = 0; i < 9; i++) mpi51_gfp_sqr_c64(t2, t2);
+  mpi51_gfp_mul_c64(t2, t2, t1);
+  mpi51_gfp_sqr_c64(t3, t2);
+  for (i = 0; i < 19; i++) mpi51_gfp_sqr_c64(t3, t3);
+  mpi51_gfp_mul_c64(t2, t3, t2);
+  mpi51_gfp_sqr_c64(t2, t2);
+  for (i = 0; i < 9; i++) mpi51_gfp_sqr_c64(t2, t2);
+  mpi51_gfp_mul_c64(t1, t2, t1);
+  mpi51_gfp_sqr_c64(t2, t1);
+  for (i = 0; i < 49; i++) mpi51_gfp_sqr_c64(t2, t2);
+  mpi51_gfp_mul_c64(t2, t2, t1);
+  mpi51_gfp_sqr_c64(t3, t2);
+  for (i = 0; i < 99; i++) mpi51_gfp_sqr_c64(t3, t3);
+  mpi51_gfp_mul_c64(t2, t3, t2);
+  mpi51_gfp_sqr_c64(t2, t2);
+  for (i = 0; i < 49; i++) mpi51_gfp_sqr_c64(t2, t2);
+  mpi51_gfp_mul_c64(t1, t2, t1);
+  mpi51_gfp_sqr_c64(t1, t1);
+  for (i = 0; i < 4; i++) mpi51_gfp_sqr_c64(t1, t1);
+  mpi51_gfp_mul_c64(r, t1, t0);
+}
+
+
+/**
+ * @brief Copy.
+ *
+ * @details
+ * Copy a to r.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi51_copy_c64(uint64_t *r, const uint64_t *a)
+{
+  r[0] = a[0];
+  r[1] = a[1];
+  r[2] = a[2];
+  r[3] = a[3];
+  r[4] = a[4];
+}
+
+
+/**
+ * @brief Conversion from a byte string.
+ *
+ * @details
+ * Decode a 32-byte little-endian string (RFC 7748) to a field element, the 
+ * most significant bit is masked.
+ *
+ * @param r Field element
+ * @param a Byte string
+ */
+void mpi51_from_bytes_c64(uint64_t *r, const uint8_t *a)
+{
+  uint64_t w[4];
+  int i, j;
+
+  for (i = 0; i < 4; i++) {
+    w[i] = 0;
+    for (j = 7; j >= 0; j--) w[i] = (w[i] << 8) | a[8*i+j];
+  }
+
+  r[0] = w[0] & MASK51;
+  r[1] = ((w[0] >> 51) | (w[1] << 13)) & MASK51;
+  r[2] = ((w[1] >> 38) | (w[2] << 26)) & MASK51;
+  r[3] = ((w[2] >> 25) | (w[3] << 39)) & MASK51;
+  r[4] = (w[3] >> 12) & MASK51;
+}
+
+
+/**
+ * @brief Conversion to a byte string.
+ *
+ * @details
+ * Reduce a field element to [0, 2^255-19) and encode it as a 32-byte 
+ * little-endian string.
+ *
+ * @param r Byte string
+ * @param a Field element
+ */
+void mpi51_to_bytes_c64(uint8_t *r, const uint64_t *a)
+{
+  uint64_t t[NWORDS51], w[4], q;
+  int i, j;
+
+  // carry propagation, the element becomes smaller than 2^255 + 2^51
+  t[0] = a[0]; t[1] = a[1]; t[2] = a[2]; t[3] = a[3]; t[4] = a[4];
+  t[1] += t[0] >> BITS51; t[0] &= MASK51;
+  t[2] += t[1] >> BITS51; t[1] &= MASK51;
+  t[3] += t[2] >> BITS51; t[2] &= MASK51;
+  t[4] += t[3] >> BITS51; t[3] &= MASK51;
+  t[0] += 19*(t[4] >> BITS51); t[4] &= MASK51;
+  t[1] += t[0] >> BITS51; t[0] &= MASK51;
+
+  // q = 1 iff t >= p, i.e. iff t+19 >= 2^255
+  q = (t[0] + 19) >> BITS51;
+  q = (t[1] + q) >> BITS51;
+  q = (t[2] + q) >> BITS51;
+  q = (t[3] + q) >> BITS51;
+  q = (t[4] + q) >> BITS51;
+
+  // t = t + 19*q - 2^255*q
+  t[0] += 19*q;
+  t[1] += t[0] >> BITS51; t[0] &= MASK51;
+  t[2] += t[1] >> BITS51; t[1] &= MASK51;
+  t[3] += t[2] >> BITS51; t[2] &= MASK51;
+  t[4] += t[3] >> BITS51; t[3] &= MASK51;
+  t[4] &= MASK51;
+
+  w[0] = (t[0]      ) | (t[1] << 51);
+  w[1] = (t[1] >> 13) | (t[2] << 38);
+  w[2] = (t[2] >> 26) | (t[3] << 25);
+  w[3] = (t[3] >> 39) | (t[4] << 12);
+  for (i = 0; i < 4; i++)
+    for (j = 0; j < 8; j++) r[8*i+j] = (uint8_t)(w[i] >> (8*j));
+}
@@ -0,0 +1,46 @@
+/**
+ *******************************************************************************
+ * @file gfparith51.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of portable 64-bit field arithmetic.
+ *
+ * @details 
+ * This file contains some constants and function prototypes of the scalar 
+ * field arithmetic that is used when no vector extension is available. 
+ *******************************************************************************
+ */
+
+#ifndef _GFPARITH51_H
+#define _GFPARITH51_H
+
+#include <stdint.h>
+
+// we use a radix-2^51 for the field elements
+#define NWORDS51 5
+#define BITS51 51
+#define MASK51 0x7FFFFFFFFFFFFULL
+#define CONSTA 486662
+// least significant and other 51-bit limbs of 2*(2^255 - 19) = 2^256 - 38
+#define LSWP51 0xFFFFFFFFFFFDAULL
+#define WRDP51 0xFFFFFFFFFFFFEULL
+
+// 128-bit products of the limbs
+__extension__ typedef unsigned __int128 uint128_t;
+
+// function prototypes
+
+void mpi51_gfp_add_c64(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void mpi51_gfp_sub_c64(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void mpi51_gfp_mul_c64(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void mpi51_gfp_mul51_c64(uint64_t *r, const uint64_t *a, const uint64_t b);
+void mpi51_gfp_sqr_c64(uint64_t *r, const uint64_t *a);
+void mpi51_gfp_inv_c64(uint64_t *r, const uint64_t *a);
+void mpi51_cswap_c64(uint64_t *r, uint64_t *a, const uint64_t b);
+void mpi51_copy_c64(uint64_t *r, const uint64_t *a);
+void mpi51_from_bytes_c64(uint64_t *r, const uint8_t *a);
+void mpi51_to_bytes_c64(uint8_t *r, const uint64_t *a);
+#endif
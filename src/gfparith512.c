@@ -0,0 +1,502 @@
+/**
+ *******************************************************************************
+ * @file gfparith512.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of AVX-512IFMA field arithmetic.
+ *
+ * @details
+ * This file contains (8*1)-way vectorized field operations.
+ * A field element consists of five 52-bit limbs (radix 2^52) in the 64-bit
+ * lanes of zmm registers. Since vpmadd52luq/huq only take the lower 52 bits of
+ * their operands into account, every operation returns limbs that are smaller
+ * than 2^52 (the most significant one is smaller than 2^48), i.e. there is no
+ * room for a lazy addition as in the radix-2^29 representation. The elements
+ * are kept slightly above 2^255 at most, but not necessarily below p.
+ *******************************************************************************
+ */
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__)
+
+#include "gfparith512.h"
+
+
+/**
+ * @brief Conditional swap.
+ *
+ * @details
+ * Replace (r,a) with (a,r) if b == 1;
+ * replace (r,a) with (r,a) if b == 0.
+ * The swapping flag of each lane is turned into a mask register that selects
+ * the lanes to be exchanged by blend operations.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Swapping flag
+ */
+void mpi52_cswap_avx512(__m512i *r, __m512i *a, const __m512i b)
+{
+  __m512i r0 = r[0], r1 = r[1], r2 = r[2], r3 = r[3], r4 = r[4];
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  const __mmask8 mask = ZTEST(b, b);
+
+  r[0] = ZBLEND(mask, r0, a0); a[0] = ZBLEND(mask, a0, r0);
+  r[1] = ZBLEND(mask, r1, a1); a[1] = ZBLEND(mask, a1, r1);
+  r[2] = ZBLEND(mask, r2, a2); a[2] = ZBLEND(mask, a2, r2);
+  r[3] = ZBLEND(mask, r3, a3); a[3] = ZBLEND(mask, a3, r3);
+  r[4] = ZBLEND(mask, r4, a4); a[4] = ZBLEND(mask, a4, r4);
+}
+
+
+/**
+ * @brief Field addition.
+ *
+ * @details
+ * r = a + b mod p.
+ * The sum is normalized to 52-bit limbs so that it can be used as an operand
+ * of the IFMA-based multiplication.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi52_gfp_add_avx512(__m512i *r, const __m512i *a, const __m512i *b)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  __m512i r0, r1, r2, r3, r4, temp;
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i V19 = ZSET164(19);
+
+  r0 = ZADD(a0, b0); r1 = ZADD(a1, b1); r2 = ZADD(a2, b2);
+  r3 = ZADD(a3, b3); r4 = ZADD(a4, b4);
+
+  // modulo-p reduction of the bits above 2^255 and carry propagation
+  temp = ZSHR(r4, BITS47); r4 = ZAND(r4, VMASK47);
+  r0 = ZMADDLO(r0, temp, V19);
+  r1 = ZADD(r1, ZSHR(r0, BITS52)); r0 = ZAND(r0, VMASK52);
+  r2 = ZADD(r2, ZSHR(r1, BITS52)); r1 = ZAND(r1, VMASK52);
+  r3 = ZADD(r3, ZSHR(r2, BITS52)); r2 = ZAND(r2, VMASK52);
+  r4 = ZADD(r4, ZSHR(r3, BITS52)); r3 = ZAND(r3, VMASK52);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
+}
+
+
+/**
+ * @brief Field subtraction.
+ *
+ * @details
+ * r = 64p + a - b mod p.
+ * This is a modular subtraction. It adds 64p to avoid any negative intermediate
+ * values and normalizes the difference to 52-bit limbs.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi52_gfp_sub_avx512(__m512i *r, const __m512i *a, const __m512i *b)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  __m512i r0, r1, r2, r3, r4, temp;
+  const __m512i VLSWP   = ZSET164(LSWP52);
+  const __m512i VWRDP   = ZSET164(WRDP52);
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i V19 = ZSET164(19);
+
+  // NOTE: as in the AVX2 version, (a[i]-b[i]) is put at the latter position.
+  r0 = ZADD(VLSWP, ZSUB(a0, b0));
+  r1 = ZADD(VWRDP, ZSUB(a1, b1));
+  r2 = ZADD(VWRDP, ZSUB(a2, b2));
+  r3 = ZADD(VWRDP, ZSUB(a3, b3));
+  r4 = ZADD(VWRDP, ZSUB(a4, b4));
+
+  // modulo-p reduction of the bits above 2^255 and carry propagation
+  temp = ZSHR(r4, BITS47); r4 = ZAND(r4, VMASK47);
+  r0 = ZMADDLO(r0, temp, V19);
+  r1 = ZADD(r1, ZSHR(r0, BITS52)); r0 = ZAND(r0, VMASK52);
+  r2 = ZADD(r2, ZSHR(r1, BITS52)); r1 = ZAND(r1, VMASK52);
+  r3 = ZADD(r3, ZSHR(r2, BITS52)); r2 = ZAND(r2, VMASK52);
+  r4 = ZADD(r4, ZSHR(r3, BITS52)); r3 = ZAND(r3, VMASK52);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
+}
+
+
+/**
+ * @brief Field multiplication.
+ *
+ * @details
+ * r = a * b mod p.
+ * This is a modular multiplication. The lower and higher halves of the 104-bit
+ * limb products are accumulated in the columns they belong to (product
+ * scanning), the upper five columns are then multiplied by 2^260 mod p = 608
+ * and added to the lower five columns.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi52_gfp_mul_avx512(__m512i *r, const __m512i *a, const __m512i *b)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i b0 = b[0], b1 = b[1], b2 = b[2], b3 = b[3], b4 = b[4];
+  __m512i z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  __m512i l5, l6, l7, l8, h5, h6, h7, h8, temp;
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i VCONSTC = ZSET164(CONSTC52);
+  const __m512i V19 = ZSET164(19);
+  const __m512i zero = ZZERO;
+
+  // product-scanning multiplication (lower halves to column i+j, higher
+  // halves to column i+j+1)
+  z0 = ZMADDLO(zero, a0, b0);
+
+  z1 = ZMADDHI(zero, a0, b0);
+  z1 = ZMADDLO(z1, a0, b1); z1 = ZMADDLO(z1, a1, b0);
+
+  z2 = ZMADDHI(zero, a0, b1); z2 = ZMADDHI(z2, a1, b0);
+  z2 = ZMADDLO(z2, a0, b2); z2 = ZMADDLO(z2, a1, b1); z2 = ZMADDLO(z2, a2, b0);
+
+  z3 = ZMADDHI(zero, a0, b2); z3 = ZMADDHI(z3, a1, b1); z3 = ZMADDHI(z3, a2, b0);
+  z3 = ZMADDLO(z3, a0, b3); z3 = ZMADDLO(z3, a1, b2); z3 = ZMADDLO(z3, a2, b1);
+  z3 = ZMADDLO(z3, a3, b0);
+
+  z4 = ZMADDHI(zero, a0, b3); z4 = ZMADDHI(z4, a1, b2); z4 = ZMADDHI(z4, a2, b1);
+  z4 = ZMADDHI(z4, a3, b0);
+  z4 = ZMADDLO(z4, a0, b4); z4 = ZMADDLO(z4, a1, b3); z4 = ZMADDLO(z4, a2, b2);
+  z4 = ZMADDLO(z4, a3, b1); z4 = ZMADDLO(z4, a4, b0);
+
+  z5 = ZMADDHI(zero, a0, b4); z5 = ZMADDHI(z5, a1, b3); z5 = ZMADDHI(z5, a2, b2);
+  z5 = ZMADDHI(z5, a3, b1); z5 = ZMADDHI(z5, a4, b0);
+  z5 = ZMADDLO(z5, a1, b4); z5 = ZMADDLO(z5, a2, b3); z5 = ZMADDLO(z5, a3, b2);
+  z5 = ZMADDLO(z5, a4, b1);
+
+  z6 = ZMADDHI(zero, a1, b4); z6 = ZMADDHI(z6, a2, b3); z6 = ZMADDHI(z6, a3, b2);
+  z6 = ZMADDHI(z6, a4, b1);
+  z6 = ZMADDLO(z6, a2, b4); z6 = ZMADDLO(z6, a3, b3); z6 = ZMADDLO(z6, a4, b2);
+
+  z7 = ZMADDHI(zero, a2, b4); z7 = ZMADDHI(z7, a3, b3); z7 = ZMADDHI(z7, a4, b2);
+  z7 = ZMADDLO(z7, a3, b4); z7 = ZMADDLO(z7, a4, b3);
+
+  z8 = ZMADDHI(zero, a3, b4); z8 = ZMADDHI(z8, a4, b3);
+  z8 = ZMADDLO(z8, a4, b4);
+
+  z9 = ZMADDHI(zero, a4, b4);
+
+  // split the upper columns into a 52-bit part and a (small) carry
+  l5 = ZAND(z5, VMASK52); h5 = ZSHR(z5, BITS52);
+  l6 = ZAND(z6, VMASK52); h6 = ZSHR(z6, BITS52);
+  l7 = ZAND(z7, VMASK52); h7 = ZSHR(z7, BITS52);
+  l8 = ZAND(z8, VMASK52); h8 = ZSHR(z8, BITS52);
+
+  // modulo-p reduction by 2^260 = 608 mod p
+  z0 = ZMADDLO(z0, l5, VCONSTC);
+  z1 = ZMADDHI(z1, l5, VCONSTC); z1 = ZMADDLO(z1, h5, VCONSTC);
+  z1 = ZMADDLO(z1, l6, VCONSTC);
+  z2 = ZMADDHI(z2, l6, VCONSTC); z2 = ZMADDLO(z2, h6, VCONSTC);
+  z2 = ZMADDLO(z2, l7, VCONSTC);
+  z3 = ZMADDHI(z3, l7, VCONSTC); z3 = ZMADDLO(z3, h7, VCONSTC);
+  z3 = ZMADDLO(z3, l8, VCONSTC);
+  z4 = ZMADDHI(z4, l8, VCONSTC); z4 = ZMADDLO(z4, h8, VCONSTC);
+  z4 = ZMADDLO(z4, z9, VCONSTC);
+  temp = ZMADDHI(zero, z9, VCONSTC);
+  z0 = ZMADDLO(z0, temp, VCONSTC);
+
+  // reduction of the bits above 2^255 and conversion to 52-bit limbs
+  temp = ZSHR(z4, BITS47); z4 = ZAND(z4, VMASK47);
+  z0 = ZMADDLO(z0, temp, V19);
+  z1 = ZADD(z1, ZSHR(z0, BITS52)); z0 = ZAND(z0, VMASK52);
+  z2 = ZADD(z2, ZSHR(z1, BITS52)); z1 = ZAND(z1, VMASK52);
+  z3 = ZADD(z3, ZSHR(z2, BITS52)); z2 = ZAND(z2, VMASK52);
+  z4 = ZADD(z4, ZSHR(z3, BITS52)); z3 = ZAND(z3, VMASK52);
+
+  r[0] = z0; r[1] = z1; r[2] = z2; r[3] = z3; r[4] = z4;
+}
+
+
+/**
+ * @brief Field scalar multiplication.
+ *
+ * @details
+ * r = b * a mod p.
+ * The modular multiplication between a field element "a" and a 52-bit integer
+ * "b".
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b 52-bit integer
+ */
+void mpi52_gfp_mul52_avx512(__m512i *r, const __m512i *a, const uint64_t b)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i r0, r1, r2, r3, r4, temp;
+  const __m512i vb = ZSET164(b);
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i VCONSTC = ZSET164(CONSTC52);
+  const __m512i V19 = ZSET164(19);
+  const __m512i zero = ZZERO;
+
+  r0 = ZMADDLO(zero, a0, vb);
+  r1 = ZMADDHI(zero, a0, vb); r1 = ZMADDLO(r1, a1, vb);
+  r2 = ZMADDHI(zero, a1, vb); r2 = ZMADDLO(r2, a2, vb);
+  r3 = ZMADDHI(zero, a2, vb); r3 = ZMADDLO(r3, a3, vb);
+  r4 = ZMADDHI(zero, a3, vb); r4 = ZMADDLO(r4, a4, vb);
+  temp = ZMADDHI(zero, a4, vb);
+  r0 = ZMADDLO(r0, temp, VCONSTC);
+
+  // reduction of the bits above 2^255 and conversion to 52-bit limbs
+  temp = ZSHR(r4, BITS47); r4 = ZAND(r4, VMASK47);
+  r0 = ZMADDLO(r0, temp, V19);
+  r1 = ZADD(r1, ZSHR(r0, BITS52)); r0 = ZAND(r0, VMASK52);
+  r2 = ZADD(r2, ZSHR(r1, BITS52)); r1 = ZAND(r1, VMASK52);
+  r3 = ZADD(r3, ZSHR(r2, BITS52)); r2 = ZAND(r2, VMASK52);
+  r4 = ZADD(r4, ZSHR(r3, BITS52)); r3 = ZAND(r3, VMASK52);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; r[3] = r3; r[4] = r4;
+}
+
+
+/**
+ * @brief Field squaring.
+ *
+ * @details
+ * r = a^2 mod p.
+ * This is a modular squaring. The cross products a[i]*a[j] (i < j) are only
+ * computed once and doubled before the squares a[i]*a[i] are added. The
+ * reduction is the same as in the multiplication.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi52_gfp_sqr_avx512(__m512i *r, const __m512i *a)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  __m512i l5, l6, l7, l8, h5, h6, h7, h8, temp;
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i VCONSTC = ZSET164(CONSTC52);
+  const __m512i V19 = ZSET164(19);
+  const __m512i zero = ZZERO;
+
+  // cross products
+  z1 = ZMADDLO(zero, a0, a1);
+
+  z2 = ZMADDHI(zero, a0, a1); z2 = ZMADDLO(z2, a0, a2);
+
+  z3 = ZMADDHI(zero, a0, a2);
+  z3 = ZMADDLO(z3, a0, a3); z3 = ZMADDLO(z3, a1, a2);
+
+  z4 = ZMADDHI(zero, a0, a3); z4 = ZMADDHI(z4, a1, a2);
+  z4 = ZMADDLO(z4, a0, a4); z4 = ZMADDLO(z4, a1, a3);
+
+  z5 = ZMADDHI(zero, a0, a4); z5 = ZMADDHI(z5, a1, a3);
+  z5 = ZMADDLO(z5, a1, a4); z5 = ZMADDLO(z5, a2, a3);
+
+  z6 = ZMADDHI(zero, a1, a4); z6 = ZMADDHI(z6, a2, a3);
+  z6 = ZMADDLO(z6, a2, a4);
+
+  z7 = ZMADDHI(zero, a2, a4);
+  z7 = ZMADDLO(z7, a3, a4);
+
+  z8 = ZMADDHI(zero, a3, a4);
+
+  // double the cross products and add the squares
+  z1 = ZSHL(z1, 1); z2 = ZSHL(z2, 1); z3 = ZSHL(z3, 1); z4 = ZSHL(z4, 1);
+  z5 = ZSHL(z5, 1); z6 = ZSHL(z6, 1); z7 = ZSHL(z7, 1); z8 = ZSHL(z8, 1);
+
+  z0 = ZMADDLO(zero, a0, a0); z1 = ZMADDHI(z1, a0, a0);
+  z2 = ZMADDLO(z2, a1, a1);   z3 = ZMADDHI(z3, a1, a1);
+  z4 = ZMADDLO(z4, a2, a2);   z5 = ZMADDHI(z5, a2, a2);
+  z6 = ZMADDLO(z6, a3, a3);   z7 = ZMADDHI(z7, a3, a3);
+  z8 = ZMADDLO(z8, a4, a4);   z9 = ZMADDHI(zero, a4, a4);
+
+  // split the upper columns into a 52-bit part and a (small) carry
+  l5 = ZAND(z5, VMASK52); h5 = ZSHR(z5, BITS52);
+  l6 = ZAND(z6, VMASK52); h6 = ZSHR(z6, BITS52);
+  l7 = ZAND(z7, VMASK52); h7 = ZSHR(z7, BITS52);
+  l8 = ZAND(z8, VMASK52); h8 = ZSHR(z8, BITS52);
+
+  // modulo-p reduction by 2^260 = 608 mod p
+  z0 = ZMADDLO(z0, l5, VCONSTC);
+  z1 = ZMADDHI(z1, l5, VCONSTC); z1 = ZMADDLO(z1, h5, VCONSTC);
+  z1 = ZMADDLO(z1, l6, VCONSTC);
+  z2 = ZMADDHI(z2, l6, VCONSTC); z2 = ZMADDLO(z2, h6, VCONSTC);
+  z2 = ZMADDLO(z2, l7, VCONSTC);
+  z3 = ZMADDHI(z3, l7, VCONSTC); z3 = ZMADDLO(z3, h7, VCONSTC);
+  z3 = ZMADDLO(z3, l8, VCONSTC);
+  z4 = ZMADDHI(z4, l8, VCONSTC); z4 = ZMADDLO(z4, h8, VCONSTC);
+  z4 = ZMADDLO(z4, z9, VCONSTC);
+  temp = ZMADDHI(zero, z9, VCONSTC);
+  z0 = ZMADDLO(z0, temp, VCONSTC);
+
+  // reduction of the bits above 2^255 and conversion to 52-bit limbs
+  temp = ZSHR(z4, BITS47); z4 = ZAND(z4, VMASK47);
+  z0 = ZMADDLO(z0, temp, V19);
+  z1 = ZADD(z1, ZSHR(z0, BITS52)); z0 = ZAND(z0, VMASK52);
+  z2 = ZADD(z2, ZSHR(z1, BITS52)); z1 = ZAND(z1, VMASK52);
+  z3 = ZADD(z3, ZSHR(z2, BITS52)); z2 = ZAND(z2, VMASK52);
+  z4 = ZADD(z4, ZSHR(z3, BITS52)); z3 = ZAND(z3, VMASK52);
+
+  r[0] = z0; r[1] = z1; r[2] = z2; r[3] = z3; r[4] = z4;
+}
+
+
+/**
+ * @brief Field multiplicative inversion.
+ *
+ * @details
+ * r = a^-1 mod p.
+ * This function computes the multiplicative inverse of an element with the
+ * same addition chain as the AVX2 version.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi52_gfp_inv_avx512(__m512i *r, const __m512i *a)
+{
+  __m512i t0[NWORDS52], t1[NWORDS52], t2[NWORDS52], t3[NWORDS52];
+  int i;
+
+  mpi52_gfp_sqr_avx512(t0, a);
+  mpi52_gfp_sqr_avx512(t1, t0);
+  mpi52_gfp_sqr_avx512(t1, t1);
+  mpi52_gfp_mul_avx512(t1, a, t1);
+  mpi52_gfp_mul_avx512(t0, t0, t1);
+  mpi52_gfp_sqr_avx512(t2, t0);
+  mpi52_gfp_mul_avx512(t1, t1, t2);
+  mpi52_gfp_sqr_avx512(t2, t1);
+  for (i = 0; i < 4; i++) mpi52_gfp_sqr_avx512(t2, t2);
+  mpi52_gfp_mul_avx512(t1, t2, t1);
+  mpi52_gfp_sqr_avx512(t2, t1);
+  for (i = 0; i < 9; i++) mpi52_gfp_sqr_avx512(t2, t2);
+  mpi52_gfp_mul_avx512(t2, t2, t1);
+  mpi52_gfp_sqr_avx512(t3, t2);
+  for (i = 0; i < 19; i++) mpi52_gfp_sqr_avx512(t3, t3);
+  mpi52_gfp_mul_avx512(t2, t3, t2);
+  mpi52_gfp_sqr_avx512(t2, t2);
+  for (i = 0; i < 9; i++) mpi52_gfp_sqr_avx512(t2, t2);
+  mpi52_gfp_mul_avx512(t1, t2, t1);
+  mpi52_gfp_sqr_avx512(t2, t1);
+  for (i = 0; i < 49; i++) mpi52_gfp_sqr_avx512(t2, t2);
+  mpi52_gfp_mul_avx512(t2, t2, t1);
+  mpi52_gfp_sqr_avx512(t3, t2);
+  for (i = 0; i < 99; i++) mpi52_gfp_sqr_avx512(t3, t3);
+  mpi52_gfp_mul_avx512(t2, t3, t2);
+  mpi52_gfp_sqr_avx512(t2, t2);
+  for (i = 0; i < 49; i++) mpi52_gfp_sqr_avx512(t2, t2);
+  mpi52_gfp_mul_avx512(t1, t2, t1);
+  mpi52_gfp_sqr_avx512(t1, t1);
+  for (i = 0; i < 4; i++) mpi52_gfp_sqr_avx512(t1, t1);
+  mpi52_gfp_mul_avx512(r, t1, t0);
+}
+
+/**
+ * @brief Zero test.
+ *
+ * @details
+ * Return a mask with the bits set of those lanes where a = 0 mod p. After the
+ * bits above 2^255 are folded, a < 2p and a = 0 mod p iff a is 0 or p.
+ *
+ * @param a Field element
+ * @return Mask of the zero lanes
+ */
+__mmask8 mpi52_gfp_iszero_avx512(const __m512i *a)
+{
+  __m512i a0 = a[0], a1 = a[1], a2 = a[2], a3 = a[3], a4 = a[4];
+  __m512i temp;
+  const __m512i VMASK52 = ZSET164(MASK52);
+  const __m512i VMASK47 = ZSET164(MASK47);
+  const __m512i V19 = ZSET164(19);
+  __mmask8 zero, full;
+
+  temp = ZSHR(a4, BITS47); a4 = ZAND(a4, VMASK47);
+  a0 = ZMADDLO(a0, temp, V19);
+  a1 = ZADD(a1, ZSHR(a0, BITS52)); a0 = ZAND(a0, VMASK52);
+  a2 = ZADD(a2, ZSHR(a1, BITS52)); a1 = ZAND(a1, VMASK52);
+  a3 = ZADD(a3, ZSHR(a2, BITS52)); a2 = ZAND(a2, VMASK52);
+  a4 = ZADD(a4, ZSHR(a3, BITS52)); a3 = ZAND(a3, VMASK52);
+
+  // a = 0 or a = p = [2^52-19, 2^52-1, 2^52-1, 2^52-1, 2^47-1]
+  zero = ZCMPEQ(ZOR(ZOR(a0, a1), ZOR(ZOR(a2, a3), a4)), ZZERO);
+  full = ZCMPEQ(ZAND(ZAND(a1, a2), a3), VMASK52);
+  full &= ZCMPEQ(a0, ZSET164(MASK52-18));
+  full &= ZCMPEQ(a4, VMASK47);
+
+  return zero | full;
+}
+
+/**
+ * @brief Simultaneous inversion of n elements.
+ *
+ * @details
+ * r[i] = a[i]^-1 mod p for i = 0, ..., n-1.
+ * Montgomery's trick with a single inversion and 3*(n-1) multiplications, an
+ * element a[i] = 0 is replaced by 1 in the products and r[i] is set to 0. The 
+ * arrays r and a must not overlap.
+ *
+ * @param r Field elements
+ * @param a Field elements
+ * @param n Number of elements (n >= 1)
+ */
+void mpi52_gfp_batchinv_avx512(__m512i (*r)[NWORDS52], 
+  const __m512i (*a)[NWORDS52], const int n)
+{
+  __m512i t0[NWORDS52], t1[NWORDS52];
+  const __m512i one = ZSET164(1);
+  __mmask8 mask;
+  int i, j;
+
+  // r[i] = a[0]*a[1]*...*a[i]
+  mpi52_copy_avx512(r[0], a[0]);
+  r[0][0] = _mm512_mask_add_epi64(r[0][0], mpi52_gfp_iszero_avx512(a[0]), 
+    r[0][0], one);
+  for (i = 1; i < n; i++) {
+    mpi52_copy_avx512(t0, a[i]);
+    t0[0] = _mm512_mask_add_epi64(t0[0], mpi52_gfp_iszero_avx512(a[i]), t0[0], one);
+    mpi52_gfp_mul_avx512(r[i], r[i-1], t0);
+  }
+
+  mpi52_gfp_inv_avx512(t1, r[n-1]);
+
+  // t1 = (a[0]*...*a[i])^-1 in the i-th iteration
+  for (i = n-1; i > 0; i--) {
+    mask = mpi52_gfp_iszero_avx512(a[i]);
+    mpi52_copy_avx512(t0, a[i]);
+    t0[0] = _mm512_mask_add_epi64(t0[0], mask, t0[0], one);
+    mpi52_gfp_mul_avx512(r[i], r[i-1], t1);
+    mpi52_gfp_mul_avx512(t1, t1, t0);
+    for (j = 0; j < NWORDS52; j++) r[i][j] = ZMOV(r[i][j], mask, ZZERO);
+  }
+  mask = mpi52_gfp_iszero_avx512(a[0]);
+  for (j = 0; j < NWORDS52; j++) r[0][j] = ZMOV(t1[j], mask, ZZERO);
+}
+
+/**
+ * @brief Copy.
+ *
+ * @details
+ * Copy a to r.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi52_copy_avx512(__m512i *r, const __m512i *a)
+{
+  r[0] = a[0];
+  r[1] = a[1];
+  r[2] = a[2];
+  r[3] = a[3];
+  r[4] = a[4];
+}
+
+#endif
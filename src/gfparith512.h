@@ -0,0 +1,50 @@
+/**
+ *******************************************************************************
+ * @file gfparith512.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of AVX-512IFMA field arithmetic.
+ *
+ * @details
+ * This file contains some constants and function prototypes of (8*1)-way
+ * field arithmetic based on the 52-bit multiply-accumulate instructions.
+ *******************************************************************************
+ */
+
+#ifndef _GFPARITH512_H
+#define _GFPARITH512_H
+
+#include "intrin512.h"
+#include <stdint.h>
+
+// we use a radix-2^52 for the field elements
+#define NWORDS52 5
+#define BITS52 52
+#define MASK52 0xFFFFFFFFFFFFFULL
+// most significant limb holds bits 208 to 254 of a reduced element
+#define BITS47 47
+#define MASK47 0x7FFFFFFFFFFFULL
+#define CONSTA 486662
+// 2^260 mod (2^255 - 19)
+#define CONSTC52 608
+// least significant and other 52-bit limbs of 64*(2^255 - 19) = 2^261 - 1216
+#define LSWP52 0x1FFFFFFFFFFB40ULL
+#define WRDP52 0x1FFFFFFFFFFFFEULL
+
+// function prototypes
+
+void mpi52_gfp_add_avx512(__m512i *r, const __m512i *a, const __m512i *b);
+void mpi52_gfp_sub_avx512(__m512i *r, const __m512i *a, const __m512i *b);
+void mpi52_gfp_mul_avx512(__m512i *r, const __m512i *a, const __m512i *b);
+void mpi52_gfp_mul52_avx512(__m512i *r, const __m512i *a, const uint64_t b);
+void mpi52_gfp_sqr_avx512(__m512i *r, const __m512i *a);
+void mpi52_gfp_inv_avx512(__m512i *r, const __m512i *a);
+void mpi52_cswap_avx512(__m512i *r, __m512i *a, const __m512i b);
+void mpi52_copy_avx512(__m512i *r, const __m512i *a);
+__mmask8 mpi52_gfp_iszero_avx512(const __m512i *a);
+void mpi52_gfp_batchinv_avx512(__m512i (*r)[NWORDS52], 
+  const __m512i (*a)[NWORDS52], const int n);
+#endif
@@ -0,0 +1,68 @@
+/**
+ *******************************************************************************
+ * @file gfparith64.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of scalar field arithmetic in radix 2^64.
+ *
+ * @details
+ * This file contains the function prototypes of the scalar field arithmetic
+ * modulo p = 2^255 - 19 with 64-bit words (gfparith64.S, MULX/ADCX/ADOX),
+ * which runs on the integer multiplier next to the AVX2 lanes in the hybrid
+ * ladder, and the canonical reduction.
+ *******************************************************************************
+ */
+
+#ifndef _GFPARITH64_H
+#define _GFPARITH64_H
+
+#include <stdint.h>
+
+// field elements are four 64-bit words in [0, 2^256), reduced mod 2^256 - 38
+#define NWORDS64 4
+
+// function prototypes (gfparith64.S, they need BMI2 and ADX)
+
+void gfp64_mul(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void gfp64_sqr(uint64_t *r, const uint64_t *a);
+void gfp64_mul32(uint64_t *r, const uint64_t *a, uint32_t b);
+void gfp64_add(uint64_t *r, const uint64_t *a, const uint64_t *b);
+void gfp64_sub(uint64_t *r, const uint64_t *a, const uint64_t *b);
+
+/**
+ * @brief The final step to reduce a field element modulo p.
+ *
+ * @details
+ * Bit 255 is folded twice (2^255 = 19), then p is subtracted (by adding 19
+ * and clearing bit 255) if the element is not below p.
+ *
+ * @param a Field element
+ */
+static inline void gfp64_final(uint64_t *a)
+{
+  const uint64_t mask63 = 0x7FFFFFFFFFFFFFFFULL;
+  uint64_t b[NWORDS64], c, m;
+  int i, k;
+
+  for (k = 0; k < 2; k++) {
+    c = 19*(a[3] >> 63);
+    a[3] &= mask63;
+    for (i = 0; i < NWORDS64; i++) {
+      a[i] += c;
+      c = (a[i] < c);
+    }
+  }
+  c = 19;
+  for (i = 0; i < NWORDS64; i++) {
+    b[i] = a[i] + c;
+    c = (b[i] < c);
+  }
+  m = 0 - (b[3] >> 63);
+  b[3] &= mask63;
+  for (i = 0; i < NWORDS64; i++) a[i] ^= (a[i] ^ b[i]) & m;
+}
+
+#endif
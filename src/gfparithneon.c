@@ -0,0 +1,523 @@
+/**
+ *******************************************************************************
+ * @file gfparithneon.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of NEON field arithmetic.
+ *
+ * @details
+ * This file contains (2*1)-way vectorized field operations on ARM NEON.
+ * They are the operations of gfparith.c with two instead of four lanes: the
+ * limbs are 64-bit lanes, the products of the multiplication and squaring
+ * are accumulated with umlal (32x32-bit multiply-accumulate) on the narrowed
+ * limbs, which are taken once per operand. The product scanning, the
+ * reduction and the bounds of the limbs are the ones of the AVX2 version
+ * (GFP_MUL_PS, GFP_SQR_PS), so the ladder of moncurveneon.c can follow the
+ * one of moncurve.c step by step. The modulus p is 64*(2^255-19).
+ *******************************************************************************
+ */
+
+#if defined(__ARM_NEON)
+
+#include "gfparithneon.h"
+
+
+/**
+ * @brief Conditional swap.
+ *
+ * @details
+ * Replace (r,a) with (a,r) if b == 1;
+ * replace (r,a) with (r,a) if b == 0.
+ * Depending on a Boolean value that is passed as an argument to the function,
+ * the two elements are either swapped or not swapped.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Swapping flag
+ */
+void mpi29_cswap_neon(uint64x2_t *r, uint64x2_t *a, const uint64x2_t b)
+{
+  const uint64x2_t mask = NSUB(NZERO, b);
+  uint64x2_t x;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) {
+    x = NAND(NXOR(r[i], a[i]), mask);
+    r[i] = NXOR(r[i], x);
+    a[i] = NXOR(a[i], x);
+  }
+}
+
+
+/**
+ * @brief Field addition.
+ *
+ * @details
+ * r = a + b.
+ * This is an ordinary addtion without reduction operation, which allows limbs
+ * to expand one more bit.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_add_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b)
+{
+  int i;
+
+  for (i = 0; i < NWORDS; i++) r[i] = NADD(a[i], b[i]);
+}
+
+
+/**
+ * @brief Field subtraction (no carry propagation and modular recution).
+ *
+ * @details
+ * r = 2p + a - b.
+ * This is an ordinary subtraction without carry propagation and modular
+ * reduction, which allows limbs to expand one more bit. It adds 2p to avoid
+ * any negative intermediate values.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_sub_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b)
+{
+  const uint64x2_t VDLSWP = NSET164(LSWP29*2);
+  const uint64x2_t VDWRDP = NSET164(MASK29*2);
+  int i;
+
+  r[0] = NADD(VDLSWP, NSUB(a[0], b[0]));
+  for (i = 1; i < NWORDS; i++) r[i] = NADD(VDWRDP, NSUB(a[i], b[i]));
+}
+
+
+/**
+ * @brief Field subtraction (including carry propagation and modular reduction).
+ *
+ * @details
+ * r = 2p + a - b mod p.
+ * This is a modular subtraction. It adds 2p to avoid any negative intermediate
+ * values.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_sbc_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b)
+{
+  uint64x2_t r0, r1, r2, r3, r4, r5, r6, r7, r8, temp;
+  const uint64x2_t VDLSWP  = NSET164(LSWP29*2);
+  const uint64x2_t VDWRDP  = NSET164(MASK29*2);
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  const uint32x2_t VCONSTC = NSET132(CONSTC);
+
+  // subtraction loop
+  r0 = NADD(VDLSWP, NSUB(a[0], b[0]));
+  r1 = NADD(VDWRDP, NSUB(a[1], b[1]));
+  r2 = NADD(VDWRDP, NSUB(a[2], b[2]));
+  r3 = NADD(VDWRDP, NSUB(a[3], b[3]));
+  r4 = NADD(VDWRDP, NSUB(a[4], b[4]));
+  r5 = NADD(VDWRDP, NSUB(a[5], b[5]));
+  r6 = NADD(VDWRDP, NSUB(a[6], b[6]));
+  r7 = NADD(VDWRDP, NSUB(a[7], b[7]));
+  r8 = NADD(VDWRDP, NSUB(a[8], b[8]));
+
+  // carry propagation loop
+  r1 = NADD(r1, NSHR(r0, BITS29)); r0 = NAND(r0, VMASK29);
+  r2 = NADD(r2, NSHR(r1, BITS29)); r1 = NAND(r1, VMASK29);
+  r3 = NADD(r3, NSHR(r2, BITS29)); r2 = NAND(r2, VMASK29);
+  r4 = NADD(r4, NSHR(r3, BITS29)); r3 = NAND(r3, VMASK29);
+  r5 = NADD(r5, NSHR(r4, BITS29)); r4 = NAND(r4, VMASK29);
+  r6 = NADD(r6, NSHR(r5, BITS29)); r5 = NAND(r5, VMASK29);
+  r7 = NADD(r7, NSHR(r6, BITS29)); r6 = NAND(r6, VMASK29);
+  r8 = NADD(r8, NSHR(r7, BITS29)); r7 = NAND(r7, VMASK29);
+
+  // the final step to compute r0 and r8
+  temp = NSHR(r8, BITS29);
+  r0   = NMAC(r0, NNARROW(temp), VCONSTC);
+  r8   = NAND(r8, VMASK29);
+
+  r[0] = r0; r[1] = r1; r[2] = r2;
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Modulo-p reduction of a product.
+ *
+ * @details
+ * r = t + 2^261*h mod p, with 2^261 = 1216 mod p.
+ * The columns t[0..8] of the lower half are added to 1216 times the upper
+ * half h (limbs h[0..7] < 2^29, h[8] < 2^32) and the sum is converted to
+ * 29-bit limbs, the last carry is folded into r[0]. This is the second part
+ * of the product scanning of mpi29_gfp_mul_ps_avx2.
+ *
+ * @param r Field element
+ * @param t Lower columns
+ * @param h Upper half
+ */
+static inline __attribute__((always_inline)) void
+mpi29_reduce_neon(uint64x2_t *r, const uint64x2_t *t, const uint64x2_t *h)
+{
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  const uint32x2_t VCONSTC = NSET132(CONSTC);
+  uint64x2_t accu;
+
+  accu = NMAC(t[0], NNARROW(h[0]), VCONSTC);
+  r[0] = NAND(accu, VMASK29);
+
+  accu = NADD(t[1], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[1]), VCONSTC);
+  r[1] = NAND(accu, VMASK29);
+
+  accu = NADD(t[2], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[2]), VCONSTC);
+  r[2] = NAND(accu, VMASK29);
+
+  accu = NADD(t[3], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[3]), VCONSTC);
+  r[3] = NAND(accu, VMASK29);
+
+  accu = NADD(t[4], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[4]), VCONSTC);
+  r[4] = NAND(accu, VMASK29);
+
+  accu = NADD(t[5], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[5]), VCONSTC);
+  r[5] = NAND(accu, VMASK29);
+
+  accu = NADD(t[6], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[6]), VCONSTC);
+  r[6] = NAND(accu, VMASK29);
+
+  accu = NADD(t[7], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[7]), VCONSTC);
+  r[7] = NAND(accu, VMASK29);
+
+  accu = NADD(t[8], NSHR(accu, BITS29)); accu = NMAC(accu, NNARROW(h[8]), VCONSTC);
+  r[8] = NAND(accu, VMASK29);
+
+  accu = NSHR(accu, BITS29);
+  r[0] = NMAC(r[0], NNARROW(accu), VCONSTC);
+}
+
+
+/**
+ * @brief Field multiplication.
+ *
+ * @details
+ * r = a * b mod p.
+ * This is a modular multiplication. It performs a product-scanning and modulo-p
+ * reduction separately, as mpi29_gfp_mul_ps_avx2. The nine limbs of both
+ * operands are narrowed once, then each of the 81 products is one umlal.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+void mpi29_gfp_mul_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b)
+{
+  const uint32x2_t a0 = NNARROW(a[0]), a1 = NNARROW(a[1]), a2 = NNARROW(a[2]);
+  const uint32x2_t a3 = NNARROW(a[3]), a4 = NNARROW(a[4]), a5 = NNARROW(a[5]);
+  const uint32x2_t a6 = NNARROW(a[6]), a7 = NNARROW(a[7]), a8 = NNARROW(a[8]);
+  const uint32x2_t b0 = NNARROW(b[0]), b1 = NNARROW(b[1]), b2 = NNARROW(b[2]);
+  const uint32x2_t b3 = NNARROW(b[3]), b4 = NNARROW(b[4]), b5 = NNARROW(b[5]);
+  const uint32x2_t b6 = NNARROW(b[6]), b7 = NNARROW(b[7]), b8 = NNARROW(b[8]);
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  uint64x2_t t[NWORDS], h[NWORDS], accu;
+
+  // 1st loop of the product-scanning multiplication
+  t[0] = NMUL(    a0, b0);
+
+  t[1] = NMUL(    a0, b1); t[1] = NMAC(t[1], a1, b0);
+
+  t[2] = NMUL(    a0, b2); t[2] = NMAC(t[2], a1, b1); t[2] = NMAC(t[2], a2, b0);
+
+  t[3] = NMUL(    a0, b3); t[3] = NMAC(t[3], a1, b2); t[3] = NMAC(t[3], a2, b1);
+  t[3] = NMAC(t[3], a3, b0);
+
+  t[4] = NMUL(    a0, b4); t[4] = NMAC(t[4], a1, b3); t[4] = NMAC(t[4], a2, b2);
+  t[4] = NMAC(t[4], a3, b1); t[4] = NMAC(t[4], a4, b0);
+
+  t[5] = NMUL(    a0, b5); t[5] = NMAC(t[5], a1, b4); t[5] = NMAC(t[5], a2, b3);
+  t[5] = NMAC(t[5], a3, b2); t[5] = NMAC(t[5], a4, b1); t[5] = NMAC(t[5], a5, b0);
+
+  t[6] = NMUL(    a0, b6); t[6] = NMAC(t[6], a1, b5); t[6] = NMAC(t[6], a2, b4);
+  t[6] = NMAC(t[6], a3, b3); t[6] = NMAC(t[6], a4, b2); t[6] = NMAC(t[6], a5, b1);
+  t[6] = NMAC(t[6], a6, b0);
+
+  t[7] = NMUL(    a0, b7); t[7] = NMAC(t[7], a1, b6); t[7] = NMAC(t[7], a2, b5);
+  t[7] = NMAC(t[7], a3, b4); t[7] = NMAC(t[7], a4, b3); t[7] = NMAC(t[7], a5, b2);
+  t[7] = NMAC(t[7], a6, b1); t[7] = NMAC(t[7], a7, b0);
+
+  t[8] = NMUL(    a0, b8); t[8] = NMAC(t[8], a1, b7); t[8] = NMAC(t[8], a2, b6);
+  t[8] = NMAC(t[8], a3, b5); t[8] = NMAC(t[8], a4, b4); t[8] = NMAC(t[8], a5, b3);
+  t[8] = NMAC(t[8], a6, b2); t[8] = NMAC(t[8], a7, b1); t[8] = NMAC(t[8], a8, b0);
+
+  accu = NSHR(t[8], BITS29);
+  t[8] = NAND(t[8], VMASK29);
+
+  // 2nd loop of the product-scanning multiplication
+  accu = NMAC(accu, a1, b8); accu = NMAC(accu, a2, b7);
+  accu = NMAC(accu, a3, b6); accu = NMAC(accu, a4, b5);
+  accu = NMAC(accu, a5, b4); accu = NMAC(accu, a6, b3);
+  accu = NMAC(accu, a7, b2); accu = NMAC(accu, a8, b1);
+  h[0] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a2, b8); accu = NMAC(accu, a3, b7);
+  accu = NMAC(accu, a4, b6); accu = NMAC(accu, a5, b5);
+  accu = NMAC(accu, a6, b4); accu = NMAC(accu, a7, b3);
+  accu = NMAC(accu, a8, b2);
+  h[1] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a3, b8); accu = NMAC(accu, a4, b7);
+  accu = NMAC(accu, a5, b6); accu = NMAC(accu, a6, b5);
+  accu = NMAC(accu, a7, b4); accu = NMAC(accu, a8, b3);
+  h[2] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a4, b8); accu = NMAC(accu, a5, b7);
+  accu = NMAC(accu, a6, b6); accu = NMAC(accu, a7, b5);
+  accu = NMAC(accu, a8, b4);
+  h[3] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a5, b8); accu = NMAC(accu, a6, b7);
+  accu = NMAC(accu, a7, b6); accu = NMAC(accu, a8, b5);
+  h[4] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a6, b8); accu = NMAC(accu, a7, b7);
+  accu = NMAC(accu, a8, b6);
+  h[5] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a7, b8); accu = NMAC(accu, a8, b7);
+  h[6] = NAND(accu, VMASK29);
+  accu = NSHR(accu, BITS29);
+
+  accu = NMAC(accu, a8, b8);
+  h[7] = NAND(accu, VMASK29);
+  h[8] = NSHR(accu, BITS29);
+
+  // modulo-p reduction and conversion to 29-bit limbs
+  mpi29_reduce_neon(r, t, h);
+}
+
+
+/**
+ * @brief Field scalar multiplication.
+ *
+ * @details
+ * r = b * a mod p.
+ * The modular multiplication between a field element "a" and a 29-bit integer "b".
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b 29-bit integer
+ */
+void mpi29_gfp_mul29_neon(uint64x2_t *r, const uint64x2_t *a, const uint32_t b)
+{
+  uint64x2_t r0, r1, r2, r3, r4, r5, r6, r7, r8, accu;
+  const uint32x2_t vb = NSET132(b);
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  const uint32x2_t VCONSTC = NSET132(CONSTC);
+
+  accu = NMUL(NNARROW(a[0]), vb);
+  r0 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[1]), vb);
+  r1 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[2]), vb);
+  r2 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[3]), vb);
+  r3 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[4]), vb);
+  r4 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[5]), vb);
+  r5 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[6]), vb);
+  r6 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[7]), vb);
+  r7 = NAND(accu, VMASK29); accu = NSHR(accu, BITS29);
+  accu = NMAC(accu, NNARROW(a[8]), vb);
+  r8 = NAND(accu, VMASK29);
+
+  accu = NMUL(VCONSTC, NNARROW(NSHR(accu, BITS29)));
+  r0   = NADD(r0, NAND(accu, VMASK29));
+  r1   = NADD(r1, NSHR(accu, BITS29));
+
+  r[0] = r0; r[1] = r1; r[2] = r2;
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Field squaring.
+ *
+ * @details
+ * r = a^2 mod p.
+ * This is a modular squaring. It performs a product-scanning and modulo-p
+ * reduction separately, as mpi29_gfp_sqr_ps_avx2: the cross products of a
+ * column are summed up and doubled with one shift.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_sqr_neon(uint64x2_t *r, const uint64x2_t *a)
+{
+  const uint32x2_t a0 = NNARROW(a[0]), a1 = NNARROW(a[1]), a2 = NNARROW(a[2]);
+  const uint32x2_t a3 = NNARROW(a[3]), a4 = NNARROW(a[4]), a5 = NNARROW(a[5]);
+  const uint32x2_t a6 = NNARROW(a[6]), a7 = NNARROW(a[7]), a8 = NNARROW(a[8]);
+  const uint64x2_t VMASK29 = NSET164(MASK29);
+  uint64x2_t t[NWORDS], h[NWORDS], accu, temp;
+
+  // 1st loop of the product-scanning squaring
+  t[0] = NMUL(a0, a0);
+
+  accu = NMUL(a0, a1);
+  t[1] = NSHL(accu, 1);
+
+  accu = NMUL(a0, a2);
+  t[2] = NSHL(accu, 1); t[2] = NMAC(t[2], a1, a1);
+
+  accu = NMUL(a0, a3); accu = NMAC(accu, a1, a2);
+  t[3] = NSHL(accu, 1);
+
+  accu = NMUL(a0, a4); accu = NMAC(accu, a1, a3);
+  t[4] = NSHL(accu, 1); t[4] = NMAC(t[4], a2, a2);
+
+  accu = NMUL(a0, a5); accu = NMAC(accu, a1, a4); accu = NMAC(accu, a2, a3);
+  t[5] = NSHL(accu, 1);
+
+  accu = NMUL(a0, a6); accu = NMAC(accu, a1, a5); accu = NMAC(accu, a2, a4);
+  t[6] = NSHL(accu, 1); t[6] = NMAC(t[6], a3, a3);
+
+  accu = NMUL(a0, a7); accu = NMAC(accu, a1, a6); accu = NMAC(accu, a2, a5);
+  accu = NMAC(accu, a3, a4);
+  t[7] = NSHL(accu, 1);
+
+  accu = NMUL(a0, a8); accu = NMAC(accu, a1, a7); accu = NMAC(accu, a2, a6);
+  accu = NMAC(accu, a3, a5);
+  t[8] = NSHL(accu, 1); t[8] = NMAC(t[8], a4, a4);
+
+  temp = NSHR(t[8], BITS29); t[8] = NAND(t[8], VMASK29);
+
+  // 2nd loop of the product-scanning squaring
+  accu = NMUL(a1, a8); accu = NMAC(accu, a2, a7); accu = NMAC(accu, a3, a6);
+  accu = NMAC(accu, a4, a5);
+  temp = NADD(temp, NSHL(accu, 1));
+  h[0] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  accu = NMUL(a2, a8); accu = NMAC(accu, a3, a7); accu = NMAC(accu, a4, a6);
+  temp = NADD(temp, NSHL(accu, 1));
+  temp = NMAC(temp, a5, a5);
+  h[1] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  accu = NMUL(a3, a8); accu = NMAC(accu, a4, a7); accu = NMAC(accu, a5, a6);
+  temp = NADD(temp, NSHL(accu, 1));
+  h[2] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  accu = NMUL(a4, a8); accu = NMAC(accu, a5, a7);
+  temp = NADD(temp, NSHL(accu, 1));
+  temp = NMAC(temp, a6, a6);
+  h[3] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  accu = NMUL(a5, a8); accu = NMAC(accu, a6, a7);
+  temp = NADD(temp, NSHL(accu, 1));
+  h[4] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  accu = NMUL(a6, a8);
+  temp = NADD(temp, NSHL(accu, 1));
+  temp = NMAC(temp, a7, a7);
+  h[5] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  accu = NMUL(a7, a8);
+  temp = NADD(temp, NSHL(accu, 1));
+  h[6] = NAND(temp, VMASK29);
+  temp = NSHR(temp, BITS29);
+
+  temp = NMAC(temp, a8, a8);
+  h[7] = NAND(temp, VMASK29);
+  h[8] = NSHR(temp, BITS29);
+
+  // modulo reduction and conversion to 29-bit limbs
+  mpi29_reduce_neon(r, t, h);
+}
+
+
+/**
+ * @brief Field multiplicative inversion.
+ *
+ * @details
+ * r = a^-1 = a^(p-2) mod p.
+ * This function computes the multiplicative inverse of an element with the
+ * addition chain of mpi29_gfp_inv_fermat_avx2 (254 squarings and 11
+ * multiplications).
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_gfp_inv_neon(uint64x2_t *r, const uint64x2_t *a)
+{
+  uint64x2_t t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS];
+  int i;
+
+  mpi29_gfp_sqr_neon(t0, a);
+  mpi29_gfp_sqr_neon(t1, t0);
+  mpi29_gfp_sqr_neon(t1, t1);
+  mpi29_gfp_mul_neon(t1, a, t1);
+  mpi29_gfp_mul_neon(t0, t0, t1);
+  mpi29_gfp_sqr_neon(t2, t0);
+  mpi29_gfp_mul_neon(t1, t1, t2);
+  mpi29_gfp_sqr_neon(t2, t1);
+  for (i = 0; i < 4; i++) mpi29_gfp_sqr_neon(t2, t2);
+  mpi29_gfp_mul_neon(t1, t2, t1);
+  mpi29_gfp_sqr_neon(t2, t1);
+  for (i = 0; i < 9; i++) mpi29_gfp_sqr_neon(t2, t2);
+  mpi29_gfp_mul_neon(t2, t2, t1);
+  mpi29_gfp_sqr_neon(t3, t2);
+  for (i = 0; i < 19; i++) mpi29_gfp_sqr_neon(t3, t3);
+  mpi29_gfp_mul_neon(t2, t3, t2);
+  mpi29_gfp_sqr_neon(t2, t2);
+  for (i = 0; i < 9; i++) mpi29_gfp_sqr_neon(t2, t2);
+  mpi29_gfp_mul_neon(t1, t2, t1);
+  mpi29_gfp_sqr_neon(t2, t1);
+  for (i = 0; i < 49; i++) mpi29_gfp_sqr_neon(t2, t2);
+  mpi29_gfp_mul_neon(t2, t2, t1);
+  mpi29_gfp_sqr_neon(t3, t2);
+  for (i = 0; i < 99; i++) mpi29_gfp_sqr_neon(t3, t3);
+  mpi29_gfp_mul_neon(t2, t3, t2);
+  mpi29_gfp_sqr_neon(t2, t2);
+  for (i = 0; i < 49; i++) mpi29_gfp_sqr_neon(t2, t2);
+  mpi29_gfp_mul_neon(t1, t2, t1);
+  mpi29_gfp_sqr_neon(t1, t1);
+  for (i = 0; i < 4; i++) mpi29_gfp_sqr_neon(t1, t1);
+  mpi29_gfp_mul_neon(r, t1, t0);
+}
+
+
+/**
+ * @brief Copy.
+ *
+ * @details
+ * Copy a to r.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+void mpi29_copy_neon(uint64x2_t *r, const uint64x2_t *a)
+{
+  int i;
+
+  for (i = 0; i < NWORDS; i++) r[i] = a[i];
+}
+
+#endif
@@ -0,0 +1,45 @@
+/**
+ *******************************************************************************
+ * @file gfparithneon.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of NEON field arithmetic.
+ *
+ * @details
+ * This file contains function prototypes of (2*1)-way field arithmetic on
+ * ARM NEON. The field elements are the radix-2^29 ones of gfparith.h, with
+ * the same limb bounds (see there), in the two 64-bit lanes of uint64x2_t.
+ *******************************************************************************
+ */
+
+#ifndef _GFPARITHNEON_H
+#define _GFPARITHNEON_H
+
+#include "intrinneon.h"
+#include <stdint.h>
+
+// we use a radix-2^29 for the field elements (as in gfparith.h)
+#define NWORDS 9
+#define BITS29 29
+#define MASK29 0x1FFFFFFFUL
+#define CONSTC 1216
+#define CONSTA 486662
+// least significant 29-bit word of p = 64*(2^255 - 19) = 2^261 - 1216
+#define LSWP29 0x1FFFFB40UL
+
+// function prototypes
+
+void mpi29_gfp_add_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b);
+void mpi29_gfp_sub_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b);
+void mpi29_gfp_sbc_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b);
+void mpi29_gfp_mul_neon(uint64x2_t *r, const uint64x2_t *a, const uint64x2_t *b);
+void mpi29_gfp_mul29_neon(uint64x2_t *r, const uint64x2_t *a, const uint32_t b);
+void mpi29_gfp_sqr_neon(uint64x2_t *r, const uint64x2_t *a);
+void mpi29_gfp_inv_neon(uint64x2_t *r, const uint64x2_t *a);
+void mpi29_cswap_neon(uint64x2_t *r, uint64x2_t *a, const uint64x2_t b);
+void mpi29_copy_neon(uint64x2_t *r, const uint64x2_t *a);
+
+#endif
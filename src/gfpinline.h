@@ -0,0 +1,760 @@
+/**
+ *******************************************************************************
+ * @file gfpinline.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the inlined field arithmetic.
+ *
+ * @details 
+ * This file contains the (4*1)-way field operations as always-inline functions 
+ * (see gfparith.c for their descriptions). Fused kernels, e.g. the ladder step, 
+ * use them on local variables, so that the compiler can keep intermediate 
+ * values in registers and interleave independent operations, instead of 
+ * loading and storing nine limbs through memory in each call. The functions 
+ * of gfparith.c are built from them.
+ *******************************************************************************
+ */
+
+#ifndef _GFPINLINE_H
+#define _GFPINLINE_H
+
+#include "gfparith.h"
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_add_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_add_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
+  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
+  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+
+  r0 = VADD(a0, b0); r1 = VADD(a1, b1); r2 = VADD(a2, b2);
+  r3 = VADD(a3, b3); r4 = VADD(a4, b4); r5 = VADD(a5, b5);
+  r6 = VADD(a6, b6); r7 = VADD(a7, b7); r8 = VADD(a8, b8);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_sub_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_sub_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
+  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
+  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  const __m256i VDLSWP = VSET164(LSWP29*2);
+  const __m256i VDWRDP = VSET164(MASK29*2);
+
+  // NOTE: if put (a[i]-b[i]) at the latter position, it is faster.
+  r0 = VADD(VDLSWP, VSUB(a0, b0));
+  r1 = VADD(VDWRDP, VSUB(a1, b1));
+  r2 = VADD(VDWRDP, VSUB(a2, b2));
+  r3 = VADD(VDWRDP, VSUB(a3, b3));
+  r4 = VADD(VDWRDP, VSUB(a4, b4));
+  r5 = VADD(VDWRDP, VSUB(a5, b5));
+  r6 = VADD(VDWRDP, VSUB(a6, b6));
+  r7 = VADD(VDWRDP, VSUB(a7, b7));
+  r8 = VADD(VDWRDP, VSUB(a8, b8));
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_sbc_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_sbc_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
+  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
+  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8, temp;
+  const __m256i VDLSWP  = VSET164(LSWP29*2);
+  const __m256i VDWRDP  = VSET164(MASK29*2);
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  // subtraction loop
+  // NOTE: if put (a[i]-b[i]) at the latter position, it is faster.
+  r0 = VADD(VDLSWP, VSUB(a0, b0));
+  r1 = VADD(VDWRDP, VSUB(a1, b1));
+  r2 = VADD(VDWRDP, VSUB(a2, b2));
+  r3 = VADD(VDWRDP, VSUB(a3, b3));
+  r4 = VADD(VDWRDP, VSUB(a4, b4));
+  r5 = VADD(VDWRDP, VSUB(a5, b5));
+  r6 = VADD(VDWRDP, VSUB(a6, b6));
+  r7 = VADD(VDWRDP, VSUB(a7, b7));
+  r8 = VADD(VDWRDP, VSUB(a8, b8));
+
+  // carry propagation loop
+  r1 = VADD(r1, VSHR(r0, BITS29)); r0 = VAND(r0, VMASK29);
+  r2 = VADD(r2, VSHR(r1, BITS29)); r1 = VAND(r1, VMASK29);
+  r3 = VADD(r3, VSHR(r2, BITS29)); r2 = VAND(r2, VMASK29);
+  r4 = VADD(r4, VSHR(r3, BITS29)); r3 = VAND(r3, VMASK29);
+  r5 = VADD(r5, VSHR(r4, BITS29)); r4 = VAND(r4, VMASK29);
+  r6 = VADD(r6, VSHR(r5, BITS29)); r5 = VAND(r5, VMASK29);
+  r7 = VADD(r7, VSHR(r6, BITS29)); r6 = VAND(r6, VMASK29);
+  r8 = VADD(r8, VSHR(r7, BITS29)); r7 = VAND(r7, VMASK29);
+
+  // the final step to compute r0 and r8
+  temp = VSHR(r8, BITS29); 
+  temp = VMUL(temp, VCONSTC);
+  r0   = VADD(r0, temp); 
+  r8   = VAND(r8, VMASK29);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_sbp_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_sbp_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
+  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
+  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  __m256i c0, c1, c2, c3, c4, c5, c6, c7, c8;
+  const __m256i VDLSWP  = VSET164(LSWP29*2);
+  const __m256i VDWRDP  = VSET164(MASK29*2);
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  r0 = VADD(VDLSWP, VSUB(a0, b0));
+  r1 = VADD(VDWRDP, VSUB(a1, b1));
+  r2 = VADD(VDWRDP, VSUB(a2, b2));
+  r3 = VADD(VDWRDP, VSUB(a3, b3));
+  r4 = VADD(VDWRDP, VSUB(a4, b4));
+  r5 = VADD(VDWRDP, VSUB(a5, b5));
+  r6 = VADD(VDWRDP, VSUB(a6, b6));
+  r7 = VADD(VDWRDP, VSUB(a7, b7));
+  r8 = VADD(VDWRDP, VSUB(a8, b8));
+
+  // one round of carries, all limbs in parallel
+  c0 = VSHR(r0, BITS29); c1 = VSHR(r1, BITS29); c2 = VSHR(r2, BITS29);
+  c3 = VSHR(r3, BITS29); c4 = VSHR(r4, BITS29); c5 = VSHR(r5, BITS29);
+  c6 = VSHR(r6, BITS29); c7 = VSHR(r7, BITS29); c8 = VSHR(r8, BITS29);
+
+  r0 = VADD(VAND(r0, VMASK29), VMUL(c8, VCONSTC));
+  r1 = VADD(VAND(r1, VMASK29), c0);
+  r2 = VADD(VAND(r2, VMASK29), c1);
+  r3 = VADD(VAND(r3, VMASK29), c2);
+  r4 = VADD(VAND(r4, VMASK29), c3);
+  r5 = VADD(VAND(r5, VMASK29), c4);
+  r6 = VADD(VAND(r6, VMASK29), c5);
+  r7 = VADD(VAND(r7, VMASK29), c6);
+  r8 = VADD(VAND(r8, VMASK29), c7);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_mul_ps_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_mul_ps_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
+  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
+  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, accu;
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  // 1st loop of the product-scanning multiplication
+  t0 = VMUL(    a0, b0);
+
+  t1 = VMUL(    a0, b1); t1 = VMAC(t1, a1, b0);
+
+  t2 = VMUL(    a0, b2); t2 = VMAC(t2, a1, b1); t2 = VMAC(t2, a2, b0);
+
+  t3 = VMUL(    a0, b3); t3 = VMAC(t3, a1, b2); t3 = VMAC(t3, a2, b1);
+  t3 = VMAC(t3, a3, b0);
+
+  t4 = VMUL(    a0, b4); t4 = VMAC(t4, a1, b3); t4 = VMAC(t4, a2, b2);
+  t4 = VMAC(t4, a3, b1); t4 = VMAC(t4, a4, b0);
+
+  t5 = VMUL(    a0, b5); t5 = VMAC(t5, a1, b4); t5 = VMAC(t5, a2, b3);
+  t5 = VMAC(t5, a3, b2); t5 = VMAC(t5, a4, b1); t5 = VMAC(t5, a5, b0);
+
+  t6 = VMUL(    a0, b6); t6 = VMAC(t6, a1, b5); t6 = VMAC(t6, a2, b4);
+  t6 = VMAC(t6, a3, b3); t6 = VMAC(t6, a4, b2); t6 = VMAC(t6, a5, b1);
+  t6 = VMAC(t6, a6, b0);
+
+  t7 = VMUL(    a0, b7); t7 = VMAC(t7, a1, b6); t7 = VMAC(t7, a2, b5);
+  t7 = VMAC(t7, a3, b4); t7 = VMAC(t7, a4, b3); t7 = VMAC(t7, a5, b2);
+  t7 = VMAC(t7, a6, b1); t7 = VMAC(t7, a7, b0);
+
+  t8 = VMUL(    a0, b8); t8 = VMAC(t8, a1, b7); t8 = VMAC(t8, a2, b6);
+  t8 = VMAC(t8, a3, b5); t8 = VMAC(t8, a4, b4); t8 = VMAC(t8, a5, b3);
+  t8 = VMAC(t8, a6, b2); t8 = VMAC(t8, a7, b1); t8 = VMAC(t8, a8, b0);
+
+  accu = VSHR(t8, BITS29);
+  t8   = VAND(t8, VMASK29);
+
+  // 2nd loop of the product-scanning multiplication
+  accu = VMAC(accu, a1, b8); accu = VMAC(accu, a2, b7);
+  accu = VMAC(accu, a3, b6); accu = VMAC(accu, a4, b5);
+  accu = VMAC(accu, a5, b4); accu = VMAC(accu, a6, b3);
+  accu = VMAC(accu, a7, b2); accu = VMAC(accu, a8, b1);
+  r0   = VAND(accu, VMASK29); 
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a2, b8); accu = VMAC(accu, a3, b7);
+  accu = VMAC(accu, a4, b6); accu = VMAC(accu, a5, b5);
+  accu = VMAC(accu, a6, b4); accu = VMAC(accu, a7, b3);
+  accu = VMAC(accu, a8, b2);
+  r1   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a3, b8); accu = VMAC(accu, a4, b7);
+  accu = VMAC(accu, a5, b6); accu = VMAC(accu, a6, b5);
+  accu = VMAC(accu, a7, b4); accu = VMAC(accu, a8, b3);
+  r2   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a4, b8); accu = VMAC(accu, a5, b7);
+  accu = VMAC(accu, a6, b6); accu = VMAC(accu, a7, b5);
+  accu = VMAC(accu, a8, b4);
+  r3   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a5, b8); accu = VMAC(accu, a6, b7);
+  accu = VMAC(accu, a7, b6); accu = VMAC(accu, a8, b5);
+  r4   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a6, b8); accu = VMAC(accu, a7, b7);
+  accu = VMAC(accu, a8, b6);
+  r5   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a7, b8); accu = VMAC(accu, a8, b7);
+  r6   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+
+  accu = VMAC(accu, a8, b8);
+  r7   = VAND(accu, VMASK29);
+
+  r8   = VSHR(accu, BITS29);
+
+  // modulo-p reduction and conversion to 29-bit limbs
+  accu = VMAC(t0, r0, VCONSTC);
+  r0   = VAND(accu, VMASK29);
+
+  accu = VADD(t1, VSHR(accu, BITS29)); accu = VMAC(accu, r1, VCONSTC);
+  r1   = VAND(accu, VMASK29);
+
+  accu = VADD(t2, VSHR(accu, BITS29)); accu = VMAC(accu, r2, VCONSTC);
+  r2   = VAND(accu, VMASK29);
+
+  accu = VADD(t3, VSHR(accu, BITS29)); accu = VMAC(accu, r3, VCONSTC);
+  r3   = VAND(accu, VMASK29);
+
+  accu = VADD(t4, VSHR(accu, BITS29)); accu = VMAC(accu, r4, VCONSTC);
+  r4   = VAND(accu, VMASK29);
+
+  accu = VADD(t5, VSHR(accu, BITS29)); accu = VMAC(accu, r5, VCONSTC);
+  r5   = VAND(accu, VMASK29);
+
+  accu = VADD(t6, VSHR(accu, BITS29)); accu = VMAC(accu, r6, VCONSTC);
+  r6   = VAND(accu, VMASK29);
+
+  accu = VADD(t7, VSHR(accu, BITS29)); accu = VMAC(accu, r7, VCONSTC);
+  r7   = VAND(accu, VMASK29);
+
+  accu = VADD(t8, VSHR(accu, BITS29)); accu = VMAC(accu, r8, VCONSTC);
+  r8   = VAND(accu, VMASK29);
+
+  accu = VSHR(accu, BITS29);
+  r0   = VMAC(r0, accu, VCONSTC);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_mul_kara_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_mul_kara_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i b0 = b[0], b1 = b[1], b2 = b[2];
+  __m256i b3 = b[3], b4 = b[4], b5 = b[5];
+  __m256i b6 = b[6], b7 = b[7], b8 = b[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, accu;
+  __m256i h0, h1, h2, h3, h4, h5, h6;
+  __m256i m0, m1, m2, m3, m4, m5, m6, m7, m8;
+  __m256i c9, c10, c11, c12, c13, c14, c15, c16;
+  __m256i s0, s1, s2, s3, u0, u1, u2, u3;
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  // L = (a0..a4)*(b0..b4), columns 0 to 8
+  t0 = VMUL(a0, b0);
+  t1 = VMUL(a0, b1); t1 = VMAC(t1, a1, b0);
+  t2 = VMUL(a0, b2); t2 = VMAC(t2, a1, b1); t2 = VMAC(t2, a2, b0);
+  t3 = VMUL(a0, b3); t3 = VMAC(t3, a1, b2); t3 = VMAC(t3, a2, b1);
+  t3 = VMAC(t3, a3, b0);
+  t4 = VMUL(a0, b4); t4 = VMAC(t4, a1, b3); t4 = VMAC(t4, a2, b2);
+  t4 = VMAC(t4, a3, b1); t4 = VMAC(t4, a4, b0);
+  t5 = VMUL(a1, b4); t5 = VMAC(t5, a2, b3); t5 = VMAC(t5, a3, b2);
+  t5 = VMAC(t5, a4, b1);
+  t6 = VMUL(a2, b4); t6 = VMAC(t6, a3, b3); t6 = VMAC(t6, a4, b2);
+  t7 = VMUL(a3, b4); t7 = VMAC(t7, a4, b3);
+  t8 = VMUL(a4, b4);
+
+  // H = (a5..a8)*(b5..b8), columns 10 to 16
+  h0 = VMUL(a5, b5);
+  h1 = VMUL(a5, b6); h1 = VMAC(h1, a6, b5);
+  h2 = VMUL(a5, b7); h2 = VMAC(h2, a6, b6); h2 = VMAC(h2, a7, b5);
+  h3 = VMUL(a5, b8); h3 = VMAC(h3, a6, b7); h3 = VMAC(h3, a7, b6);
+  h3 = VMAC(h3, a8, b5);
+  h4 = VMUL(a6, b8); h4 = VMAC(h4, a7, b7); h4 = VMAC(h4, a8, b6);
+  h5 = VMUL(a7, b8); h5 = VMAC(h5, a8, b7);
+  h6 = VMUL(a8, b8);
+
+  // M = (aL+aH)*(bL+bH) - L - H, columns 5 to 13 (exact mod 2^64, since the 
+  // differences are the cross products of the schoolbook multiplication)
+  s0 = VADD(a0, a5); s1 = VADD(a1, a6); s2 = VADD(a2, a7); s3 = VADD(a3, a8);
+  u0 = VADD(b0, b5); u1 = VADD(b1, b6); u2 = VADD(b2, b7); u3 = VADD(b3, b8);
+  m0 = VMUL(s0, u0);
+  m1 = VMUL(s0, u1); m1 = VMAC(m1, s1, u0);
+  m2 = VMUL(s0, u2); m2 = VMAC(m2, s1, u1); m2 = VMAC(m2, s2, u0);
+  m3 = VMUL(s0, u3); m3 = VMAC(m3, s1, u2); m3 = VMAC(m3, s2, u1);
+  m3 = VMAC(m3, s3, u0);
+  m4 = VMUL(s0, b4); m4 = VMAC(m4, s1, u3); m4 = VMAC(m4, s2, u2);
+  m4 = VMAC(m4, s3, u1); m4 = VMAC(m4, a4, u0);
+  m5 = VMUL(s1, b4); m5 = VMAC(m5, s2, u3); m5 = VMAC(m5, s3, u2);
+  m5 = VMAC(m5, a4, u1);
+  m6 = VMUL(s2, b4); m6 = VMAC(m6, s3, u3); m6 = VMAC(m6, a4, u2);
+  m7 = VMUL(s3, b4); m7 = VMAC(m7, a4, u3);
+  m8 = VMUL(a4, b4);
+  m0 = VSUB(VSUB(m0, t0), h0); m1 = VSUB(VSUB(m1, t1), h1); m2 = VSUB(VSUB(m2, t2), h2);
+  m3 = VSUB(VSUB(m3, t3), h3); m4 = VSUB(VSUB(m4, t4), h4); m5 = VSUB(VSUB(m5, t5), h5);
+  m6 = VSUB(VSUB(m6, t6), h6); m7 = VSUB(m7, t7); m8 = VSUB(m8, t8);
+
+  // columns of the product
+  t5 = VADD(t5, m0); t6 = VADD(t6, m1); t7 = VADD(t7, m2); t8 = VADD(t8, m3);
+  c9  = m4;          c10 = VADD(m5, h0); c11 = VADD(m6, h1);
+  c12 = VADD(m7, h2); c13 = VADD(m8, h3); c14 = h4; c15 = h5; c16 = h6;
+
+  // columns 9 to 16 to 29-bit limbs
+  accu = VSHR(t8, BITS29);
+  t8   = VAND(t8, VMASK29);
+  accu = VADD(accu, c9); r0 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c10); r1 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c11); r2 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c12); r3 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c13); r4 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c14); r5 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c15); r6 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c16); r7 = VAND(accu, VMASK29);
+  r8   = VSHR(accu, BITS29);
+
+  // modulo-p reduction and conversion to 29-bit limbs
+  accu = VMAC(t0, r0, VCONSTC);
+  r0   = VAND(accu, VMASK29);
+
+  accu = VADD(t1, VSHR(accu, BITS29)); accu = VMAC(accu, r1, VCONSTC);
+  r1   = VAND(accu, VMASK29);
+
+  accu = VADD(t2, VSHR(accu, BITS29)); accu = VMAC(accu, r2, VCONSTC);
+  r2   = VAND(accu, VMASK29);
+
+  accu = VADD(t3, VSHR(accu, BITS29)); accu = VMAC(accu, r3, VCONSTC);
+  r3   = VAND(accu, VMASK29);
+
+  accu = VADD(t4, VSHR(accu, BITS29)); accu = VMAC(accu, r4, VCONSTC);
+  r4   = VAND(accu, VMASK29);
+
+  accu = VADD(t5, VSHR(accu, BITS29)); accu = VMAC(accu, r5, VCONSTC);
+  r5   = VAND(accu, VMASK29);
+
+  accu = VADD(t6, VSHR(accu, BITS29)); accu = VMAC(accu, r6, VCONSTC);
+  r6   = VAND(accu, VMASK29);
+
+  accu = VADD(t7, VSHR(accu, BITS29)); accu = VMAC(accu, r7, VCONSTC);
+  r7   = VAND(accu, VMASK29);
+
+  accu = VADD(t8, VSHR(accu, BITS29)); accu = VMAC(accu, r8, VCONSTC);
+  r8   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+  r0   = VMAC(r0, accu, VCONSTC);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_mul_avx2 (the multiplication that is
+ * selected by GFP_MUL).
+ *
+ * @param r Field element
+ * @param a Field element
+ * @param b Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_mul_inl_avx2(__m256i *r, const __m256i *a, const __m256i *b)
+{
+#if GFP_MUL == GFP_MUL_KARATSUBA
+  mpi29_gfp_mul_kara_inl_avx2(r, a, b);
+#else
+  mpi29_gfp_mul_ps_inl_avx2(r, a, b);
+#endif
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_mul29_avx2.
+ *
+ * @param r Field element
+ * @param a Field element 
+ * @param b 29-bit integer
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_mul29_inl_avx2(__m256i *r, const __m256i *a, const uint32_t b)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8, accu;
+  const __m256i vb = VSET164(b);
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  accu = VMUL(a0, vb); r0 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a1, vb); r1 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a2, vb); r2 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a3, vb); r3 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a4, vb); r4 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a5, vb); r5 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a6, vb); r6 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a7, vb); r7 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VMAC(accu, a8, vb); r8 = VAND(accu, VMASK29); 
+
+  accu = VMUL(VCONSTC, VSHR(accu, BITS29));
+  r0   = VADD(r0, VAND(accu, VMASK29));
+  r1   = VADD(r1, VSHR(accu, BITS29));
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_sqr_ps_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_sqr_ps_inl_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, accu, temp;
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  // 1st loop of the product-scanning squaring
+  t0   = VMUL(a0, a0);
+
+  accu = VMUL(a0, a1); 
+  t1   = VSHL(accu, 1);
+
+  accu = VMUL(a0, a2); 
+  t2   = VSHL(accu, 1); t2 = VMAC(t2, a1, a1);
+
+  accu = VMUL(a0, a3); 
+  accu = VMAC(accu, a1, a2); 
+  t3   = VSHL(accu, 1);
+
+  accu = VMUL(a0, a4); accu = VMAC(accu, a1, a3);
+  t4   = VSHL(accu, 1); t4  = VMAC(t4, a2, a2);
+
+  accu = VMUL(a0, a5); accu = VMAC(accu, a1, a4); accu = VMAC(accu, a2, a3);
+  t5   = VSHL(accu, 1);
+
+  accu = VMUL(a0, a6); accu = VMAC(accu, a1, a5); accu = VMAC(accu, a2, a4);
+  t6   = VSHL(accu, 1); t6  = VMAC(t6, a3, a3);
+
+  accu = VMUL(a0, a7); accu = VMAC(accu, a1, a6); accu = VMAC(accu, a2, a5);
+  accu = VMAC(accu, a3, a4);
+  t7   = VSHL(accu, 1);
+
+  accu = VMUL(a0, a8); accu = VMAC(accu, a1, a7); accu = VMAC(accu, a2, a6);
+  accu = VMAC(accu, a3, a5);
+  t8   = VSHL(accu, 1); t8  = VMAC(t8, a4, a4);
+
+  temp = VSHR(t8, BITS29); t8 = VAND(t8, VMASK29);
+
+  // 2nd loop of the product-scanning squaring
+  accu = VMUL(a1, a8); accu = VMAC(accu, a2, a7); accu = VMAC(accu, a3, a6);
+  accu = VMAC(accu, a4, a5);
+  temp = VADD(temp, VSHL(accu, 1));
+  r0   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  accu = VMUL(a2, a8); accu = VMAC(accu, a3, a7); accu = VMAC(accu, a4, a6);
+  temp = VADD(temp, VSHL(accu, 1));
+  temp = VMAC(temp, a5, a5);
+  r1   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  accu = VMUL(a3, a8); accu = VMAC(accu, a4, a7); accu = VMAC(accu, a5, a6);
+  temp = VADD(temp, VSHL(accu, 1));
+  r2   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  accu = VMUL(a4, a8); accu = VMAC(accu, a5, a7);
+  temp = VADD(temp, VSHL(accu, 1));
+  temp = VMAC(temp, a6, a6);
+  r3   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  accu = VMUL(a5, a8); accu = VMAC(accu, a6, a7);
+  temp = VADD(temp, VSHL(accu, 1));
+  r4   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  accu = VMUL(a6, a8);
+  temp = VADD(temp, VSHL(accu, 1));
+  temp = VMAC(temp, a7, a7);
+  r5   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  accu = VMUL(a7, a8);
+  temp = VADD(temp, VSHL(accu, 1));
+  r6   = VAND(temp, VMASK29);
+  temp = VSHR(temp, BITS29);
+
+  temp = VMAC(temp, a8, a8);
+  r7   = VAND(temp, VMASK29);
+  r8   = VSHR(temp, BITS29);
+
+  // modulo reduction and conversion to 29-bit limbs
+  accu = VADD(t0, VMUL(r0, VCONSTC));
+  r0   = VAND(accu, VMASK29);
+
+  accu = VADD(t1, VSHR(accu, BITS29)); accu = VMAC(accu, r1, VCONSTC);
+  r1   = VAND(accu, VMASK29);
+
+  accu = VADD(t2, VSHR(accu, BITS29)); accu = VMAC(accu, r2, VCONSTC);
+  r2   = VAND(accu, VMASK29);
+
+  accu = VADD(t3, VSHR(accu, BITS29)); accu = VMAC(accu, r3, VCONSTC);
+  r3   = VAND(accu, VMASK29);
+
+  accu = VADD(t4, VSHR(accu, BITS29)); accu = VMAC(accu, r4, VCONSTC);
+  r4   = VAND(accu, VMASK29);
+
+  accu = VADD(t5, VSHR(accu, BITS29)); accu = VMAC(accu, r5, VCONSTC);
+  r5   = VAND(accu, VMASK29);
+
+  accu = VADD(t6, VSHR(accu, BITS29)); accu = VMAC(accu, r6, VCONSTC);
+  r6   = VAND(accu, VMASK29);
+
+  accu = VADD(t7, VSHR(accu, BITS29)); accu = VMAC(accu, r7, VCONSTC);
+  r7   = VAND(accu, VMASK29);
+
+  accu = VADD(t8, VSHR(accu, BITS29)); accu = VMAC(accu, r8, VCONSTC);
+  r8   = VAND(accu, VMASK29);
+
+  accu = VSHR(accu, BITS29);
+  r0   = VADD(r0, VMUL(accu, VCONSTC));
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_sqr_dbl_avx2.
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_sqr_dbl_inl_avx2(__m256i *r, const __m256i *a)
+{
+  __m256i a0 = a[0], a1 = a[1], a2 = a[2];
+  __m256i a3 = a[3], a4 = a[4], a5 = a[5];
+  __m256i a6 = a[6], a7 = a[7], a8 = a[8];
+  __m256i r0, r1, r2, r3, r4, r5, r6, r7, r8;
+  __m256i t0, t1, t2, t3, t4, t5, t6, t7, t8, accu;
+  __m256i c9, c10, c11, c12, c13, c14, c15, c16;
+  __m256i d1, d2, d3, d4, d5, d6, d7, d8;
+  const __m256i VMASK29 = VSET164(MASK29);
+  const __m256i VCONSTC = VSET164(CONSTC);
+
+  // doubled limbs, the cross products need no shifts
+  d1 = VADD(a1, a1); d2 = VADD(a2, a2); d3 = VADD(a3, a3); d4 = VADD(a4, a4);
+  d5 = VADD(a5, a5); d6 = VADD(a6, a6); d7 = VADD(a7, a7); d8 = VADD(a8, a8);
+
+  // columns 0 to 16
+  t0 = VMUL(a0, a0);
+  t1 = VMUL(a0, d1);
+  t2 = VMUL(a0, d2); t2 = VMAC(t2, a1, a1);
+  t3 = VMUL(a0, d3); t3 = VMAC(t3, a1, d2);
+  t4 = VMUL(a0, d4); t4 = VMAC(t4, a1, d3); t4 = VMAC(t4, a2, a2);
+  t5 = VMUL(a0, d5); t5 = VMAC(t5, a1, d4); t5 = VMAC(t5, a2, d3);
+  t6 = VMUL(a0, d6); t6 = VMAC(t6, a1, d5); t6 = VMAC(t6, a2, d4);
+  t6 = VMAC(t6, a3, a3);
+  t7 = VMUL(a0, d7); t7 = VMAC(t7, a1, d6); t7 = VMAC(t7, a2, d5);
+  t7 = VMAC(t7, a3, d4);
+  t8 = VMUL(a0, d8); t8 = VMAC(t8, a1, d7); t8 = VMAC(t8, a2, d6);
+  t8 = VMAC(t8, a3, d5); t8 = VMAC(t8, a4, a4);
+  c9 = VMUL(a1, d8); c9 = VMAC(c9, a2, d7); c9 = VMAC(c9, a3, d6);
+  c9 = VMAC(c9, a4, d5);
+  c10 = VMUL(a2, d8); c10 = VMAC(c10, a3, d7); c10 = VMAC(c10, a4, d6);
+  c10 = VMAC(c10, a5, a5);
+  c11 = VMUL(a3, d8); c11 = VMAC(c11, a4, d7); c11 = VMAC(c11, a5, d6);
+  c12 = VMUL(a4, d8); c12 = VMAC(c12, a5, d7); c12 = VMAC(c12, a6, a6);
+  c13 = VMUL(a5, d8); c13 = VMAC(c13, a6, d7);
+  c14 = VMUL(a6, d8); c14 = VMAC(c14, a7, a7);
+  c15 = VMUL(a7, d8);
+  c16 = VMUL(a8, a8);
+
+  // columns 9 to 16 to 29-bit limbs
+  accu = VSHR(t8, BITS29);
+  t8   = VAND(t8, VMASK29);
+  accu = VADD(accu, c9); r0 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c10); r1 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c11); r2 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c12); r3 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c13); r4 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c14); r5 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c15); r6 = VAND(accu, VMASK29); accu = VSHR(accu, BITS29);
+  accu = VADD(accu, c16); r7 = VAND(accu, VMASK29);
+  r8   = VSHR(accu, BITS29);
+
+  // modulo-p reduction and conversion to 29-bit limbs
+  accu = VMAC(t0, r0, VCONSTC);
+  r0   = VAND(accu, VMASK29);
+
+  accu = VADD(t1, VSHR(accu, BITS29)); accu = VMAC(accu, r1, VCONSTC);
+  r1   = VAND(accu, VMASK29);
+
+  accu = VADD(t2, VSHR(accu, BITS29)); accu = VMAC(accu, r2, VCONSTC);
+  r2   = VAND(accu, VMASK29);
+
+  accu = VADD(t3, VSHR(accu, BITS29)); accu = VMAC(accu, r3, VCONSTC);
+  r3   = VAND(accu, VMASK29);
+
+  accu = VADD(t4, VSHR(accu, BITS29)); accu = VMAC(accu, r4, VCONSTC);
+  r4   = VAND(accu, VMASK29);
+
+  accu = VADD(t5, VSHR(accu, BITS29)); accu = VMAC(accu, r5, VCONSTC);
+  r5   = VAND(accu, VMASK29);
+
+  accu = VADD(t6, VSHR(accu, BITS29)); accu = VMAC(accu, r6, VCONSTC);
+  r6   = VAND(accu, VMASK29);
+
+  accu = VADD(t7, VSHR(accu, BITS29)); accu = VMAC(accu, r7, VCONSTC);
+  r7   = VAND(accu, VMASK29);
+
+  accu = VADD(t8, VSHR(accu, BITS29)); accu = VMAC(accu, r8, VCONSTC);
+  r8   = VAND(accu, VMASK29);
+  accu = VSHR(accu, BITS29);
+  r0   = VMAC(r0, accu, VCONSTC);
+
+  r[0] = r0; r[1] = r1; r[2] = r2; 
+  r[3] = r3; r[4] = r4; r[5] = r5;
+  r[6] = r6; r[7] = r7; r[8] = r8;
+}
+
+
+/**
+ * @brief Inlined version of mpi29_gfp_sqr_avx2 (the squaring that is selected
+ * by GFP_SQR).
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+static inline __attribute__((always_inline)) void
+mpi29_gfp_sqr_inl_avx2(__m256i *r, const __m256i *a)
+{
+#if GFP_SQR == GFP_SQR_DOUBLED
+  mpi29_gfp_sqr_dbl_inl_avx2(r, a);
+#else
+  mpi29_gfp_sqr_ps_inl_avx2(r, a);
+#endif
+}
+
+#endif
@@ -33,6 +33,8 @@
 #define VSHL(X, Y)         _mm256_slli_epi64(X, Y)
 // the memory accessing and the broadcasting
 #define VLOAD128(X)        _mm_load_si128((__m128i*)X)
+#define VLOADU(X)          _mm256_loadu_si256((__m256i*)X)
+#define VSTOREU(X, Y)      _mm256_storeu_si256((__m256i*)X, Y)
 #define VSET164(X)         _mm256_set1_epi64x(X)
 #define VSET64(W, X, Y, Z) _mm256_set_epi64x(W, X, Y, Z)
 #define VZERO              _mm256_setzero_si256()
@@ -40,6 +42,7 @@
 #define VSHUF32(X, Y)      _mm256_shuffle_epi32(X, Y)
 #define VBROAD64(X)        _mm256_broadcastq_epi64(X)
 #define VPERM64(X, Y)      _mm256_permute4x64_epi64(X, Y)
+#define VBLEND32(X, Y, Z)  _mm256_blend_epi32(X, Y, Z)
 
 
 #endif
@@ -0,0 +1,46 @@
+/**
+ *******************************************************************************
+ * @file intrin512.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of Intel AVX-512 intrinsics.
+ *
+ * @details
+ * Define some short names of AVX-512F and AVX-512IFMA intrinsics for a clean
+ * code. The prefix "Z" refers to the 512-bit zmm registers.
+ *******************************************************************************
+ */
+
+#ifndef INTRIN512_H
+#define INTRIN512_H
+
+// AVX-512 head file
+#include <immintrin.h>
+
+// packed 64-bit arithmetics
+#define ZADD(X, Y)         _mm512_add_epi64(X, Y)
+#define ZSUB(X, Y)         _mm512_sub_epi64(X, Y)
+// 52-bit multiply-accumulate: Z + lo52(X*Y) and Z + hi52(X*Y)
+#define ZMADDLO(Z, X, Y)   _mm512_madd52lo_epu64(Z, X, Y)
+#define ZMADDHI(Z, X, Y)   _mm512_madd52hi_epu64(Z, X, Y)
+// bitwise logical operations
+#define ZXOR(X, Y)         _mm512_xor_si512(X, Y)
+#define ZAND(X, Y)         _mm512_and_si512(X, Y)
+#define ZOR(X, Y)          _mm512_or_si512(X, Y)
+#define ZSHR(X, Y)         _mm512_srli_epi64(X, Y)
+#define ZSHL(X, Y)         _mm512_slli_epi64(X, Y)
+// the memory accessing, broadcasting, comparison and blending
+#define ZLOADU(X)          _mm512_loadu_si512((void*)X)
+#define ZSTOREU(X, Y)      _mm512_storeu_si512((void*)X, Y)
+#define ZSET164(X)         _mm512_set1_epi64(X)
+#define ZZERO              _mm512_setzero_si512()
+#define ZCMPEQ(X, Y)       _mm512_cmpeq_epi64_mask(X, Y)
+#define ZTEST(X, Y)        _mm512_test_epi64_mask(X, Y)
+#define ZBLEND(M, X, Y)    _mm512_mask_blend_epi64(M, X, Y)
+#define ZMOV(Z, M, X)      _mm512_mask_mov_epi64(Z, M, X)
+
+
+#endif
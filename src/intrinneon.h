@@ -0,0 +1,56 @@
+/**
+ *******************************************************************************
+ * @file intrinneon.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of ARM NEON intrinsics.
+ *
+ * @details
+ * Define some short names of AArch64 NEON (ASIMD) intrinsics for a clean
+ * code. The prefix "N" refers to the 128-bit NEON registers, which hold two
+ * 64-bit lanes (uint64x2_t) or, for the operands of the multiplications, two
+ * 32-bit lanes (uint32x2_t).
+ *******************************************************************************
+ */
+
+#ifndef INTRINNEON_H
+#define INTRINNEON_H
+
+// NEON head file
+#include <arm_neon.h>
+
+// packed 64-bit arithmetics
+#define NADD(X, Y)         vaddq_u64(X, Y)
+#define NSUB(X, Y)         vsubq_u64(X, Y)
+// 32x32-bit multiplication (umull) and multiply-accumulate (umlal) of the
+// narrowed operands: unlike VMUL of AVX2, the low 32 bits of the 64-bit lanes
+// are taken explicitly with NNARROW (xtn), once per operand
+#define NMUL(X, Y)         vmull_u32(X, Y)
+#define NMAC(Z, X, Y)      vmlal_u32(Z, X, Y)
+#define NNARROW(X)         vmovn_u64(X)
+// bitwise logical operations
+#define NXOR(X, Y)         veorq_u64(X, Y)
+#define NAND(X, Y)         vandq_u64(X, Y)
+#define NOR(X, Y)          vorrq_u64(X, Y)
+#define NSHR(X, Y)         vshrq_n_u64(X, Y)
+#define NSHL(X, Y)         vshlq_n_u64(X, Y)
+// shift right by a variable count (ushl by a negative count)
+#define NSHRV(X, Y)        vshlq_u64(X, vdupq_n_s64(-(int64_t)(Y)))
+// the memory accessing and the broadcasting
+#define NLOADU(X)          vld1q_u64((const uint64_t *)(X))
+#define NSTOREU(X, Y)      vst1q_u64((uint64_t *)(X), Y)
+#define NSET164(X)         vdupq_n_u64(X)
+#define NSET132(X)         vdup_n_u32(X)
+#define NSET64(X, Y)       vcombine_u64(vcreate_u64(Y), vcreate_u64(X))
+#define NZERO              vdupq_n_u64(0)
+#define NEXTR64(X, Y)      vgetq_lane_u64(X, Y)
+// interleave the low (high) 64-bit lanes of two vectors, i.e. transpose a 2x2
+// matrix of 64-bit words
+#define NUNPACKLO(X, Y)    vzip1q_u64(X, Y)
+#define NUNPACKHI(X, Y)    vzip2q_u64(X, Y)
+
+
+#endif
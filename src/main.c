@@ -14,12 +14,133 @@
  */
 
 #include "gfparith.h"
+#include "gfparith25.h"
 #include "moncurve.h"
+#include "moncurve51.h"
 #include "tedcurve.h"
 #include "ecdh.h"
+#include "gfparith512.h"
+#include "moncurve512.h"
+#include "tedcurve512.h"
+#include "x25519.h"
+#include "engine.h"
+#include "peercache.h"
+#include "numa.h"
+#include "prof.h"
+#include "ed25519.h"
+#include "elligator.h"
+#include "gfparith448.h"
+#include "ecdh448.h"
+#include "sha512.h"
+#include "sc25519.h"
 #include "utils.h"
 #include <time.h>
 #include <string.h>
+#include <unistd.h>
+
+// the AVX-512IFMA functions are only called if the CPU supports them
+#define TARGET_AVX512 __attribute__((target("avx2,avx512f,avx512ifma")))
+
+/**
+ * @brief Test the correctness of the field multiplication variants.
+ *
+ * @details
+ * Compare the Karatsuba multiplication, the squaring on doubled limbs and the
+ * radix-2^25.5 multiplication and squaring with the product scanning, for 
+ * random reduced operands, for the difference times the sum of two of them 
+ * (the largest operands that are multiplied), and for the maximal limbs. The
+ * safegcd inversion is compared with the Fermat inversion, also for 0, 1, 
+ * p-1 and p.
+ */
+void test_fp_arith()
+{
+  __m256i a[NWORDS], b[NWORDS], c[NWORDS], d[NWORDS], r[NWORDS];
+  __m256i a25[NWORDS25], b25[NWORDS25], r25[NWORDS25];
+  uint8_t x[4][32], y[4][32], s[4][32], t[4][32];
+  int i, j, n, wrong = 0;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (field multiplication variants):");
+  puts("-------------------------------------------------------------------");
+
+  for (n = 0; n < 1000; n++) {
+    for (i = 0; i < 4; i++)
+      for (j = 0; j < 32; j++) {
+        x[i][j] = (uint8_t)random();
+        y[i][j] = (uint8_t)random();
+      }
+    if (n == 2) {
+      // 0, 1, p-1 and p
+      memset(x, 0, sizeof(x));
+      x[1][0] = 1;
+      for (i = 2; i < 4; i++) {
+        memset(x[i], 0xFF, 32);
+        x[i][0] = (uint8_t)(0xEA + i);
+        x[i][31] = 0x7F;
+      }
+    }
+    mpi29_conv_bytes2mpi29_avx2(a, (const uint8_t (*)[32])x);
+    mpi29_conv_bytes2mpi29_avx2(b, (const uint8_t (*)[32])y);
+    if (n == 0)
+      for (i = 0; i < NWORDS; i++) a[i] = b[i] = VSET164(MASK29);
+
+    // c = a-b (limbs < 1.5*2^30) and d = a+b (limbs < 2^30)
+    mpi29_gfp_sub_avx2(c, a, b);
+    mpi29_gfp_add_avx2(d, a, b);
+    if (n == 1)
+      for (i = 0; i < NWORDS; i++) {
+        c[i] = VSET164(3*MASK29);
+        d[i] = VSET164(2*MASK29);
+      }
+    mpi29_gfp_mul_ps_avx2(r, c, d);
+    mpi29_conv_mpi292bytes_avx2(s, r);
+    mpi29_gfp_mul_kara_avx2(r, c, d);
+    mpi29_conv_mpi292bytes_avx2(t, r);
+    wrong |= memcmp(s, t, sizeof(s));
+    mpi29_gfp_sqr_ps_avx2(r, d);
+    mpi29_conv_mpi292bytes_avx2(s, r);
+    mpi29_gfp_sqr_dbl_avx2(r, d);
+    mpi29_conv_mpi292bytes_avx2(t, r);
+    wrong |= memcmp(s, t, sizeof(s));
+
+    // radix 2^25.5 (of the byte strings)
+    mpi29_conv_bytes2mpi29_avx2(a, (const uint8_t (*)[32])x);
+    mpi29_conv_bytes2mpi29_avx2(b, (const uint8_t (*)[32])y);
+    mpi25_conv_bytes2mpi25_avx2(a25, (const uint8_t (*)[32])x);
+    mpi25_conv_bytes2mpi25_avx2(b25, (const uint8_t (*)[32])y);
+    mpi29_gfp_mul_ps_avx2(r, a, b);
+    mpi29_conv_mpi292bytes_avx2(s, r);
+    mpi25_gfp_mul_avx2(r25, a25, b25);
+    mpi25_conv_mpi252bytes_avx2(t, r25);
+    wrong |= memcmp(s, t, sizeof(s));
+    mpi29_gfp_sqr_ps_avx2(r, a);
+    mpi29_conv_mpi292bytes_avx2(s, r);
+    mpi25_gfp_sqr_avx2(r25, a25);
+    mpi25_conv_mpi252bytes_avx2(t, r25);
+    wrong |= memcmp(s, t, sizeof(s));
+
+    // safegcd inversion (of the byte strings and of the sums, the squarings
+    // of the Fermat inversion do not take larger limbs)
+    mpi29_gfp_inv_fermat_avx2(r, a);
+    mpi29_conv_mpi292bytes_avx2(s, r);
+    mpi29_gfp_inv_safegcd_avx2(r, a);
+    mpi29_conv_mpi292bytes_avx2(t, r);
+    wrong |= memcmp(s, t, sizeof(s));
+    mpi29_gfp_inv_fermat_avx2(r, d);
+    mpi29_conv_mpi292bytes_avx2(s, r);
+    mpi29_gfp_inv_safegcd_avx2(r, d);
+    mpi29_conv_mpi292bytes_avx2(t, r);
+    wrong |= memcmp(s, t, sizeof(s));
+  }
+
+  printf("* multiplication: GFP_MUL = %d, squaring: GFP_SQR = %d\n", GFP_MUL, GFP_SQR);
+  printf("* inversion: GFP_INV = %d\n", GFP_INV);
+  if (wrong)
+    printf("TEST (field variants): \x1b[31mNOT PASS!\x1b[0m\n");
+  else
+    printf("TEST (field variants): \x1b[32mPASS!\x1b[0m\n");
+  puts("*******************************************************************");
+}
 
 /**
  * @brief Test the correctness of our software.
@@ -181,15 +302,1433 @@ void test_ecdh()
   puts("*******************************************************************");
 }
 
+/**
+ * @brief Test the correctness of the AVX-512IFMA software.
+ *
+ * @details
+ * Test the (8*1)-way key generation and shared secret against the (4*1)-way 
+ * AVX2 software, using the test vectors of RFC 7748 and random private keys.
+ */
+TARGET_AVX512 void test_ecdh_avx512()
+{
+  uint64_t w52[NWORDS52][8];
+  uint32_t sk_m[8][8], pk_m[8][8], ss_m[8][8], r29[NWORDS], r[NWORDS];
+  __m512i sk[8], pk[NWORDS52], ss[NWORDS52];
+  __m256i sk4[8], pk4[NWORDS], ss4[NWORDS];
+  int i, j, l, h, wrong = 0;
+
+  // Alice's and Bob's private key (from RFC7748)
+  const uint32_t sk_a[8] = { 0x0a6d0777, 0x7da51873, 0x72c1163c, 0x4566b251, \
+    0x872f4cdf, 0x2a99c0eb, 0xa5fb77b1, 0x2a2cb91d};
+  const uint32_t sk_b[8] = { 0x7e08ab5d, 0x4b8a4a62, 0x8b7fe179, 0xe60e8083, \
+    0x29b13b6f, 0xfdb61826, 0x278b2f1c, 0xebe088ff};
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (AVX-512IFMA):");
+  puts("-------------------------------------------------------------------");
+  puts("EIGHT instances in each run, compared with the AVX2 software.");
+  puts("1st: Alice;    2nd: Bob;  (Alice & Bob are test vectors of RFC7748)");
+  puts("3rd-8th: random, the (2i+1)-th and (2i+2)-th share a secret.");
+
+  for (j = 0; j < 1000; j++) {
+    for (l = 0; l < 8; l++)
+      for (i = 0; i < 8; i++) sk_m[l][i] = (uint32_t)random();
+    if (j == 0) {
+      memcpy(sk_m[0], sk_a, sizeof(sk_a));
+      memcpy(sk_m[1], sk_b, sizeof(sk_b));
+    }
+
+    // intialize AVX-512 vector of private key
+    for (i = 0; i < 8; i++) 
+      sk[i] = _mm512_set_epi64(sk_m[7][i], sk_m[6][i], sk_m[5][i], sk_m[4][i], 
+        sk_m[3][i], sk_m[2][i], sk_m[1][i], sk_m[0][i]);
+
+    keygen_avx512(pk, sk);
+    for (i = 0; i < NWORDS52; i++) memcpy(w52[i], &pk[i], sizeof(pk[i]));
+    for (l = 0; l < 8; l++) {
+      uint64_t a[NWORDS52];
+      for (i = 0; i < NWORDS52; i++) a[i] = w52[i][l];
+      mpi52_conv_52to32(pk_m[l], a);
+    }
+
+    // swap the public keys of each pair and compute the shared secrets
+    for (i = 0; i < NWORDS52; i++) pk[i] = _mm512_permutex_epi64(pk[i], 0xB1);
+    sharedsecret_avx512(ss, sk, pk);
+    for (i = 0; i < NWORDS52; i++) memcpy(w52[i], &ss[i], sizeof(ss[i]));
+    for (l = 0; l < 8; l++) {
+      uint64_t a[NWORDS52];
+      for (i = 0; i < NWORDS52; i++) a[i] = w52[i][l];
+      mpi52_conv_52to32(ss_m[l], a);
+    }
+
+    // the AVX2 software computes the same results for each half
+    for (h = 0; h < 2; h++) {
+      for (i = 0; i < 8; i++) 
+        sk4[i] = VSET64(sk_m[4*h+3][i], sk_m[4*h+2][i], sk_m[4*h+1][i], sk_m[4*h][i]);
+      keygen(pk4, sk4);
+      for (l = 0; l < 4; l++) {
+        for (i = 0; i < NWORDS; i++) r29[i] = ((uint32_t *)&pk4[i])[2*l];
+        mpi29_conv_29to32(r, r29, NWORDS, NWORDS);
+        wrong |= memcmp(r, pk_m[4*h+l], 8*sizeof(uint32_t));
+      }
+      for (i = 0; i < NWORDS; i++) pk4[i] = VPERM64(pk4[i], 0xB1);
+      sharedsecret(ss4, sk4, pk4);
+      for (l = 0; l < 4; l++) {
+        for (i = 0; i < NWORDS; i++) r29[i] = ((uint32_t *)&ss4[i])[2*l];
+        mpi29_conv_29to32(r, r29, NWORDS, NWORDS);
+        wrong |= memcmp(r, ss_m[4*h+l], 8*sizeof(uint32_t));
+      }
+    }
+    for (l = 0; l < 8; l += 2) wrong |= memcmp(ss_m[l], ss_m[l+1], 8*sizeof(uint32_t));
+
+    if (j == 0) {
+      puts("\n* Public key:");
+      mpi29_print("  - Alice : ", pk_m[0], 8);
+      mpi29_print("  - Bob   : ", pk_m[1], 8);
+      puts("\n* Shared secret:");
+      mpi29_print("  - Alice : ", ss_m[0], 8);
+      mpi29_print("  - Bob   : ", ss_m[1], 8);
+      puts("");
+    }
+  }
+
+  puts("Test 8-way ECDH for 1000 times (randomly each time):");
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Test the table query of the fixed-base comb.
+ *
+ * @details
+ * Compare the limb-wise table query with the reference query (64-bit words) 
+ * for every position and every signed digit in each lane, then the queries 
+ * of the replicas of the tables on the NUMA nodes.
+ */
+void test_table_query()
+{
+  NumaInfo info;
+  ProPoint r, s;
+  __m256i b;
+  int pos, d, e, wrong = 0;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (fixed-base table query):");
+  puts("-------------------------------------------------------------------");
+
+  for (pos = 0; pos < FIXBASE_P; pos++)
+    for (d = -FIXBASE_K; d <= FIXBASE_K; d++) {
+      // the digit d and its neighbours, such that the lanes differ
+      e = (d < 0) ? -FIXBASE_K-d : FIXBASE_K-d;
+      b = VSET64((uint8_t)d, (uint8_t)(-d), (uint8_t)(d/2), (uint8_t)e);
+      ted_point_query_table_avx2(&r, pos, b);
+      ted_point_query_table_duif_avx2(&s, pos, b);
+      wrong |= memcmp(r.x, s.x, sizeof(r.x)) | memcmp(r.y, s.y, sizeof(r.y)) |
+               memcmp(r.z, s.z, sizeof(r.z));
+    }
+
+  printf("Test %d positions, digits -%d..%d:\n", FIXBASE_P, FIXBASE_K, FIXBASE_K);
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  // the replicas on the NUMA nodes hold the same tables as base and base29
+  x25519_numa_tables();
+  x25519_numa_bind();
+  numa_get_info(&info);
+  wrong = memcmp(fixbase29, base29, sizeof(base29)) | memcmp(fixbase, base, sizeof(base));
+  for (pos = 0; pos < FIXBASE_P; pos++) {
+    b = VSET64(1, (uint8_t)(-FIXBASE_K), FIXBASE_K, 0);
+    ted_point_query_table_avx2(&r, pos, b);
+    ted_point_query_table_duif_avx2(&s, pos, b);
+    wrong |= memcmp(r.x, s.x, sizeof(r.x)) | memcmp(r.y, s.y, sizeof(r.y)) |
+             memcmp(r.z, s.z, sizeof(r.z));
+  }
+  printf("Replicas: %d node(s), %d in 2 MB pages, %d bound, %ld bytes each\n", 
+         info.nodes, info.huge, info.bound, info.bytes);
+  if (wrong) 
+    printf("TEST (NUMA replicas): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (NUMA replicas): \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Compare two points in extended projective coordinates.
+ *
+ * @param p Point
+ * @param q Point
+ * @return Nonzero if the points differ in any lane
+ */
+static int ted_point_differ_avx2(ExtPoint *p, ExtPoint *q)
+{
+  __m256i s[NWORDS], t[NWORDS];
+  int64_t lane[4];
+
+  // x1*z2 = x2*z1 and y1*z2 = y2*z1
+  mpi29_gfp_mul_avx2(s, p->x, q->z);
+  mpi29_gfp_mul_avx2(t, q->x, p->z);
+  mpi29_gfp_sbc_avx2(s, s, t);
+  VSTOREU(lane, mpi29_gfp_iszero_avx2(s));
+  if (!(lane[0] & lane[1] & lane[2] & lane[3])) return 1;
+  mpi29_gfp_mul_avx2(s, p->y, q->z);
+  mpi29_gfp_mul_avx2(t, q->y, p->z);
+  mpi29_gfp_sbc_avx2(s, s, t);
+  VSTOREU(lane, mpi29_gfp_iszero_avx2(s));
+  return !(lane[0] & lane[1] & lane[2] & lane[3]);
+}
+
+/**
+ * @brief Test the correctness of the variable-time scalar multiplications.
+ *
+ * @details
+ * Compare the variable-time fixed-base comb with the constant-time one, and 
+ * the variable-base wNAF of a*B by k with the comb of a*k mod l, for random 
+ * scalars a, k < l and the scalars k = 0, 1, l-1.
+ */
+void test_vartime()
+{
+  const uint8_t zero[32] = { 0 };
+  const uint8_t lm1[32] = { 
+    0xec, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14, 
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10 };
+  ExtPoint p, q, r;
+  __m256i k[8];
+  uint8_t a[4][32], b[4][32], c[4][32], h[64];
+  int i, j, l, wrong0 = 0, wrong1 = 0;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (variable-time scalar multiplication):");
+  puts("-------------------------------------------------------------------");
+
+  for (i = 0; i < 100; i++) {
+    for (l = 0; l < 4; l++) {
+      for (j = 0; j < 64; j++) h[j] = (uint8_t)random();
+      sc25519_reduce(a[l], h);
+      for (j = 0; j < 64; j++) h[j] = (uint8_t)random();
+      sc25519_reduce(b[l], h);
+    }
+    // k = 0, 1 and l-1 in the first round
+    if (i == 0) { 
+      memset(b[0], 0, 32); 
+      memset(b[1], 0, 32); 
+      b[1][0] = 1; 
+      memcpy(b[2], lm1, 32); 
+    }
+    for (l = 0; l < 4; l++) sc25519_muladd(c[l], a[l], b[l], zero);
+
+    conv_bytes2key_avx2(k, (const uint8_t (*)[32])b);
+    ted_mul_fixbase_ext_avx2(&p, k);
+    ted_mul_fixbase_vartime_avx2(&q, k);
+    wrong0 |= ted_point_differ_avx2(&p, &q);
+
+    conv_bytes2key_avx2(k, (const uint8_t (*)[32])a);
+    ted_mul_fixbase_ext_avx2(&p, k);
+    ted_mul_varbase_vartime_avx2(&r, &p, (const uint8_t (*)[32])b);
+    conv_bytes2key_avx2(k, (const uint8_t (*)[32])c);
+    ted_mul_fixbase_vartime_avx2(&q, k);
+    wrong1 |= ted_point_differ_avx2(&r, &q);
+  }
+
+  puts("Test fixed-base (variable-time vs. constant-time):");
+  if (wrong0) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+  puts("Test variable-base (wNAF, w = 5):");
+  if (wrong1) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Test the correctness of Ed25519 signing.
+ *
+ * @details
+ * Test SHA-512 with the test vectors of FIPS 180-4, key generation and signing
+ * with the test vectors 1 to 3 of RFC 8032 (in every lane), and compare the 
+ * batch signing of n = 0..40 random messages with the 4-way signing. Then 
+ * verify the test vectors and batches of signatures, each also with a bit 
+ * flipped.
+ */
+void test_ed25519()
+{
+  // SHA-512("abc") and SHA-512 of the 448-bit two-block message
+  const char *msg_2b = "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq";
+  const uint8_t sha_1b[64] = { 
+    0xdd, 0xaf, 0x35, 0xa1, 0x93, 0x61, 0x7a, 0xba, 0xcc, 0x41, 0x73, 0x49, 0xae, 0x20, 0x41, 0x31, 
+    0x12, 0xe6, 0xfa, 0x4e, 0x89, 0xa9, 0x7e, 0xa2, 0x0a, 0x9e, 0xee, 0xe6, 0x4b, 0x55, 0xd3, 0x9a, 
+    0x21, 0x92, 0x99, 0x2a, 0x27, 0x4f, 0xc1, 0xa8, 0x36, 0xba, 0x3c, 0x23, 0xa3, 0xfe, 0xeb, 0xbd, 
+    0x45, 0x4d, 0x44, 0x23, 0x64, 0x3c, 0xe8, 0x0e, 0x2a, 0x9a, 0xc9, 0x4f, 0xa5, 0x4c, 0xa4, 0x9f };
+  const uint8_t sha_2b[64] = { 
+    0x20, 0x4a, 0x8f, 0xc6, 0xdd, 0xa8, 0x2f, 0x0a, 0x0c, 0xed, 0x7b, 0xeb, 0x8e, 0x08, 0xa4, 0x16, 
+    0x57, 0xc1, 0x6e, 0xf4, 0x68, 0xb2, 0x28, 0xa8, 0x27, 0x9b, 0xe3, 0x31, 0xa7, 0x03, 0xc3, 0x35, 
+    0x96, 0xfd, 0x15, 0xc1, 0x3b, 0x1b, 0x07, 0xf9, 0xaa, 0x1d, 0x3b, 0xea, 0x57, 0x78, 0x9c, 0xa0, 
+    0x31, 0xad, 0x85, 0xc7, 0xa7, 0x1d, 0xd7, 0x03, 0x54, 0xec, 0x63, 0x12, 0x38, 0xca, 0x34, 0x45 };
+  // RFC 8032, test vectors 1 to 3 (messages of 0, 1 and 2 bytes)
+  const uint8_t sk_v[3][32] = { {
+    0x9d, 0x61, 0xb1, 0x9d, 0xef, 0xfd, 0x5a, 0x60, 0xba, 0x84, 0x4a, 0xf4, 0x92, 0xec, 0x2c, 0xc4, 
+    0x44, 0x49, 0xc5, 0x69, 0x7b, 0x32, 0x69, 0x19, 0x70, 0x3b, 0xac, 0x03, 0x1c, 0xae, 0x7f, 0x60 }, {
+    0x4c, 0xcd, 0x08, 0x9b, 0x28, 0xff, 0x96, 0xda, 0x9d, 0xb6, 0xc3, 0x46, 0xec, 0x11, 0x4e, 0x0f, 
+    0x5b, 0x8a, 0x31, 0x9f, 0x35, 0xab, 0xa6, 0x24, 0xda, 0x8c, 0xf6, 0xed, 0x4f, 0xb8, 0xa6, 0xfb }, {
+    0xc5, 0xaa, 0x8d, 0xf4, 0x3f, 0x9f, 0x83, 0x7b, 0xed, 0xb7, 0x44, 0x2f, 0x31, 0xdc, 0xb7, 0xb1, 
+    0x66, 0xd3, 0x85, 0x35, 0x07, 0x6f, 0x09, 0x4b, 0x85, 0xce, 0x3a, 0x2e, 0x0b, 0x44, 0x58, 0xf7 } };
+  const uint8_t pk_v[3][32] = { {
+    0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7, 0xd5, 0x4b, 0xfe, 0xd3, 0xc9, 0x64, 0x07, 0x3a, 
+    0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25, 0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a }, {
+    0x3d, 0x40, 0x17, 0xc3, 0xe8, 0x43, 0x89, 0x5a, 0x92, 0xb7, 0x0a, 0xa7, 0x4d, 0x1b, 0x7e, 0xbc, 
+    0x9c, 0x98, 0x2c, 0xcf, 0x2e, 0xc4, 0x96, 0x8c, 0xc0, 0xcd, 0x55, 0xf1, 0x2a, 0xf4, 0x66, 0x0c }, {
+    0xfc, 0x51, 0xcd, 0x8e, 0x62, 0x18, 0xa1, 0xa3, 0x8d, 0xa4, 0x7e, 0xd0, 0x02, 0x30, 0xf0, 0x58, 
+    0x08, 0x16, 0xed, 0x13, 0xba, 0x33, 0x03, 0xac, 0x5d, 0xeb, 0x91, 0x15, 0x48, 0x90, 0x80, 0x25 } };
+  const uint8_t msg_v[3][2] = { { 0x00, 0x00 }, { 0x72, 0x00 }, { 0xaf, 0x82 } };
+  // the lower 16 bytes of the group order l
+  const uint8_t sc_l[16] = { 0xed, 0xd3, 0xf5, 0x5c, 0x1a, 0x63, 0x12, 0x58, 
+    0xd6, 0x9c, 0xf7, 0xa2, 0xde, 0xf9, 0xde, 0x14 };
+  const uint8_t sig_v[3][64] = { {
+    0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72, 0x90, 0x86, 0xe2, 0xcc, 0x80, 0x6e, 0x82, 0x8a, 
+    0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74, 0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55, 
+    0x5f, 0xb8, 0x82, 0x15, 0x90, 0xa3, 0x3b, 0xac, 0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b, 
+    0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24, 0x65, 0x51, 0x41, 0x43, 0x8e, 0x7a, 0x10, 0x0b }, {
+    0x92, 0xa0, 0x09, 0xa9, 0xf0, 0xd4, 0xca, 0xb8, 0x72, 0x0e, 0x82, 0x0b, 0x5f, 0x64, 0x25, 0x40, 
+    0xa2, 0xb2, 0x7b, 0x54, 0x16, 0x50, 0x3f, 0x8f, 0xb3, 0x76, 0x22, 0x23, 0xeb, 0xdb, 0x69, 0xda, 
+    0x08, 0x5a, 0xc1, 0xe4, 0x3e, 0x15, 0x99, 0x6e, 0x45, 0x8f, 0x36, 0x13, 0xd0, 0xf1, 0x1d, 0x8c, 
+    0x38, 0x7b, 0x2e, 0xae, 0xb4, 0x30, 0x2a, 0xee, 0xb0, 0x0d, 0x29, 0x16, 0x12, 0xbb, 0x0c, 0x00 }, {
+    0x62, 0x91, 0xd6, 0x57, 0xde, 0xec, 0x24, 0x02, 0x48, 0x27, 0xe6, 0x9c, 0x3a, 0xbe, 0x01, 0xa3, 
+    0x0c, 0xe5, 0x48, 0xa2, 0x84, 0x74, 0x3a, 0x44, 0x5e, 0x36, 0x80, 0xd7, 0xdb, 0x5a, 0xc3, 0xac, 
+    0x18, 0xff, 0x9b, 0x53, 0x8d, 0x16, 0xf2, 0x90, 0xae, 0x67, 0xf7, 0x60, 0x98, 0x4d, 0xc6, 0x59, 
+    0x4a, 0x7c, 0x15, 0xe9, 0x71, 0x6e, 0xd2, 0x8d, 0xc0, 0x27, 0xbe, 0xce, 0xea, 0x1e, 0xc4, 0x0a } };
+  // three spare entries, the 4-way reference reads message i to i+3
+  static uint8_t sk[44][32], pk[44][32], sig[40][64], sigr[4][64], buf[44][300];
+  const uint8_t *msg[44];
+  size_t len[44];
+  uint8_t h[64];
+  int i, j, l, n, wrong;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (Ed25519 signing and verification):");
+  puts("-------------------------------------------------------------------");
+
+  sha512(h, (const uint8_t *)"abc", 3);
+  wrong = memcmp(h, sha_1b, 64);
+  sha512(h, (const uint8_t *)msg_2b, strlen(msg_2b));
+  wrong |= memcmp(h, sha_2b, 64);
+  puts("Test SHA-512 (FIPS 180-4):");
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  // test vector j in the lanes, the fourth lane repeats the first one
+  wrong = 0;
+  for (l = 0; l < 4; l++) {
+    memcpy(sk[l], sk_v[l%3], 32);
+    msg[l] = msg_v[l%3];
+    len[l] = l%3;
+  }
+  ed25519_pubkey_avx2(pk, (const uint8_t (*)[32])sk);
+  ed25519_sign_avx2(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+  for (l = 0; l < 4; l++) {
+    wrong |= memcmp(pk[l], pk_v[l%3], 32);
+    wrong |= memcmp(sig[l], sig_v[l%3], 64);
+  }
+  puts("Test 4-way key generation and signing (RFC 8032):");
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  // batches of n random messages vs. the 4-way signing (message i in lane 0)
+  wrong = 0;
+  for (i = 0; i < 44; i++) {
+    for (j = 0; j < 32; j++) sk[i][j] = (uint8_t)random();
+    len[i] = (size_t)(random() % 300);
+    for (j = 0; j < (int)len[i]; j++) buf[i][j] = (uint8_t)random();
+    msg[i] = buf[i];
+  }
+  for (i = 0; i < 44; i += 4) ed25519_pubkey_avx2(pk + i, (const uint8_t (*)[32])(sk + i));
+  for (n = 0; n <= 40; n += (n < 8) ? 1 : 11) {
+    memset(sig, 0, sizeof(sig));
+    ed25519_sign_batch(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, n);
+    for (i = 0; i < n; i++) {
+      ed25519_sign_avx2(sigr, msg + i, len + i, (const uint8_t (*)[32])(sk + i), 
+        (const uint8_t (*)[32])(pk + i));
+      wrong |= memcmp(sig[i], sigr[0], 64);
+    }
+    for (i = n; i < 40; i++) for (j = 0; j < 64; j++) wrong |= sig[i][j];
+  }
+  puts("Test batch signing (n = 0..40):");
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  // verification of the RFC 8032 signatures, and of modified ones
+  wrong = 0;
+  for (j = 0; j < 3; j++) {
+    wrong |= (ed25519_verify(sig_v[j], msg_v[j], j, pk_v[j]) != 1);
+    memcpy(sigr[0], sig_v[j], 64);
+    sigr[0][j] ^= 0x01;
+    wrong |= (ed25519_verify(sigr[0], msg_v[j], j, pk_v[j]) != 0);
+    memcpy(sigr[0], sig_v[j], 64);
+    sigr[0][40+j] ^= 0x20;
+    wrong |= (ed25519_verify(sigr[0], msg_v[j], j, pk_v[j]) != 0);
+    wrong |= (ed25519_verify(sig_v[j], msg_v[j], j, pk_v[(j+1)%3]) != 0);
+    if (j > 0) wrong |= (ed25519_verify(sig_v[j], msg_v[j], j-1, pk_v[j]) != 0);
+  }
+  // S + l is rejected (not canonical)
+  memcpy(sigr[0], sig_v[0], 64);
+  for (i = 0, l = 0; i < 32; i++) {
+    l += sigr[0][32+i] + (i < 16 ? sc_l[i] : (i == 31 ? 0x10 : 0));
+    sigr[0][32+i] = (uint8_t)l;
+    l >>= 8;
+  }
+  wrong |= (ed25519_verify(sigr[0], msg_v[0], 0, pk_v[0]) != 0);
+  puts("Test verification (RFC 8032, modified signatures):");
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  // batches of n valid signatures, then with one modified signature
+  wrong = 0;
+  ed25519_sign_batch(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, 40);
+  for (n = 1; n <= 40; n += (n < 8) ? 1 : 11) {
+    wrong |= (ed25519_verify_batch((const uint8_t (*)[64])sig, msg, len, 
+      (const uint8_t (*)[32])pk, n) != 1);
+    i = (int)(random() % n);
+    sig[i][random() % 64] ^= 0x04;
+    wrong |= (ed25519_verify_batch((const uint8_t (*)[64])sig, msg, len, 
+      (const uint8_t (*)[32])pk, n) != 0);
+    ed25519_sign_batch(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, 40);
+  }
+  puts("Test batch verification (n = 1..40):");
+  if (wrong) 
+    printf("TEST: \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST : \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Test the correctness of all supported implementations.
+ *
+ * @details
+ * Test the byte-level key generation and shared secret of every implementation 
+ * supported by this CPU according to the test vectors of RFC 7748, and compare 
+ * them with the portable implementation for random private keys.
+ */
+void test_x25519()
+{
+  // Alice's private and public key, Bob's public key and the shared secret (RFC7748)
+  const uint8_t sk_a[32] = { 
+    0x77, 0x07, 0x6d, 0x0a, 0x73, 0x18, 0xa5, 0x7d, 0x3c, 0x16, 0xc1, 0x72, 0x51, 0xb2, 0x66, 0x45, 
+    0xdf, 0x4c, 0x2f, 0x87, 0xeb, 0xc0, 0x99, 0x2a, 0xb1, 0x77, 0xfb, 0xa5, 0x1d, 0xb9, 0x2c, 0x2a };
+  const uint8_t pk_a[32] = { 
+    0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d, 0xdc, 0xb4, 0x3e, 0xf7, 0x5a, 
+    0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38, 0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a };
+  const uint8_t pk_b[32] = { 
+    0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61, 0xc2, 0xec, 0xe4, 0x35, 0x37, 
+    0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78, 0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f };
+  const uint8_t ss_ab[32] = { 
+    0x4a, 0x5d, 0x9d, 0x5b, 0xa4, 0xce, 0x2d, 0xe1, 0x72, 0x8e, 0x3b, 0xf4, 0x80, 0x35, 0x0f, 0x25, 
+    0xe0, 0x7e, 0x21, 0xc9, 0x47, 0xd1, 0x9e, 0x33, 0x76, 0xf0, 0x9b, 0x3c, 0x1e, 0x16, 0x17, 0x42 };
+  uint8_t sk[8][32], pk[8][32], ss[8][32], pkr[8][32], ssr[8][32];
+  const X25519Impl *impl, *ref = x25519_impl_by_id(X25519_C64);
+  int i, j, l, id, wrong;
+
+  puts("\n*******************************************************************");
+  printf("CORRECTNESS TEST (dispatcher, selected: %s):\n", x25519_impl()->name);
+  puts("-------------------------------------------------------------------");
+
+  for (id = 0; id < X25519_NIMPLS; id++) {
+    impl = x25519_impl_by_id(id);
+    if (impl == NULL) continue;
+    wrong = 0;
+
+    // RFC 7748 test vectors in every lane
+    for (l = 0; l < impl->lanes; l++) {
+      memcpy(sk[l], sk_a, 32);
+      memcpy(pk[l], pk_b, 32);
+    }
+    impl->keygen(pkr, (const uint8_t (*)[32])sk);
+    impl->sharedsecret(ssr, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+    for (l = 0; l < impl->lanes; l++) {
+      wrong |= memcmp(pkr[l], pk_a, 32);
+      wrong |= memcmp(ssr[l], ss_ab, 32);
+    }
+
+    // random private keys (and public keys with bit 255 set) against c64
+    for (j = 0; j < 100; j++) {
+      for (l = 0; l < impl->lanes; l++)
+        for (i = 0; i < 32; i++) {
+          sk[l][i] = (uint8_t)random();
+          pk[l][i] = (uint8_t)random();
+        }
+      impl->keygen(pkr, (const uint8_t (*)[32])sk);
+      impl->sharedsecret(ssr, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+      for (l = 0; l < impl->lanes; l++) {
+        ref->keygen((uint8_t (*)[32])ss[l], (const uint8_t (*)[32])sk[l]);
+        wrong |= memcmp(pkr[l], ss[l], 32);
+        ref->sharedsecret((uint8_t (*)[32])ss[l], (const uint8_t (*)[32])sk[l], 
+          (const uint8_t (*)[32])pk[l]);
+        wrong |= memcmp(ssr[l], ss[l], 32);
+      }
+    }
+
+    if (wrong) 
+      printf("TEST (%-8s, %d-way): \x1b[31mNOT PASS!\x1b[0m\n", impl->name, impl->lanes);
+    else 
+      printf("TEST (%-8s, %d-way): \x1b[32mPASS!\x1b[0m\n", impl->name, impl->lanes);
+  }
+
+  // the identifiers of the ABI (AVXECC_1.0) and the selection by throughput 
+  // (unless AVXECC_IMPL forces another one)
+  {
+    static const char *const names[X25519_NIMPLS] = { "c64", "avx2-1x4", "avx2", 
+      "avx512", "avx2-2x2", "neon" };
+    wrong = 0;
+    for (id = 0; id < X25519_NIMPLS; id++) {
+      impl = x25519_impl_by_id(id);
+      if ((impl != NULL) && strcmp(impl->name, names[id])) wrong = 1;
+    }
+    if (getenv("AVXECC_IMPL") == NULL) {
+      if (x25519_impl_by_id(X25519_AVX512)) wrong |= (x25519_impl() != x25519_impl_by_id(X25519_AVX512));
+      else if (x25519_impl_by_id(X25519_AVX2)) wrong |= (x25519_impl() != x25519_impl_by_id(X25519_AVX2));
+    }
+    if (wrong) 
+      printf("TEST (identifiers and selection): \x1b[31mNOT PASS!\x1b[0m\n");
+    else 
+      printf("TEST (identifiers and selection): \x1b[32mPASS!\x1b[0m\n");
+  }
+
+  // batches of all sizes up to 19 (full groups and every possible tail)
+  uint8_t skn[19][32], pkn[19][32], ssn[19][32], rn[19][32];
+  size_t n;
+  wrong = 0;
+  for (n = 0; n <= 19; n++) {
+    for (l = 0; l < (int)n; l++)
+      for (i = 0; i < 32; i++) {
+        skn[l][i] = (uint8_t)random();
+        pkn[l][i] = (uint8_t)random();
+      }
+    x25519_keygen_batch(rn, (const uint8_t (*)[32])skn, n);
+    for (l = 0; l < (int)n; l++) {
+      ref->keygen((uint8_t (*)[32])ssn[l], (const uint8_t (*)[32])skn[l]);
+      wrong |= memcmp(rn[l], ssn[l], 32);
+    }
+    x25519_sharedsecret_batch(rn, (const uint8_t (*)[32])skn, (const uint8_t (*)[32])pkn, n);
+    for (l = 0; l < (int)n; l++) {
+      ref->sharedsecret((uint8_t (*)[32])ssn[l], (const uint8_t (*)[32])skn[l], 
+        (const uint8_t (*)[32])pkn[l]);
+      wrong |= memcmp(rn[l], ssn[l], 32);
+    }
+  }
+  if (wrong) 
+    printf("TEST (batch, n = 0..19): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (batch, n = 0..19): \x1b[32mPASS!\x1b[0m\n");
+
+  // calls with a shared inversion, including the low-order inputs 0 and p
+  static uint8_t skm[8*X25519_MAXGROUPS][32], pkm[8*X25519_MAXGROUPS][32];
+  static uint8_t rm[8*X25519_MAXGROUPS][32], sm[8*X25519_MAXGROUPS][32];
+  const int ms[3] = { 1, 3, X25519_MAXGROUPS };
+  for (id = 0; id < X25519_NIMPLS; id++) {
+    impl = x25519_impl_by_id(id);
+    if ((impl == NULL) || (impl->keygen_n == NULL)) continue;
+    wrong = 0;
+    for (j = 0; j < 3; j++) {
+      n = (size_t)(ms[j]*impl->lanes);
+      for (l = 0; l < (int)n; l++)
+        for (i = 0; i < 32; i++) {
+          skm[l][i] = (uint8_t)random();
+          pkm[l][i] = (uint8_t)random();
+        }
+      memset(pkm[n/2], 0, 32);
+      memset(pkm[n-1], 0xFF, 32); pkm[n-1][0] = 0xED; pkm[n-1][31] = 0x7F;
+      impl->keygen_n(rm, (const uint8_t (*)[32])skm, ms[j]);
+      for (l = 0; l < (int)n; l++) {
+        ref->keygen((uint8_t (*)[32])sm[l], (const uint8_t (*)[32])skm[l]);
+        wrong |= memcmp(rm[l], sm[l], 32);
+      }
+      impl->sharedsecret_n(rm, (const uint8_t (*)[32])skm, (const uint8_t (*)[32])pkm, ms[j]);
+      for (l = 0; l < (int)n; l++) {
+        ref->sharedsecret((uint8_t (*)[32])sm[l], (const uint8_t (*)[32])skm[l], 
+          (const uint8_t (*)[32])pkm[l]);
+        wrong |= memcmp(rm[l], sm[l], 32);
+      }
+    }
+    if (wrong) 
+      printf("TEST (%-8s, batch inversion): \x1b[31mNOT PASS!\x1b[0m\n", impl->name);
+    else 
+      printf("TEST (%-8s, batch inversion): \x1b[32mPASS!\x1b[0m\n", impl->name);
+  }
+
+  // validation: the points of small order (0, 1, -1, the two of order 8, and
+  // p and p+1) and random public keys, in the kernels and in batches
+  const uint8_t lo8[2][32] = { {
+    0xe0, 0xeb, 0x7a, 0x7c, 0x3b, 0x41, 0xb8, 0xae, 0x16, 0x56, 0xe3, 0xfa, 0xf1, 0x9f, 0xc4, 0x6a, 
+    0xda, 0x09, 0x8d, 0xeb, 0x9c, 0x32, 0xb1, 0xfd, 0x86, 0x62, 0x05, 0x16, 0x5f, 0x49, 0xb8, 0x00 }, {
+    0x5f, 0x9c, 0x95, 0xbc, 0xa3, 0x50, 0x8c, 0x24, 0xb1, 0xd0, 0xb1, 0x55, 0x9c, 0x83, 0xef, 0x5b, 
+    0x04, 0x44, 0x5c, 0xc4, 0x58, 0x1c, 0x8e, 0x86, 0xd8, 0x22, 0x4e, 0xdd, 0xd0, 0x9f, 0x11, 0x57 } };
+  static uint8_t okm[8*X25519_MAXGROUPS], lom[8*X25519_MAXGROUPS];
+  __m256i vk[8], vu[NWORDS], vr[NWORDS];
+  uint64_t w[4];
+  size_t cnt;
+  wrong = 0;
+  for (j = 0; j < 4; j++) {
+    n = (size_t)(j*29 + 3);
+    for (l = 0; l < (int)n; l++) {
+      for (i = 0; i < 32; i++) {
+        skm[l][i] = (uint8_t)random();
+        pkm[l][i] = (uint8_t)random();
+      }
+      lom[l] = ((l*5 + j) % 7 == 0);
+      if (lom[l]) {
+        i = (int)(random() % 7);
+        memset(pkm[l], 0, 32);
+        if (i < 2) memcpy(pkm[l], lo8[i], 32);
+        else if (i == 3) pkm[l][0] = 1;
+        else if (i >= 4) {
+          memset(pkm[l], 0xFF, 32); pkm[l][31] = 0x7F;
+          pkm[l][0] = (i == 4) ? 0xEC : (i == 5) ? 0xED : 0xEE;
+        }
+      }
+    }
+    cnt = x25519_sharedsecret_batch_checked(rm, okm, (const uint8_t (*)[32])skm, 
+      (const uint8_t (*)[32])pkm, n);
+    x25519_sharedsecret_batch(sm, (const uint8_t (*)[32])skm, (const uint8_t (*)[32])pkm, n);
+    wrong |= memcmp(rm, sm, 32*n);
+    for (l = 0; l < (int)n; l++) { wrong |= (okm[l] == lom[l]); cnt += lom[l]; }
+    wrong |= (cnt != n);
+  }
+  for (id = X25519_AVX2; id <= X25519_AVX512; id++) {
+    impl = x25519_impl_by_id(id);
+    if (impl == NULL) continue;
+    n = (size_t)(3*impl->lanes);
+    cnt = (size_t)((id == X25519_AVX2) ? 
+      x25519_sharedsecret_checked_n_avx2(rm, okm, (const uint8_t (*)[32])skm, 
+        (const uint8_t (*)[32])pkm, 3) :
+      x25519_sharedsecret_checked_n_avx512(rm, okm, (const uint8_t (*)[32])skm, 
+        (const uint8_t (*)[32])pkm, 3));
+    for (l = 0; l < (int)n; l++) { wrong |= (okm[l] == lom[l]); cnt += lom[l]; }
+    wrong |= (cnt != n) | memcmp(rm, sm, 32*n);
+  }
+  conv_bytes2key_avx2(vk, (const uint8_t (*)[32])skm);
+  mpi29_conv_bytes2mpi29_avx2(vu, (const uint8_t (*)[32])pkm);
+  VSTOREU(w, sharedsecret_checked(vr, vk, vu));
+  for (l = 0; l < 4; l++) wrong |= ((w[l] & 1) == lom[l]);
+  if (wrong) 
+    printf("TEST (validated shared secrets): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (validated shared secrets): \x1b[32mPASS!\x1b[0m\n");
+
+  // interleaved buffers: the kernels of every implementation (the shared 
+  // secrets in place of the public keys), then batches of all sizes up to 19
+  static X25519Group gsk[2*X25519_MAXGROUPS], gpk[2*X25519_MAXGROUPS];
+  static X25519Group gr[2*X25519_MAXGROUPS];
+  void (*keygen_soa)(X25519Group *, const X25519Group *, int);
+  void (*sharedsecret_soa)(X25519Group *, const X25519Group *, const X25519Group *, int);
+  for (id = 0; id < X25519_NIMPLS; id++) {
+    impl = x25519_impl_by_id(id);
+    if ((impl == NULL) || ((id != X25519_AVX2) && (id != X25519_AVX512))) continue;
+    keygen_soa = (id == X25519_AVX2) ? x25519_keygen_soa_n_avx2 : x25519_keygen_soa_n_avx512;
+    sharedsecret_soa = (id == X25519_AVX2) ? x25519_sharedsecret_soa_n_avx2 : 
+      x25519_sharedsecret_soa_n_avx512;
+    wrong = 0;
+    for (j = 0; j < 3; j++) {
+      n = (size_t)(ms[j]*impl->lanes);
+      for (l = 0; l < (int)n; l++) {
+        for (i = 0; i < 32; i++) {
+          skm[l][i] = (uint8_t)random();
+          pkm[l][i] = (uint8_t)random();
+        }
+        x25519_soa_put(gsk, (size_t)l, skm[l]);
+        x25519_soa_put(gpk, (size_t)l, pkm[l]);
+      }
+      keygen_soa(gr, gsk, ms[j]);
+      for (l = 0; l < (int)n; l++) {
+        ref->keygen((uint8_t (*)[32])sm[l], (const uint8_t (*)[32])skm[l]);
+        x25519_soa_get(rm[l], gr, (size_t)l);
+        wrong |= memcmp(rm[l], sm[l], 32);
+      }
+      sharedsecret_soa(gpk, gsk, gpk, ms[j]);
+      for (l = 0; l < (int)n; l++) {
+        ref->sharedsecret((uint8_t (*)[32])sm[l], (const uint8_t (*)[32])skm[l], 
+          (const uint8_t (*)[32])pkm[l]);
+        x25519_soa_get(rm[l], gpk, (size_t)l);
+        wrong |= memcmp(rm[l], sm[l], 32);
+      }
+    }
+    if (wrong) 
+      printf("TEST (%-8s, interleaved): \x1b[31mNOT PASS!\x1b[0m\n", impl->name);
+    else 
+      printf("TEST (%-8s, interleaved): \x1b[32mPASS!\x1b[0m\n", impl->name);
+  }
+  wrong = 0;
+  for (n = 0; n <= 19; n++) {
+    for (l = 0; l < (int)n; l++) {
+      for (i = 0; i < 32; i++) {
+        skn[l][i] = (uint8_t)random();
+        pkn[l][i] = (uint8_t)random();
+      }
+      x25519_soa_put(gsk, (size_t)l, skn[l]);
+      x25519_soa_put(gpk, (size_t)l, pkn[l]);
+    }
+    x25519_keygen_soa(gr, gsk, n);
+    for (l = 0; l < (int)n; l++) {
+      ref->keygen((uint8_t (*)[32])ssn[l], (const uint8_t (*)[32])skn[l]);
+      x25519_soa_get(rn[l], gr, (size_t)l);
+      wrong |= memcmp(rn[l], ssn[l], 32);
+    }
+    x25519_sharedsecret_soa(gsk, gsk, gpk, n);
+    for (l = 0; l < (int)n; l++) {
+      ref->sharedsecret((uint8_t (*)[32])ssn[l], (const uint8_t (*)[32])skn[l], 
+        (const uint8_t (*)[32])pkn[l]);
+      x25519_soa_get(rn[l], gsk, (size_t)l);
+      wrong |= memcmp(rn[l], ssn[l], 32);
+    }
+  }
+  if (wrong) 
+    printf("TEST (interleaved batch, n = 0..19): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (interleaved batch, n = 0..19): \x1b[32mPASS!\x1b[0m\n");
+
+  // hybrid ladder: the four AVX2 lanes and the ns scalar instances against c64
+  if (x25519_has_hybrid()) {
+    int ns;
+    wrong = 0;
+    for (ns = 0; ns <= MON_HYBRID_MAXSCALAR; ns++)
+      for (j = 0; j < 20; j++) {
+        for (l = 0; l < 4+ns; l++)
+          for (i = 0; i < 32; i++) {
+            sk[l][i] = (uint8_t)random();
+            pk[l][i] = (uint8_t)random();
+          }
+        if (j == 0) memcpy(pk[3+ns], pk_b, 32);
+        x25519_sharedsecret_hybrid_avx2(ssr, (const uint8_t (*)[32])sk, 
+          (const uint8_t (*)[32])pk, ns);
+        for (l = 0; l < 4+ns; l++) {
+          ref->sharedsecret((uint8_t (*)[32])ss[l], (const uint8_t (*)[32])sk[l], 
+            (const uint8_t (*)[32])pk[l]);
+          wrong |= memcmp(ssr[l], ss[l], 32);
+        }
+      }
+    if (wrong) 
+      printf("TEST (hybrid AVX2 + MULX, ns = 0..%d): \x1b[31mNOT PASS!\x1b[0m\n", MON_HYBRID_MAXSCALAR);
+    else 
+      printf("TEST (hybrid AVX2 + MULX, ns = 0..%d): \x1b[32mPASS!\x1b[0m\n", MON_HYBRID_MAXSCALAR);
+  }
+
+  // non-canonical u-coordinates: p+5, 2^255-1, 2^256-1 (bit 255 masked) and 9
+  uint8_t u[4][32], e[4][32];
+  __m256i v[NWORDS];
+  memset(u, 0xFF, sizeof(u)); memset(e, 0, sizeof(e));
+  u[0][0] = 0xF2; u[0][31] = 0x7F; e[0][0] = 5;
+  u[1][31] = 0x7F; e[1][0] = 18;
+  e[2][0] = 18;
+  memset(u[3], 0, 32); u[3][0] = 9; e[3][0] = 9;
+  mpi29_conv_bytes2mpi29_avx2(v, (const uint8_t (*)[32])u);
+  mpi29_conv_mpi292bytes_avx2(u, v);
+  if (memcmp(u, e, sizeof(u))) 
+    printf("TEST (canonical encoding): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (canonical encoding): \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Test the correctness of X448.
+ *
+ * @details
+ * Test the 4-way X448 with the test vectors of RFC 7748, compare the 
+ * fixed-base key generation (the comb on Ed448) with the ladder on u = 5 for
+ * random private keys, and check that u-coordinates >= p are reduced.
+ */
+void test_x448()
+{
+  // the test vectors of RFC 7748, section 5.2 (the first two) and 6.2
+  const uint8_t x448_k1[56] = { 
+    0x3d, 0x26, 0x2f, 0xdd, 0xf9, 0xec, 0x8e, 0x88, 0x49, 0x52, 0x66, 0xfe, 0xa1, 0x9a, 0x34, 0xd2, 
+    0x88, 0x82, 0xac, 0xef, 0x04, 0x51, 0x04, 0xd0, 0xd1, 0xaa, 0xe1, 0x21, 0x70, 0x0a, 0x77, 0x9c, 
+    0x98, 0x4c, 0x24, 0xf8, 0xcd, 0xd7, 0x8f, 0xbf, 0xf4, 0x49, 0x43, 0xeb, 0xa3, 0x68, 0xf5, 0x4b, 
+    0x29, 0x25, 0x9a, 0x4f, 0x1c, 0x60, 0x0a, 0xd3 };
+  const uint8_t x448_u1[56] = { 
+    0x06, 0xfc, 0xe6, 0x40, 0xfa, 0x34, 0x87, 0xbf, 0xda, 0x5f, 0x6c, 0xf2, 0xd5, 0x26, 0x3f, 0x8a, 
+    0xad, 0x88, 0x33, 0x4c, 0xbd, 0x07, 0x43, 0x7f, 0x02, 0x0f, 0x08, 0xf9, 0x81, 0x4d, 0xc0, 0x31, 
+    0xdd, 0xbd, 0xc3, 0x8c, 0x19, 0xc6, 0xda, 0x25, 0x83, 0xfa, 0x54, 0x29, 0xdb, 0x94, 0xad, 0xa1, 
+    0x8a, 0xa7, 0xa7, 0xfb, 0x4e, 0xf8, 0xa0, 0x86 };
+  const uint8_t x448_r1[56] = { 
+    0xce, 0x3e, 0x4f, 0xf9, 0x5a, 0x60, 0xdc, 0x66, 0x97, 0xda, 0x1d, 0xb1, 0xd8, 0x5e, 0x6a, 0xfb, 
+    0xdf, 0x79, 0xb5, 0x0a, 0x24, 0x12, 0xd7, 0x54, 0x6d, 0x5f, 0x23, 0x9f, 0xe1, 0x4f, 0xba, 0xad, 
+    0xeb, 0x44, 0x5f, 0xc6, 0x6a, 0x01, 0xb0, 0x77, 0x9d, 0x98, 0x22, 0x39, 0x61, 0x11, 0x1e, 0x21, 
+    0x76, 0x62, 0x82, 0xf7, 0x3d, 0xd9, 0x6b, 0x6f };
+  const uint8_t x448_k2[56] = { 
+    0x20, 0x3d, 0x49, 0x44, 0x28, 0xb8, 0x39, 0x93, 0x52, 0x66, 0x5d, 0xdc, 0xa4, 0x2f, 0x9d, 0xe8, 
+    0xfe, 0xf6, 0x00, 0x90, 0x8e, 0x0d, 0x46, 0x1c, 0xb0, 0x21, 0xf8, 0xc5, 0x38, 0x34, 0x5d, 0xd7, 
+    0x7c, 0x3e, 0x48, 0x06, 0xe2, 0x5f, 0x46, 0xd3, 0x31, 0x5c, 0x44, 0xe0, 0xa5, 0xb4, 0x37, 0x12, 
+    0x82, 0xdd, 0x2c, 0x8d, 0x5b, 0xe3, 0x09, 0x5f };
+  const uint8_t x448_u2[56] = { 
+    0x0f, 0xbc, 0xc2, 0xf9, 0x93, 0xcd, 0x56, 0xd3, 0x30, 0x5b, 0x0b, 0x7d, 0x9e, 0x55, 0xd4, 0xc1, 
+    0xa8, 0xfb, 0x5d, 0xbb, 0x52, 0xf8, 0xe9, 0xa1, 0xe9, 0xb6, 0x20, 0x1b, 0x16, 0x5d, 0x01, 0x58, 
+    0x94, 0xe5, 0x6c, 0x4d, 0x35, 0x70, 0xbe, 0xe5, 0x2f, 0xe2, 0x05, 0xe2, 0x8a, 0x78, 0xb9, 0x1c, 
+    0xdf, 0xbd, 0xe7, 0x1c, 0xe8, 0xd1, 0x57, 0xdb };
+  const uint8_t x448_r2[56] = { 
+    0x88, 0x4a, 0x02, 0x57, 0x62, 0x39, 0xff, 0x7a, 0x2f, 0x2f, 0x63, 0xb2, 0xdb, 0x6a, 0x9f, 0xf3, 
+    0x70, 0x47, 0xac, 0x13, 0x56, 0x8e, 0x1e, 0x30, 0xfe, 0x63, 0xc4, 0xa7, 0xad, 0x1b, 0x3e, 0xe3, 
+    0xa5, 0x70, 0x0d, 0xf3, 0x43, 0x21, 0xd6, 0x20, 0x77, 0xe6, 0x36, 0x33, 0xc5, 0x75, 0xc1, 0xc9, 
+    0x54, 0x51, 0x4e, 0x99, 0xda, 0x7c, 0x17, 0x9d };
+  const uint8_t sk_a[56] = { 
+    0x9a, 0x8f, 0x49, 0x25, 0xd1, 0x51, 0x9f, 0x57, 0x75, 0xcf, 0x46, 0xb0, 0x4b, 0x58, 0x00, 0xd4, 
+    0xee, 0x9e, 0xe8, 0xba, 0xe8, 0xbc, 0x55, 0x65, 0xd4, 0x98, 0xc2, 0x8d, 0xd9, 0xc9, 0xba, 0xf5, 
+    0x74, 0xa9, 0x41, 0x97, 0x44, 0x89, 0x73, 0x91, 0x00, 0x63, 0x82, 0xa6, 0xf1, 0x27, 0xab, 0x1d, 
+    0x9a, 0xc2, 0xd8, 0xc0, 0xa5, 0x98, 0x72, 0x6b };
+  const uint8_t pk_a[56] = { 
+    0x9b, 0x08, 0xf7, 0xcc, 0x31, 0xb7, 0xe3, 0xe6, 0x7d, 0x22, 0xd5, 0xae, 0xa1, 0x21, 0x07, 0x4a, 
+    0x27, 0x3b, 0xd2, 0xb8, 0x3d, 0xe0, 0x9c, 0x63, 0xfa, 0xa7, 0x3d, 0x2c, 0x22, 0xc5, 0xd9, 0xbb, 
+    0xc8, 0x36, 0x64, 0x72, 0x41, 0xd9, 0x53, 0xd4, 0x0c, 0x5b, 0x12, 0xda, 0x88, 0x12, 0x0d, 0x53, 
+    0x17, 0x7f, 0x80, 0xe5, 0x32, 0xc4, 0x1f, 0xa0 };
+  const uint8_t sk_b[56] = { 
+    0x1c, 0x30, 0x6a, 0x7a, 0xc2, 0xa0, 0xe2, 0xe0, 0x99, 0x0b, 0x29, 0x44, 0x70, 0xcb, 0xa3, 0x39, 
+    0xe6, 0x45, 0x37, 0x72, 0xb0, 0x75, 0x81, 0x1d, 0x8f, 0xad, 0x0d, 0x1d, 0x69, 0x27, 0xc1, 0x20, 
+    0xbb, 0x5e, 0xe8, 0x97, 0x2b, 0x0d, 0x3e, 0x21, 0x37, 0x4c, 0x9c, 0x92, 0x1b, 0x09, 0xd1, 0xb0, 
+    0x36, 0x6f, 0x10, 0xb6, 0x51, 0x73, 0x99, 0x2d };
+  const uint8_t pk_b[56] = { 
+    0x3e, 0xb7, 0xa8, 0x29, 0xb0, 0xcd, 0x20, 0xf5, 0xbc, 0xfc, 0x0b, 0x59, 0x9b, 0x6f, 0xec, 0xcf, 
+    0x6d, 0xa4, 0x62, 0x71, 0x07, 0xbd, 0xb0, 0xd4, 0xf3, 0x45, 0xb4, 0x30, 0x27, 0xd8, 0xb9, 0x72, 
+    0xfc, 0x3e, 0x34, 0xfb, 0x42, 0x32, 0xa1, 0x3c, 0xa7, 0x06, 0xdc, 0xb5, 0x7a, 0xec, 0x3d, 0xae, 
+    0x07, 0xbd, 0xc1, 0xc6, 0x7b, 0xf3, 0x36, 0x09 };
+  const uint8_t ss_ab[56] = { 
+    0x07, 0xff, 0xf4, 0x18, 0x1a, 0xc6, 0xcc, 0x95, 0xec, 0x1c, 0x16, 0xa9, 0x4a, 0x0f, 0x74, 0xd1, 
+    0x2d, 0xa2, 0x32, 0xce, 0x40, 0xa7, 0x75, 0x52, 0x28, 0x1d, 0x28, 0x2b, 0xb6, 0x0c, 0x0b, 0x56, 
+    0xfd, 0x24, 0x64, 0xc3, 0x35, 0x54, 0x39, 0x36, 0x52, 0x1c, 0x24, 0x40, 0x30, 0x85, 0xd5, 0x9a, 
+    0x44, 0x9a, 0x50, 0x37, 0x51, 0x4a, 0x87, 0x9d };
+  uint8_t sk[4][56], pk[4][56], ss[4][56], r[4][56];
+  int i, j, l, wrong = 0;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (X448):");
+  puts("-------------------------------------------------------------------");
+
+  // lanes: the two vectors of section 5.2, Alice with Bob and Bob with Alice
+  memcpy(sk[0], x448_k1, 56); memcpy(pk[0], x448_u1, 56);
+  memcpy(sk[1], x448_k2, 56); memcpy(pk[1], x448_u2, 56);
+  memcpy(sk[2], sk_a, 56);    memcpy(pk[2], pk_b, 56);
+  memcpy(sk[3], sk_b, 56);    memcpy(pk[3], pk_a, 56);
+  x448_sharedsecret_avx2(ss, (const uint8_t (*)[56])sk, (const uint8_t (*)[56])pk);
+  wrong |= memcmp(ss[0], x448_r1, 56) | memcmp(ss[1], x448_r2, 56);
+  wrong |= memcmp(ss[2], ss_ab, 56) | memcmp(ss[3], ss_ab, 56);
+  x448_keygen_avx2(r, (const uint8_t (*)[56])sk);
+  wrong |= memcmp(r[2], pk_a, 56) | memcmp(r[3], pk_b, 56);
+  if (wrong) 
+    printf("TEST (RFC 7748 vectors): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (RFC 7748 vectors): \x1b[32mPASS!\x1b[0m\n");
+
+  // random private keys: the comb against the ladder on u = 5
+  wrong = 0;
+  memset(pk, 0, sizeof(pk));
+  for (l = 0; l < 4; l++) pk[l][0] = 5;
+  for (j = 0; j < 20; j++) {
+    for (l = 0; l < 4; l++)
+      for (i = 0; i < 56; i++) sk[l][i] = (uint8_t)random();
+    x448_keygen_avx2(r, (const uint8_t (*)[56])sk);
+    x448_sharedsecret_avx2(ss, (const uint8_t (*)[56])sk, (const uint8_t (*)[56])pk);
+    wrong |= memcmp(r, ss, sizeof(r));
+  }
+  if (wrong) 
+    printf("TEST (fixed-base key generation): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (fixed-base key generation): \x1b[32mPASS!\x1b[0m\n");
+
+  // non-canonical u-coordinates: p and p+1 give the results of 0 and 1
+  for (l = 1; l < 4; l++) memcpy(sk[l], sk[0], 56);
+  memset(pk, 0, sizeof(pk));
+  memset(pk[0], 0xFF, 56); pk[0][28] = 0xFE;
+  memset(pk[1]+28, 0xFF, 28);
+  pk[3][0] = 1;
+  x448_sharedsecret_avx2(ss, (const uint8_t (*)[56])sk, (const uint8_t (*)[56])pk);
+  wrong = memcmp(ss[0], ss[2], 56) | memcmp(ss[1], ss[3], 56);
+  if (wrong) 
+    printf("TEST (non-canonical u-coordinates): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (non-canonical u-coordinates): \x1b[32mPASS!\x1b[0m\n");
+
+  // batches of 1 to 7 keys against the 4-way kernels
+  {
+    uint8_t bsk[8][56], bpk[8][56], bss[8][56], ref[8][56];
+    int n;
+    wrong = 0;
+    for (i = 0; i < 8*56; i++) {
+      bsk[i/56][i%56] = (uint8_t)random();
+      bpk[i/56][i%56] = (uint8_t)random();
+    }
+    x448_keygen_avx2(ref, (const uint8_t (*)[56])bsk);
+    x448_keygen_avx2(ref + 4, (const uint8_t (*)[56])(bsk + 4));
+    for (n = 1; n < 8; n++) {
+      memset(bss, 0, sizeof(bss));
+      x448_keygen_batch(bss, (const uint8_t (*)[56])bsk, (size_t)n);
+      wrong |= memcmp(bss, ref, n*56) | (bss[n][0] != 0);
+    }
+    x448_sharedsecret_avx2(ref, (const uint8_t (*)[56])bsk, (const uint8_t (*)[56])bpk);
+    x448_sharedsecret_avx2(ref + 4, (const uint8_t (*)[56])(bsk + 4), 
+      (const uint8_t (*)[56])(bpk + 4));
+    for (n = 1; n < 8; n++) {
+      memset(bss, 0, sizeof(bss));
+      x448_sharedsecret_batch(bss, (const uint8_t (*)[56])bsk, (const uint8_t (*)[56])bpk, 
+        (size_t)n);
+      wrong |= memcmp(bss, ref, n*56) | (bss[n][0] != 0);
+    }
+  }
+  if (wrong) 
+    printf("TEST (batches): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (batches): \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Low-order component of a point on Curve25519.
+ *
+ * @details
+ * Compute l*P with a Montgomery ladder (without pruning) for the order l of 
+ * the prime-order subgroup, so that only the component of P in the 8-torsion
+ * subgroup is left; its u-coordinate is the class of the component.
+ *
+ * @param u u-coordinate of P
+ * @return 0 for the neutral element, 1 for order 2, 2 for order 4, 3 and 4 for
+ * the two u-coordinates of the points of order 8, -1 otherwise
+ */
+static int torsion_class(const uint8_t *u)
+{
+  static const uint8_t l[32] = { 0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58,
+    0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14, [31] = 0x10 };
+  static const uint8_t u8[2][32] = {
+    { 0x5F, 0x9C, 0x95, 0xBC, 0xA3, 0x50, 0x8C, 0x24, 0xB1, 0xD0, 0xB1, 0x55,
+      0x9C, 0x83, 0xEF, 0x5B, 0x04, 0x44, 0x5C, 0xC4, 0x58, 0x1C, 0x8E, 0x86,
+      0xD8, 0x22, 0x4E, 0xDD, 0xD0, 0x9F, 0x11, 0x57 },
+    { 0xE0, 0xEB, 0x7A, 0x7C, 0x3B, 0x41, 0xB8, 0xAE, 0x16, 0x56, 0xE3, 0xFA,
+      0xF1, 0x9F, 0xC4, 0x6A, 0xDA, 0x09, 0x8D, 0xEB, 0x9C, 0x32, 0xB1, 0xFD,
+      0x86, 0x62, 0x05, 0x16, 0x5F, 0x49, 0xB8, 0x00 } };
+  uint8_t r[32], one[32] = { 1 }, zero[32] = { 0 };
+  ProPoint51 p1, p2;
+  uint64_t b, s = 0, x[NWORDS51], t[NWORDS51];
+  int i;
+
+  mpi51_from_bytes_c64(x, u);
+  for (i = 0; i < NWORDS51; i++) {
+    p1.x[i] = p1.z[i] = p2.z[i] = 0;
+    p2.x[i] = x[i];
+  }
+  p1.x[0] = p2.z[0] = 1;
+  for (i = 254; i >= 0; i--) {
+    b = (l[i>>3] >> (i&7)) & 1;
+    s ^= b;
+    mpi51_cswap_c64(p1.x, p2.x, s);
+    mpi51_cswap_c64(p1.z, p2.z, s);
+    mon_ladder_step_c64(&p1, &p2, x);
+    s = b;
+  }
+  mpi51_cswap_c64(p1.x, p2.x, s);
+  mpi51_cswap_c64(p1.z, p2.z, s);
+
+  mpi51_to_bytes_c64(r, p1.z);
+  if (memcmp(r, zero, 32) == 0) return 0;
+  mpi51_gfp_inv_c64(t, p1.z);
+  mpi51_gfp_mul_c64(t, t, p1.x);
+  mpi51_to_bytes_c64(r, t);
+  if (memcmp(r, zero, 32) == 0) return 1;
+  if (memcmp(r, one, 32) == 0) return 2;
+  if (memcmp(r, u8[0], 32) == 0) return 3;
+  if (memcmp(r, u8[1], 32) == 0) return 4;
+  return -1;
+}
+
+/**
+ * @brief Test the correctness of the Elligator 2 maps.
+ *
+ * @details
+ * Check the square test and the square root of a ratio on squares and 
+ * non-squares, that the inverse map of a mapped representative gives back 
+ * +-r on one branch and representatives of the same point on both, that the
+ * key pairs of the batch key generation are X25519 key pairs whose 
+ * representatives map to the public keys, that the low-order components of
+ * these keys are spread evenly, and that -A is rejected.
+ */
+void test_elligator()
+{
+  // p = 2^255 - 19 and -A = p - 486662, little-endian
+  uint8_t p[32], ma[32];
+  static uint8_t sk[37][32], pk[37][32], rep[37][32], u[37][32], ok[37];
+  uint8_t r[4][32], s[4][32], t[4][32], rn[32], tw[37];
+  __m256i a[NWORDS], b[NWORDS], c[NWORDS], d[NWORDS], m;
+  uint64_t w[4];
+  int i, j, l, k, borrow, wrong = 0;
+  // class of 5c*T (see torsion_class) for the tweak bits c
+  static const int tclass[8] = { 0, 4, 2, 3, 1, 3, 2, 4 };
+  int hist[5];
+  size_t cnt;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (Elligator 2):");
+  puts("-------------------------------------------------------------------");
+
+  memset(p, 0xFF, 32); p[0] = 0xED; p[31] = 0x7F;
+  memcpy(ma, p, 32);
+  ma[0] = 0xED - 0x06; ma[1] = 0xFF - 0x6D; ma[2] = 0xFF - 0x07;
+
+  // x^2 is a square, 2*x^2 is not; v*r^2 = u for u = x^2*v
+  for (j = 0; j < 20; j++) {
+    for (l = 0; l < 4; l++)
+      for (i = 0; i < 32; i++) { r[l][i] = (uint8_t)random(); s[l][i] = (uint8_t)random(); }
+    mpi29_conv_bytes2mpi29_avx2(a, (const uint8_t (*)[32])r);
+    mpi29_conv_bytes2mpi29_avx2(b, (const uint8_t (*)[32])s);
+    mpi29_gfp_sqr_avx2(c, a);
+    m = mpi29_gfp_issquare_avx2(c);
+    mpi29_gfp_add_avx2(d, c, c);
+    m = _mm256_andnot_si256(mpi29_gfp_issquare_avx2(d), m);
+    mpi29_gfp_mul_avx2(c, c, b);
+    m = VAND(m, mpi29_gfp_sqrt_ratio_avx2(d, c, b));
+    mpi29_gfp_sqr_avx2(d, d);
+    mpi29_gfp_mul_avx2(d, d, b);
+    mpi29_conv_mpi292bytes_avx2(t, d);
+    mpi29_conv_mpi292bytes_avx2(r, c);
+    mpi29_gfp_add_avx2(c, c, c);
+    m = _mm256_andnot_si256(mpi29_gfp_sqrt_ratio_avx2(d, c, b), m);
+    VSTOREU(w, m);
+    wrong |= memcmp(r, t, sizeof(r));
+    for (l = 0; l < 4; l++) wrong |= (w[l] != UINT64_MAX);
+  }
+  if (wrong) 
+    printf("TEST (square test and square root): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (square test and square root): \x1b[32mPASS!\x1b[0m\n");
+
+  // u = map(r): both branches give a representative of u, one of them +-r
+  wrong = 0;
+  for (j = 0; j < 50; j++) {
+    for (l = 0; l < 4; l++) {
+      for (i = 0; i < 32; i++) r[l][i] = (uint8_t)random();
+      tw[l] = (uint8_t)random();
+    }
+    elligator_map_avx2(u, (const uint8_t (*)[32])r);
+    for (k = 0; k < 2; k++) {
+      for (l = 0; l < 4; l++) tw[l] = (uint8_t)((tw[l] & 0xFE) | k);
+      wrong |= (elligator_rev_avx2(k ? t : s, (const uint8_t (*)[32])u, tw) != 15);
+      for (l = 0; l < 4; l++) wrong |= (((k ? t : s)[l][31] & 0xC0) != (tw[l] & 0xC0));
+      elligator_map_avx2(u + 4, (const uint8_t (*)[32])(k ? t : s));
+      wrong |= memcmp(u, u + 4, 4*32);
+    }
+    for (l = 0; l < 4; l++) {
+      // rn = min(r, p-r) for r in [0, 2^254)
+      r[l][31] &= 0x3F;
+      for (i = 0, borrow = 0; i < 32; i++) {
+        k = p[i] - r[l][i] - borrow;
+        rn[i] = (uint8_t)k;
+        borrow = (k < 0);
+      }
+      for (i = 31; i > 0 && rn[i] == r[l][i]; i--);
+      if (r[l][i] < rn[i]) memcpy(rn, r[l], 32);
+      s[l][31] &= 0x3F; t[l][31] &= 0x3F;
+      wrong |= memcmp(s[l], rn, 32) && memcmp(t[l], rn, 32);
+    }
+  }
+  if (wrong) 
+    printf("TEST (inverse of the map): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (inverse of the map): \x1b[32mPASS!\x1b[0m\n");
+
+  // key pairs with representatives (37 is not a multiple of 4)
+  for (l = 0; l < 37; l++) {
+    for (i = 0; i < 32; i++) sk[l][i] = (uint8_t)random();
+    tw[l] = (uint8_t)random();
+  }
+  elligator_keygen_batch(pk, rep, sk, tw, 37);
+  elligator_map_batch(u, (const uint8_t (*)[32])rep, 37);
+  wrong = memcmp(u, pk, sizeof(pk));
+  // the public keys are dirty, but give the shared secrets of the clean keys
+  for (l = 0; l < 37; l++) {
+    k = (l + 1) % 37;
+    x25519_keygen_c64(&r[0], (const uint8_t (*)[32])&sk[k]);
+    x25519_sharedsecret_c64(&r[1], (const uint8_t (*)[32])&sk[l], 
+      (const uint8_t (*)[32])&r[0]);
+    x25519_sharedsecret_c64(&r[2], (const uint8_t (*)[32])&sk[k], 
+      (const uint8_t (*)[32])&pk[l]);
+    wrong |= memcmp(r[1], r[2], 32) | ((rep[l][31] & 0xC0) != (tw[l] & 0xC0));
+  }
+  cnt = elligator_rev_batch(u, ok, (const uint8_t (*)[32])pk, tw, 37);
+  wrong |= (cnt != 37) | memcmp(u, rep, sizeof(rep));
+  if (wrong) 
+    printf("TEST (key generation with representatives): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (key generation with representatives): \x1b[32mPASS!\x1b[0m\n");
+
+  // the low-order components of the decoded representatives are the points 
+  // selected by the tweaks (l*cT = 5c*T), and spread evenly over the 8 points
+  wrong = 0;
+  memset(hist, 0, sizeof(hist));
+  for (j = 0; j < 8; j++) {
+    for (l = 0; l < 32; l++) {
+      for (i = 0; i < 32; i++) sk[l][i] = (uint8_t)random();
+      tw[l] = (uint8_t)random();
+    }
+    elligator_keygen_batch(pk, rep, sk, tw, 32);
+    elligator_map_batch(u, (const uint8_t (*)[32])rep, 32);
+    for (l = 0; l < 32; l++) {
+      k = torsion_class(u[l]);
+      wrong |= (k < 0) || (k != tclass[(tw[l] >> 1) & 7]);
+      if (k >= 0) hist[k]++;
+    }
+  }
+  // 256 keys: 32 for the classes of order 1 and 2, 64 for the others
+  for (k = 0; k < 5; k++) 
+    wrong |= (hist[k] < ((k < 2) ? 16 : 32)) || (hist[k] > ((k < 2) ? 48 : 96));
+  if (wrong) 
+    printf("TEST (low-order components of the representatives): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (low-order components of the representatives): \x1b[32mPASS!\x1b[0m\n");
+
+  // about half of the public keys are representable, -A is never, 0 is (r = 0)
+  for (l = 0; l < 37; l++)
+    for (i = 0; i < 32; i++) sk[l][i] = (uint8_t)random();
+  for (l = 0; l < 36; l += 4) x25519_keygen_avx2(pk + l, (const uint8_t (*)[32])sk + l);
+  memcpy(pk[36], ma, 32);
+  cnt = elligator_rev_batch(u, ok, (const uint8_t (*)[32])pk, tw, 37);
+  wrong = (cnt == 0) | (cnt >= 36) | ok[36];
+  memset(s, 0, sizeof(s));
+  memcpy(s[0], ma, 32); memcpy(s[1], ma, 32);
+  for (l = 0; l < 4; l++) tw[l] = (uint8_t)(l & 1);
+  wrong |= (elligator_rev_avx2(t, (const uint8_t (*)[32])s, tw) != 4);
+  elligator_map_avx2(r, (const uint8_t (*)[32])t);
+  wrong |= memcmp(r[2], s[2], 32) | memcmp(t[2], s[2], 32);
+  if (wrong) 
+    printf("TEST (non-representable points): \x1b[31mNOT PASS!\x1b[0m\n");
+  else 
+    printf("TEST (non-representable points): \x1b[32mPASS!\x1b[0m\n");
+
+  puts("*******************************************************************");
+}
+
+// callback of the engine test, counts the finished jobs
+static void engine_count_done(EngineJob *job, void *arg)
+{
+  __atomic_add_fetch((int *)arg, 1, __ATOMIC_RELAXED);
+  (void)job;
+}
+
+/**
+ * @brief Test and measure the multi-threaded engine.
+ *
+ * @details
+ * Compute a stream of shared-secret jobs (half of them with callback, half 
+ * of them through the completion queue) with 1, 2, 4, ... worker threads, 
+ * compare the results with the batch API and print the throughput of each 
+ * worker thread.
+ */
+void test_engine()
+{
+  enum { NJOBS = 4096 };
+  static uint8_t sk[NJOBS][32], pk[NJOBS][32], ss[NJOBS][32], ref[NJOBS][32];
+  static EngineJob jobs[NJOBS];
+  EngineStats st;
+  Engine *e;
+  struct timespec start_time, end_time;
+  double sec;
+  long ncpu = sysconf(_SC_NPROCESSORS_ONLN);
+  int i, j, t, ncb, nq, wrong = 0;
+
+  for (i = 0; i < NJOBS; i++)
+    for (j = 0; j < 32; j++) {
+      sk[i][j] = (uint8_t)random();
+      pk[i][j] = (uint8_t)random();
+    }
+  x25519_sharedsecret_batch(ref, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, NJOBS);
+
+  puts("\n*******************************************************************");
+  puts("MULTI-THREADED ENGINE (shared secret):");
+  puts("-------------------------------------------------------------------");
+  for (t = 1; t <= 2*ncpu; t *= 2) {
+    e = engine_create(t, 1);
+    if (e == NULL) break;
+    memset(ss, 0, sizeof(ss));
+    ncb = nq = 0;
+    clock_gettime(CLOCK_MONOTONIC, &start_time);
+    for (i = 0; i < NJOBS; i++) {
+      jobs[i].op = ENGINE_SHAREDSECRET;
+      jobs[i].sk = sk[i];
+      jobs[i].pk = pk[i];
+      jobs[i].out = ss[i];
+      jobs[i].done = (i & 1) ? engine_count_done : NULL;
+      jobs[i].arg = &ncb;
+      engine_submit(e, &jobs[i]);
+    }
+    while (engine_wait(e) != NULL) nq++;
+    clock_gettime(CLOCK_MONOTONIC, &end_time);
+    sec = (double)(end_time.tv_sec-start_time.tv_sec) + 1e-9*(end_time.tv_nsec-start_time.tv_nsec);
+    wrong |= (nq + ncb != NJOBS) || memcmp(ss, ref, sizeof(ss));
+
+    printf("* %d thread(s): %8.1f op/sec\n", t, NJOBS / sec);
+    for (i = 0; i < t; i++) {
+      engine_stats(e, i, &st);
+      printf("  - worker %d: %5llu jobs, %4llu batches, %4llu stolen, %8.1f op/sec\n", 
+        i, (unsigned long long)st.jobs, (unsigned long long)st.batches, 
+        (unsigned long long)st.stolen, st.throughput);
+    }
+    engine_destroy(e);
+  }
+
+  if (wrong)
+    printf("TEST (engine): \x1b[31mNOT PASS!\x1b[0m\n");
+  else
+    printf("TEST (engine): \x1b[32mPASS!\x1b[0m\n");
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Test and measure the coalescing of the engine.
+ *
+ * @details
+ * Submit shared-secret jobs with a gap of about 10 microseconds (a lightly 
+ * loaded server) to an engine with one worker and print the lane-fill ratio 
+ * and the queueing latency for several deadlines.
+ */
+void test_coalescing()
+{
+  enum { NJOBS = 256 };
+  static uint8_t sk[NJOBS][32], pk[NJOBS][32], ss[NJOBS][32], ref[NJOBS][32];
+  static EngineJob jobs[NJOBS];
+  const uint64_t deadline[3] = { 0, 20000, 100000 };
+  const struct timespec gap = { 0, 10000 };
+  EngineStats st;
+  Engine *e;
+  int i, j, wrong = 0;
+
+  for (i = 0; i < NJOBS; i++)
+    for (j = 0; j < 32; j++) {
+      sk[i][j] = (uint8_t)random();
+      pk[i][j] = (uint8_t)random();
+    }
+  x25519_sharedsecret_batch(ref, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, NJOBS);
+
+  puts("\n*******************************************************************");
+  puts("COALESCING (shared secret, one job every ~10 us):");
+  puts("-------------------------------------------------------------------");
+  for (j = 0; j < 3; j++) {
+    e = engine_create(1, 1);
+    if (e == NULL) break;
+    engine_set_deadline(e, deadline[j]);
+    memset(ss, 0, sizeof(ss));
+    for (i = 0; i < NJOBS; i++) {
+      jobs[i].op = ENGINE_SHAREDSECRET;
+      jobs[i].sk = sk[i];
+      jobs[i].pk = pk[i];
+      jobs[i].out = ss[i];
+      jobs[i].done = NULL;
+      engine_submit(e, &jobs[i]);
+      nanosleep(&gap, NULL);
+    }
+    while (engine_wait(e) != NULL);
+    wrong |= memcmp(ss, ref, sizeof(ss));
+    engine_stats(e, -1, &st);
+    printf("* deadline %3d us: fill %.2f, %3llu batches, wait avg %6.1f / p99 %6.1f / max %6.1f us\n", 
+      (int)(deadline[j]/1000), st.fill, (unsigned long long)st.batches, st.wait_avg, 
+      st.wait_p99, st.wait_max);
+    engine_destroy(e);
+  }
+
+  if (wrong)
+    printf("TEST (coalescing): \x1b[31mNOT PASS!\x1b[0m\n");
+  else
+    printf("TEST (coalescing): \x1b[32mPASS!\x1b[0m\n");
+  puts("*******************************************************************");
+}
+
+/**
+ * @brief Test the correctness of the cache of per-peer tables.
+ *
+ * @details
+ * Compute rounds of shared secrets with 24 peers through a cache of 8 tables 
+ * and compare them with x25519_sharedsecret_batch. Half of the public keys 
+ * are random (about half of them on the twist), and u = 0 and u = p-1 are 
+ * among them.
+ */
+void test_peercache()
+{
+  enum { NPEERS = 24, NSS = 200 };
+  static uint8_t sk[NSS][32], pk[NSS][32], ss[NSS][32], ref[NSS][32];
+  uint8_t peer[NPEERS][32], psk[NPEERS][32];
+  PeerCacheStats st;
+  PeerCache *c;
+  int i, j, r, wrong = 0;
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (cache of per-peer tables):");
+  puts("-------------------------------------------------------------------");
+
+  for (i = 0; i < NPEERS; i++)
+    for (j = 0; j < 32; j++) {
+      psk[i][j] = (uint8_t)random();
+      peer[i][j] = (uint8_t)random();
+    }
+  x25519_keygen_batch(peer, (const uint8_t (*)[32])psk, NPEERS/2);
+  memset(peer[NPEERS-2], 0, 32);
+  memset(peer[NPEERS-1], 0xFF, 32);
+  peer[NPEERS-1][0] = 0xEC;
+  peer[NPEERS-1][31] = 0x7F;
+
+  c = peercache_create(8);
+  for (r = 0; (c != NULL) && (r < 3); r++) {
+    for (i = 0; i < NSS; i++) {
+      for (j = 0; j < 32; j++) sk[i][j] = (uint8_t)random();
+      memcpy(pk[i], peer[random() % ((r == 0) ? 4 : NPEERS)], 32);
+    }
+    x25519_sharedsecret_batch(ref, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, NSS);
+    memset(ss, 0, sizeof(ss));
+    peercache_sharedsecret(c, ss, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, 
+      (r == 2) ? 37 : NSS);
+    wrong |= memcmp(ss, ref, ((r == 2) ? 37 : NSS)*32);
+  }
+  if (c == NULL) wrong = 1;
+  else {
+    peercache_stats(c, &st);
+    printf("* %llu hits, %llu tables, %llu evictions, %llu ladders, %d entries (%d KB each)\n", 
+      (unsigned long long)st.hits, (unsigned long long)st.misses, 
+      (unsigned long long)st.evictions, (unsigned long long)st.ladders, (int)st.entries, 
+      (int)(peercache_table_size() >> 10));
+    if (x25519_impl_by_id(X25519_AVX2) && ((st.hits == 0) || (st.evictions == 0))) wrong = 1;
+    peercache_destroy(c);
+  }
+
+  if (wrong)
+    printf("TEST (peer cache): \x1b[31mNOT PASS!\x1b[0m\n");
+  else
+    printf("TEST (peer cache): \x1b[32mPASS!\x1b[0m\n");
+  puts("*******************************************************************");
+}
+
+#if PROF
+/**
+ * @brief Test the per-phase cycle counters (make PROF=1).
+ *
+ * @details
+ * Count the measurements of a 4-way key generation and shared secret, and
+ * print the cycles per measurement of each phase (without the overhead).
+ */
+void test_prof()
+{
+  __m256i k[NWORDS], r[NWORDS];
+  ProfStats st;
+  int i, wrong = 0;
+  const uint64_t calls[PROF_NPHASES] = { 2, 1, 1, FIXBASE_D, 
+    FIXBASE_D + FIXBASE_S - 1, 2, 2 };
+
+  puts("\n*******************************************************************");
+  puts("CORRECTNESS TEST (phase counters):");
+  puts("-------------------------------------------------------------------");
+
+  for (i = 0; i < NWORDS; i++) {
+    k[i] = VSET64((uint32_t)random(), (uint32_t)random(), (uint32_t)random(), (uint32_t)random());
+    r[i] = k[i];
+  }
+  keygen(r, r);
+  prof_reset();
+  keygen(r, k);
+  sharedsecret(r, k, r);
+  prof_stats(&st, 0);
+  for (i = 0; i < PROF_NPHASES; i++) {
+    printf("* %-6s %3llu x %8.0f cycles\n", prof_phase_name(i), 
+      (unsigned long long)st.calls[i], (st.calls[i] == 0) ? 0.0 :
+      (double)st.cycles[i]/st.calls[i] - (double)st.overhead);
+    if (st.calls[i] != calls[i]) wrong = 1;
+  }
+  prof_stats(&st, 1);
+  if (st.calls[PROF_LADDER] < 1) wrong = 1;
+
+  if (wrong)
+    printf("TEST (phase counters): \x1b[31mNOT PASS!\x1b[0m\n");
+  else
+    printf("TEST (phase counters): \x1b[32mPASS!\x1b[0m\n");
+  puts("*******************************************************************");
+}
+#endif
+
+/**
+ * @brief Measure latency of the shared secrets with per-peer tables.
+ *
+ * @details
+ * Measure latency of the precomputation of four tables, of a 4-way shared 
+ * secret with the tables, and the cost per shared secret of a batch of 64 
+ * shared secrets with 16 public keys through the cache.
+ */
+void timing_peercache()
+{
+  static uint8_t sk[64][32], pk[64][32], ss[64][32];
+  PeerTable *t[4];
+  PeerCache *c;
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, j, iterations = 200;
+
+  for (i = 0; i < 64; i++) for (j = 0; j < 32; j++) sk[i][j] = (uint8_t)random();
+  x25519_keygen_batch(pk, (const uint8_t (*)[32])sk, 16);
+  for (i = 16; i < 64; i++) memcpy(pk[i], pk[i%16], 32);
+  for (i = 0; i < 4; i++) t[i] = (PeerTable *)aligned_alloc(32, sizeof(PeerTable));
+  c = peercache_create(16);
+  if ((t[0] == NULL) || (t[1] == NULL) || (t[2] == NULL) || (t[3] == NULL) || (c == NULL)) {
+    for (i = 0; i < 4; i++) free(t[i]);
+    peercache_destroy(c);
+    return;
+  }
+
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) x25519_peer_table_avx2((struct peer_table *const *)t, 
+    (const uint8_t (*)[32])pk);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("\n* 4-Way Per-Peer Table (s = %d, %d KB): %lld\n", TED_PEER_S, 
+    (int)(sizeof(PeerTable) >> 10), diff_cycles);
+
+  for (i = 0; i < iterations; i++) x25519_sharedsecret_peer_n_avx2(ss, 
+    (const uint8_t (*)[32])sk, (const struct peer_table *const *)t, 1);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) x25519_sharedsecret_peer_n_avx2(ss, 
+    (const uint8_t (*)[32])sk, (const struct peer_table *const *)t, 1);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way Shared Secret (per-peer tables): %lld\n", diff_cycles);
+
+  peercache_sharedsecret(c, ss, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, 64);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) 
+    peercache_sharedsecret(c, ss, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, 64);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(64*iterations);
+  printf("* Cached Shared Secret (64 with 16 peers), per shared secret: %lld\n", diff_cycles);
+
+  for (i = 0; i < 4; i++) free(t[i]);
+  peercache_destroy(c);
+}
+
 /**
  * @brief Measure latency of field operations.
  *
  * @details
- * Measure latency of field addition, subtraction, multiplication and squaring.
+ * Measure latency of field addition, subtraction, multiplication and squaring,
+ * and of the variants of the multiplication and squaring.
  */
 void timing_fp_arith()
 {
-  __m256i a[NWORDS], b[NWORDS], r[NWORDS];
+  __m256i a[NWORDS], b[NWORDS], r[NWORDS], a25[NWORDS25], r25[NWORDS25];
   int i, seed;
 
   // initialize random generator
@@ -267,49 +1806,222 @@ void timing_fp_arith()
   }
   end_cycles = read_tsc();
   diff_cycles = (end_cycles-start_cycles)/(10*iterations);
-  printf("* 4-Way SBC: %lld\n", diff_cycles);
+  printf("* 4-Way SBC: %lld\n", diff_cycles);
+
+  // load cache
+  for (i = 0; i < iterations; i++) mpi29_gfp_mul_avx2(r, r, a);
+  // measure timing
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+    mpi29_gfp_mul_avx2(r, r, a);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way MUL: %lld\n", diff_cycles);
+
+  // load cache
+  for (i = 0; i < iterations; i++) mpi29_gfp_sqr_avx2(r, r);
+  // measure timing 
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+    mpi29_gfp_sqr_avx2(r, r);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way SQR: %lld\n", diff_cycles);
+
+  // the variants of the multiplication and squaring (GFP_MUL and GFP_SQR)
+  puts("");
+  for (i = 0; i < iterations; i++) mpi29_gfp_mul_ps_avx2(r, r, a);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi29_gfp_mul_ps_avx2(r, r, a);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way MUL (product scanning): %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations; i++) mpi29_gfp_mul_kara_avx2(r, r, a);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi29_gfp_mul_kara_avx2(r, r, a);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way MUL (Karatsuba): %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations; i++) mpi29_gfp_sqr_ps_avx2(r, r);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi29_gfp_sqr_ps_avx2(r, r);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way SQR (product scanning): %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations; i++) mpi29_gfp_sqr_dbl_avx2(r, r);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi29_gfp_sqr_dbl_avx2(r, r);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way SQR (doubled limbs): %lld\n", diff_cycles);
+
+  for (i = 0; i < NWORDS25; i++) {
+    a25[i] = VAND(VSET164(random()), VSET164(MASK25));
+    r25[i] = VAND(VSET164(random()), VSET164(MASK25));
+  }
+  for (i = 0; i < iterations; i++) mpi25_gfp_mul_avx2(r25, r25, a25);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi25_gfp_mul_avx2(r25, r25, a25);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way MUL (radix 2^25.5): %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations; i++) mpi25_gfp_sqr_avx2(r25, r25);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi25_gfp_sqr_avx2(r25, r25);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way SQR (radix 2^25.5): %lld\n", diff_cycles);
+
+  // the inversions (GFP_INV)
+  puts("");
+  for (i = 0; i < iterations/100; i++) mpi29_gfp_inv_fermat_avx2(r, r);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/10; i++) mpi29_gfp_inv_fermat_avx2(r, r);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/10);
+  printf("* 4-Way INV (Fermat): %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations/100; i++) mpi29_gfp_inv_safegcd_avx2(r, r);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/10; i++) mpi29_gfp_inv_safegcd_avx2(r, r);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/10);
+  printf("* 4-Way INV (safegcd): %lld\n", diff_cycles);
+}
+
+/**
+ * @brief Measure latency of AVX-512IFMA field operations.
+ *
+ * @details
+ * Measure latency of (8*1)-way field addition, subtraction, multiplication 
+ * and squaring.
+ */
+TARGET_AVX512 void timing_fp_arith_avx512()
+{
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, iterations = 1000000;
+  __m512i za[NWORDS52], zb[NWORDS52], zr[NWORDS52];
+  const __m512i zmask = _mm512_set1_epi64(MASK52);
+
+  // randomize the input (52-bit limbs)
+  for (i = 0; i < NWORDS52; i++) {
+    za[i] = _mm512_and_si512(zmask, _mm512_set_epi64(random(), random(), random(), random(), 
+      random(), random(), random(), random()));
+    zb[i] = _mm512_and_si512(zmask, _mm512_set_epi64(random(), random(), random(), random(), 
+      random(), random(), random(), random()));
+    zr[i] = _mm512_and_si512(zmask, _mm512_set_epi64(random(), random(), random(), random(), 
+      random(), random(), random(), random()));
+  }
+
+  // load cache
+  for (i = 0; i < iterations; i++) mpi52_gfp_add_avx512(zr, zr, zb);
+  // measure timing
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+    mpi52_gfp_add_avx512(zr, zr, zb);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 8-Way ADD: %lld\n", diff_cycles);
+
+  // load cache
+  for (i = 0; i < iterations; i++) mpi52_gfp_sub_avx512(zr, zr, za);
+  // measure timing
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+    mpi52_gfp_sub_avx512(zr, zr, za);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 8-Way SUB: %lld\n", diff_cycles);
 
   // load cache
-  for (i = 0; i < iterations; i++) mpi29_gfp_mul_avx2(r, r, a);
+  for (i = 0; i < iterations; i++) mpi52_gfp_mul_avx512(zr, zr, za);
   // measure timing
   start_cycles = read_tsc();
   for (i = 0; i < iterations; i++) {
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
-    mpi29_gfp_mul_avx2(r, r, a);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
+    mpi52_gfp_mul_avx512(zr, zr, za);
   }
   end_cycles = read_tsc();
   diff_cycles = (end_cycles-start_cycles)/(10*iterations);
-  printf("* 4-Way MUL: %lld\n", diff_cycles);
+  printf("* 8-Way MUL: %lld\n", diff_cycles);
 
   // load cache
-  for (i = 0; i < iterations; i++) mpi29_gfp_sqr_avx2(r, r);
-  // measure timing 
+  for (i = 0; i < iterations; i++) mpi52_gfp_sqr_avx512(zr, zr);
+  // measure timing
   start_cycles = read_tsc();
   for (i = 0; i < iterations; i++) {
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
-    mpi29_gfp_sqr_avx2(r, r);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
+    mpi52_gfp_sqr_avx512(zr, zr);
   }
   end_cycles = read_tsc();
   diff_cycles = (end_cycles-start_cycles)/(10*iterations);
-  printf("* 4-Way SQR: %lld\n", diff_cycles);
+  printf("* 8-Way SQR: %lld\n", diff_cycles);
 }
 
+
+TARGET_AVX512 void timing_point_arith_avx512();
+TARGET_AVX512 void timing_fixbase_avx512(const __m256i *k);
+
 /**
  * @brief Measure latency of point operations.
  *
@@ -375,6 +2087,31 @@ void timing_point_arith()
   diff_cycles = (end_cycles-start_cycles)/(10*iterations);
   printf("* 4-Way Ladder-Step: %lld\n", diff_cycles);
 
+  // load cache
+  for (i = 0; i < iterations; i++) mon_ladder_step_fused_avx2(&p, &q, t);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mon_ladder_step_fused_avx2(&p, &q, t);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 4-Way Ladder-Step (fused): %lld\n", diff_cycles);
+  if (x25519_impl_by_id(X25519_AVX512)) timing_point_arith_avx512();
+
+  // load cache
+  for (i = 0; i < iterations; i++) mon_ladder_step_1x4_avx2(p.x, t);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mon_ladder_step_1x4_avx2(p.x, t);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 1x4-Way Ladder-Step: %lld\n", diff_cycles);
+
+  // load cache
+  for (i = 0; i < iterations; i++) mon_ladder_step_2x2_avx2(p.x, t);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mon_ladder_step_2x2_avx2(p.x, t);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 2x2-Way Ladder-Step: %lld\n", diff_cycles);
+
   puts("\ntwisted Edwards curve:");
 
   // load cache
@@ -396,6 +2133,22 @@ void timing_point_arith()
   diff_cycles = (end_cycles-start_cycles)/(10*iterations);
   printf("* 4-Way Point Addition: %lld\n", diff_cycles);
 
+  // load cache
+  for (i = 0; i < iterations; i++) ted_point_add_1x4_avx2(r.x, a.x, p.x);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_point_add_1x4_avx2(r.x, r.x, p.x);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 1x4-Way Point Addition: %lld\n", diff_cycles);
+
+  // load cache
+  for (i = 0; i < iterations; i++) ted_point_add_2x2_avx2(r.x, a.x, p.x);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_point_add_2x2_avx2(r.x, r.x, p.x);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 2x2-Way Point Addition: %lld\n", diff_cycles);
+
   // load cache
   for (i = 0; i < iterations; i++) ted_point_dbl_avx2(&r, &a);
   start_cycles = read_tsc();
@@ -416,27 +2169,157 @@ void timing_point_arith()
   printf("* 4-Way Point Doubling: %lld\n", diff_cycles);
 
   // load cache
-  for (i = 0; i < iterations; i++) ted_point_query_table_avx2(&p, i&0x1F, VSET164(1));
+  for (i = 0; i < iterations; i++) ted_point_query_table_avx2(&p, i%FIXBASE_P, VSET164(1));
   start_cycles = read_tsc();
   for (i = 0; i < iterations; i++)
   {
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+1]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+2]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+3]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+4]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+5]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+6]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+7]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9+8]);
-    ted_point_query_table_avx2(&p, i&0x1F, t[i%9]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+1]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+2]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+3]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+4]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+5]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+6]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+7]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9+8]);
+    ted_point_query_table_avx2(&p, i%FIXBASE_P, t[i%9]);
   } 
   end_cycles = read_tsc();
   diff_cycles = (end_cycles-start_cycles)/(10*iterations);
   printf("* 4-Way Table Query   : %lld\n", diff_cycles);
 
+  // reference query that scans the table in 64-bit words
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++)
+  {
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+1]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+2]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+3]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+4]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+5]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+6]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+7]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9+8]);
+    ted_point_query_table_duif_avx2(&p, i%FIXBASE_P, t[i%9]);
+  } 
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 64-Bit Word Query : %lld\n", diff_cycles);
+
+  // fixed-base comb of the geometry chosen at compile time
+  __m256i k[8];
+  uint8_t kb[32], kv[4][32];
+  ExtPoint h, hv;
+  for (i = 0; i < 8; i++) k[i] = VAND(t[i], VSET164(0xFFFFFFFFU));
+  for (i = 0; i < 32; i++) kb[i] = (uint8_t)random();
+  printf("\n* Fixed-Base Comb (w = %d, s = %d): %d additions, %d doublings, %d KB table\n", 
+    FIXBASE_W, FIXBASE_S, FIXBASE_D, FIXBASE_W*(FIXBASE_S-1), (int)(sizeof(base) >> 10));
+  iterations = 1000;
+  for (i = 0; i < iterations; i++) ted_mul_fixbase_avx2(&p, k);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_mul_fixbase_avx2(&p, k);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 4-Way Fixed-Base (w = %d, s = %d): %lld\n", FIXBASE_W, FIXBASE_S, diff_cycles);
+  for (i = 0; i < iterations; i++) ted_mul_fixbase_vartime_avx2(&h, k);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_mul_fixbase_vartime_avx2(&h, k);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 4-Way Fixed-Base (variable-time): %lld\n", diff_cycles);
+  for (i = 0; i < 128; i++) kv[i&3][i>>2] = (uint8_t)random();
+  kv[0][31] = kv[1][31] = kv[2][31] = kv[3][31] = 0x0F;
+  for (i = 0; i < iterations; i++) ted_mul_varbase_vartime_avx2(&hv, &h, (const uint8_t (*)[32])kv);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_mul_varbase_vartime_avx2(&hv, &h, (const uint8_t (*)[32])kv);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 4-Way Variable-Base (variable-time, wNAF w = %d): %lld\n", TED_WNAF_W, diff_cycles);
+  for (i = 0; i < iterations; i++) ted_mul_fixbase_1x4_avx2(t, kb);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_mul_fixbase_1x4_avx2(t, kb);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 1x4-Way Fixed-Base (w = %d, s = %d): %lld\n", FIXBASE_W, FIXBASE_S, diff_cycles);
+  for (i = 0; i < iterations; i++) ted_mul_fixbase_2x2_avx2(h.x, k);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_mul_fixbase_2x2_avx2(h.x, k);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 2x2-Way Fixed-Base (w = %d, s = %d): %lld\n", FIXBASE_W, FIXBASE_S, diff_cycles);
+  if (x25519_impl_by_id(X25519_AVX512)) timing_fixbase_avx512(k);
+}
+
+/**
+ * @brief Measure latency of AVX-512IFMA point operations.
+ *
+ * @details
+ * Measure latency of the (8*1)-way ladder-step on Montgomery curve.
+ */
+TARGET_AVX512 void timing_point_arith_avx512()
+{
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, iterations = 100000;
+  ProPoint512 zp, zq;
+  __m512i zt[NWORDS52];
+  const __m512i zmask = _mm512_set1_epi64(MASK52);
+
+  // randomize the input (52-bit limbs)
+  for (i = 0; i < NWORDS52; i++) {
+    zt[i]   = _mm512_and_si512(zmask, _mm512_set1_epi64(random()));
+    zp.x[i] = _mm512_and_si512(zmask, _mm512_set1_epi64(random()));
+    zp.z[i] = _mm512_and_si512(zmask, _mm512_set1_epi64(random()));
+    zq.x[i] = _mm512_and_si512(zmask, _mm512_set1_epi64(random()));
+    zq.z[i] = _mm512_and_si512(zmask, _mm512_set1_epi64(random()));
+  }
+
+  // load cache
+  for (i = 0; i < iterations; i++) mon_ladder_step_avx512(&zp, &zq, zt);
+  // measure timing
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+    mon_ladder_step_avx512(&zp, &zq, zt);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 8-Way Ladder-Step: %lld\n", diff_cycles);
+}
+
+/**
+ * @brief Measure latency of the AVX-512IFMA fixed-base comb.
+ *
+ * @details
+ * The eight scalars are two copies of the four scalars of the AVX2 timing.
+ *
+ * @param k Scalars in the 64-bit lanes of eight AVX2 vectors
+ */
+TARGET_AVX512 void timing_fixbase_avx512(const __m256i *k)
+{
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, iterations = 1000;
+  __m512i zk[8];
+  ProPoint512 zp;
+
+  for (i = 0; i < 8; i++) zk[i] = _mm512_broadcast_i64x4(k[i]);
+  for (i = 0; i < iterations; i++) ted_mul_fixbase_avx512(&zp, zk);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) ted_mul_fixbase_avx512(&zp, zk);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("  - 8-Way Fixed-Base (w = %d, s = %d): %lld\n", FIXBASE_W, FIXBASE_S, diff_cycles);
 }
 
+
 /**
  * @brief Measure latency of Diffie-Hellman functions.
  *
@@ -516,6 +2399,359 @@ void timing_ecdh()
   printf("  - Latency (single): %lld\n", diff_cycles/4);
   tp = 1e6*4*10*iterations / (double)(end_time-start_time);
   printf("  - Throughput: %8.1f op/sec\n", tp);
+
+  // conversion of four u-coordinates from and to 32-byte strings
+  uint8_t u[4][32];
+  memset(u, 0x5A, sizeof(u));
+  for (i = 0; i < iterations; i++) mpi29_conv_bytes2mpi29_avx2(r, (const uint8_t (*)[32])u);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) {
+    mpi29_conv_bytes2mpi29_avx2(r, (const uint8_t (*)[32])u);
+    mpi29_conv_mpi292bytes_avx2(u, r);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("\n* 4-Way Load+Store of u: %lld\n", diff_cycles);
+
+  // shared inversion of X25519_MAXGROUPS calls, cycles per call
+  static uint8_t kn[4*X25519_MAXGROUPS][32];
+  memset(kn, 0x5A, sizeof(kn));
+  for (i = 0; i < iterations/X25519_MAXGROUPS; i++) 
+    x25519_sharedsecret_n_avx2(kn, (const uint8_t (*)[32])kn, (const uint8_t (*)[32])kn, X25519_MAXGROUPS);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/X25519_MAXGROUPS; i++) 
+    x25519_sharedsecret_n_avx2(kn, (const uint8_t (*)[32])kn, (const uint8_t (*)[32])kn, X25519_MAXGROUPS);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/X25519_MAXGROUPS*X25519_MAXGROUPS);
+  printf("\n* 4-Way Shared Secret (%d calls, one inversion): %lld\n", X25519_MAXGROUPS, diff_cycles);
+  static uint8_t okn[4*X25519_MAXGROUPS];
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/X25519_MAXGROUPS; i++) 
+    x25519_sharedsecret_checked_n_avx2(kn, okn, (const uint8_t (*)[32])kn, 
+      (const uint8_t (*)[32])kn, X25519_MAXGROUPS);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/X25519_MAXGROUPS*X25519_MAXGROUPS);
+  printf("* 4-Way Shared Secret (%d calls, validated): %lld\n", X25519_MAXGROUPS, diff_cycles);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) 
+    x25519_sharedsecret_avx2(kn, (const uint8_t (*)[32])kn, (const uint8_t (*)[32])kn);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("* 4-Way Shared Secret (bytes, own inversion): %lld\n", diff_cycles);
+  static X25519Group gn[X25519_MAXGROUPS];
+  memset(gn, 0x5A, sizeof(gn));
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/X25519_MAXGROUPS; i++) 
+    x25519_sharedsecret_soa_n_avx2(gn, gn, gn, X25519_MAXGROUPS);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/X25519_MAXGROUPS*X25519_MAXGROUPS);
+  printf("* 4-Way Shared Secret (%d calls, interleaved): %lld\n", X25519_MAXGROUPS, diff_cycles);
+
+  // hybrid ladder, cycles per shared secret (4+ns instances per call)
+  if (x25519_has_hybrid()) {
+    int ns;
+    for (ns = 0; ns <= MON_HYBRID_MAXSCALAR; ns++) {
+      start_cycles = read_tsc();
+      for (i = 0; i < iterations/10; i++) 
+        x25519_sharedsecret_hybrid_avx2(kn, (const uint8_t (*)[32])kn, (const uint8_t (*)[32])kn, ns);
+      end_cycles = read_tsc();
+      diff_cycles = (end_cycles-start_cycles)/(iterations/10*(4+ns));
+      printf("* 4-Way + %d Scalar Shared Secret (hybrid, per op): %lld\n", ns, diff_cycles);
+    }
+  }
+
+  // single-instance latency of the (1*4)-way implementation
+  for (i = 0; i < iterations; i++) x25519_keygen_1x4_avx2(u, (const uint8_t (*)[32])u);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) x25519_keygen_1x4_avx2(u, (const uint8_t (*)[32])u);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("\n* 1x4-Way Key Generation (single): %lld\n", diff_cycles);
+  for (i = 0; i < iterations; i++) 
+    x25519_sharedsecret_1x4_avx2(u, (const uint8_t (*)[32])u, (const uint8_t (*)[32])u);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) 
+    x25519_sharedsecret_1x4_avx2(u, (const uint8_t (*)[32])u, (const uint8_t (*)[32])u);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 1x4-Way Shared Secret (single): %lld\n", diff_cycles);
+
+  // latency of a pair of instances with the (2*2)-way implementation
+  for (i = 0; i < iterations; i++) x25519_keygen_2x2_avx2(u, (const uint8_t (*)[32])u);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) x25519_keygen_2x2_avx2(u, (const uint8_t (*)[32])u);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("\n* 2x2-Way Key Generation (pair): %lld\n", diff_cycles);
+  for (i = 0; i < iterations; i++) 
+    x25519_sharedsecret_2x2_avx2(u, (const uint8_t (*)[32])u, (const uint8_t (*)[32])u);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) 
+    x25519_sharedsecret_2x2_avx2(u, (const uint8_t (*)[32])u, (const uint8_t (*)[32])u);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* 2x2-Way Shared Secret (pair): %lld\n", diff_cycles);
+}
+
+/**
+ * @brief Measure latency of X448.
+ *
+ * @details
+ * Measure latency of the 4-way radix-2^28 field multiplication, squaring and
+ * inversion, and of the 4-way X448 key generation and shared secret.
+ */
+void timing_x448()
+{
+  __m256i a[NWORDS448], b[NWORDS448];
+  uint8_t k[4][X448_BYTES];
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, iterations = 2000;
+
+  for (i = 0; i < NWORDS448; i++) {
+    a[i] = VSET64(random() & MASK28, random() & MASK28, random() & MASK28, random() & MASK28);
+    b[i] = VSET64(random() & MASK28, random() & MASK28, random() & MASK28, random() & MASK28);
+  }
+  memset(k, 0x5A, sizeof(k));
+
+  for (i = 0; i < iterations; i++) mpi28_gfp448_mul_avx2(a, a, b);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi28_gfp448_mul_avx2(a, a, b);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("\n* X448 4-Way MUL: %lld\n", diff_cycles);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) mpi28_gfp448_sqr_avx2(a, a);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("* X448 4-Way SQR: %lld\n", diff_cycles);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/10; i++) mpi28_gfp448_inv_avx2(a, a);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/10);
+  printf("* X448 4-Way INV: %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations/10; i++) x448_keygen_avx2(k, (const uint8_t (*)[X448_BYTES])k);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) x448_keygen_avx2(k, (const uint8_t (*)[X448_BYTES])k);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("\n* X448 4-Way Key Generation: %lld\n", diff_cycles);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) 
+    x448_sharedsecret_avx2(k, (const uint8_t (*)[X448_BYTES])k, (const uint8_t (*)[X448_BYTES])k);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("* X448 4-Way Shared Secret: %lld\n", diff_cycles);
+}
+
+/**
+ * @brief Measure latency of Ed25519 signing and verification.
+ *
+ * @details
+ * Measure latency of 4-way key generation and signing of 64-byte messages, 
+ * the cost per signature of a batch of 4*ED25519_MAXGROUPS messages, and the
+ * cost per signature of the batch verification of 1 to 256 signatures.
+ */
+void timing_ed25519()
+{
+  static uint8_t sk[4*ED25519_MAXGROUPS][32], pk[4*ED25519_MAXGROUPS][32];
+  static uint8_t sig[256][64], buf[256][64], vpk[256][32];
+  const uint8_t *msg[256];
+  size_t len[256];
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, n, iterations = 1000;
+
+  memset(sk, 0x5A, sizeof(sk));
+  memset(buf, 0xA5, sizeof(buf));
+  for (i = 0; i < 256; i++) { buf[i][0] = (uint8_t)i; msg[i] = buf[i]; len[i] = 64; }
+
+  for (i = 0; i < iterations; i++) ed25519_pubkey_avx2(pk, (const uint8_t (*)[32])sk);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) ed25519_pubkey_avx2(pk, (const uint8_t (*)[32])sk);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("\n* 4-Way Ed25519 Key Generation: %lld\n", diff_cycles);
+
+  for (i = 0; i < iterations; i++) 
+    ed25519_sign_avx2(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) 
+    ed25519_sign_avx2(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("* 4-Way Ed25519 Sign (64-byte messages): %lld\n", diff_cycles);
+  printf("  - per signature: %lld\n", diff_cycles/4);
+
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/ED25519_MAXGROUPS; i++) 
+    ed25519_sign_batch(sig, msg, len, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, 
+      4*ED25519_MAXGROUPS);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/ED25519_MAXGROUPS*4*ED25519_MAXGROUPS);
+  printf("* Ed25519 Batch Sign (%d messages), per signature: %lld\n", 
+    4*ED25519_MAXGROUPS, diff_cycles);
+
+  // 256 signatures under the 4*ED25519_MAXGROUPS keys
+  for (i = 0; i < 256; i++) memcpy(vpk[i], pk[i%(4*ED25519_MAXGROUPS)], 32);
+  for (i = 0; i < 256; i += 4*ED25519_MAXGROUPS)
+    ed25519_sign_batch(sig + i, msg + i, len + i, (const uint8_t (*)[32])sk, 
+      (const uint8_t (*)[32])pk, 4*ED25519_MAXGROUPS);
+
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/10; i++) ed25519_verify(sig[0], msg[0], len[0], vpk[0]);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/10);
+  printf("* Ed25519 Verify: %lld\n", diff_cycles);
+
+  for (n = 4; n <= 256; n *= 4) {
+    start_cycles = read_tsc();
+    for (i = 0; i < iterations/n; i++) 
+      ed25519_verify_batch((const uint8_t (*)[64])sig, msg, len, 
+        (const uint8_t (*)[32])vpk, (size_t)n);
+    end_cycles = read_tsc();
+    diff_cycles = (end_cycles-start_cycles)/((iterations/n)*n);
+    printf("* Ed25519 Batch Verify (%d signatures), per signature: %lld\n", n, diff_cycles);
+  }
+}
+
+/**
+ * @brief Measure latency of the Elligator 2 maps.
+ *
+ * @details
+ * Measure latency of the 4-way map and inverse map, the cost per point of a
+ * batch map of 4*ELLIGATOR_MAXGROUPS representatives, and the cost per key
+ * pair of the key generation with representatives.
+ */
+void timing_elligator()
+{
+  static uint8_t sk[4*ELLIGATOR_MAXGROUPS][32], pk[4*ELLIGATOR_MAXGROUPS][32];
+  static uint8_t rep[4*ELLIGATOR_MAXGROUPS][32], tw[4*ELLIGATOR_MAXGROUPS];
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  int i, j, iterations = 1000;
+
+  for (i = 0; i < 4*ELLIGATOR_MAXGROUPS; i++) {
+    for (j = 0; j < 32; j++) rep[i][j] = (uint8_t)random();
+    tw[i] = (uint8_t)random();
+  }
+
+  for (i = 0; i < iterations; i++) elligator_map_avx2(pk, (const uint8_t (*)[32])rep);
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) elligator_map_avx2(pk, (const uint8_t (*)[32])rep);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("\n* 4-Way Elligator 2 Map: %lld\n", diff_cycles);
+
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/ELLIGATOR_MAXGROUPS; i++) 
+    elligator_map_batch(pk, (const uint8_t (*)[32])rep, 4*ELLIGATOR_MAXGROUPS);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/ELLIGATOR_MAXGROUPS*4*ELLIGATOR_MAXGROUPS);
+  printf("* Elligator 2 Batch Map (%d points), per point: %lld\n", 
+    4*ELLIGATOR_MAXGROUPS, diff_cycles);
+
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) 
+    elligator_rev_avx2(rep, (const uint8_t (*)[32])pk, tw);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/iterations;
+  printf("* 4-Way Inverse Elligator 2 Map: %lld\n", diff_cycles);
+
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations/ELLIGATOR_MAXGROUPS; i++) 
+    elligator_keygen_batch(pk, rep, sk, tw, 4*ELLIGATOR_MAXGROUPS);
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(iterations/ELLIGATOR_MAXGROUPS*4*ELLIGATOR_MAXGROUPS);
+  printf("* Key Generation with Representatives (%d keys), per key: %lld\n", 
+    4*ELLIGATOR_MAXGROUPS, diff_cycles);
+}
+
+/**
+ * @brief Measure latency of AVX-512IFMA Diffie-Hellman functions.
+ *
+ * @details
+ * Measure latency of (8*1)-way key generation and shared secret.
+ */
+TARGET_AVX512 void timing_ecdh_avx512()
+{
+  uint64_t start_cycles, end_cycles, diff_cycles;
+  clock_t start_time, end_time;
+  double tp;
+  int i, iterations = 2000;
+  __m512i za[NWORDS52], zr[NWORDS52];
+  const __m512i zmask = _mm512_set1_epi64(MASK52);
+
+  // randomize the input (52-bit limbs)
+  for (i = 0; i < NWORDS52; i++) {
+    za[i] = _mm512_and_si512(zmask, _mm512_set_epi64(random(), random(), random(), random(), 
+      random(), random(), random(), random()));
+    zr[i] = _mm512_and_si512(zmask, _mm512_set_epi64(random(), random(), random(), random(), 
+      random(), random(), random(), random()));
+  }
+
+  // load cache
+  for (i = 0; i < iterations; i++) keygen_avx512(zr, zr);
+  // measure timing
+  start_time = clock();
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+    keygen_avx512(zr, zr);
+  }
+  end_cycles = read_tsc();
+  end_time = clock();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  puts("\n* Key Generation (AVX-512IFMA):");
+  printf("  - Latency (8-Way ): %lld\n", diff_cycles);
+  printf("  - Latency (single): %lld\n", diff_cycles/8);
+  tp = 1e6*8*10*iterations / (double)(end_time-start_time);
+  printf("  - Throughput: %8.1f op/sec\n", tp);
+
+  // load cache
+  for (i = 0; i < iterations; i++) sharedsecret_avx512(zr, za, zr);
+  // measure timing
+  start_time = clock();
+  start_cycles = read_tsc();
+  for (i = 0; i < iterations; i++) {
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+    sharedsecret_avx512(zr, za, zr);
+  }
+  end_cycles = read_tsc();
+  end_time = clock();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  puts("\n* Shared Secret (AVX-512IFMA):");
+  printf("  - Latency (8-Way ): %lld\n", diff_cycles);
+  printf("  - Latency (single): %lld\n", diff_cycles/8);
+  tp = 1e6*8*10*iterations / (double)(end_time-start_time);
+  printf("  - Throughput: %8.1f op/sec\n", tp);
+
+  // conversion of eight u-coordinates from and to 32-byte strings
+  uint8_t u[8][32];
+  memset(u, 0x5A, sizeof(u));
+  for (i = 0; i < iterations; i++) mpi52_conv_bytes2mpi52_avx512(zr, (const uint8_t (*)[32])u);
+  start_cycles = read_tsc();
+  for (i = 0; i < 10*iterations; i++) {
+    mpi52_conv_bytes2mpi52_avx512(zr, (const uint8_t (*)[32])u);
+    mpi52_conv_mpi522bytes_avx512(u, zr);
+  }
+  end_cycles = read_tsc();
+  diff_cycles = (end_cycles-start_cycles)/(10*iterations);
+  printf("\n* 8-Way Load+Store of u: %lld\n", diff_cycles);
 }
 
 
@@ -533,18 +2769,51 @@ void timing_all()
   puts("-------------------------------------------------------------------");
   puts("Field operations:");
   timing_fp_arith();
+  if (x25519_impl_by_id(X25519_AVX512)) timing_fp_arith_avx512();
   puts("-------------------------------------------------------------------");
   puts("Point operations:");
   timing_point_arith();
   puts("-------------------------------------------------------------------");
   puts("Diffie-Hellman functions:");
   timing_ecdh();
+  timing_peercache();
+  if (x25519_impl_by_id(X25519_AVX512)) timing_ecdh_avx512();
+  timing_x448();
+  timing_elligator();
+  puts("-------------------------------------------------------------------");
+  puts("Signatures:");
+  timing_ed25519();
   puts("*******************************************************************");
 }
 
-int main()
+int main(int argc, char **argv)
 {
+  // "test_bench point" only measures the point operations (see bench-fixbase)
+  if ((argc > 1) && !strcmp(argv[1], "point")) {
+    timing_point_arith();
+    return 0;
+  }
+  // "test_bench field" only measures the field operations (see bench-gfp)
+  if ((argc > 1) && !strcmp(argv[1], "field")) {
+    test_fp_arith();
+    timing_fp_arith();
+    return 0;
+  }
+  test_fp_arith();
   test_ecdh();
+  if (x25519_impl_by_id(X25519_AVX512)) test_ecdh_avx512();
+  test_table_query();
+  test_vartime();
+  test_ed25519();
+  test_x25519();
+  test_x448();
+  test_elligator();
+  test_engine();
+  test_coalescing();
+  test_peercache();
+#if PROF
+  test_prof();
+#endif
   timing_all();
   return 0;
 }
@@ -10,11 +10,17 @@
  *
  * @details 
  * This file contains (4*1)-way parallel point operations on Montgomery curve. 
+ * The (1*4)-way functions compute a single instance and use the four lanes for
+ * the independent field operations of one ladder step, which has a lower
+ * latency than four instances with three of them unused. The (2*2)-way 
+ * functions compute two instances with two lanes each, in between the two.
  *******************************************************************************
  */
 
 #include "moncurve.h"
 #include "tedcurve.h"
+#include "gfpinline.h"
+#include "prof.h"
 
 
 /**
@@ -55,6 +61,53 @@ void mon_ladder_step_avx2(ProPoint *p, ProPoint *q, const __m256i *xd)
 }
 
 
+/**
+ * @brief Fused Montgomery ladder step.
+ *
+ * @details
+ * (P,Q) <- LadderStep(P,Q,pk)
+ * The same ladder step as mon_ladder_step_avx2, but with the inlined field 
+ * operations on local variables instead of 18 calls that load and store their 
+ * operands through memory (and p->y and q->y as scratch). The operations are 
+ * ordered in pairs of independent multiplications/squarings, which lets the 
+ * processor overlap their (long) dependency chains. The limbs of the operands 
+ * of each multiplication have the same bounds as in mon_ladder_step_avx2. The 
+ * y-coordinates are not used.
+ * 
+ * @param p Projective point 
+ * @param q Projective point 
+ * @param xd Field element
+ */
+void mon_ladder_step_fused_avx2(ProPoint *p, ProPoint *q, const __m256i *xd)
+{
+  __m256i a[NWORDS], b[NWORDS], c[NWORDS], d[NWORDS];
+  __m256i aa[NWORDS], bb[NWORDS], da[NWORDS], cb[NWORDS];
+  __m256i e[NWORDS], t[NWORDS];
+
+  mpi29_gfp_add_inl_avx2(a, p->x, p->z);
+  mpi29_gfp_sbc_inl_avx2(b, p->x, p->z);
+  mpi29_gfp_add_inl_avx2(c, q->x, q->z);
+  mpi29_gfp_sub_inl_avx2(d, q->x, q->z);
+  // AA = A^2 and DA = D*A, BB = B^2 and CB = C*B
+  mpi29_gfp_sqr_inl_avx2(aa, a);
+  mpi29_gfp_mul_inl_avx2(da, d, a);
+  mpi29_gfp_sqr_inl_avx2(bb, b);
+  mpi29_gfp_mul_inl_avx2(cb, c, b);
+  mpi29_gfp_sub_inl_avx2(e, aa, bb);
+  mpi29_gfp_add_inl_avx2(a, da, cb);
+  mpi29_gfp_sbc_inl_avx2(b, da, cb);
+  mpi29_gfp_mul29_inl_avx2(t, e, (CONSTA-2)/4);
+  mpi29_gfp_add_inl_avx2(t, t, aa);
+  // x2 = AA*BB and x3 = (DA+CB)^2, z2 = E*(AA+a24*E) and (DA-CB)^2
+  mpi29_gfp_mul_inl_avx2(p->x, aa, bb);
+  mpi29_gfp_sqr_inl_avx2(q->x, a);
+  mpi29_gfp_mul_inl_avx2(p->z, t, e);
+  mpi29_gfp_sqr_inl_avx2(c, b);
+  // z3 = xd*(DA-CB)^2
+  mpi29_gfp_mul_inl_avx2(q->z, c, xd);
+}
+
+
 /**
  * @brief Conditional swap (cswap) of two points.
  *
@@ -79,19 +132,20 @@ static void mon_cswap_point_avx2(ProPoint *p, ProPoint *q, const __m256i b)
 
 
 /**
- * @brief Variable-base scalar multiplication.
+ * @brief Variable-base scalar multiplication in projective coordinates.
  *
  * @details
- * xR = k * xP.
- * This function computes only the x-coordinate of R = k * P, where R and P are
- * points with affine coordinates. This is the core operation of ECDH shared 
- * secret phase. 
+ * (x2 : z2) = k * xP.
+ * The Montgomery ladder without the final inversion, so that the caller can 
+ * invert the z-coordinates of several calls at once (see batchinv). 
  * 
- * @param r x-coordinate of point with affine coordinates
+ * @param x2 Projective x-coordinate of R
+ * @param z2 Projective z-coordinate of R
  * @param k scalar 
  * @param x x-coordinate of point with affine coordinates
  */
-void mon_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x)
+void mon_mul_varbase_proj_avx2(__m256i *x2, __m256i *z2, const __m256i *k, 
+  const __m256i *x)
 {
   ProPoint p1, p2;
   __m256i b, s = VZERO, kp[8];
@@ -101,12 +155,15 @@ void mon_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x)
   int i;
 
   // prune scalar k
+  PROF_START(t_prune);
   for (i = 0; i < 8; i++) kp[i] = k[i];
   kp[0] = VAND(kp[0], t0);
   kp[7] = VAND(kp[7], t1);
   kp[7] = VOR(kp[7], t2);
+  PROF_STOP(PROF_PRUNE, t_prune);
 
   // initialize ladder
+  PROF_START(t_ladder);
   for (i = 0; i < NWORDS; i++) {
     p1.x[i] = p1.z[i] = p2.z[i] = VZERO;
     p2.x[i] = x[i];
@@ -119,14 +176,324 @@ void mon_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x)
   b = VSHR(b, i&31);
   s = VXOR(s, b);
   mon_cswap_point_avx2(&p1, &p2, s);
-  mon_ladder_step_avx2(&p1, &p2, x);
+  mon_ladder_step_fused_avx2(&p1, &p2, x);
   s = b;
 }
   mon_cswap_point_avx2(&p1, &p2, s);
+  PROF_STOP(PROF_LADDER, t_ladder);
+
+  for (i = 0; i < NWORDS; i++) {
+    x2[i] = p1.x[i];
+    z2[i] = p1.z[i];
+  }
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * This function computes only the x-coordinate of R = k * P, where R and P are
+ * points with affine coordinates. This is the core operation of ECDH shared 
+ * secret phase. 
+ * 
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar 
+ * @param x x-coordinate of point with affine coordinates
+ */
+void mon_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x)
+{
+  __m256i z[NWORDS];
+
+  mon_mul_varbase_proj_avx2(r, z, k, x);
+
+  // projective -> affine
+  mpi29_gfp_inv_avx2(z, z);
+  mpi29_gfp_mul_avx2(r, r, z);
+}
+
+
+/**
+ * @brief Scalar ladder state of the hybrid ladder.
+ *
+ * @details
+ * The points (x2 : z2) and (x3 : z3) and the difference x1 of one instance
+ * in radix-2^64 words, and its temporaries.
+ */
+typedef struct mon64_ladder {
+  uint64_t x1[NWORDS64], x2[NWORDS64], z2[NWORDS64], x3[NWORDS64], z3[NWORDS64];
+  uint64_t a[NWORDS64], b[NWORDS64], c[NWORDS64], d[NWORDS64], e[NWORDS64];
+  uint64_t aa[NWORDS64], bb[NWORDS64];
+} Mon64Ladder;
+
+
+/**
+ * @brief Conditional swap of the two points of a scalar ladder.
+ *
+ * @param s Scalar ladder
+ * @param b Swapping flag (0 or 1)
+ */
+static void mon64_cswap(Mon64Ladder *s, const uint64_t b)
+{
+  const uint64_t mask = 0 - b;
+  uint64_t t;
+  int i;
+
+  for (i = 0; i < NWORDS64; i++) {
+    t = (s->x2[i] ^ s->x3[i]) & mask;
+    s->x2[i] ^= t; s->x3[i] ^= t;
+    t = (s->z2[i] ^ s->z3[i]) & mask;
+    s->z2[i] ^= t; s->z3[i] ^= t;
+  }
+}
+
+
+/**
+ * @brief Hybrid Montgomery ladder step.
+ *
+ * @details
+ * (P,Q) <- LadderStep(P,Q,pk) of the four AVX2 lanes (as in 
+ * mon_ladder_step_fused_avx2) and of ns scalar ladders. The scalar field 
+ * operations are interleaved with the vector ones, which execute on other 
+ * ports (or wait for the long latency of the vector multiplier), so the 
+ * out-of-order core runs both instruction streams at the same time.
+ * 
+ * @param p Projective point
+ * @param q Projective point
+ * @param xd Field element
+ * @param s Scalar ladders
+ * @param ns Number of scalar ladders
+ */
+static void mon_ladder_step_hybrid_avx2(ProPoint *p, ProPoint *q, const __m256i *xd,
+  Mon64Ladder *s, const int ns)
+{
+  __m256i a[NWORDS], b[NWORDS], c[NWORDS], d[NWORDS];
+  __m256i aa[NWORDS], bb[NWORDS], da[NWORDS], cb[NWORDS];
+  __m256i e[NWORDS], t[NWORDS];
+  Mon64Ladder *u;
+  int j;
+
+  mpi29_gfp_add_inl_avx2(a, p->x, p->z);
+  mpi29_gfp_sbc_inl_avx2(b, p->x, p->z);
+  mpi29_gfp_add_inl_avx2(c, q->x, q->z);
+  mpi29_gfp_sub_inl_avx2(d, q->x, q->z);
+  for (j = 0, u = s; j < ns; j++, u++) {
+    gfp64_add(u->a, u->x2, u->z2);
+    gfp64_sub(u->b, u->x2, u->z2);
+    gfp64_add(u->c, u->x3, u->z3);
+    gfp64_sub(u->d, u->x3, u->z3);
+  }
+  mpi29_gfp_sqr_inl_avx2(aa, a);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_sqr(u->aa, u->a);
+  mpi29_gfp_mul_inl_avx2(da, d, a);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_mul(u->d, u->d, u->a);
+  mpi29_gfp_sqr_inl_avx2(bb, b);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_sqr(u->bb, u->b);
+  mpi29_gfp_mul_inl_avx2(cb, c, b);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_mul(u->c, u->c, u->b);
+  mpi29_gfp_sub_inl_avx2(e, aa, bb);
+  mpi29_gfp_add_inl_avx2(a, da, cb);
+  mpi29_gfp_sbc_inl_avx2(b, da, cb);
+  mpi29_gfp_mul29_inl_avx2(t, e, (CONSTA-2)/4);
+  mpi29_gfp_add_inl_avx2(t, t, aa);
+  for (j = 0, u = s; j < ns; j++, u++) {
+    gfp64_sub(u->e, u->aa, u->bb);
+    gfp64_add(u->a, u->d, u->c);
+    gfp64_sub(u->b, u->d, u->c);
+  }
+  mpi29_gfp_mul_inl_avx2(p->x, aa, bb);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_mul(u->x2, u->aa, u->bb);
+  mpi29_gfp_sqr_inl_avx2(q->x, a);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_sqr(u->x3, u->a);
+  mpi29_gfp_mul_inl_avx2(p->z, t, e);
+  for (j = 0, u = s; j < ns; j++, u++) {
+    gfp64_mul32(u->c, u->e, (CONSTA-2)/4);
+    gfp64_add(u->c, u->c, u->aa);
+    gfp64_mul(u->z2, u->c, u->e);
+  }
+  mpi29_gfp_sqr_inl_avx2(c, b);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_sqr(u->b, u->b);
+  mpi29_gfp_mul_inl_avx2(q->z, c, xd);
+  for (j = 0, u = s; j < ns; j++, u++) gfp64_mul(u->z3, u->b, u->x1);
+}
+
+
+/**
+ * @brief Scalar field inversion.
+ *
+ * @details
+ * r = a^(p-2) mod p (254 squarings and 11 multiplications).
+ *
+ * @param r Field element
+ * @param a Field element
+ */
+static void gfp64_inv(uint64_t *r, const uint64_t *a)
+{
+  uint64_t z2[NWORDS64], z9[NWORDS64], z11[NWORDS64], z5[NWORDS64];
+  uint64_t z10[NWORDS64], z20[NWORDS64], z50[NWORDS64], z100[NWORDS64];
+  uint64_t t[NWORDS64];
+  int i;
+
+  gfp64_sqr(z2, a);                                       // 2
+  gfp64_sqr(t, z2); gfp64_sqr(t, t);                      // 8
+  gfp64_mul(z9, t, a);                                    // 9
+  gfp64_mul(z11, z9, z2);                                 // 11
+  gfp64_sqr(t, z11);                                      // 22
+  gfp64_mul(z5, t, z9);                                   // 2^5 - 1
+  gfp64_sqr(t, z5);
+  for (i = 1; i < 5; i++) gfp64_sqr(t, t);
+  gfp64_mul(z10, t, z5);                                  // 2^10 - 1
+  gfp64_sqr(t, z10);
+  for (i = 1; i < 10; i++) gfp64_sqr(t, t);
+  gfp64_mul(z20, t, z10);                                 // 2^20 - 1
+  gfp64_sqr(t, z20);
+  for (i = 1; i < 20; i++) gfp64_sqr(t, t);
+  gfp64_mul(t, t, z20);                                   // 2^40 - 1
+  for (i = 0; i < 10; i++) gfp64_sqr(t, t);
+  gfp64_mul(z50, t, z10);                                 // 2^50 - 1
+  gfp64_sqr(t, z50);
+  for (i = 1; i < 50; i++) gfp64_sqr(t, t);
+  gfp64_mul(z100, t, z50);                                // 2^100 - 1
+  gfp64_sqr(t, z100);
+  for (i = 1; i < 100; i++) gfp64_sqr(t, t);
+  gfp64_mul(t, t, z100);                                  // 2^200 - 1
+  for (i = 0; i < 50; i++) gfp64_sqr(t, t);
+  gfp64_mul(t, t, z50);                                   // 2^250 - 1
+  for (i = 0; i < 5; i++) gfp64_sqr(t, t);
+  gfp64_mul(r, t, z11);                                   // 2^255 - 21
+}
+
+
+/**
+ * @brief Hybrid variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP for the four AVX2 lanes (as mon_mul_varbase_avx2) and, in the 
+ * same ladder loop, for ns <= 2 further instances on the scalar integer 
+ * multiplier (radix 2^64, gfparith64.S), which is otherwise idle. This needs 
+ * BMI2 and ADX besides AVX2. The scalar results are reduced to [0, p).
+ * 
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar 
+ * @param x x-coordinate of point with affine coordinates
+ * @param rs x-coordinates of the scalar instances
+ * @param ks scalars of the scalar instances (four 64-bit words)
+ * @param xs x-coordinates of the scalar instances, < 2^255
+ * @param ns Number of scalar instances (0, 1 or 2)
+ */
+void mon_mul_varbase_hybrid_avx2(__m256i *r, const __m256i *k, const __m256i *x,
+  uint64_t (*rs)[NWORDS64], const uint64_t (*ks)[NWORDS64], 
+  const uint64_t (*xs)[NWORDS64], const int ns)
+{
+  ProPoint p1, p2;
+  Mon64Ladder sl[MON_HYBRID_MAXSCALAR];
+  uint64_t kp[MON_HYBRID_MAXSCALAR][NWORDS64], c, ss[MON_HYBRID_MAXSCALAR] = { 0 };
+  __m256i b, s = VZERO, kv[8], z[NWORDS];
+  const __m256i t0 = VSET164(0xFFFFFFF8UL);
+  const __m256i t1 = VSET164(0x7FFFFFFFUL);
+  const __m256i t2 = VSET164(0x40000000UL);
+  int i, j;
+
+  // prune scalars
+  for (i = 0; i < 8; i++) kv[i] = k[i];
+  kv[0] = VAND(kv[0], t0);
+  kv[7] = VAND(kv[7], t1);
+  kv[7] = VOR(kv[7], t2);
+  for (j = 0; j < ns; j++) {
+    for (i = 0; i < NWORDS64; i++) kp[j][i] = ks[j][i];
+    kp[j][0] &= 0xFFFFFFFFFFFFFFF8ULL;
+    kp[j][3] &= 0x7FFFFFFFFFFFFFFFULL;
+    kp[j][3] |= 0x4000000000000000ULL;
+  }
+
+  // initialize ladders
+  for (i = 0; i < NWORDS; i++) {
+    p1.x[i] = p1.z[i] = p2.z[i] = VZERO;
+    p2.x[i] = x[i];
+  }
+  p1.x[0] = p2.z[0] = VSET164(1);
+  for (j = 0; j < ns; j++) {
+    for (i = 0; i < NWORDS64; i++) {
+      sl[j].x1[i] = sl[j].x3[i] = xs[j][i];
+      sl[j].x2[i] = sl[j].z2[i] = sl[j].z3[i] = 0;
+    }
+    sl[j].x2[0] = sl[j].z3[0] = 1;
+  }
+
+  // main ladder loop
+  for (i = 254; i >= 0; i--) {
+    b = kv[i>>5];
+    b = VSHR(b, i&31);
+    s = VXOR(s, b);
+    mon_cswap_point_avx2(&p1, &p2, s);
+    for (j = 0; j < ns; j++) {
+      c = (kp[j][i>>6] >> (i&63)) & 1;
+      mon64_cswap(&sl[j], ss[j] ^ c);
+      ss[j] = c;
+    }
+    mon_ladder_step_hybrid_avx2(&p1, &p2, x, sl, ns);
+    s = b;
+  }
+  mon_cswap_point_avx2(&p1, &p2, s);
+  for (j = 0; j < ns; j++) mon64_cswap(&sl[j], ss[j]);
 
   // projective -> affine
-  mpi29_gfp_inv_avx2(p2.y, p1.z);
-  mpi29_gfp_mul_avx2(r, p2.y, p1.x);
+  mpi29_gfp_inv_avx2(z, p1.z);
+  mpi29_gfp_mul_avx2(r, p1.x, z);
+  for (j = 0; j < ns; j++) {
+    gfp64_inv(sl[j].z2, sl[j].z2);
+    gfp64_mul(rs[j], sl[j].x2, sl[j].z2);
+    gfp64_final(rs[j]);
+  }
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication in projective coordinates.
+ *
+ * @details
+ * (x : z) = k * B.
+ * Map the result of the fixed-base scalar multiplication on twisted Edwards 
+ * curve to the projective x-coordinate u = (z+y) : (z-y) on Montgomery curve,
+ * without the final inversion.
+ * 
+ * @param x Projective x-coordinate of R
+ * @param z Projective z-coordinate of R
+ * @param k Scalar 
+ */
+void mon_mul_fixbase_proj_avx2(__m256i *x, __m256i *z, const __m256i *k)
+{
+  ProPoint p;
+
+  ted_mul_fixbase_avx2(&p, k);
+  mpi29_gfp_sbc_avx2(z, p.z, p.y);
+  mpi29_gfp_add_avx2(x, p.z, p.y);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication plus a low-order point in projective
+ * coordinates.
+ *
+ * @details
+ * (x : z) = k * B + c * T.
+ * Same as mon_mul_fixbase_proj_avx2 with the point c*T of the 8-torsion 
+ * subgroup added on the twisted Edwards curve (see ted_mul_fixbase_dirty_avx2).
+ * 
+ * @param x Projective x-coordinate of R
+ * @param z Projective z-coordinate of R
+ * @param k Scalar 
+ * @param c Index of the low-order point in each lane (0 <= c <= 7)
+ */
+void mon_mul_fixbase_dirty_proj_avx2(__m256i *x, __m256i *z, const __m256i *k,
+  const __m256i c)
+{
+  ProPoint p;
+
+  ted_mul_fixbase_dirty_avx2(&p, k, c);
+  mpi29_gfp_sbc_avx2(z, p.z, p.y);
+  mpi29_gfp_add_avx2(x, p.z, p.y);
 }
 
 
@@ -144,13 +511,406 @@ void mon_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x)
  */
 void mon_mul_fixbase_avx2(__m256i *r, const __m256i *k)
 {
-  ProPoint p;
-  __m256i t[NWORDS];
+  __m256i z[NWORDS];
 
-  ted_mul_fixbase_avx2(&p, k);
+  mon_mul_fixbase_proj_avx2(r, z, k);
   // from twisted Edwards curve to Montgomery curve u = (z+y)/(z-y)
-  mpi29_gfp_sbc_avx2(p.x, p.z, p.y);   // t1 = z-y
-  mpi29_gfp_inv_avx2(p.x, p.x);        // t1 = 1/(z-y) 
-  mpi29_gfp_add_avx2(t, p.z, p.y);     // t2 = z+y
-  mpi29_gfp_mul_avx2(r, t, p.x);       // r = (z+y)/(z-y)
+  mpi29_gfp_inv_avx2(z, z);
+  mpi29_gfp_mul_avx2(r, r, z);
+}
+
+
+/**
+ * @brief (1*4)-way Montgomery ladder step.
+ *
+ * @details
+ * [x2, z2, x3, z3] <- LadderStep([x2, z2, x3, z3], x1)
+ * The two points of a single ladder are held in the four lanes of one field
+ * element. A ladder step needs three (1*4)-way multiplications: [AA, BB, CB, DA]
+ * with A = x2+z2, B = x2-z2, C = x3+z3 and D = x3-z3, then [x2, a24*E, x3, 
+ * (DA-CB)^2] with E = AA-BB and x3 = (DA+CB)^2, and finally the product with 
+ * [1, E, 1, x1], which multiplies AA+a24*E by E and (DA-CB)^2 by x1. 
+ * 
+ * @param x Field element [x2, z2, x3, z3]
+ * @param c Field element [1, ?, 1, x1]
+ */
+void mon_ladder_step_1x4_avx2(__m256i *x, const __m256i *c)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], u[NWORDS], y[NWORDS];
+  __m256i k[NWORDS];
+  int i;
+
+  for (i = 1; i < NWORDS; i++) k[i] = VZERO;
+  k[0] = VSET64(0, 0, (CONSTA-2)/4, 0);
+
+  // [A, B, C, D] = [x2+z2, x2-z2, x3+z3, x3-z3]
+  MPI29_PERM(t0, x, 0xA0);                // [x2, x2, x3, x3]
+  MPI29_PERM(t1, x, 0xF5);                // [z2, z2, z3, z3]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbp_avx2(t0, t0, t1);
+  MPI29_BLEND(u, t2, t0, 0xCC);
+  // [AA, BB, CB, DA] = [A, B, C, D] * [A, B, B, A]
+  MPI29_PERM(t0, u, 0x14);
+  mpi29_gfp_mul_avx2(u, u, t0);
+  // [E, E, DA+CB, DA-CB]
+  MPI29_PERM(t0, u, 0xF0);                // [AA, AA, DA, DA]
+  MPI29_PERM(t1, u, 0xA5);                // [BB, BB, CB, CB]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbp_avx2(y, t0, t1);
+  MPI29_BLEND(y, y, t2, 0x30);
+  // [x2, a24*E, x3, (DA-CB)^2] = [AA, E, DA+CB, DA-CB] * [BB, a24, DA+CB, DA-CB]
+  MPI29_BLEND(t2, y, t1, 0x03);
+  MPI29_BLEND(t2, t2, k, 0x0C);
+  MPI29_BLEND(u, y, u, 0x03);
+  mpi29_gfp_mul_avx2(u, u, t2);
+  // [x2, z2, x3, z3] = [x2, AA+a24*E, x3, (DA-CB)^2] * [1, E, 1, x1]
+  for (i = 0; i < NWORDS; i++) t1[i] = VBLEND32(VZERO, t0[i], 0x0C);
+  mpi29_gfp_add_avx2(u, u, t1);
+  MPI29_BLEND(t2, c, y, 0x0C);
+  mpi29_gfp_mul_avx2(x, u, t2);
+}
+
+
+/**
+ * @brief (1*4)-way conditional swap.
+ *
+ * @details
+ * Replace [x2, z2, x3, z3] with [x3, z3, x2, z2] if b == 1.
+ * 
+ * @param x Field element [x2, z2, x3, z3]
+ * @param b Swapping flag
+ */
+static void mon_cswap_1x4_avx2(__m256i *x, const int b)
+{
+  const __m256i mask = VSET164(-(int64_t)b);
+  __m256i t;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) {
+    t = VAND(VXOR(x[i], VPERM64(x[i], 0x4E)), mask);
+    x[i] = VXOR(x[i], t);
+  }
+}
+
+
+/**
+ * @brief (1*4)-way variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * Single-instance version of mon_mul_varbase_avx2 based on the (1*4)-way 
+ * ladder step. 
+ * 
+ * @param r x-coordinate of R in lane 0 (the other lanes are undefined)
+ * @param k Scalar (32 bytes)
+ * @param x x-coordinate of P in lane 3 (or in all lanes)
+ */
+void mon_mul_varbase_1x4_avx2(__m256i *r, const uint8_t *k, const __m256i *x)
+{
+  __m256i p[NWORDS], c[NWORDS], t[NWORDS];
+  uint8_t kp[32];
+  int i, b, s = 0;
+
+  // prune scalar k
+  for (i = 0; i < 32; i++) kp[i] = k[i];
+  kp[0] &= 0xF8;
+  kp[31] &= 0x7F;
+  kp[31] |= 0x40;
+
+  // initialize ladder [1, 0, x1, 1] and the constant [1, 0, 1, x1]
+  for (i = 0; i < NWORDS; i++) {
+    p[i] = VBLEND32(VZERO, x[i], 0x30);
+    c[i] = VBLEND32(VZERO, x[i], 0xC0);
+  }
+  p[0] = VOR(p[0], VSET64(1, 0, 0, 1));
+  c[0] = VOR(c[0], VSET64(0, 1, 0, 1));
+
+  // main ladder loop
+  for (i = 254; i >= 0; i--) {
+    b = (kp[i>>3] >> (i&7)) & 1;
+    s ^= b;
+    mon_cswap_1x4_avx2(p, s);
+    mon_ladder_step_1x4_avx2(p, c);
+    s = b;
+  }
+  mon_cswap_1x4_avx2(p, s);
+
+  // projective -> affine, x2/z2 in lane 0
+  mpi29_gfp_inv_avx2(t, p);
+  MPI29_PERM(t, t, 0x01);
+  mpi29_gfp_mul_avx2(r, p, t);
+}
+
+
+/**
+ * @brief (1*4)-way fixed-base scalar multiplication on Montgomery curve.
+ *
+ * @details
+ * R = k * B.
+ * Single-instance version of mon_mul_fixbase_avx2 based on the (1*4)-way 
+ * fixed-base scalar multiplication on twisted Edwards curve.
+ * 
+ * @param r x-coordinate of R in all lanes
+ * @param k Scalar (32 bytes)
+ */
+void mon_mul_fixbase_1x4_avx2(__m256i *r, const uint8_t *k)
+{
+  __m256i p[NWORDS], y[NWORDS], z[NWORDS];
+
+  ted_mul_fixbase_1x4_avx2(p, k);
+  // from twisted Edwards curve to Montgomery curve u = (z+y)/(z-y)
+  MPI29_PERM(y, p, 0x55);
+  MPI29_PERM(z, p, 0xAA);
+  mpi29_gfp_sbc_avx2(p, z, y);         // t1 = z-y
+  mpi29_gfp_inv_avx2(p, p);            // t1 = 1/(z-y) 
+  mpi29_gfp_add_avx2(y, z, y);         // t2 = z+y
+  mpi29_gfp_mul_avx2(r, y, p);         // r = (z+y)/(z-y)
+}
+
+
+/**
+ * @brief (2*2)-way Montgomery ladder step.
+ *
+ * @details
+ * [x2, z2], [x3, z3] <- LadderStep([x2, z2], [x3, z3], x1)
+ * Two ladders, each of them in one 128-bit half (two lanes) of the field 
+ * elements, so that all lane moves are in-lane shuffles. A ladder step needs
+ * five (2*2)-way multiplications/squarings: [AA, BB] and [DA, CB], then [x3, 
+ * (DA-CB)^2] with x3 = (DA+CB)^2 and [a24*E, x2] with E = AA-BB, and finally
+ * the product of [AA+a24*E, (DA-CB)^2] with [E, x1].
+ * 
+ * @param x Field elements [x2, z2] (x) and [x3, z3] (x+NWORDS)
+ * @param c Field element [a24, x1]
+ */
+void mon_ladder_step_2x2_avx2(__m256i *x, const __m256i *c)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS], u[NWORDS];
+  __m256i v[NWORDS], *y = x + NWORDS;
+
+  // [A, B] = [x2+z2, x2-z2] and [D, C] = [x3-z3, x3+z3]
+  MPI29_SHUF(t0, x, 0x44);                // [x2, x2]
+  MPI29_SHUF(t1, x, 0xEE);                // [z2, z2]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(u, t2, t0, 0xCC);
+  MPI29_SHUF(t0, y, 0x44);                // [x3, x3]
+  MPI29_SHUF(t1, y, 0xEE);                // [z3, z3]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(v, t0, t2, 0xCC);
+  // [DA, CB] = [D, C] * [A, B] and [AA, BB] = [A, B]^2
+  mpi29_gfp_mul_avx2(v, v, u);
+  mpi29_gfp_sqr_avx2(u, u);
+  // [x3, (DA-CB)^2] = [DA+CB, DA-CB]^2
+  MPI29_SHUF(t0, v, 0x44);                // [DA, DA]
+  MPI29_SHUF(t1, v, 0xEE);                // [CB, CB]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(y, t2, t0, 0xCC);
+  mpi29_gfp_sqr_avx2(y, y);
+  // [a24*E, x2] = [E, AA] * [a24, BB]
+  MPI29_SHUF(t0, u, 0x44);                // [AA, AA]
+  MPI29_SHUF(t1, u, 0xEE);                // [BB, BB]
+  mpi29_gfp_sbc_avx2(t3, t0, t1);         // [E, E]
+  MPI29_BLEND(t2, t3, t0, 0xCC);
+  MPI29_BLEND(t1, c, t1, 0xCC);
+  mpi29_gfp_mul_avx2(x, t2, t1);
+  // [z2, z3] = [AA+a24*E, (DA-CB)^2] * [E, x1]
+  mpi29_gfp_add_avx2(t0, x, t0);
+  MPI29_BLEND(t0, t0, y, 0xCC);
+  MPI29_BLEND(t1, t3, c, 0xCC);
+  mpi29_gfp_mul_avx2(t0, t0, t1);
+  // [x2, z2] and [x3, z3]
+  MPI29_SHUF(x, x, 0xEE);
+  MPI29_SHUF(t1, t0, 0x44);
+  MPI29_BLEND(x, x, t1, 0xCC);
+  MPI29_BLEND(y, y, t0, 0xCC);
+}
+
+
+/**
+ * @brief (2*2)-way variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * Two instances of mon_mul_varbase_avx2 with the (2*2)-way ladder step, the
+ * lanes 0, 1 hold the first and the lanes 2, 3 the second instance (also in
+ * k, such that a shift of k yields the swapping flags of both halves).
+ * 
+ * @param r x-coordinates of R in the lanes 0 and 2 (the others are undefined)
+ * @param k Scalars in the lanes [k0, k0, k1, k1]
+ * @param x x-coordinates of P in the lanes [x0, x0, x1, x1]
+ */
+void mon_mul_varbase_2x2_avx2(__m256i *r, const __m256i *k, const __m256i *x)
+{
+  __m256i p[2*NWORDS], c[NWORDS], t[NWORDS], kp[8], b, s = VZERO;
+  const __m256i one = VSET164(1);
+  const __m256i t0 = VSET164(0xFFFFFFF8UL);
+  const __m256i t1 = VSET164(0x7FFFFFFFUL);
+  const __m256i t2 = VSET164(0x40000000UL);
+  int i;
+
+  // prune scalar k
+  for (i = 0; i < 8; i++) kp[i] = k[i];
+  kp[0] = VAND(kp[0], t0);
+  kp[7] = VAND(kp[7], t1);
+  kp[7] = VOR(kp[7], t2);
+
+  // initialize ladder [1, 0], [x1, 1] and the constant [a24, x1]
+  for (i = 0; i < NWORDS; i++) {
+    p[i] = VZERO;
+    p[NWORDS+i] = VBLEND32(x[i], VZERO, 0xCC);
+    c[i] = VBLEND32(VZERO, x[i], 0xCC);
+  }
+  p[0] = VSET64(0, 1, 0, 1);
+  p[NWORDS] = VOR(p[NWORDS], VSET64(1, 0, 1, 0));
+  c[0] = VOR(c[0], VSET64(0, (CONSTA-2)/4, 0, (CONSTA-2)/4));
+
+  // main ladder loop
+  for (i = 254; i >= 0; i--) {
+    b = VSHR(kp[i>>5], i&31);
+    s = VXOR(s, b);
+    mpi29_cswap_avx2(p, p+NWORDS, VAND(s, one));
+    mon_ladder_step_2x2_avx2(p, c);
+    s = b;
+  }
+  mpi29_cswap_avx2(p, p+NWORDS, VAND(s, one));
+
+  // projective -> affine, x2/z2 in the lanes 0 and 2
+  mpi29_gfp_inv_avx2(t, p);
+  MPI29_SHUF(t, t, 0x4E);
+  mpi29_gfp_mul_avx2(r, p, t);
+}
+
+
+/**
+ * @brief (2*2)-way fixed-base scalar multiplication on Montgomery curve.
+ *
+ * @details
+ * R = k * B.
+ * Two instances of mon_mul_fixbase_avx2 based on the (2*2)-way fixed-base 
+ * scalar multiplication on twisted Edwards curve.
+ * 
+ * @param r x-coordinates of R in the lanes [r0, r0, r1, r1]
+ * @param k Scalars in the lanes [k0, k0, k1, k1]
+ */
+void mon_mul_fixbase_2x2_avx2(__m256i *r, const __m256i *k)
+{
+  __m256i p[2*NWORDS], y[NWORDS], z[NWORDS];
+
+  ted_mul_fixbase_2x2_avx2(p, k);
+  // from twisted Edwards curve to Montgomery curve u = (z+y)/(z-y)
+  MPI29_SHUF(y, p, 0xEE);
+  MPI29_SHUF(z, p+NWORDS, 0x44);
+  mpi29_gfp_sbc_avx2(p, z, y);         // t1 = z-y
+  mpi29_gfp_inv_avx2(p, p);            // t1 = 1/(z-y) 
+  mpi29_gfp_add_avx2(y, z, y);         // t2 = z+y
+  mpi29_gfp_mul_avx2(r, y, p);         // r = (z+y)/(z-y)
+}
+
+
+/**
+ * @brief Elligator 2 map in projective coordinates.
+ *
+ * @details
+ * (x : z) = Elligator2(r).
+ * The map of Bernstein, Hamburg, Krasnova and Lange with the non-square 2: 
+ * u1 = -A/(1+2*r^2), and u = u1 if u1^3+A*u1^2+u1 is a square, otherwise u =
+ * -A-u1. With z = 1+2*r^2 (never 0, since -1/2 is not a square) the square 
+ * test is done on -A*z*(z^2-A^2*(z-1)), which has the same quadratic character
+ * as u1^3+A*u1^2+u1, and u = -A/z or u = -A*2*r^2/z. So the map costs one 
+ * Legendre symbol and no inversion, and several calls can share the inversion
+ * of z. Constant-time.
+ * 
+ * @param x Projective x-coordinate of the point
+ * @param z Projective z-coordinate of the point
+ * @param r Representative (field element)
+ */
+void mon_elligator_map_proj_avx2(__m256i *x, __m256i *z, const __m256i *r)
+{
+  __m256i t[NWORDS], s[NWORDS], h[NWORDS], one[NWORDS], e;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) one[i] = VZERO;
+  one[0] = VSET164(1);
+
+  // t = 2*r^2, z = 1+t
+  mpi29_gfp_sqr_avx2(t, r);
+  mpi29_gfp_add_avx2(t, t, t);
+  mpi29_gfp_add_avx2(z, t, one);
+  // e = 1 if -A*z*(z^2-A^2*t) = A*z*(A^2*t-z^2) is a square
+  mpi29_gfp_mul29_avx2(h, t, CONSTA);
+  mpi29_gfp_mul29_avx2(h, h, CONSTA);
+  mpi29_gfp_sqr_avx2(s, z);
+  mpi29_gfp_sub_avx2(h, h, s);
+  mpi29_gfp_mul_avx2(h, h, z);
+  mpi29_gfp_mul29_avx2(h, h, CONSTA);
+  e = mpi29_gfp_issquare_avx2(h);
+  // x = -A or x = -A*t
+  mpi29_cswap_avx2(one, t, VSHR(_mm256_andnot_si256(e, VSET164(-1)), 63));
+  mpi29_gfp_mul29_avx2(h, one, CONSTA);
+  for (i = 0; i < NWORDS; i++) s[i] = VZERO;
+  mpi29_gfp_sub_avx2(x, s, h);
+}
+
+
+/**
+ * @brief Elligator 2 map.
+ *
+ * @details
+ * u = Elligator2(r), mon_elligator_map_proj_avx2 with the inversion of z.
+ * 
+ * @param u x-coordinate of the point
+ * @param r Representative (field element)
+ */
+void mon_elligator_map_avx2(__m256i *u, const __m256i *r)
+{
+  __m256i z[NWORDS];
+
+  mon_elligator_map_proj_avx2(u, z, r);
+  mpi29_gfp_inv_avx2(z, z);
+  mpi29_gfp_mul_avx2(u, u, z);
+}
+
+
+/**
+ * @brief Inverse Elligator 2 map.
+ *
+ * @details
+ * r = Elligator2^-1(u).
+ * A point u != -A has a representative iff -2*u*(u+A) is a square, and then 
+ * two of them: r = sqrt(-u/(2*(u+A))) maps back through u1 = -A-u (b = 0), and
+ * r = sqrt(-(u+A)/(2*u)) through u1 = u (b = 1). The root is taken without 
+ * inversion (mpi29_gfp_sqrt_ratio_avx2) and the one in [0, (p-1)/2] is 
+ * returned, i.e. r or -r such that 2*r mod p is even. Constant-time.
+ * 
+ * @param r Representative in [0, (p-1)/2] (undefined if not representable)
+ * @param u x-coordinate of the point
+ * @param b Branch (0 or 1 in each lane)
+ * @return Mask of the representable lanes
+ */
+__m256i mon_elligator_rev_avx2(__m256i *r, const __m256i *u, const __m256i b)
+{
+  __m256i n[NWORDS], d[NWORDS], s[NWORDS], t[NWORDS], ok, zero;
+  int i;
+
+  for (i = 0; i < NWORDS; i++) t[i] = VZERO;
+  t[0] = VSET164(CONSTA);
+  mpi29_gfp_add_avx2(s, u, t);
+  zero = mpi29_gfp_iszero_avx2(s);
+
+  // [n, d] = [-u, 2*(u+A)] (b = 0) or [-(u+A), 2*u] (b = 1)
+  mpi29_copy_avx2(n, u);
+  mpi29_cswap_avx2(n, s, b);
+  for (i = 0; i < NWORDS; i++) t[i] = VZERO;
+  mpi29_gfp_sub_avx2(n, t, n);
+  mpi29_gfp_add_avx2(d, s, s);
+  ok = mpi29_gfp_sqrt_ratio_avx2(r, n, d);
+
+  // r = -r if 2*r mod p is odd
+  mpi29_gfp_add_avx2(d, r, r);
+  mpi29_gfp_sub_avx2(n, t, r);
+  mpi29_cswap_avx2(r, n, VSHR(mpi29_gfp_isodd_avx2(d), 63));
+
+  return _mm256_andnot_si256(zero, ok);
 }
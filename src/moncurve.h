@@ -18,6 +18,7 @@
 #define _MONCURVE_H
 
 #include "gfparith.h"
+#include "gfparith64.h"
 
 // projective points with coordinates [x, y, z] 
 typedef struct projective_point {
@@ -26,9 +27,31 @@ typedef struct projective_point {
   __m256i z[NWORDS];  // projective z coordinate
 } ProPoint;
 
+// at most this many scalar (radix-2^64) instances next to the four AVX2 
+// lanes of the hybrid ladder
+#define MON_HYBRID_MAXSCALAR 2
+
 // function prototypes
 void mon_ladder_step_avx2(ProPoint *p, ProPoint *q, const __m256i *xd);
+void mon_ladder_step_fused_avx2(ProPoint *p, ProPoint *q, const __m256i *xd);
 void mon_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x);
+void mon_mul_varbase_hybrid_avx2(__m256i *r, const __m256i *k, const __m256i *x,
+  uint64_t (*rs)[NWORDS64], const uint64_t (*ks)[NWORDS64], 
+  const uint64_t (*xs)[NWORDS64], const int ns);
 void mon_mul_fixbase_avx2(__m256i *r, const __m256i *k);
+void mon_mul_varbase_proj_avx2(__m256i *x2, __m256i *z2, const __m256i *k, 
+  const __m256i *x);
+void mon_mul_fixbase_proj_avx2(__m256i *x, __m256i *z, const __m256i *k);
+void mon_mul_fixbase_dirty_proj_avx2(__m256i *x, __m256i *z, const __m256i *k,
+  const __m256i c);
+void mon_ladder_step_1x4_avx2(__m256i *x, const __m256i *c);
+void mon_mul_varbase_1x4_avx2(__m256i *r, const uint8_t *k, const __m256i *x);
+void mon_mul_fixbase_1x4_avx2(__m256i *r, const uint8_t *k);
+void mon_ladder_step_2x2_avx2(__m256i *x, const __m256i *c);
+void mon_mul_varbase_2x2_avx2(__m256i *r, const __m256i *k, const __m256i *x);
+void mon_mul_fixbase_2x2_avx2(__m256i *r, const __m256i *k);
+void mon_elligator_map_proj_avx2(__m256i *x, __m256i *z, const __m256i *r);
+void mon_elligator_map_avx2(__m256i *u, const __m256i *r);
+__m256i mon_elligator_rev_avx2(__m256i *r, const __m256i *u, const __m256i b);
 
 #endif
@@ -0,0 +1,166 @@
+/**
+ *******************************************************************************
+ * @file moncurve448.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of point arithmetic on the Montgomery curve curve448.
+ *
+ * @details
+ * This file contains the (4*1)-way Montgomery ladder of X448 (RFC 7748) and
+ * the fixed-base scalar multiplication, which takes the comb on the Edwards
+ * curve Ed448 (tedcurve448.c) and maps the result with the 4-isogeny.
+ *******************************************************************************
+ */
+
+#include "moncurve448.h"
+#include "tedcurve448.h"
+
+
+/**
+ * @brief Montgomery ladder step.
+ *
+ * @details
+ * (P,Q) <- LadderStep(P,Q,pk)
+ * The same differential addition and doubling as mon_ladder_step_avx2, with
+ * a24 = 39081: x2 = AA*BB, z2 = E*(AA+a24*E), x3 = (DA+CB)^2 and z3 = xd*
+ * (DA-CB)^2. The field operations carry their results, so every difference
+ * can be squared.
+ *
+ * @param p Projective point
+ * @param q Projective point
+ * @param xd Field element
+ */
+void mon448_ladder_step_avx2(ProPoint448 *p, ProPoint448 *q, const __m256i *xd)
+{
+  __m256i a[NWORDS448], b[NWORDS448], c[NWORDS448], d[NWORDS448];
+  __m256i aa[NWORDS448], bb[NWORDS448], e[NWORDS448];
+
+  mpi28_gfp448_add_avx2(a, p->x, p->z);
+  mpi28_gfp448_sub_avx2(b, p->x, p->z);
+  mpi28_gfp448_add_avx2(c, q->x, q->z);
+  mpi28_gfp448_sub_avx2(d, q->x, q->z);
+  mpi28_gfp448_sqr_avx2(aa, a);
+  mpi28_gfp448_sqr_avx2(bb, b);
+  mpi28_gfp448_mul_avx2(d, d, a);             // DA
+  mpi28_gfp448_mul_avx2(c, c, b);             // CB
+  mpi28_gfp448_sub_avx2(e, aa, bb);
+  mpi28_gfp448_add_avx2(a, d, c);
+  mpi28_gfp448_sub_avx2(b, d, c);
+  mpi28_gfp448_sqr_avx2(q->x, a);
+  mpi28_gfp448_sqr_avx2(b, b);
+  mpi28_gfp448_mul_avx2(q->z, b, xd);
+  mpi28_gfp448_mul_avx2(p->x, aa, bb);
+  mpi28_gfp448_mul28_avx2(a, e, CONSTA24_448);
+  mpi28_gfp448_add_avx2(a, a, aa);
+  mpi28_gfp448_mul_avx2(p->z, a, e);
+}
+
+
+/**
+ * @brief Conditional swap (cswap) of two points.
+ *
+ * @details
+ * Replace (P,Q) with (Q,P) if b == 1;
+ * replace (P,Q) with (P,Q) if b == 0.
+ *
+ * @param p Projective point
+ * @param q Projective point
+ * @param b Swapping flag
+ */
+static void mon448_cswap_point_avx2(ProPoint448 *p, ProPoint448 *q, const __m256i b)
+{
+  const __m256i one = VSET164(1);
+  const __m256i cbit = VAND(b, one);
+
+  mpi28_cswap448_avx2(p->x, q->x, cbit);
+  mpi28_cswap448_avx2(p->z, q->z, cbit);
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * The x-coordinate of R = k * P with the 448-step Montgomery ladder, the
+ * scalar is pruned first (the two least significant bits are cleared and bit
+ * 447 is set).
+ *
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar
+ * @param x x-coordinate of point with affine coordinates
+ */
+void mon448_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x)
+{
+  ProPoint448 p1, p2;
+  __m256i b, s = VZERO, kp[NKWORDS448];
+  const __m256i t0 = VSET164(0xFFFFFFFCUL);
+  const __m256i t1 = VSET164(0x80000000UL);
+  int i;
+
+  // prune scalar k
+  for (i = 0; i < NKWORDS448; i++) kp[i] = k[i];
+  kp[0] = VAND(kp[0], t0);
+  kp[NKWORDS448-1] = VOR(kp[NKWORDS448-1], t1);
+
+  // initialize ladder
+  for (i = 0; i < NWORDS448; i++) {
+    p1.x[i] = p1.z[i] = p2.z[i] = VZERO;
+    p2.x[i] = x[i];
+  }
+  p1.x[0] = p2.z[0] = VSET164(1);
+
+  // main ladder loop
+  for (i = 447; i >= 0; i--) {
+    b = kp[i>>5];
+    b = VSHR(b, i&31);
+    s = VXOR(s, b);
+    mon448_cswap_point_avx2(&p1, &p2, s);
+    mon448_ladder_step_avx2(&p1, &p2, x);
+    s = b;
+  }
+  mon448_cswap_point_avx2(&p1, &p2, s);
+
+  // projective -> affine
+  mpi28_gfp448_inv_avx2(p1.z, p1.z);
+  mpi28_gfp448_mul_avx2(r, p1.x, p1.z);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xB, xB = 5.
+ * The comb on Ed448 computes k * B' for the Edwards point B' which the
+ * 4-isogeny of RFC 7748, u = y^2/x^2, maps to the base point u = 5, and so
+ * k * B' to k * 5, since the isogeny is a homomorphism. The Z of the
+ * projective point cancels, so u = Y^2/X^2 needs a single inversion.
+ *
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar
+ */
+void mon448_mul_fixbase_avx2(__m256i *r, const __m256i *k)
+{
+  ExtPoint448 h;
+  __m256i kp[NKWORDS448], t[NWORDS448];
+  const __m256i t0 = VSET164(0xFFFFFFFCUL);
+  const __m256i t1 = VSET164(0x80000000UL);
+  int i;
+
+  // prune scalar k
+  for (i = 0; i < NKWORDS448; i++) kp[i] = k[i];
+  kp[0] = VAND(kp[0], t0);
+  kp[NKWORDS448-1] = VOR(kp[NKWORDS448-1], t1);
+
+  ted448_mul_fixbase_avx2(&h, kp);
+
+  // u = (Y/Z)^2 / (X/Z)^2 = Y^2 / X^2
+  mpi28_gfp448_sqr_avx2(t, h.x);
+  mpi28_gfp448_inv_avx2(t, t);
+  mpi28_gfp448_sqr_avx2(r, h.y);
+  mpi28_gfp448_mul_avx2(r, r, t);
+}
@@ -0,0 +1,36 @@
+/**
+ *******************************************************************************
+ * @file moncurve448.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of point arithmetic on the Montgomery curve curve448.
+ *
+ * @details
+ * This file defines the struct of projective x-only points and contains the
+ * function prototypes of the X448 scalar multiplications (4-way, radix 2^28).
+ * The scalars are 14 32-bit words per lane, as the 8 words of X25519.
+ *******************************************************************************
+ */
+
+#ifndef _MONCURVE448_H
+#define _MONCURVE448_H
+
+#include "gfparith448.h"
+
+#define NKWORDS448 14
+
+// projective x-only points [x, z]
+typedef struct projective_point448 {
+  __m256i x[NWORDS448];  // projective x coordinate
+  __m256i z[NWORDS448];  // projective z coordinate
+} ProPoint448;
+
+// function prototypes
+void mon448_ladder_step_avx2(ProPoint448 *p, ProPoint448 *q, const __m256i *xd);
+void mon448_mul_varbase_avx2(__m256i *r, const __m256i *k, const __m256i *x);
+void mon448_mul_fixbase_avx2(__m256i *r, const __m256i *k);
+
+#endif
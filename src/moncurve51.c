@@ -0,0 +1,121 @@
+/**
+ *******************************************************************************
+ * @file moncurve51.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of portable point arithmetic on Montgomery curve.
+ *
+ * @details 
+ * This file contains (1*1)-way ladder step and variable-base scalar 
+ * multiplication. It is the fallback for CPUs without AVX2.
+ *******************************************************************************
+ */
+
+#include "moncurve51.h"
+
+
+/**
+ * @brief Montgomery ladder step.
+ *
+ * @details
+ * (P,Q) <- LadderStep(P,Q,pk)
+ * The Ladder-step contains a differential point addition and point doubling, 
+ * and it only operates on x- and z-coordinates of projective points.  
+ * 
+ * @param p Projective point 
+ * @param q Projective point 
+ * @param xd Field element
+ */
+void mon_ladder_step_c64(ProPoint51 *p, ProPoint51 *q, const uint64_t *xd)
+{
+  uint64_t tmp1[NWORDS51], tmp2[NWORDS51], tmp3[NWORDS51];
+
+  mpi51_gfp_add_c64(tmp1, p->x, p->z);      // A  = x2+z2
+  mpi51_gfp_sub_c64(p->x, p->x, p->z);      // B  = x2-z2
+  mpi51_gfp_add_c64(tmp2, q->x, q->z);      // C  = x3+z3
+  mpi51_gfp_sub_c64(q->x, q->x, q->z);      // D  = x3-z3
+  mpi51_gfp_mul_c64(q->z, q->x, tmp1);      // DA = D*A
+  mpi51_gfp_mul_c64(tmp2, tmp2, p->x);      // CB = C*B
+  mpi51_gfp_sqr_c64(tmp1, tmp1);            // AA = A^2
+  mpi51_gfp_sqr_c64(p->x, p->x);            // BB = B^2
+  mpi51_gfp_add_c64(tmp3, q->z, tmp2);      
+  mpi51_gfp_sqr_c64(q->x, tmp3);            // x3 = (DA+CB)^2
+  mpi51_gfp_sub_c64(tmp3, q->z, tmp2);      
+  mpi51_gfp_sqr_c64(tmp3, tmp3);
+  mpi51_gfp_mul_c64(q->z, tmp3, xd);        // z3 = x1*(DA-CB)^2
+  mpi51_gfp_sub_c64(tmp2, tmp1, p->x);      // E  = AA-BB
+  mpi51_gfp_mul51_c64(tmp3, tmp2, (CONSTA-2)/4);
+  mpi51_gfp_add_c64(tmp3, tmp3, tmp1);      
+  mpi51_gfp_mul_c64(p->z, tmp3, tmp2);      // z2 = E*(AA+a24*E)
+  mpi51_gfp_mul_c64(p->x, p->x, tmp1);      // x2 = AA*BB
+}
+
+
+/**
+ * @brief Conditional swap (cswap) of two points.
+ *
+ * @details
+ * Replace (P,Q) with (Q,P) if b == 1;
+ * replace (P,Q) with (P,Q) if b == 0.
+ * 
+ * @param p Projective point
+ * @param q Projective point
+ * @param b Swapping flag
+ */
+static void mon_cswap_point_c64(ProPoint51 *p, ProPoint51 *q, const uint64_t b)
+{
+  mpi51_cswap_c64(p->x, q->x, b & 1);
+  mpi51_cswap_c64(p->z, q->z, b & 1);
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * This function computes only the x-coordinate of R = k * P, where R and P are
+ * points with affine coordinates. The scalar k is a 32-byte little-endian 
+ * string, which is pruned as specified in RFC 7748.
+ * 
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar 
+ * @param x x-coordinate of point with affine coordinates
+ */
+void mon_mul_varbase_c64(uint64_t *r, const uint8_t *k, const uint64_t *x)
+{
+  ProPoint51 p1, p2;
+  uint64_t b, s = 0, t[NWORDS51];
+  uint8_t kp[32];
+  int i;
+
+  // prune scalar k
+  for (i = 0; i < 32; i++) kp[i] = k[i];
+  kp[0] &= 0xF8;
+  kp[31] &= 0x7F;
+  kp[31] |= 0x40;
+
+  // initialize ladder
+  for (i = 0; i < NWORDS51; i++) {
+    p1.x[i] = p1.z[i] = p2.z[i] = 0;
+    p2.x[i] = x[i];
+  }
+  p1.x[0] = p2.z[0] = 1;
+
+  // main ladder loop
+  for (i = 254; i >= 0; i--) {
+    b = (kp[i>>3] >> (i&7)) & 1;
+    s ^= b;
+    mon_cswap_point_c64(&p1, &p2, s);
+    mon_ladder_step_c64(&p1, &p2, x);
+    s = b;
+  }
+  mon_cswap_point_c64(&p1, &p2, s);
+
+  // projective -> affine
+  mpi51_gfp_inv_c64(t, p1.z);
+  mpi51_gfp_mul_c64(r, t, p1.x);
+}
@@ -0,0 +1,32 @@
+/**
+ *******************************************************************************
+ * @file moncurve51.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of portable point arithmetic on Montgomery curve.
+ *
+ * @details 
+ * This file defines the struct of projective point and contains function 
+ * prototypes of (1*1)-way point arithmetic on Montgomery curve. 
+ *******************************************************************************
+ */
+
+#ifndef _MONCURVE51_H
+#define _MONCURVE51_H
+
+#include "gfparith51.h"
+
+// projective points with coordinates [x, z] 
+typedef struct projective_point51 {
+  uint64_t x[NWORDS51];  // projective x coordinate
+  uint64_t z[NWORDS51];  // projective z coordinate
+} ProPoint51;
+
+// function prototypes
+void mon_ladder_step_c64(ProPoint51 *p, ProPoint51 *q, const uint64_t *xd);
+void mon_mul_varbase_c64(uint64_t *r, const uint8_t *k, const uint64_t *x);
+
+#endif
@@ -0,0 +1,207 @@
+/**
+ *******************************************************************************
+ * @file moncurve512.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of AVX-512IFMA point arithmetic on Montgomery curve.
+ *
+ * @details 
+ * This file contains (8*1)-way parallel point operations on Montgomery curve. 
+ *******************************************************************************
+ */
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__)
+
+#include "moncurve512.h"
+#include "tedcurve512.h"
+
+
+/**
+ * @brief Montgomery ladder step.
+ *
+ * @details
+ * (P,Q) <- LadderStep(P,Q,pk)
+ * The Ladder-step contains a differential point addition and point doubling, 
+ * and it only operates on x- and z-coordinates of projective points.  
+ * 
+ * @param p Projective point 
+ * @param q Projective point 
+ * @param xd Field element
+ */
+void mon_ladder_step_avx512(ProPoint512 *p, ProPoint512 *q, const __m512i *xd)
+{
+  // we use y-coordinate as tmp1, tmp2
+  __m512i *tmp1 = p->y, *tmp2 = q->y;
+
+  mpi52_gfp_add_avx512(tmp1, p->x, p->z);
+  mpi52_gfp_sub_avx512(p->x, p->x, p->z);
+  mpi52_gfp_add_avx512(tmp2, q->x, q->z);
+  mpi52_gfp_sub_avx512(q->x, q->x, q->z);
+  mpi52_gfp_sqr_avx512(p->z, tmp1);
+  mpi52_gfp_mul_avx512(q->z, tmp2, p->x);
+  mpi52_gfp_mul_avx512(tmp2, q->x, tmp1);
+  mpi52_gfp_sqr_avx512(tmp1, p->x);
+  mpi52_gfp_mul_avx512(p->x, p->z, tmp1);
+  mpi52_gfp_sub_avx512(tmp1, p->z, tmp1);
+  mpi52_gfp_mul52_avx512(q->x, tmp1, (CONSTA-2)/4);
+  mpi52_gfp_add_avx512(q->x, q->x, p->z);
+  mpi52_gfp_mul_avx512(p->z, q->x, tmp1);
+  mpi52_gfp_add_avx512(tmp1, tmp2, q->z);
+  mpi52_gfp_sqr_avx512(q->x, tmp1);
+  mpi52_gfp_sub_avx512(tmp1, tmp2, q->z);
+  mpi52_gfp_sqr_avx512(tmp2, tmp1);
+  mpi52_gfp_mul_avx512(q->z, tmp2, xd);
+}
+
+
+/**
+ * @brief Conditional swap (cswap) of two points.
+ *
+ * @details
+ * Replace (P,Q) with (Q,P) if b == 1;
+ * replace (P,Q) with (P,Q) if b == 0.
+ * Depending on a boolean value that is passed as argument to the function,
+ * the two points are either swapped or not swapped. 
+ * 
+ * @param p Projective point
+ * @param q Projective point
+ * @param b Swapping flag
+ */
+static void mon_cswap_point_avx512(ProPoint512 *p, ProPoint512 *q, const __m512i b)
+{
+  const __m512i one = ZSET164(1);
+  const __m512i cbit = ZAND(b, one);
+
+  mpi52_cswap_avx512(p->x, q->x, cbit);
+  mpi52_cswap_avx512(p->z, q->z, cbit);
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication in projective coordinates.
+ *
+ * @details
+ * (x2 : z2) = k * xP.
+ * The Montgomery ladder without the final inversion, so that the caller can 
+ * invert the z-coordinates of several calls at once (see batchinv). 
+ * 
+ * @param x2 Projective x-coordinate of R
+ * @param z2 Projective z-coordinate of R
+ * @param k scalar 
+ * @param x x-coordinate of point with affine coordinates
+ */
+void mon_mul_varbase_proj_avx512(__m512i *x2, __m512i *z2, const __m512i *k, 
+  const __m512i *x)
+{
+  ProPoint512 p1, p2;
+  __m512i b, s = ZZERO, kp[8];
+  const __m512i t0 = ZSET164(0xFFFFFFF8UL);
+  const __m512i t1 = ZSET164(0x7FFFFFFFUL);
+  const __m512i t2 = ZSET164(0x40000000UL);
+  int i;
+
+  // prune scalar k
+  for (i = 0; i < 8; i++) kp[i] = k[i];
+  kp[0] = ZAND(kp[0], t0);
+  kp[7] = ZAND(kp[7], t1);
+  kp[7] = ZOR(kp[7], t2);
+
+  // initialize ladder
+  for (i = 0; i < NWORDS52; i++) {
+    p1.x[i] = p1.z[i] = p2.z[i] = ZZERO;
+    p2.x[i] = x[i];
+  }
+  p1.x[0] = p2.z[0] = ZSET164(1);
+
+  // main ladder loop
+  for (i = 254; i >= 0; i--) {
+    b = kp[i>>5];
+    b = ZSHR(b, i&31);
+    s = ZXOR(s, b);
+    mon_cswap_point_avx512(&p1, &p2, s);
+    mon_ladder_step_avx512(&p1, &p2, x);
+    s = b;
+  }
+  mon_cswap_point_avx512(&p1, &p2, s);
+
+  for (i = 0; i < NWORDS52; i++) {
+    x2[i] = p1.x[i];
+    z2[i] = p1.z[i];
+  }
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * This function computes only the x-coordinate of R = k * P, where R and P are
+ * points with affine coordinates. This is the core operation of ECDH shared 
+ * secret phase. 
+ * 
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar 
+ * @param x x-coordinate of point with affine coordinates
+ */
+void mon_mul_varbase_avx512(__m512i *r, const __m512i *k, const __m512i *x)
+{
+  __m512i z[NWORDS52];
+
+  mon_mul_varbase_proj_avx512(r, z, k, x);
+
+  // projective -> affine
+  mpi52_gfp_inv_avx512(z, z);
+  mpi52_gfp_mul_avx512(r, r, z);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication in projective coordinates.
+ *
+ * @details
+ * (x : z) = k * B.
+ * Map the result of the fixed-base scalar multiplication on twisted Edwards 
+ * curve to the projective x-coordinate u = (z+y) : (z-y) on Montgomery curve,
+ * without the final inversion.
+ * 
+ * @param x Projective x-coordinate of R
+ * @param z Projective z-coordinate of R
+ * @param k Scalar 
+ */
+void mon_mul_fixbase_proj_avx512(__m512i *x, __m512i *z, const __m512i *k)
+{
+  ProPoint512 p;
+
+  ted_mul_fixbase_avx512(&p, k);
+  mpi52_gfp_sub_avx512(z, p.z, p.y);
+  mpi52_gfp_add_avx512(x, p.z, p.y);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication on Montgomery curve.
+ *
+ * @details
+ * R = k * B.
+ * Take advantage of fixed-base scalar multiplication on twsited Edwards curve 
+ * and then map the projective points to Montgomery curve. Finally output the 
+ * x-coordinate of R on Montgomery curve.
+ * 
+ * @param r Projective point 
+ * @param k Scalar 
+ */
+void mon_mul_fixbase_avx512(__m512i *r, const __m512i *k)
+{
+  __m512i z[NWORDS52];
+
+  mon_mul_fixbase_proj_avx512(r, z, k);
+  // from twisted Edwards curve to Montgomery curve u = (z+y)/(z-y)
+  mpi52_gfp_inv_avx512(z, z);
+  mpi52_gfp_mul_avx512(r, r, z);
+}
+
+#endif
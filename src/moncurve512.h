@@ -0,0 +1,37 @@
+/**
+ *******************************************************************************
+ * @file moncurve512.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of AVX-512IFMA point arithmetic on Montgomery curve.
+ *
+ * @details 
+ * This file defines the struct of 8-way projective point and contains function 
+ * prototypes of points arithmetic on Montgomery curve. 
+ *******************************************************************************
+ */
+
+#ifndef _MONCURVE512_H
+#define _MONCURVE512_H
+
+#include "gfparith512.h"
+
+// projective points with coordinates [x, y, z] 
+typedef struct projective_point512 {
+  __m512i x[NWORDS52];  // projective x coordinate
+  __m512i y[NWORDS52];  // projective y coordinate
+  __m512i z[NWORDS52];  // projective z coordinate
+} ProPoint512;
+
+// function prototypes
+void mon_ladder_step_avx512(ProPoint512 *p, ProPoint512 *q, const __m512i *xd);
+void mon_mul_varbase_avx512(__m512i *r, const __m512i *k, const __m512i *x);
+void mon_mul_fixbase_avx512(__m512i *r, const __m512i *k);
+void mon_mul_varbase_proj_avx512(__m512i *x2, __m512i *z2, const __m512i *k, 
+  const __m512i *x);
+void mon_mul_fixbase_proj_avx512(__m512i *x, __m512i *z, const __m512i *k);
+
+#endif
@@ -0,0 +1,158 @@
+/**
+ *******************************************************************************
+ * @file moncurveneon.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of NEON point arithmetic on Montgomery curve.
+ *
+ * @details
+ * This file contains (2*1)-way parallel point operations on Montgomery curve.
+ * There is no table of the fixed-base in this version (the comb of tedcurve.c
+ * queries its table with AVX2 permutations), the key generation is the
+ * ladder with u = 9 as in the portable version.
+ *******************************************************************************
+ */
+
+#if defined(__ARM_NEON)
+
+#include "moncurveneon.h"
+
+
+/**
+ * @brief Montgomery ladder step.
+ *
+ * @details
+ * (P,Q) <- LadderStep(P,Q,pk)
+ * The Ladder-step contains a differential point addition and point doubling,
+ * and it only operates on x- and z-coordinates of projective points. The
+ * sequence of field operations (and thus the bounds of the limbs) is the one
+ * of mon_ladder_step_avx2.
+ *
+ * @param p Projective point
+ * @param q Projective point
+ * @param xd Field element
+ */
+void mon_ladder_step_neon(ProPointNeon *p, ProPointNeon *q, const uint64x2_t *xd)
+{
+  // we use y-coordinate as tmp1, tmp2
+  uint64x2_t *tmp1 = p->y, *tmp2 = q->y;
+
+  mpi29_gfp_add_neon(tmp1, p->x, p->z);
+  mpi29_gfp_sbc_neon(p->x, p->x, p->z);
+  mpi29_gfp_add_neon(tmp2, q->x, q->z);
+  mpi29_gfp_sub_neon(q->x, q->x, q->z);
+  mpi29_gfp_sqr_neon(p->z, tmp1);
+  mpi29_gfp_mul_neon(q->z, tmp2, p->x);
+  mpi29_gfp_mul_neon(tmp2, q->x, tmp1);
+  mpi29_gfp_sqr_neon(tmp1, p->x);
+  mpi29_gfp_mul_neon(p->x, p->z, tmp1);
+  mpi29_gfp_sub_neon(tmp1, p->z, tmp1);
+  mpi29_gfp_mul29_neon(q->x, tmp1, (CONSTA-2)/4);
+  mpi29_gfp_add_neon(q->x, q->x, p->z);
+  mpi29_gfp_mul_neon(p->z, q->x, tmp1);
+  mpi29_gfp_add_neon(tmp1, tmp2, q->z);
+  mpi29_gfp_sqr_neon(q->x, tmp1);
+  mpi29_gfp_sbc_neon(tmp1, tmp2, q->z);
+  mpi29_gfp_sqr_neon(tmp2, tmp1);
+  mpi29_gfp_mul_neon(q->z, tmp2, xd);
+}
+
+
+/**
+ * @brief Conditional swap (cswap) of two points.
+ *
+ * @details
+ * Replace (P,Q) with (Q,P) if b == 1;
+ * replace (P,Q) with (P,Q) if b == 0.
+ * Depending on a boolean value that is passed as argument to the function,
+ * the two points are either swapped or not swapped.
+ *
+ * @param p Projective point
+ * @param q Projective point
+ * @param b Swapping flag
+ */
+static void mon_cswap_point_neon(ProPointNeon *p, ProPointNeon *q, const uint64x2_t b)
+{
+  const uint64x2_t one = NSET164(1);
+  const uint64x2_t cbit = NAND(b, one);
+
+  mpi29_cswap_neon(p->x, q->x, cbit);
+  mpi29_cswap_neon(p->z, q->z, cbit);
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication.
+ *
+ * @details
+ * xR = k * xP.
+ * This function computes only the x-coordinate of R = k * P, where R and P are
+ * points with affine coordinates. The scalar holds the eight 32-bit words of
+ * the private keys in the two 64-bit lanes (as the AVX2 version).
+ *
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar
+ * @param x x-coordinate of point with affine coordinates
+ */
+void mon_mul_varbase_neon(uint64x2_t *r, const uint64x2_t *k, const uint64x2_t *x)
+{
+  ProPointNeon p1, p2;
+  uint64x2_t b, s = NZERO, kp[8];
+  const uint64x2_t t0 = NSET164(0xFFFFFFF8UL);
+  const uint64x2_t t1 = NSET164(0x7FFFFFFFUL);
+  const uint64x2_t t2 = NSET164(0x40000000UL);
+  int i;
+
+  // prune scalar k
+  for (i = 0; i < 8; i++) kp[i] = k[i];
+  kp[0] = NAND(kp[0], t0);
+  kp[7] = NAND(kp[7], t1);
+  kp[7] = NOR(kp[7], t2);
+
+  // initialize ladder
+  for (i = 0; i < NWORDS; i++) {
+    p1.x[i] = p1.z[i] = p2.z[i] = NZERO;
+    p2.x[i] = x[i];
+  }
+  p1.x[0] = p2.z[0] = NSET164(1);
+
+  // main ladder loop
+  for (i = 254; i >= 0; i--) {
+    b = NSHRV(kp[i>>5], i&31);
+    s = NXOR(s, b);
+    mon_cswap_point_neon(&p1, &p2, s);
+    mon_ladder_step_neon(&p1, &p2, x);
+    s = b;
+  }
+  mon_cswap_point_neon(&p1, &p2, s);
+
+  // projective -> affine
+  mpi29_gfp_inv_neon(p1.z, p1.z);
+  mpi29_gfp_mul_neon(r, p1.x, p1.z);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication.
+ *
+ * @details
+ * xR = k * 9.
+ * The ladder with the base point u = 9.
+ *
+ * @param r x-coordinate of point with affine coordinates
+ * @param k scalar
+ */
+void mon_mul_fixbase_neon(uint64x2_t *r, const uint64x2_t *k)
+{
+  uint64x2_t u[NWORDS];
+  int i;
+
+  for (i = 0; i < NWORDS; i++) u[i] = NZERO;
+  u[0] = NSET164(9);
+  mon_mul_varbase_neon(r, k, u);
+}
+
+#endif
@@ -0,0 +1,34 @@
+/**
+ *******************************************************************************
+ * @file moncurveneon.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of NEON point arithmetic on Montgomery curve.
+ *
+ * @details 
+ * This file defines the struct of 2-way projective point and contains function 
+ * prototypes of points arithmetic on Montgomery curve. 
+ *******************************************************************************
+ */
+
+#ifndef _MONCURVENEON_H
+#define _MONCURVENEON_H
+
+#include "gfparithneon.h"
+
+// projective points with coordinates [x, y, z] 
+typedef struct projective_point_neon {
+  uint64x2_t x[NWORDS];  // projective x coordinate
+  uint64x2_t y[NWORDS];  // projective y coordinate
+  uint64x2_t z[NWORDS];  // projective z coordinate
+} ProPointNeon;
+
+// function prototypes
+void mon_ladder_step_neon(ProPointNeon *p, ProPointNeon *q, const uint64x2_t *xd);
+void mon_mul_varbase_neon(uint64x2_t *r, const uint64x2_t *k, const uint64x2_t *x);
+void mon_mul_fixbase_neon(uint64x2_t *r, const uint64x2_t *k);
+
+#endif
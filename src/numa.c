@@ -0,0 +1,225 @@
+/**
+ *******************************************************************************
+ * @file numa.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the placement of the fixed-base tables.
+ *
+ * @details
+ * On a multi-socket machine the global tables of the comb live on one node,
+ * and the threads of the other nodes fetch every query over the interconnect.
+ * numa_replicate_tables copies both tables into one region per node: the
+ * region is a multiple of 2 MB and 2 MB aligned, it is taken from hugetlbfs
+ * if pages are reserved and otherwise advised for transparent huge pages,
+ * and it is bound to its node with mbind before it is written, so its pages
+ * are allocated there. A thread then points its table pointers (fixbase and
+ * fixbase29 of tedcurve.h) at the replica of the node it runs on. The
+ * replicas are read-only and kept until the process exits, since threads
+ * may still read them. Linux on x86-64 only (elsewhere no replica is made,
+ * the tables belong to the AVX2 comb).
+ *******************************************************************************
+ */
+
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+#define _GNU_SOURCE
+#endif
+
+#include "numa.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__linux__) && defined(__x86_64__)
+#define NUMA_REPLICAS
+#include "tedcurve.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#define HUGE_2MB (2L << 20)
+
+static NumaInfo info;
+
+#if defined(NUMA_REPLICAS)
+
+// replicas of the nodes (NULL if the node has none), written once
+static const uint8_t *replica[NUMA_MAXNODES];
+
+// the limb table is first (32-byte aligned rows), the LutPoints follow
+#define LIMBS_BYTES ((long)sizeof(base29))
+#define DUIF_BYTES ((long)sizeof(base))
+
+
+/**
+ * @brief Number of NUMA nodes.
+ *
+ * @details
+ * Parse the highest node of /sys/devices/system/node/online (e.g. "0-1").
+ *
+ * @return Number of nodes (1 if unknown)
+ */
+static int node_count(void)
+{
+  FILE *f = fopen("/sys/devices/system/node/online", "r");
+  char buf[256], *p;
+  int n = 0, v;
+
+  if (f == NULL) return 1;
+  if (fgets(buf, sizeof(buf), f) != NULL) {
+    for (p = buf; *p; ) {
+      if ((*p >= '0') && (*p <= '9')) {
+        for (v = 0; (*p >= '0') && (*p <= '9'); p++) v = 10*v + (*p - '0');
+        if (v + 1 > n) n = v + 1;
+      }
+      else p++;
+    }
+  }
+  fclose(f);
+  return (n < 1) ? 1 : (n > NUMA_MAXNODES) ? NUMA_MAXNODES : n;
+}
+
+
+/**
+ * @brief Allocate a region that is backed by 2 MB pages.
+ *
+ * @details
+ * Try hugetlbfs first, then an over-allocated anonymous mapping that is
+ * trimmed to a 2 MB aligned region and advised for transparent huge pages.
+ *
+ * @param len Length (a multiple of 2 MB)
+ * @param huge Set to 1 if the region is in huge pages (hugetlbfs or THP)
+ * @return Region, or NULL
+ */
+static uint8_t *alloc_huge(long len, int *huge)
+{
+  uint8_t *p, *q;
+  uintptr_t a;
+
+#if defined(MAP_HUGETLB)
+  p = (uint8_t *)mmap(NULL, (size_t)len, PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (p != MAP_FAILED) { *huge = 1; return p; }
+#endif
+  p = (uint8_t *)mmap(NULL, (size_t)(len + HUGE_2MB), PROT_READ | PROT_WRITE,
+    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (p == MAP_FAILED) return NULL;
+  a = ((uintptr_t)p + HUGE_2MB - 1) & ~(uintptr_t)(HUGE_2MB - 1);
+  q = (uint8_t *)a;
+  if (q > p) munmap(p, (size_t)(q - p));
+  munmap(q + len, (size_t)(p + HUGE_2MB - q));
+#if defined(MADV_HUGEPAGE)
+  *huge = (madvise(q, (size_t)len, MADV_HUGEPAGE) == 0);
+#else
+  *huge = 0;
+#endif
+  return q;
+}
+
+
+/**
+ * @brief Bind a region to a NUMA node.
+ *
+ * @details
+ * mbind(MPOL_BIND) without libnuma; it fails (and the pages are allocated
+ * where they are first written) if the kernel or the container does not
+ * allow it.
+ *
+ * @param p Region
+ * @param len Length
+ * @param node Node
+ * @return 1 if bound, 0 otherwise
+ */
+static int bind_node(uint8_t *p, long len, int node)
+{
+#if defined(SYS_mbind)
+  unsigned long mask[NUMA_MAXNODES/(8*sizeof(unsigned long))];
+  const int mpol_bind = 2;
+
+  memset(mask, 0, sizeof(mask));
+  mask[node/(8*sizeof(unsigned long))] = 1UL << (node % (8*sizeof(unsigned long)));
+  return syscall(SYS_mbind, p, (unsigned long)len, mpol_bind, mask,
+    (unsigned long)NUMA_MAXNODES + 1, 0UL) == 0;
+#else
+  (void)p; (void)len; (void)node;
+  return 0;
+#endif
+}
+
+#endif
+
+
+/**
+ * @brief Replicate the fixed-base tables on every NUMA node.
+ *
+ * @details
+ * Allocate and fill one replica per node (see the file description). It must
+ * be called before the threads that bind to the replicas run, a second call
+ * does nothing.
+ *
+ * @return Number of nodes with a replica (0 if none could be made)
+ */
+int numa_replicate_tables(void)
+{
+#if defined(NUMA_REPLICAS)
+  const long len = (LIMBS_BYTES + DUIF_BYTES + HUGE_2MB - 1) & ~(HUGE_2MB - 1);
+  uint8_t *p;
+  int n, i, huge;
+
+  if (info.nodes > 0) return info.nodes;
+  n = node_count();
+  for (i = 0; i < n; i++) {
+    p = alloc_huge(len, &huge);
+    if (p == NULL) continue;
+    info.bound += bind_node(p, len, i);
+    info.huge += huge;
+    memcpy(p, base29, (size_t)LIMBS_BYTES);
+    memcpy(p + LIMBS_BYTES, base, (size_t)DUIF_BYTES);
+    mprotect(p, (size_t)len, PROT_READ);
+    replica[i] = p;
+    info.nodes++;
+  }
+  info.bytes = len;
+  return info.nodes;
+#else
+  return 0;
+#endif
+}
+
+
+/**
+ * @brief Point the calling thread at the replica of its node.
+ *
+ * @details
+ * The node is the one of the CPU that the thread runs on at the call, so a
+ * thread should be pinned first (the workers of the engine are). Without a
+ * replica of the node the thread keeps the global tables.
+ */
+void numa_bind_thread(void)
+{
+#if defined(NUMA_REPLICAS) && defined(SYS_getcpu)
+  unsigned int cpu = 0, node = 0;
+  const uint8_t *p;
+
+  if (info.nodes == 0) return;
+  if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0) return;
+  p = (node < NUMA_MAXNODES) ? replica[node] : NULL;
+  if (p == NULL) return;
+  fixbase29 = (const uint32_t (*)[3][NWORDS][FIXBASE_K])p;
+  fixbase = (const LutPoint (*)[FIXBASE_K])(p + LIMBS_BYTES);
+#endif
+}
+
+
+/**
+ * @brief Placement of the replicas.
+ *
+ * @param i Information (all zero without replicas)
+ */
+void numa_get_info(NumaInfo *i)
+{
+  *i = info;
+}
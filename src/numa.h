@@ -0,0 +1,39 @@
+/**
+ *******************************************************************************
+ * @file numa.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the placement of the fixed-base tables.
+ *
+ * @details
+ * This file contains function prototypes to replicate the tables of the
+ * fixed-base comb (base and base29) on every NUMA node, in memory that is
+ * backed by 2 MB pages, and to point a thread at the replica of its node.
+ * Without replicas (the default) all threads read the global tables.
+ *******************************************************************************
+ */
+
+#ifndef _NUMA_H
+#define _NUMA_H
+
+// maximum number of NUMA nodes with a replica
+#define NUMA_MAXNODES 64
+
+// placement of the replicas
+typedef struct numa_info {
+  int nodes;      // number of nodes with a replica (0: global tables)
+  int huge;       // number of replicas in 2 MB pages (hugetlbfs or THP)
+  int bound;      // number of replicas bound to their node (mbind)
+  long bytes;     // bytes of a replica (a multiple of 2 MB)
+} NumaInfo;
+
+// function prototypes
+
+int numa_replicate_tables(void);
+void numa_bind_thread(void);
+void numa_get_info(NumaInfo *info);
+
+#endif
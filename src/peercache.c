@@ -0,0 +1,410 @@
+/**
+ *******************************************************************************
+ * @file peercache.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the cache of per-peer tables.
+ *
+ * @details
+ * The cache is a hash table of the public keys with a doubly linked list in
+ * the order of the last use. A batch is processed in chunks: the tables of a
+ * chunk are looked up (and pinned) under the lock, the missing tables are
+ * computed four at a time without the lock, and the shared secrets are
+ * computed with x25519_sharedsecret_peer_n_avx2. Public keys on the twist
+ * have no table, their entry only records that they need the ladder. Pinned
+ * tables are never evicted. This file is compiled without vector extensions,
+ * the AVX2 kernels are only called if the CPU supports them (on aarch64 the
+ * cache is not built and every shared secret is a ladder).
+ *******************************************************************************
+ */
+
+#include "peercache.h"
+#if defined(__x86_64__)
+#include "tedcurve.h"
+#else
+typedef struct peer_table PeerTable;
+#endif
+#include "ecdh.h"
+#include "x25519.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// number of shared secrets that are looked up and computed at once
+#define CHUNK (4*X25519_MAXGROUPS)
+
+// cached public key
+typedef struct peer_entry {
+  uint8_t pk[32];
+  PeerTable *table;           // NULL if the key is on the twist
+  int pins;                   // shared secrets in progress with the table
+  struct peer_entry *prev;    // more recently used entry
+  struct peer_entry *next;    // less recently used entry
+  struct peer_entry *chain;   // next entry of the hash bucket
+} PeerEntry;
+
+struct peer_cache {
+  pthread_mutex_t lock;
+  size_t capacity;            // maximum number of entries
+  size_t nbuckets;            // power of 2
+  PeerEntry **buckets;
+  PeerEntry *head, *tail;     // most and least recently used entry
+  int avx2;                   // AVX2 kernels are supported
+  PeerCacheStats stats;
+};
+
+
+/**
+ * @brief Free an entry.
+ *
+ * @param e Entry
+ */
+static void free_entry(PeerEntry *e)
+{
+  free(e->table);
+  free(e);
+}
+
+
+/**
+ * @brief Create a cache.
+ *
+ * @details
+ * A table takes peercache_table_size() bytes.
+ *
+ * @param capacity Maximum number of cached public keys
+ * @return Cache, or NULL if there is not enough memory
+ */
+PeerCache *peercache_create(size_t capacity)
+{
+  PeerCache *c = (PeerCache *)calloc(1, sizeof(PeerCache));
+
+  if (c == NULL) return NULL;
+  c->capacity = capacity;
+  for (c->nbuckets = 16; c->nbuckets < capacity; c->nbuckets <<= 1);
+  c->buckets = (PeerEntry **)calloc(c->nbuckets, sizeof(PeerEntry *));
+  if (c->buckets == NULL) { free(c); return NULL; }
+  c->avx2 = (x25519_impl_by_id(X25519_AVX2) != NULL);
+  pthread_mutex_init(&c->lock, NULL);
+  return c;
+}
+
+
+/**
+ * @brief Destroy a cache.
+ *
+ * @details
+ * No shared secret may be in progress.
+ *
+ * @param c Cache
+ */
+void peercache_destroy(PeerCache *c)
+{
+  PeerEntry *e, *next;
+
+  if (c == NULL) return;
+  for (e = c->head; e != NULL; e = next) {
+    next = e->next;
+    free_entry(e);
+  }
+  pthread_mutex_destroy(&c->lock);
+  free(c->buckets);
+  free(c);
+}
+
+
+#if defined(__x86_64__)
+
+/**
+ * @brief Hash of a public key (FNV-1a).
+ *
+ * @param pk Public key
+ * @return Hash
+ */
+static uint64_t hash_key(const uint8_t *pk)
+{
+  uint64_t h = 0xCBF29CE484222325ULL;
+  int i;
+
+  for (i = 0; i < 32; i++) h = (h ^ pk[i]) * 0x100000001B3ULL;
+  return h;
+}
+
+
+/**
+ * @brief Find the entry of a public key.
+ *
+ * @param c Cache
+ * @param pk Public key
+ * @return Entry, or NULL if the key is not cached
+ */
+static PeerEntry *lookup(PeerCache *c, const uint8_t *pk)
+{
+  PeerEntry *e = c->buckets[hash_key(pk) & (c->nbuckets-1)];
+
+  while ((e != NULL) && memcmp(e->pk, pk, 32)) e = e->chain;
+  return e;
+}
+
+
+/**
+ * @brief Remove an entry from the list.
+ *
+ * @param c Cache
+ * @param e Entry
+ */
+static void unlink_entry(PeerCache *c, PeerEntry *e)
+{
+  if (e->prev != NULL) e->prev->next = e->next;
+  else c->head = e->next;
+  if (e->next != NULL) e->next->prev = e->prev;
+  else c->tail = e->prev;
+}
+
+
+/**
+ * @brief Put an entry at the front of the list (most recently used).
+ *
+ * @param c Cache
+ * @param e Entry
+ */
+static void push_front(PeerCache *c, PeerEntry *e)
+{
+  e->prev = NULL;
+  e->next = c->head;
+  if (c->head != NULL) c->head->prev = e;
+  else c->tail = e;
+  c->head = e;
+}
+
+
+/**
+ * @brief Evict the least recently used entries that are not pinned.
+ *
+ * @param c Cache (locked)
+ */
+static void evict(PeerCache *c)
+{
+  PeerEntry *e = c->tail, *prev, **b;
+
+  while ((c->stats.entries > c->capacity) && (e != NULL)) {
+    prev = e->prev;
+    if (e->pins == 0) {
+      for (b = &c->buckets[hash_key(e->pk) & (c->nbuckets-1)]; *b != e; b = &(*b)->chain);
+      *b = e->chain;
+      unlink_entry(c, e);
+      free_entry(e);
+      c->stats.entries--;
+      c->stats.evictions++;
+    }
+    e = prev;
+  }
+}
+
+
+/**
+ * @brief Look up the tables of a chunk and compute the missing ones.
+ *
+ * @details
+ * e[i] is the pinned entry of the i-th key, or NULL if no entry could be
+ * allocated.
+ *
+ * @param c Cache
+ * @param e Entries
+ * @param pkb Public keys
+ * @param n Number of keys (n <= CHUNK)
+ */
+static void acquire(PeerCache *c, PeerEntry **e, const uint8_t pkb[][32], size_t n)
+{
+  PeerEntry *add[CHUNK], *x;
+  PeerTable *t[4];
+  uint8_t pk[4][32];
+  int slot[CHUNK], na = 0, i, j, k, valid;
+
+  pthread_mutex_lock(&c->lock);
+  for (i = 0; i < (int)n; i++) {
+    e[i] = lookup(c, pkb[i]);
+    if (e[i] == NULL) continue;
+    e[i]->pins++;
+    unlink_entry(c, e[i]);
+    push_front(c, e[i]);
+    if (e[i]->table != NULL) c->stats.hits++;
+  }
+  pthread_mutex_unlock(&c->lock);
+
+  // new entries of the distinct missing keys
+  for (i = 0; i < (int)n; i++) {
+    slot[i] = -1;
+    if (e[i] != NULL) continue;
+    for (k = 0; (k < na) && memcmp(add[k]->pk, pkb[i], 32); k++);
+    if (k == na) {
+      add[na] = (PeerEntry *)calloc(1, sizeof(PeerEntry));
+      if (add[na] == NULL) continue;
+      add[na]->table = (PeerTable *)aligned_alloc(32, sizeof(PeerTable));
+      if (add[na]->table == NULL) { free(add[na]); continue; }
+      memcpy(add[na]->pk, pkb[i], 32);
+      na++;
+    }
+    slot[i] = k;
+  }
+
+  // their tables, four at a time (the last key is repeated)
+  for (k = 0; k < na; k += 4) {
+    for (j = 0; j < 4; j++) {
+      x = add[(k+j < na) ? k+j : na-1];
+      t[j] = x->table;
+      memcpy(pk[j], x->pk, 32);
+    }
+    valid = x25519_peer_table_avx2(t, (const uint8_t (*)[32])pk);
+    for (j = 0; (j < 4) && (k+j < na); j++)
+      if ((valid < 0) || !((valid >> j) & 1)) {
+        free(add[k+j]->table);
+        add[k+j]->table = NULL;
+      }
+  }
+
+  // insert them, unless another thread was faster
+  pthread_mutex_lock(&c->lock);
+  for (k = 0; k < na; k++) {
+    x = lookup(c, add[k]->pk);
+    if (x != NULL) {
+      free_entry(add[k]);
+      add[k] = x;
+      continue;
+    }
+    x = add[k];
+    x->chain = c->buckets[hash_key(x->pk) & (c->nbuckets-1)];
+    c->buckets[hash_key(x->pk) & (c->nbuckets-1)] = x;
+    push_front(c, x);
+    c->stats.entries++;
+    if (x->table != NULL) c->stats.misses++;
+  }
+  for (i = 0; i < (int)n; i++)
+    if (slot[i] >= 0) {
+      e[i] = add[slot[i]];
+      e[i]->pins++;
+    }
+  evict(c);
+  pthread_mutex_unlock(&c->lock);
+}
+
+
+/**
+ * @brief Shared secrets of a chunk.
+ *
+ * @param c Cache
+ * @param ss Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param n Number of shared secrets (n <= CHUNK)
+ */
+static void chunk(PeerCache *c, uint8_t ss[][32], const uint8_t ska[][32],
+  const uint8_t pkb[][32], size_t n)
+{
+  PeerEntry *e[CHUNK];
+  const PeerTable *t[CHUNK];
+  uint8_t sk[CHUNK][32], pk[CHUNK][32], out[CHUNK][32];
+  int idx[CHUNK], lad[CHUNK], nt = 0, nl = 0, i;
+
+  acquire(c, e, pkb, n);
+
+  // instances with a table (padded to full groups) and with the ladder
+  for (i = 0; i < (int)n; i++) {
+    if ((e[i] != NULL) && (e[i]->table != NULL)) {
+      t[nt] = e[i]->table;
+      memcpy(sk[nt], ska[i], 32);
+      idx[nt++] = i;
+    }
+    else lad[nl++] = i;
+  }
+  if (nt > 0) {
+    for (i = nt; i % 4; i++) { t[i] = t[nt-1]; memcpy(sk[i], sk[nt-1], 32); }
+    x25519_sharedsecret_peer_n_avx2(out, (const uint8_t (*)[32])sk,
+      (const struct peer_table *const *)t, (nt+3)/4);
+    for (i = 0; i < nt; i++) memcpy(ss[idx[i]], out[i], 32);
+  }
+  if (nl > 0) {
+    for (i = 0; i < nl; i++) {
+      memcpy(sk[i], ska[lad[i]], 32);
+      memcpy(pk[i], pkb[lad[i]], 32);
+    }
+    x25519_sharedsecret_batch(out, (const uint8_t (*)[32])sk,
+      (const uint8_t (*)[32])pk, (size_t)nl);
+    for (i = 0; i < nl; i++) memcpy(ss[lad[i]], out[i], 32);
+  }
+
+  pthread_mutex_lock(&c->lock);
+  for (i = 0; i < (int)n; i++) if (e[i] != NULL) e[i]->pins--;
+  c->stats.ladders += (uint64_t)nl;
+  evict(c);
+  pthread_mutex_unlock(&c->lock);
+}
+
+#endif
+
+
+/**
+ * @brief Shared secrets with cached tables.
+ *
+ * @details
+ * ss[i] is the shared secret of ska[i] and pkb[i], as computed by
+ * x25519_sharedsecret_batch. The tables of the public keys are looked up in
+ * the cache and computed (and cached) if they are missing.
+ *
+ * @param c Cache
+ * @param ss Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param n Number of shared secrets
+ */
+void peercache_sharedsecret(PeerCache *c, uint8_t ss[][32], const uint8_t ska[][32],
+  const uint8_t pkb[][32], size_t n)
+{
+  size_t o;
+
+  if (!c->avx2 || (c->capacity == 0)) {
+    x25519_sharedsecret_batch(ss, ska, pkb, n);
+    pthread_mutex_lock(&c->lock);
+    c->stats.ladders += (uint64_t)n;
+    pthread_mutex_unlock(&c->lock);
+    return;
+  }
+#if defined(__x86_64__)
+  for (o = 0; o < n; o += CHUNK)
+    chunk(c, ss + o, ska + o, pkb + o, (n-o < CHUNK) ? n-o : CHUNK);
+#else
+  (void)o;
+#endif
+}
+
+
+/**
+ * @brief Statistics of a cache.
+ *
+ * @param c Cache
+ * @param s Statistics
+ */
+void peercache_stats(PeerCache *c, PeerCacheStats *s)
+{
+  pthread_mutex_lock(&c->lock);
+  *s = c->stats;
+  pthread_mutex_unlock(&c->lock);
+}
+
+
+/**
+ * @brief Size of the table of a public key.
+ *
+ * @return Bytes (0 on aarch64, where there are no tables)
+ */
+size_t peercache_table_size(void)
+{
+#if defined(__x86_64__)
+  return sizeof(PeerTable);
+#else
+  return 0;
+#endif
+}
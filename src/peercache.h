@@ -0,0 +1,49 @@
+/**
+ *******************************************************************************
+ * @file peercache.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the cache of per-peer tables.
+ *
+ * @details
+ * This file contains function prototypes of a cache of precomputed tables of
+ * public keys, for shared secrets that are computed repeatedly with the same
+ * (static) public keys, e.g. when rekeying. The table of a public key is
+ * computed when the key is seen for the first time, later shared secrets with
+ * the key are comb multiplications instead of ladders. The least recently
+ * used tables are evicted when the cache is full. The cache can be used by
+ * several threads at once.
+ *******************************************************************************
+ */
+
+#ifndef _PEERCACHE_H
+#define _PEERCACHE_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// statistics of a cache
+typedef struct peer_cache_stats {
+  uint64_t hits;          // shared secrets with a cached table
+  uint64_t misses;        // tables computed
+  uint64_t evictions;     // tables evicted
+  uint64_t ladders;       // shared secrets computed with the ladder (the
+                          // public key is on the twist, or there is no AVX2)
+  size_t entries;         // cached public keys
+} PeerCacheStats;
+
+typedef struct peer_cache PeerCache;
+
+// function prototypes
+
+PeerCache *peercache_create(size_t capacity);
+void peercache_destroy(PeerCache *c);
+void peercache_sharedsecret(PeerCache *c, uint8_t ss[][32], const uint8_t ska[][32],
+  const uint8_t pkb[][32], size_t n);
+void peercache_stats(PeerCache *c, PeerCacheStats *s);
+size_t peercache_table_size(void);
+
+#endif
@@ -0,0 +1,128 @@
+/**
+ *******************************************************************************
+ * @file prof.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the per-phase cycle counters.
+ *
+ * @details
+ * Only compiled with PROF = 1. A thread allocates its counters at its first
+ * measurement and puts them on a global list, so that prof_stats can sum the
+ * counters of all threads; the counters are only written by their thread and
+ * are kept when it exits. The sums of other threads are read without locking
+ * and may miss the measurements that are in progress.
+ *******************************************************************************
+ */
+
+#include "prof.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+
+// counters of a thread on the global list
+typedef struct prof_node {
+  ProfStats s;
+  struct prof_node *next;
+} ProfNode;
+
+__thread ProfStats *prof_local;
+
+static ProfNode *nodes;
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+
+static const char *names[PROF_NPHASES] = { "prune", "ladder", "recode",
+  "table", "point", "inv", "modp" };
+
+
+/**
+ * @brief Allocate the counters of the calling thread.
+ *
+ * @return Counters (a static block if there is not enough memory)
+ */
+ProfStats *prof_register(void)
+{
+  static ProfStats dummy;
+  ProfNode *n = (ProfNode *)calloc(1, sizeof(ProfNode));
+
+  if (n == NULL) return prof_local = &dummy;
+  pthread_mutex_lock(&lock);
+  n->next = nodes;
+  nodes = n;
+  pthread_mutex_unlock(&lock);
+  return prof_local = &n->s;
+}
+
+
+/**
+ * @brief Cycles of an empty measurement.
+ *
+ * @details
+ * The minimum of 64 read_tsc pairs (each read_tsc serializes with cpuid,
+ * which is much slower in a virtual machine).
+ *
+ * @return Cycles
+ */
+static uint64_t prof_overhead(void)
+{
+  uint64_t t, min = UINT64_MAX;
+  int i;
+
+  for (i = 0; i < 64; i++) {
+    t = read_tsc();
+    t = read_tsc() - t;
+    if (t < min) min = t;
+  }
+  return min;
+}
+
+
+/**
+ * @brief Query the counters.
+ *
+ * @param s Counters of the calling thread, or the sums of all threads
+ * @param all 0 for the calling thread, 1 for all threads
+ */
+void prof_stats(ProfStats *s, int all)
+{
+  ProfNode *n;
+  int i;
+
+  memset(s, 0, sizeof(*s));
+  if (!all) {
+    if (prof_local != NULL) *s = *prof_local;
+  } else {
+    pthread_mutex_lock(&lock);
+    for (n = nodes; n != NULL; n = n->next) {
+      for (i = 0; i < PROF_NPHASES; i++) {
+        s->cycles[i] += n->s.cycles[i];
+        s->calls[i] += n->s.calls[i];
+      }
+    }
+    pthread_mutex_unlock(&lock);
+  }
+  s->overhead = prof_overhead();
+}
+
+
+/**
+ * @brief Reset the counters of the calling thread.
+ */
+void prof_reset(void)
+{
+  if (prof_local != NULL) memset(prof_local, 0, sizeof(*prof_local));
+}
+
+
+/**
+ * @brief Name of a phase.
+ *
+ * @param phase Phase
+ * @return Name ("prune", "ladder", ...)
+ */
+const char *prof_phase_name(int phase)
+{
+  return ((phase >= 0) && (phase < PROF_NPHASES)) ? names[phase] : "?";
+}
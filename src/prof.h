@@ -0,0 +1,87 @@
+/**
+ *******************************************************************************
+ * @file prof.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the per-phase cycle counters.
+ *
+ * @details
+ * With PROF = 1 (make PROF=1) the AVX2 scalar multiplications, the inversion
+ * and the final reduction add the cycles (read_tsc) of their phases to the
+ * counters of the calling thread, and prof_stats returns the counters of the
+ * thread or the sums of all threads. With PROF = 0 (the default) the macros
+ * are empty and neither the counters nor the functions exist.
+ *******************************************************************************
+ */
+
+#ifndef _PROF_H
+#define _PROF_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef PROF
+#define PROF 0
+#endif
+
+// phases
+#define PROF_PRUNE   0    // scalar pruning (ladder and comb)
+#define PROF_LADDER  1    // the 255 steps and cswaps of the Montgomery ladder
+#define PROF_RECODE  2    // recoding of the scalar to signed digits (comb)
+#define PROF_TABLE   3    // table queries and prefetches (comb)
+#define PROF_POINT   4    // point additions and doublings (comb)
+#define PROF_INV     5    // field inversion
+#define PROF_MODP    6    // final reduction modulo p (final_modp)
+#define PROF_NPHASES 7
+
+// counters of the phases
+typedef struct prof_stats {
+  uint64_t cycles[PROF_NPHASES];  // TSC cycles, with one read_tsc pair each
+  uint64_t calls[PROF_NPHASES];   // number of measurements
+  uint64_t overhead;              // cycles of an empty measurement
+} ProfStats;
+
+#if PROF
+
+// Return the clock cycle value of CPU
+extern uint64_t read_tsc(void);
+
+// counters of the calling thread (NULL until its first measurement)
+extern __thread ProfStats *prof_local;
+
+// function prototypes
+
+ProfStats *prof_register(void);
+void prof_stats(ProfStats *s, int all);
+void prof_reset(void);
+const char *prof_phase_name(int phase);
+
+/**
+ * @brief Add the cycles of a phase to the counters of the thread.
+ *
+ * @param phase Phase
+ * @param cycles Cycles
+ */
+static inline void prof_add(int phase, uint64_t cycles)
+{
+  ProfStats *s = prof_local;
+
+  if (s == NULL) s = prof_register();
+  s->cycles[phase] += cycles;
+  s->calls[phase]++;
+}
+
+#define PROF_START(T)        uint64_t T = read_tsc()
+#define PROF_STOP(PHASE, T)  prof_add(PHASE, read_tsc() - (T))
+
+#else
+
+#define PROF_START(T)
+#define PROF_STOP(PHASE, T)
+
+#endif
+
+#endif
@@ -0,0 +1,130 @@
+/**
+ *******************************************************************************
+ * @file sc25519.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of scalar arithmetic modulo the group order.
+ *
+ * @details
+ * This file contains the reduction of 512-bit integers modulo l and the 
+ * multiply-accumulate of Ed25519 signing. The integers are held as 64 signed 
+ * radix-2^8 digits in 64-bit words, so that the products of the digits can be
+ * summed without carries. The operations are constant-time.
+ *******************************************************************************
+ */
+
+#include "sc25519.h"
+
+// l = 2^252 + 27742317777372353535851937790883648493 in radix 2^8
+static const int64_t L[32] = { 0xED, 0xD3, 0xF5, 0x5C, 0x1A, 0x63, 0x12, 0x58, 
+  0xD6, 0x9C, 0xF7, 0xA2, 0xDE, 0xF9, 0xDE, 0x14, 0, 0, 0, 0, 0, 0, 0, 0, 
+  0, 0, 0, 0, 0, 0, 0, 0x10 };
+
+
+/**
+ * @brief Reduction of the digits modulo l.
+ *
+ * @details
+ * The digits 63 to 32 are folded from the top with 2^256 = -16*(l - 2^252) 
+ * mod l, keeping the lower digits in [-128, 128). Then the bits above 2^252 
+ * are folded and one l is subtracted conditionally (as a multiple 0 or 1 of l
+ * given by the final borrow), and the carries are propagated.
+ *
+ * @param r Scalar in [0, l) (32 bytes)
+ * @param x Digits (64 words, destroyed)
+ */
+static void sc25519_modl(uint8_t *r, int64_t *x)
+{
+  int64_t carry;
+  int i, j;
+
+  for (i = 63; i >= 32; i--) {
+    carry = 0;
+    for (j = i-32; j < i-12; j++) {
+      x[j] += carry - 16*x[i]*L[j-(i-32)];
+      carry = (x[j] + 128) >> 8;
+      x[j] -= carry*256;
+    }
+    x[j] += carry;
+    x[i] = 0;
+  }
+
+  carry = 0;
+  for (j = 0; j < 32; j++) {
+    x[j] += carry - (x[31] >> 4)*L[j];
+    carry = x[j] >> 8;
+    x[j] &= 0xFF;
+  }
+  for (j = 0; j < 32; j++) x[j] -= carry*L[j];
+
+  for (i = 0; i < 32; i++) {
+    x[i+1] += x[i] >> 8;
+    r[i] = (uint8_t)(x[i] & 0xFF);
+  }
+}
+
+
+/**
+ * @brief Reduction of a 512-bit integer modulo l.
+ *
+ * @param r Scalar in [0, l) (32 bytes)
+ * @param a Integer (64 bytes), e.g. a SHA-512 digest
+ */
+void sc25519_reduce(uint8_t *r, const uint8_t *a)
+{
+  int64_t x[64];
+  int i;
+
+  for (i = 0; i < 64; i++) x[i] = a[i];
+  sc25519_modl(r, x);
+}
+
+
+/**
+ * @brief Multiply-accumulate modulo l.
+ *
+ * @details
+ * R = A*B + C mod l, the S part of an Ed25519 signature.
+ *
+ * @param r Scalar in [0, l) (32 bytes)
+ * @param a Scalar (32 bytes)
+ * @param b Scalar (32 bytes)
+ * @param c Scalar (32 bytes)
+ */
+void sc25519_muladd(uint8_t *r, const uint8_t *a, const uint8_t *b, 
+  const uint8_t *c)
+{
+  int64_t x[64];
+  int i, j;
+
+  for (i = 0; i < 32; i++) x[i] = c[i];
+  for (i = 32; i < 64; i++) x[i] = 0;
+  for (i = 0; i < 32; i++)
+    for (j = 0; j < 32; j++) x[i+j] += (int64_t)a[i]*b[j];
+  sc25519_modl(r, x);
+}
+
+
+/**
+ * @brief Range check of a scalar.
+ *
+ * @details
+ * Return 1 if a < l, i.e. a is the canonical encoding (e.g. the S part of a 
+ * signature), and 0 otherwise. Not constant-time (for public scalars only).
+ *
+ * @param a Scalar (32 bytes)
+ * @return 1 if a < l, 0 otherwise
+ */
+int sc25519_iscanonical(const uint8_t *a)
+{
+  int i;
+
+  for (i = 31; i >= 0; i--) {
+    if (a[i] < L[i]) return 1;
+    if (a[i] > L[i]) return 0;
+  }
+  return 0;
+}
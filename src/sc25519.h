@@ -0,0 +1,30 @@
+/**
+ *******************************************************************************
+ * @file sc25519.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of scalar arithmetic modulo the group order.
+ *
+ * @details
+ * This file contains function prototypes of arithmetic modulo the order 
+ * l = 2^252 + 27742317777372353535851937790883648493 of the base point, the 
+ * scalars are 32-byte (or 64-byte) little-endian strings.
+ *******************************************************************************
+ */
+
+#ifndef _SC25519_H
+#define _SC25519_H
+
+#include <stdint.h>
+
+// function prototypes
+
+void sc25519_reduce(uint8_t *r, const uint8_t *a);
+void sc25519_muladd(uint8_t *r, const uint8_t *a, const uint8_t *b, 
+  const uint8_t *c);
+int sc25519_iscanonical(const uint8_t *a);
+
+#endif
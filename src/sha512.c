@@ -0,0 +1,205 @@
+/**
+ *******************************************************************************
+ * @file sha512.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the SHA-512 hash function.
+ *
+ * @details
+ * This file contains a portable implementation of SHA-512 (FIPS 180-4) in
+ * 64-bit C, which is used to derive the scalars of Ed25519.
+ *******************************************************************************
+ */
+
+#include "sha512.h"
+#include <string.h>
+
+// round constants
+static const uint64_t K[80] = {
+  0x428a2f98d728ae22ULL, 0x7137449123ef65cdULL, 0xb5c0fbcfec4d3b2fULL, 0xe9b5dba58189dbbcULL,
+  0x3956c25bf348b538ULL, 0x59f111f1b605d019ULL, 0x923f82a4af194f9bULL, 0xab1c5ed5da6d8118ULL,
+  0xd807aa98a3030242ULL, 0x12835b0145706fbeULL, 0x243185be4ee4b28cULL, 0x550c7dc3d5ffb4e2ULL,
+  0x72be5d74f27b896fULL, 0x80deb1fe3b1696b1ULL, 0x9bdc06a725c71235ULL, 0xc19bf174cf692694ULL,
+  0xe49b69c19ef14ad2ULL, 0xefbe4786384f25e3ULL, 0x0fc19dc68b8cd5b5ULL, 0x240ca1cc77ac9c65ULL,
+  0x2de92c6f592b0275ULL, 0x4a7484aa6ea6e483ULL, 0x5cb0a9dcbd41fbd4ULL, 0x76f988da831153b5ULL,
+  0x983e5152ee66dfabULL, 0xa831c66d2db43210ULL, 0xb00327c898fb213fULL, 0xbf597fc7beef0ee4ULL,
+  0xc6e00bf33da88fc2ULL, 0xd5a79147930aa725ULL, 0x06ca6351e003826fULL, 0x142929670a0e6e70ULL,
+  0x27b70a8546d22ffcULL, 0x2e1b21385c26c926ULL, 0x4d2c6dfc5ac42aedULL, 0x53380d139d95b3dfULL,
+  0x650a73548baf63deULL, 0x766a0abb3c77b2a8ULL, 0x81c2c92e47edaee6ULL, 0x92722c851482353bULL,
+  0xa2bfe8a14cf10364ULL, 0xa81a664bbc423001ULL, 0xc24b8b70d0f89791ULL, 0xc76c51a30654be30ULL,
+  0xd192e819d6ef5218ULL, 0xd69906245565a910ULL, 0xf40e35855771202aULL, 0x106aa07032bbd1b8ULL,
+  0x19a4c116b8d2d0c8ULL, 0x1e376c085141ab53ULL, 0x2748774cdf8eeb99ULL, 0x34b0bcb5e19b48a8ULL,
+  0x391c0cb3c5c95a63ULL, 0x4ed8aa4ae3418acbULL, 0x5b9cca4f7763e373ULL, 0x682e6ff3d6b2b8a3ULL,
+  0x748f82ee5defb2fcULL, 0x78a5636f43172f60ULL, 0x84c87814a1f0ab72ULL, 0x8cc702081a6439ecULL,
+  0x90befffa23631e28ULL, 0xa4506cebde82bde9ULL, 0xbef9a3f7b2c67915ULL, 0xc67178f2e372532bULL,
+  0xca273eceea26619cULL, 0xd186b8c721c0c207ULL, 0xeada7dd6cde0eb1eULL, 0xf57d4f7fee6ed178ULL,
+  0x06f067aa72176fbaULL, 0x0a637dc5a2c898a6ULL, 0x113f9804bef90daeULL, 0x1b710b35131c471bULL,
+  0x28db77f523047d84ULL, 0x32caab7b40c72493ULL, 0x3c9ebe0a15c9bebcULL, 0x431d67c49c100d4cULL,
+  0x4cc5d4becb3e42b6ULL, 0x597f299cfc657e2aULL, 0x5fcb6fab3ad6faecULL, 0x6c44198c4a475817ULL };
+
+// initial chaining value
+static const uint64_t IV[8] = {
+  0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL, 0xa54ff53a5f1d36f1ULL,
+  0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL, 0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL };
+
+#define ROTR(X, N)   (((X) >> (N)) | ((X) << (64 - (N))))
+#define CH(X, Y, Z)  (((X) & (Y)) ^ (~(X) & (Z)))
+#define MAJ(X, Y, Z) (((X) & (Y)) ^ ((X) & (Z)) ^ ((Y) & (Z)))
+#define S0(X)        (ROTR(X, 28) ^ ROTR(X, 34) ^ ROTR(X, 39))
+#define S1(X)        (ROTR(X, 14) ^ ROTR(X, 18) ^ ROTR(X, 41))
+#define G0(X)        (ROTR(X,  1) ^ ROTR(X,  8) ^ ((X) >> 7))
+#define G1(X)        (ROTR(X, 19) ^ ROTR(X, 61) ^ ((X) >> 6))
+
+
+/**
+ * @brief Load a 64-bit big-endian word.
+ *
+ * @param a Byte string (8 bytes)
+ * @return Word
+ */
+static uint64_t load64_be(const uint8_t *a)
+{
+  return ((uint64_t)a[0] << 56) | ((uint64_t)a[1] << 48) |
+         ((uint64_t)a[2] << 40) | ((uint64_t)a[3] << 32) |
+         ((uint64_t)a[4] << 24) | ((uint64_t)a[5] << 16) |
+         ((uint64_t)a[6] <<  8) |  (uint64_t)a[7];
+}
+
+
+/**
+ * @brief Store a 64-bit word in big-endian order.
+ *
+ * @param r Byte string (8 bytes)
+ * @param a Word
+ */
+static void store64_be(uint8_t *r, uint64_t a)
+{
+  int i;
+
+  for (i = 7; i >= 0; i--) { r[i] = (uint8_t)a; a >>= 8; }
+}
+
+
+/**
+ * @brief Compression function.
+ *
+ * @details
+ * Update the chaining value with nb consecutive 128-byte blocks.
+ *
+ * @param h Chaining value
+ * @param m Blocks
+ * @param nb Number of blocks
+ */
+static void sha512_compress(uint64_t *h, const uint8_t *m, size_t nb)
+{
+  uint64_t w[80], a, b, c, d, e, f, g, k, t1, t2;
+  int i;
+
+  for (; nb > 0; nb--, m += 128) {
+    // message schedule
+    for (i = 0; i < 16; i++) w[i] = load64_be(m + 8*i);
+    for (i = 16; i < 80; i++) w[i] = G1(w[i-2]) + w[i-7] + G0(w[i-15]) + w[i-16];
+
+    a = h[0]; b = h[1]; c = h[2]; d = h[3];
+    e = h[4]; f = h[5]; g = h[6]; k = h[7];
+    for (i = 0; i < 80; i++) {
+      t1 = k + S1(e) + CH(e, f, g) + K[i] + w[i];
+      t2 = S0(a) + MAJ(a, b, c);
+      k = g; g = f; f = e; e = d + t1;
+      d = c; c = b; b = a; a = t1 + t2;
+    }
+    h[0] += a; h[1] += b; h[2] += c; h[3] += d;
+    h[4] += e; h[5] += f; h[6] += g; h[7] += k;
+  }
+}
+
+
+/**
+ * @brief Initialize a context.
+ *
+ * @param c Context
+ */
+void sha512_init(Sha512Ctx *c)
+{
+  memcpy(c->h, IV, sizeof(IV));
+  c->len = 0;
+}
+
+
+/**
+ * @brief Hash more bytes of the message.
+ *
+ * @details
+ * The bytes are appended to the partial block, full blocks are compressed
+ * directly from the message.
+ *
+ * @param c Context
+ * @param m Message bytes
+ * @param n Number of bytes
+ */
+void sha512_update(Sha512Ctx *c, const uint8_t *m, size_t n)
+{
+  size_t used = (size_t)(c->len & 127), take;
+
+  c->len += n;
+  if (used > 0) {
+    take = (n < 128 - used) ? n : 128 - used;
+    memcpy(c->buf + used, m, take);
+    m += take; n -= take; used += take;
+    if (used < 128) return;
+    sha512_compress(c->h, c->buf, 1);
+  }
+  sha512_compress(c->h, m, n >> 7);
+  m += n & ~(size_t)127;
+  memcpy(c->buf, m, n & 127);
+}
+
+
+/**
+ * @brief Finish the computation.
+ *
+ * @details
+ * Pad the message with 0x80, zeros and the 128-bit bit length, and output the
+ * 64-byte digest.
+ *
+ * @param c Context
+ * @param h Digest (64 bytes)
+ */
+void sha512_final(Sha512Ctx *c, uint8_t *h)
+{
+  size_t used = (size_t)(c->len & 127);
+  int i;
+
+  c->buf[used++] = 0x80;
+  if (used > 112) {
+    memset(c->buf + used, 0, 128 - used);
+    sha512_compress(c->h, c->buf, 1);
+    used = 0;
+  }
+  memset(c->buf + used, 0, 120 - used);
+  store64_be(c->buf + 120, c->len << 3);
+  c->buf[119] = (uint8_t)(c->len >> 61);
+  sha512_compress(c->h, c->buf, 1);
+
+  for (i = 0; i < 8; i++) store64_be(h + 8*i, c->h[i]);
+}
+
+
+/**
+ * @brief One-shot SHA-512.
+ *
+ * @param h Digest (64 bytes)
+ * @param m Message
+ * @param n Number of bytes
+ */
+void sha512(uint8_t *h, const uint8_t *m, size_t n)
+{
+  Sha512Ctx c;
+
+  sha512_init(&c);
+  sha512_update(&c, m, n);
+  sha512_final(&c, h);
+}
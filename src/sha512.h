@@ -0,0 +1,37 @@
+/**
+ *******************************************************************************
+ * @file sha512.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the SHA-512 hash function.
+ *
+ * @details
+ * This file defines the context of SHA-512 (FIPS 180-4) and contains function
+ * prototypes of the incremental and the one-shot interface.
+ *******************************************************************************
+ */
+
+#ifndef _SHA512_H
+#define _SHA512_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// context of an incremental computation
+typedef struct sha512_ctx {
+  uint64_t h[8];        // chaining value
+  uint8_t buf[128];     // partial block
+  uint64_t len;         // number of bytes hashed so far
+} Sha512Ctx;
+
+// function prototypes
+
+void sha512_init(Sha512Ctx *c);
+void sha512_update(Sha512Ctx *c, const uint8_t *m, size_t n);
+void sha512_final(Sha512Ctx *c, uint8_t *h);
+void sha512(uint8_t *h, const uint8_t *m, size_t n);
+
+#endif
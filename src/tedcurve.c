@@ -10,15 +10,64 @@
  *
  * @details 
  * This file contains (4*1)-way parallel point operations on twisted Edwards curve. 
+ * The (1*4)-way functions hold the coordinates [x, y, z, t] of one point in the
+ * four lanes of a single field element, the (2*2)-way functions two points in
+ * the 128-bit halves of two field elements [x, y] and [z, t].
  *******************************************************************************
  */
 
 #include "base.h"
 #include "tedcurve.h"
+#include "ecdh.h"
+#include "prof.h"
+#include <stdlib.h>
 
 // "1/2" in the field
 static const uint64_t one_half[4] = { 0xFFFFFFFFFFFFFFF7, 0xFFFFFFFFFFFFFFFF, 
   0xFFFFFFFFFFFFFFFF, 0x3FFFFFFFFFFFFFFF };
+// d and 2*d in the field
+static const uint32_t cond29[NWORDS] = { 0x135978A3, 0x0F5A6E50, 0x10762ADD,
+  0x00149A82, 0x1E898007, 0x003CBBBC, 0x19CE331D, 0x1DC56DFF, 0x0052036C };
+static const uint32_t con2d29[NWORDS] = { 0x06B2F159, 0x1EB4DCA1, 0x00EC55BA,
+  0x00293505, 0x1D13000E, 0x00797779, 0x139C663A, 0x1B8ADBFF, 0x002406D9 };
+static const uint32_t one_half29[NWORDS] = { 0x1FFFFFF7, 0x1FFFFFFF, 0x1FFFFFFF,
+  0x1FFFFFFF, 0x1FFFFFFF, 0x1FFFFFFF, 0x1FFFFFFF, 0x1FFFFFFF, 0x003FFFFF };
+// the 8-torsion subgroup [x, y] of c*T (c = 0, ..., 7, T of order 8): c = 0 is
+// the neutral element, c = 4 the point (0, -1) of order 2, c = 2 and 6 the
+// points (+-sqrt(-1), 0) of order 4, and the odd c the points of order 8
+static const uint32_t torsion29[8][2][NWORDS] = {
+  { { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000 },
+    { 0x00000001, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000 } },
+  { { 0x1ABA2EA3, 0x0AF5CDC9, 0x068771C8, 0x0D871FD8, 0x1B544A3E, 0x1366E390,
+      0x175C5B31, 0x0BFF38D6, 0x00602A46 },
+    { 0x0F95E826, 0x013D9614, 0x1D30D16C, 0x11DFE513, 0x0DFD5F09, 0x036982D6,
+      0x02C4E4CF, 0x0DB10047, 0x0005FC53 } },
+  { { 0x15F15F3D, 0x188F26C5, 0x1406E1CE, 0x19CFF2A5, 0x02858D0B, 0x1FB36102,
+      0x03D352CB, 0x0FF607C4, 0x00547CDB },
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000 } },
+  { { 0x1ABA2EA3, 0x0AF5CDC9, 0x068771C8, 0x0D871FD8, 0x1B544A3E, 0x1366E390,
+      0x175C5B31, 0x0BFF38D6, 0x00602A46 },
+    { 0x106A17C7, 0x1EC269EB, 0x02CF2E93, 0x0E201AEC, 0x1202A0F6, 0x1C967D29,
+      0x1D3B1B30, 0x124EFFB8, 0x007A03AC } },
+  { { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000 },
+    { 0x1FFFFFEC, 0x1FFFFFFF, 0x1FFFFFFF, 0x1FFFFFFF, 0x1FFFFFFF, 0x1FFFFFFF,
+      0x1FFFFFFF, 0x1FFFFFFF, 0x007FFFFF } },
+  { { 0x0545D14A, 0x150A3236, 0x19788E37, 0x1278E027, 0x04ABB5C1, 0x0C991C6F,
+      0x08A3A4CE, 0x1400C729, 0x001FD5B9 },
+    { 0x106A17C7, 0x1EC269EB, 0x02CF2E93, 0x0E201AEC, 0x1202A0F6, 0x1C967D29,
+      0x1D3B1B30, 0x124EFFB8, 0x007A03AC } },
+  { { 0x0A0EA0B0, 0x0770D93A, 0x0BF91E31, 0x06300D5A, 0x1D7A72F4, 0x004C9EFD,
+      0x1C2CAD34, 0x1009F83B, 0x002B8324 },
+    { 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+      0x00000000, 0x00000000, 0x00000000 } },
+  { { 0x0545D14A, 0x150A3236, 0x19788E37, 0x1278E027, 0x04ABB5C1, 0x0C991C6F,
+      0x08A3A4CE, 0x1400C729, 0x001FD5B9 },
+    { 0x0F95E826, 0x013D9614, 0x1D30D16C, 0x11DFE513, 0x0DFD5F09, 0x036982D6,
+      0x02C4E4CF, 0x0DB10047, 0x0005FC53 } } };
 
 /**
  * @brief Point addition.
@@ -42,7 +91,7 @@ void ted_point_add_avx2(ExtPoint *r, ExtPoint *p, ProPoint *q)
   mpi29_gfp_sub_avx2(r->e, r->y, r->x);
   mpi29_gfp_add_avx2(r->h, r->y, r->x);
   mpi29_gfp_mul_avx2(r->x, t, q->z);
-  mpi29_gfp_sbc_avx2(t, p->z, r->x);
+  mpi29_gfp_sbp_avx2(t, p->z, r->x);
   mpi29_gfp_add_avx2(r->x, p->z, r->x);
   mpi29_gfp_mul_avx2(r->z, t, r->x);
   mpi29_gfp_mul_avx2(r->y, r->x, r->h);
@@ -50,6 +99,52 @@ void ted_point_add_avx2(ExtPoint *r, ExtPoint *p, ProPoint *q)
 }
 
 
+/**
+ * @brief Point addition of two extended points.
+ *
+ * @details
+ * Unified addition R = P + Q on a twisted Edwards curve with a = -1, where 
+ * both points are in extended coordinates (the t-coordinates are computed from
+ * e*h first). R may alias P or Q.
+ *
+ * @param r Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ * @param p Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ * @param q Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ */
+void ted_point_add_ext_avx2(ExtPoint *r, const ExtPoint *p, const ExtPoint *q)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS], d2[NWORDS];
+  int i;
+
+  for (i = 0; i < NWORDS; i++) d2[i] = VSET164(con2d29[i]);
+
+  // C = 2d*t1*t2 and D = 2*z1*z2
+  mpi29_gfp_mul_avx2(t0, p->e, p->h);
+  mpi29_gfp_mul_avx2(t1, q->e, q->h);
+  mpi29_gfp_mul_avx2(t0, t0, t1);
+  mpi29_gfp_mul_avx2(t0, t0, d2);
+  mpi29_gfp_mul_avx2(t1, p->z, q->z);
+  mpi29_gfp_add_avx2(t1, t1, t1);
+  // A = (y1-x1)*(y2-x2) and B = (y1+x1)*(y2+x2), the differences are carried
+  // since the product of two uncarried ones can overflow the 64-bit columns
+  mpi29_gfp_sbp_avx2(t2, p->y, p->x);
+  mpi29_gfp_sbp_avx2(t3, q->y, q->x);
+  mpi29_gfp_mul_avx2(t2, t2, t3);
+  mpi29_gfp_add_avx2(t3, p->y, p->x);
+  mpi29_gfp_add_avx2(d2, q->y, q->x);
+  mpi29_gfp_mul_avx2(t3, t3, d2);
+  // E = B-A, H = B+A, F = D-C, G = D+C (D is not carried, G < 1.5*2^30)
+  mpi29_gfp_sbp_avx2(r->e, t3, t2);
+  mpi29_gfp_add_avx2(r->h, t3, t2);
+  mpi29_gfp_sbp_avx2(t2, t1, t0);
+  mpi29_gfp_add_avx2(t3, t1, t0);
+  // x3 = E*F, y3 = G*H, z3 = F*G (and t3 = E*H)
+  mpi29_gfp_mul_avx2(r->x, r->e, t2);
+  mpi29_gfp_mul_avx2(r->y, t3, r->h);
+  mpi29_gfp_mul_avx2(r->z, t2, t3);
+}
+
+
 /**
  * @brief Point doubling.
  *
@@ -65,7 +160,7 @@ void ted_point_dbl_avx2(ExtPoint *r, ExtPoint *p)
 
   mpi29_gfp_sqr_avx2(r->e, p->x);
   mpi29_gfp_sqr_avx2(r->h, p->y);
-  mpi29_gfp_sbc_avx2(t, r->e, r->h);
+  mpi29_gfp_sbp_avx2(t, r->e, r->h);
   mpi29_gfp_add_avx2(r->h, r->e, r->h);
   mpi29_gfp_add_avx2(r->x, p->x, p->y);
   mpi29_gfp_sqr_avx2(r->e, r->x);
@@ -111,24 +206,85 @@ static void ted_point_init_ext_avx2(ExtPoint *p)
  *
  * @details
  * Look up the table with specifying the position to obtain the multiple of base
- * point (in Duif representation).
+ * point (in Duif representation). The entries of a position are pre-split into 
+ * 29-bit limbs, such that one aligned load holds a limb of eight entries and a 
+ * vpermd moves the limb of the entry |b| into the lane. Every entry is loaded 
+ * and there are no secret-dependent addresses, so the query is constant-time.
  *
  * @param r Point of the table in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
  * @param pos Position of the table
- * @param b Scalar (a nibble)
+ * @param b Scalar (a signed digit)
  */
 void ted_point_query_table_avx2(ProPoint *r, const int pos, const __m256i b)
 {
-  const __m256i babs  = VABS8(b);   // the abs of scalar nibble
+  const __m256i lo32 = VSET164(0xFFFFFFFFU);
+  const __m256i one = VSET164(1);
+  const __m256i babs = VABS8(b);
+  const __m256i index = VSUB(babs, one);
+  const uint32_t (*const tab)[NWORDS][FIXBASE_K] = fixbase29[pos];
+  __m256i gmask[FIXBASE_K/8], zmask, bsign, t[NWORDS], v;
+  __m256i *coor[3];
+  int c, g, i;
+
+  // the lanes with b = 0 get the neutral element [1/2, 1/2, 0], the others 
+  // the entry |b|-1 in group (|b|-1)/8 (the upper 32 bits are masked off)
+  zmask = VAND(_mm256_cmpeq_epi64(babs, VZERO), lo32);
+  for (g = 0; g < FIXBASE_K/8; g++)
+    gmask[g] = VAND(_mm256_cmpeq_epi64(VSHR(index, 3), VSET164(g)), lo32);
+  for (i = 0; i < NWORDS; i++) {
+    r->x[i] = r->y[i] = VAND(zmask, VSET164(one_half29[i]));
+    r->z[i] = VZERO;
+  }
+
+  // query the table
+  coor[0] = r->x; coor[1] = r->y; coor[2] = r->z;
+  for (c = 0; c < 3; c++)
+    for (i = 0; i < NWORDS; i++)
+      for (g = 0; g < FIXBASE_K/8; g++) {
+        v = _mm256_load_si256((__m256i *)&tab[c][i][8*g]);
+        v = _mm256_permutevar8x32_epi32(v, index);
+        coor[c][i] = VXOR(coor[c][i], VAND(gmask[g], v));
+      }
+
+  // if b < 0, swap the first two coordinates and negate d*x*y
+  bsign = VSHR(b, 7);
+  v = VSUB(VZERO, bsign);
+  for (i = 0; i < NWORDS; i++) {
+    t[i]    = VAND(VXOR(r->x[i], r->y[i]), v);
+    r->x[i] = VXOR(r->x[i], t[i]);
+    r->y[i] = VXOR(r->y[i], t[i]);
+    t[i] = VZERO;
+  }
+  mpi29_gfp_sub_avx2(t, t, r->z);
+  mpi29_cswap_avx2(r->z, t, bsign);
+}
+
+
+/**
+ * @brief Point multiplication based on the look-up table (64-bit words).
+ *
+ * @details
+ * Reference version of ted_point_query_table_avx2 that scans the table in
+ * 64-bit words (the layout of LutPoint) and converts the coordinates to mpi29
+ * format afterwards.
+ *
+ * @param r Point of the table in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
+ * @param pos Position of the table
+ * @param b Scalar (a signed digit)
+ */
+void ted_point_query_table_duif_avx2(ProPoint *r, const int pos, const __m256i b)
+{
+  const __m256i babs  = VABS8(b);   // the abs of scalar digit
   const __m256i one   = VSET164(1);
   const __m256i zero  = VZERO; 
-  __m256i mask[9], xP[4], yP[4], zP[4], t[NWORDS];
+  const LutPoint *const tab = fixbase[pos];
+  __m256i mask[FIXBASE_K+1], xP[4], yP[4], zP[4], t[NWORDS];
   __m256i xcoor, ycoor, zcoor, index, tmp, bsign, bmask;
   int i, j;
 
   // create the masks
   index = zero;
-  for (i = 0; i < 9; i++) {
+  for (i = 0; i <= FIXBASE_K; i++) {
     mask[i] = VXOR(babs, index);
     mask[i] = VSUB(mask[i], one);
     mask[i] = VSHR(mask[i], 32);  
@@ -147,11 +303,11 @@ void ted_point_query_table_avx2(ProPoint *r, const int pos, const __m256i b)
     xP[i] = VXOR(xP[i], VAND(mask[0], xcoor));
     yP[i] = VXOR(yP[i], VAND(mask[0], ycoor));
 
-    for (j = 0; j < 8; j++) {
+    for (j = 0; j < FIXBASE_K; j++) {
       // Using SET164 is pretty slow here 
-      xcoor = VBROAD64(VLOAD128(&(base[pos][j].x[i]))); 
-      ycoor = VBROAD64(VLOAD128(&(base[pos][j].y[i])));
-      zcoor = VBROAD64(VLOAD128(&(base[pos][j].z[i])));
+      xcoor = VBROAD64(VLOAD128(&(tab[j].x[i]))); 
+      ycoor = VBROAD64(VLOAD128(&(tab[j].y[i])));
+      zcoor = VBROAD64(VLOAD128(&(tab[j].z[i])));
 
       xP[i] = VXOR(xP[i], VAND(mask[j+1], xcoor));
       yP[i] = VXOR(yP[i], VAND(mask[j+1], ycoor));
@@ -180,44 +336,130 @@ void ted_point_query_table_avx2(ProPoint *r, const int pos, const __m256i b)
 
 
 /**
- * @brief Convert a scalar to signed nibbles.
+ * @brief Convert a scalar to signed digits of w bits.
  *
  * @details
- * Convert the 256-bit scalar to 64 signed nibbles and store them in an array.
+ * Convert the 256-bit scalar to nd digits of w bits in the range [-2^(w-1), 
+ * 2^(w-1)] and store them (as 8-bit integers) in an array.
  *
- * @param e Nibbles
+ * @param e Digits
  * @param k Scalar
+ * @param w Width of the digits
+ * @param nd Number of digits, nd*w >= 256
  */
-void ted_conv_scalar2nibble_avx2(__m256i *e, const __m256i *k)
+static void ted_conv_scalar2digit_w_avx2(__m256i *e, const __m256i *k, const int w,
+  const int nd)
 {
-  int i;
-  const __m256i eight = VSET164(8);
-  const __m256i mask4 = VSET164(0x0F);
+  int i, j, o;
+  const __m256i half  = VSET164(1 << (w-1));
+  const __m256i maskw = VSET164((1 << w) - 1);
   const __m256i mask8 = VSET164(0xFF);
   __m256i carry = VZERO;
 
-  // convert scalar to nibbles
-  for (i = 0; i < 8; i++) {
-    e[8*i] = VAND(k[i], mask4);
-    e[8*i+1] = VAND(VSHR(k[i], 4), mask4);
-    e[8*i+2] = VAND(VSHR(k[i], 8), mask4);
-    e[8*i+3] = VAND(VSHR(k[i], 12), mask4);
-    e[8*i+4] = VAND(VSHR(k[i], 16), mask4);
-    e[8*i+5] = VAND(VSHR(k[i], 20), mask4);
-    e[8*i+6] = VAND(VSHR(k[i], 24), mask4);
-    e[8*i+7] = VAND(VSHR(k[i], 28), mask4);
+  // convert scalar to unsigned digits, a digit may span two 32-bit words
+  for (i = 0; i < nd; i++) {
+    j = (w*i) >> 5;
+    o = (w*i) & 31;
+    e[i] = VSHR(k[j], o);
+    if ((o + w > 32) && (j < 7)) e[i] = VOR(e[i], VSHL(k[j+1], 32-o));
+    e[i] = VAND(e[i], maskw);
   }
 
-  // convert unsigned nibbles to signed
-  for (i = 0; i < 63; i++) {
+  // convert unsigned digits to signed
+  for (i = 0; i < nd-1; i++) {
     e[i] = VADD(e[i], carry);
-    carry = VADD(e[i], eight);
-    carry = VSHR(carry, 4);
-    e[i] = VSUB(e[i], VSHL(carry, 4));
+    carry = VADD(e[i], half);
+    carry = VSHR(carry, w);
+    e[i] = VSUB(e[i], VSHL(carry, w));
     e[i] = VAND(e[i], mask8);
   }
-  e[63] = VADD(e[63], carry);
-  e[63] = VAND(e[63], mask8);
+  e[nd-1] = VADD(e[nd-1], carry);
+  e[nd-1] = VAND(e[nd-1], mask8);
+}
+
+
+/**
+ * @brief Convert a scalar to signed digits.
+ *
+ * @details
+ * Convert the 256-bit scalar to FIXBASE_D digits of FIXBASE_W bits in the 
+ * range [-2^(W-1), 2^(W-1)] and store them (as 8-bit integers) in an array.
+ *
+ * @param e Digits
+ * @param k Scalar
+ */
+void ted_conv_scalar2digit_avx2(__m256i *e, const __m256i *k)
+{
+  ted_conv_scalar2digit_w_avx2(e, k, FIXBASE_W, FIXBASE_D);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication on twisted Edwards curve (any k).
+ *
+ * @details
+ * H = k * B.
+ * Compute a scalar multiplication H = k * B with a fixed base B (x, 4/5) on 
+ * twisted Edwards curve for a scalar k < 2^255 that is not pruned (e.g. the
+ * nonce of an Ed25519 signature), and output all coordinates of H.
+ * 
+ * @param h Point in extended projective coordinates
+ * @param k Scalar 
+ */
+void ted_mul_fixbase_ext_avx2(ExtPoint *h, const __m256i *k)
+{
+  ProPoint p;
+  __m256i e[FIXBASE_D];
+  int i, j;
+
+  PROF_START(t_recode);
+  ted_conv_scalar2digit_avx2(e, k);
+  PROF_STOP(PROF_RECODE, t_recode);
+
+  ted_point_init_ext_avx2(h);
+
+  // the teeth from the most significant one, FIXBASE_W doublings in between
+  for (j = FIXBASE_S-1; j >= 0; j--) {
+    if (j < FIXBASE_S-1) {
+      PROF_START(t_dbl);
+      for (i = 0; i < FIXBASE_W; i++) ted_point_dbl_avx2(h, h);
+      PROF_STOP(PROF_POINT, t_dbl);
+    }
+    for (i = j; i < FIXBASE_D; i += FIXBASE_S) {
+      PROF_START(t_table);
+      ted_point_query_table_avx2(&p, i/FIXBASE_S, e[i]);
+      if (i + FIXBASE_S < FIXBASE_D) ted_prefetch_table(i/FIXBASE_S + 1);
+      PROF_STOP(PROF_TABLE, t_table);
+      PROF_START(t_add);
+      ted_point_add_avx2(h, h, &p);
+      PROF_STOP(PROF_POINT, t_add);
+    }
+  }
+}
+
+
+/**
+ * @brief Prune a scalar (X25519 clamping).
+ *
+ * @details
+ * Clear the three least significant bits and bit 255, set bit 254.
+ *
+ * @param kp Pruned scalar
+ * @param k Scalar
+ */
+static void ted_prune_scalar_avx2(__m256i *kp, const __m256i *k)
+{
+  const __m256i t0 = VSET164(0xFFFFFFF8U);
+  const __m256i t1 = VSET164(0x7FFFFFFFU);
+  const __m256i t2 = VSET164(0x40000000U);
+  int i;
+
+  PROF_START(t_prune);
+  for (i = 0; i < 8; i++) kp[i] = k[i];
+  kp[0] = VAND(kp[0], t0);
+  kp[7] = VAND(kp[7], t1);
+  kp[7] = VOR(kp[7], t2);
+  PROF_STOP(PROF_PRUNE, t_prune);
 }
 
 
@@ -235,38 +477,1012 @@ void ted_conv_scalar2nibble_avx2(__m256i *e, const __m256i *k)
 void ted_mul_fixbase_avx2(ProPoint *r, const __m256i *k)
 {
   ExtPoint h;
-  __m256i e[64], carry, kp[8];
+  __m256i kp[8];
+
+  ted_prune_scalar_avx2(kp, k);
+  ted_mul_fixbase_ext_avx2(&h, kp);
+
+  // mpi29_copy_avx2(r->x, h.x);
+  mpi29_copy_avx2(r->y, h.y);
+  mpi29_copy_avx2(r->z, h.z);
+}
+
+
+/**
+ * @brief Query the 8-torsion subgroup.
+ *
+ * @details
+ * Select the point c*T of the 8-torsion subgroup in each lane, with z = 1,
+ * e = x and h = y. All eight points are masked in, so the query is 
+ * constant-time.
+ *
+ * @param r Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ * @param c Index of the point in each lane (0 <= c <= 7)
+ */
+static void ted_point_query_torsion_avx2(ExtPoint *r, const __m256i c)
+{
+  __m256i mask;
+  int g, i;
+
+  for (i = 0; i < NWORDS; i++) r->x[i] = r->y[i] = r->z[i] = VZERO;
+  r->z[0] = VSET164(1);
+  for (g = 0; g < 8; g++) {
+    mask = _mm256_cmpeq_epi64(c, VSET164(g));
+    for (i = 0; i < NWORDS; i++) {
+      r->x[i] = VXOR(r->x[i], VAND(mask, VSET164(torsion29[g][0][i])));
+      r->y[i] = VXOR(r->y[i], VAND(mask, VSET164(torsion29[g][1][i])));
+    }
+  }
+  mpi29_copy_avx2(r->e, r->x);
+  mpi29_copy_avx2(r->h, r->y);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication plus a low-order point.
+ *
+ * @details
+ * R = k * B + c * T.
+ * Same as ted_mul_fixbase_avx2, but the point c*T of the 8-torsion subgroup 
+ * is added to the result. The pruned scalar is a multiple of 8, so every 
+ * X25519 shared secret with the (u-coordinate of the) sum equals the one with
+ * k * B, whereas k * B alone is always in the subgroup of prime order.
+ * 
+ * @param r Projective point 
+ * @param k Scalar 
+ * @param c Index of the low-order point in each lane (0 <= c <= 7)
+ */
+void ted_mul_fixbase_dirty_avx2(ProPoint *r, const __m256i *k, const __m256i c)
+{
+  ExtPoint h, q;
+  __m256i kp[8];
+
+  ted_prune_scalar_avx2(kp, k);
+  ted_mul_fixbase_ext_avx2(&h, kp);
+  ted_point_query_torsion_avx2(&q, c);
+  ted_point_add_ext_avx2(&h, &h, &q);
+
+  mpi29_copy_avx2(r->y, h.y);
+  mpi29_copy_avx2(r->z, h.z);
+}
+
+
+/**
+ * @brief Precomputation of the tables of four points.
+ *
+ * @details
+ * Lane l of P is the point of the table t[l]: the entry [j][k] is (k+1) * 
+ * 2^(4*TED_PEER_S*j) * P in Duif representation [(y+x)/2, (y-x)/2, d*x*y], 
+ * split into 29-bit limbs as base29. The multiples are computed in extended 
+ * coordinates and made affine with one (batched) inversion.
+ *
+ * @param t Tables of the four lanes
+ * @param p Points
+ * @return 0, or -1 if there is not enough memory
+ */
+int ted_peer_table_avx2(PeerTable *const *t, const ExtPoint *p)
+{
+  const int n = 8*TED_PEER_P;
+  __m256i (*x)[NWORDS], (*y)[NWORDS], (*z)[NWORDS], (*zi)[NWORDS];
+  __m256i c[3][NWORDS], h[NWORDS], d[NWORDS];
+  ExtPoint b, q;
+  uint64_t v[4];
+  int i, j, k, l, m;
+
+  x = (__m256i (*)[NWORDS])aligned_alloc(32, 4*(size_t)n*sizeof(*x));
+  if (x == NULL) return -1;
+  y = x + n; z = y + n; zi = z + n;
+
+  // (k+1) * b for the positions b = 2^(4*TED_PEER_S*j) * P
+  b = *p;
+  for (j = 0; j < TED_PEER_P; j++) {
+    q = b;
+    for (k = 0; k < 8; k++) {
+      if (k > 0) ted_point_add_ext_avx2(&q, &q, &b);
+      mpi29_copy_avx2(x[8*j+k], q.x);
+      mpi29_copy_avx2(y[8*j+k], q.y);
+      mpi29_copy_avx2(z[8*j+k], q.z);
+    }
+    for (i = 0; (j < TED_PEER_P-1) && (i < 4*TED_PEER_S); i++) ted_point_dbl_avx2(&b, &b);
+  }
+  mpi29_gfp_batchinv_avx2(zi, (const __m256i (*)[NWORDS])z, n);
+
+  for (i = 0; i < NWORDS; i++) {
+    h[i] = VSET164(one_half29[i]);
+    d[i] = VSET164(cond29[i]);
+  }
+  for (m = 0; m < n; m++) {
+    // [(y+x)/2, (y-x)/2, d*x*y] of x = X/Z and y = Y/Z
+    mpi29_gfp_mul_avx2(x[m], x[m], zi[m]);
+    mpi29_gfp_mul_avx2(y[m], y[m], zi[m]);
+    mpi29_gfp_add_avx2(c[0], y[m], x[m]);
+    mpi29_gfp_mul_avx2(c[0], c[0], h);
+    mpi29_gfp_sbc_avx2(c[1], y[m], x[m]);
+    mpi29_gfp_mul_avx2(c[1], c[1], h);
+    mpi29_gfp_mul_avx2(c[2], x[m], y[m]);
+    mpi29_gfp_mul_avx2(c[2], c[2], d);
+    for (k = 0; k < 3; k++)
+      for (i = 0; i < NWORDS; i++) {
+        VSTOREU(v, c[k][i]);
+        for (l = 0; l < 4; l++) t[l]->t[m/8][k][i][m%8] = (uint32_t)v[l];
+      }
+  }
+
+  free(x);
+  return 0;
+}
+
+
+/**
+ * @brief Point multiplication based on the tables of four points.
+ *
+ * @details
+ * Lane l of R is the entry |b|-1 of position pos of the table t[l], or the 
+ * neutral element if b = 0 (and negated if b < 0). A row of a table holds a 
+ * limb of all eight entries, so a vpermd selects the entry of a lane and the 
+ * four rows are blended. There are no secret-dependent addresses.
+ *
+ * @param r Point of the table in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
+ * @param t Tables of the four lanes
+ * @param pos Position of the tables
+ * @param b Scalar (a signed digit)
+ */
+void ted_point_query_peer_avx2(ProPoint *r, const PeerTable *const *t, const int pos, 
+  const __m256i b)
+{
+  const __m256i lo32 = VSET164(0xFFFFFFFFU);
+  const __m256i one = VSET164(1);
+  const __m256i babs = VABS8(b);
+  const __m256i index = VSUB(babs, one);
+  __m256i zmask, bsign, t0[NWORDS], v;
+  __m256i *coor[3];
+  int c, i;
+
+  // the lanes with b = 0 get the neutral element [1/2, 1/2, 0]
+  zmask = _mm256_cmpeq_epi64(babs, VZERO);
+  coor[0] = r->x; coor[1] = r->y; coor[2] = r->z;
+  for (c = 0; c < 3; c++)
+    for (i = 0; i < NWORDS; i++) {
+      v = _mm256_permutevar8x32_epi32(_mm256_load_si256((__m256i *)t[0]->t[pos][c][i]), index);
+      v = VBLEND32(v, _mm256_permutevar8x32_epi32(
+        _mm256_load_si256((__m256i *)t[1]->t[pos][c][i]), index), 0x0C);
+      v = VBLEND32(v, _mm256_permutevar8x32_epi32(
+        _mm256_load_si256((__m256i *)t[2]->t[pos][c][i]), index), 0x30);
+      v = VBLEND32(v, _mm256_permutevar8x32_epi32(
+        _mm256_load_si256((__m256i *)t[3]->t[pos][c][i]), index), 0xC0);
+      coor[c][i] = _mm256_andnot_si256(zmask, VAND(v, lo32));
+    }
+  for (i = 0; i < NWORDS; i++) {
+    v = VAND(zmask, VSET164(one_half29[i]));
+    r->x[i] = VOR(r->x[i], v);
+    r->y[i] = VOR(r->y[i], v);
+  }
+
+  // if b < 0, swap the first two coordinates and negate d*x*y
+  bsign = VSHR(b, 7);
+  v = VSUB(VZERO, bsign);
+  for (i = 0; i < NWORDS; i++) {
+    t0[i]   = VAND(VXOR(r->x[i], r->y[i]), v);
+    r->x[i] = VXOR(r->x[i], t0[i]);
+    r->y[i] = VXOR(r->y[i], t0[i]);
+    t0[i] = VZERO;
+  }
+  mpi29_gfp_sub_avx2(t0, t0, r->z);
+  mpi29_cswap_avx2(r->z, t0, bsign);
+}
+
+
+/**
+ * @brief Scalar multiplication with the tables of four points.
+ *
+ * @details
+ * H = k * P.
+ * Lane l of H is k * P for lane l of k and the point P of the table t[l], 
+ * computed with the comb of the tables: 64 signed 4-bit digits, the digits 
+ * TED_PEER_S*j + s of the same tooth s share 4 doublings. The scalar k < 2^255
+ * is not pruned. Constant-time.
+ * 
+ * @param h Point in extended projective coordinates 
+ * @param t Tables of the four lanes
+ * @param k Scalar 
+ */
+void ted_mul_peer_avx2(ExtPoint *h, const PeerTable *const *t, const __m256i *k)
+{
+  ProPoint p;
+  __m256i e[TED_PEER_D];
+  int i, j;
+
+  ted_conv_scalar2digit_w_avx2(e, k, 4, TED_PEER_D);
+
+  ted_point_init_ext_avx2(h);
+
+  for (j = TED_PEER_S-1; j >= 0; j--) {
+    if (j < TED_PEER_S-1) 
+      for (i = 0; i < 4; i++) ted_point_dbl_avx2(h, h);
+    for (i = j; i < TED_PEER_D; i += TED_PEER_S) {
+      ted_point_query_peer_avx2(&p, t, i/TED_PEER_S, e[i]);
+      ted_point_add_avx2(h, h, &p);
+    }
+  }
+}
+
+
+/**
+ * @brief Point multiplication based on the look-up table (variable-time).
+ *
+ * @details
+ * Variable-time version of ted_point_query_table_avx2 for public digits: the 
+ * vpermd only reads the groups of eight entries that hold an entry |b|-1 of a
+ * lane, and the swap and the negation are skipped if no lane has b < 0.
+ *
+ * @param r Point of the table in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
+ * @param pos Position of the table
+ * @param b Scalar (a signed digit)
+ */
+void ted_point_query_table_vartime_avx2(ProPoint *r, const int pos, const __m256i b)
+{
+  const __m256i lo32 = VSET164(0xFFFFFFFFU);
+  const __m256i one = VSET164(1);
+  const __m256i babs = VABS8(b);
+  const __m256i index = VSUB(babs, one);
+  const uint32_t (*const tab)[NWORDS][FIXBASE_K] = fixbase29[pos];
+  __m256i gmask, zmask, bsign, t[NWORDS], v;
+  __m256i *coor[3];
+  int c, g, i;
+
+  zmask = VAND(_mm256_cmpeq_epi64(babs, VZERO), lo32);
+  for (i = 0; i < NWORDS; i++) {
+    r->x[i] = r->y[i] = VAND(zmask, VSET164(one_half29[i]));
+    r->z[i] = VZERO;
+  }
+
+  coor[0] = r->x; coor[1] = r->y; coor[2] = r->z;
+  for (g = 0; g < FIXBASE_K/8; g++) {
+    gmask = VAND(_mm256_cmpeq_epi64(VSHR(index, 3), VSET164(g)), lo32);
+    if (_mm256_testz_si256(gmask, gmask)) continue;
+    for (c = 0; c < 3; c++)
+      for (i = 0; i < NWORDS; i++) {
+        v = _mm256_load_si256((__m256i *)&tab[c][i][8*g]);
+        v = _mm256_permutevar8x32_epi32(v, index);
+        coor[c][i] = VXOR(coor[c][i], VAND(gmask, v));
+      }
+  }
+
+  bsign = VSHR(b, 7);
+  if (_mm256_testz_si256(bsign, bsign)) return;
+  v = VSUB(VZERO, bsign);
+  for (i = 0; i < NWORDS; i++) {
+    t[i]    = VAND(VXOR(r->x[i], r->y[i]), v);
+    r->x[i] = VXOR(r->x[i], t[i]);
+    r->y[i] = VXOR(r->y[i], t[i]);
+    t[i] = VZERO;
+  }
+  mpi29_gfp_sub_avx2(t, t, r->z);
+  mpi29_cswap_avx2(r->z, t, bsign);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication on twisted Edwards curve 
+ * (variable-time).
+ *
+ * @details
+ * H = k * B.
+ * Variable-time version of ted_mul_fixbase_ext_avx2 for public scalars (e.g. 
+ * in the signature verification): the query only scans the groups of eight 
+ * entries used by some lane (masked vpermd per group), the negation 
+ * (mpi29_cswap_avx2) is skipped if no digit is negative, and the additions of
+ * four zero digits are skipped. 
+ * 
+ * @param h Point in extended projective coordinates
+ * @param k Scalar 
+ */
+void ted_mul_fixbase_vartime_avx2(ExtPoint *h, const __m256i *k)
+{
+  ProPoint p;
+  __m256i e[FIXBASE_D];
+  int i, j;
+
+  ted_conv_scalar2digit_avx2(e, k);
+
+  ted_point_init_ext_avx2(h);
+
+  for (j = FIXBASE_S-1; j >= 0; j--) {
+    if (j < FIXBASE_S-1) 
+      for (i = 0; i < FIXBASE_W; i++) ted_point_dbl_avx2(h, h);
+    for (i = j; i < FIXBASE_D; i += FIXBASE_S) {
+      if (_mm256_testz_si256(e[i], e[i])) continue;
+      ted_point_query_table_vartime_avx2(&p, i/FIXBASE_S, e[i]);
+      ted_point_add_avx2(h, h, &p);
+    }
+  }
+}
+
+
+/**
+ * @brief Gather a point from four points.
+ *
+ * @details
+ * Lane l of R is lane l of the point t[l].
+ *
+ * @param r Point in extended projective coordinates
+ * @param t Pointers to the points of the four lanes
+ */
+static void ted_point_gather_avx2(ExtPoint *r, const ExtPoint *const *t)
+{
+  const int nvec = sizeof(ExtPoint)/sizeof(__m256i);
+  const __m256i *v0 = (const __m256i *)t[0], *v1 = (const __m256i *)t[1];
+  const __m256i *v2 = (const __m256i *)t[2], *v3 = (const __m256i *)t[3];
+  __m256i *v = (__m256i *)r;
+  int i;
+
+  for (i = 0; i < nvec; i++) {
+    v[i] = VLOADU(v0 + i);
+    v[i] = VBLEND32(v[i], VLOADU(v1 + i), 0x0C);
+    v[i] = VBLEND32(v[i], VLOADU(v2 + i), 0x30);
+    v[i] = VBLEND32(v[i], VLOADU(v3 + i), 0xC0);
+  }
+}
+
+
+/**
+ * @brief Sign of a point.
+ *
+ * @details
+ * Lane l of Q is lane l of P if d[l] > 0, of -P = [-x, y, z, -e, h] if d[l] 
+ * < 0, and the neutral element [0, 1, 1, 0, 1] if d[l] = 0. The coordinates x
+ * and e of P must be carried (outputs of a multiplication or of sbc).
+ *
+ * @param q Point in extended projective coordinates
+ * @param p Point in extended projective coordinates
+ * @param d Signed digits of the four lanes
+ */
+static void ted_point_sign_avx2(ExtPoint *q, const ExtPoint *p, const int16_t *d)
+{
+  __m256i t[NWORDS], neg, zmask;
+  int i;
+
+  *q = *p;
+  neg = VSET64(d[3] < 0, d[2] < 0, d[1] < 0, d[0] < 0);
+  zmask = VSET64(-(d[3] == 0), -(d[2] == 0), -(d[1] == 0), -(d[0] == 0));
+  for (i = 0; i < NWORDS; i++) t[i] = VZERO;
+  mpi29_gfp_sbc_avx2(t, t, p->x);
+  mpi29_cswap_avx2(q->x, t, neg);
+  for (i = 0; i < NWORDS; i++) t[i] = VZERO;
+  mpi29_gfp_sbc_avx2(t, t, p->e);
+  mpi29_cswap_avx2(q->e, t, neg);
+  for (i = 0; i < NWORDS; i++) {
+    q->x[i] = _mm256_andnot_si256(zmask, q->x[i]);
+    q->e[i] = _mm256_andnot_si256(zmask, q->e[i]);
+    q->y[i] = _mm256_andnot_si256(zmask, q->y[i]);
+    q->z[i] = _mm256_andnot_si256(zmask, q->z[i]);
+    q->h[i] = _mm256_andnot_si256(zmask, q->h[i]);
+  }
+  zmask = VSHR(zmask, 63);
+  q->y[0] = VOR(q->y[0], zmask);
+  q->z[0] = VOR(q->z[0], zmask);
+  q->h[0] = VOR(q->h[0], zmask);
+}
+
+
+/**
+ * @brief Add four points to the buckets of their lanes.
+ *
+ * @details
+ * Lane l of P is added to lane l of bucket |d[l]|-1, negated if d[l] < 0 and 
+ * replaced by the neutral element if d[l] = 0. Each lane has its own buckets, 
+ * so the buckets of the four lanes are loaded with blends and written back 
+ * with masked stores. Not constant-time.
+ *
+ * @param b Buckets
+ * @param p Points
+ * @param d Signed digits of the four lanes
+ */
+static void ted_bucket_add_avx2(ExtPoint *b, const ExtPoint *p, const int16_t *d)
+{
+  ExtPoint s, q;
+  const int nvec = sizeof(ExtPoint)/sizeof(__m256i);
+  const __m256i *v = (const __m256i *)&s;
+  const ExtPoint *bl[4];
+  __m256i lmask;
+  int l, i;
+
+  for (l = 0; l < 4; l++) bl[l] = &b[(d[l] == 0) ? 0 : abs(d[l])-1];
+
+  ted_point_gather_avx2(&s, bl);
+  ted_point_sign_avx2(&q, p, d);
+  ted_point_add_ext_avx2(&s, &s, &q);
+
+  // scatter the lanes back to their buckets
+  for (l = 0; l < 4; l++) {
+    lmask = VSET64(-(l == 3), -(l == 2), -(l == 1), -(l == 0));
+    for (i = 0; i < nvec; i++) 
+      _mm256_maskstore_epi64((long long *)((__m256i *)bl[l] + i), lmask, v[i]);
+  }
+}
+
+
+/**
+ * @brief Convert a scalar to signed digits of c bits.
+ *
+ * @details
+ * Digits e[i] in [-2^(c-1), 2^(c-1)) with k = sum e[i]*2^(c*i), nw windows.
+ *
+ * @param e Digits
+ * @param k Scalar (32 bytes, k < 2^255)
+ * @param c Window width
+ * @param nw Number of windows
+ */
+static void ted_conv_scalar2window(int16_t *e, const uint8_t *k, int c, int nw)
+{
+  int i, j, b, w, carry = 0;
+
+  for (i = 0; i < nw; i++) {
+    for (w = 0, j = 0; j < c; j++) {
+      b = c*i + j;
+      if (b < 256) w |= ((k[b >> 3] >> (b & 7)) & 1) << j;
+    }
+    w += carry;
+    carry = (w + (1 << (c-1))) >> c;
+    e[i] = (int16_t)(w - (carry << c));
+  }
+}
+
+
+/**
+ * @brief Multi-scalar multiplication (Pippenger).
+ *
+ * @details
+ * R = k[0]*P[0] + k[1]*P[1] + ..., where lane l of p[t] is the point P[4t+l].
+ * Every lane computes the sum of its points with the bucket method on signed
+ * windows of c bits (c is chosen from the number of points), i.e. per window
+ * each point is added to one bucket and the buckets are summed up with 2^c 
+ * additions, and finally the sums of the four lanes are added. Groups of 
+ * four zero digits are skipped. Not constant-time (for public scalars only).
+ *
+ * @param r Sum (in all lanes)
+ * @param p Points of the groups
+ * @param k Scalars (4*np, k < 2^255)
+ * @param np Number of groups
+ * @return 0, or -1 if there is not enough memory
+ */
+int ted_msm_vartime_avx2(ExtPoint *r, const ExtPoint *p, const uint8_t (*k)[32], 
+  const int np)
+{
+  ExtPoint *b, run, sum, u;
+  int16_t *e;
+  long cost, best = -1;
+  int c, nb, nw = 0, w, t, j, i, l, w0;
+
+  // window width with the smallest number of additions
+  for (c = 2, w0 = 2; c <= 10; c++) {
+    cost = (long)(256/c + 1)*(np + (2 << (c-1)));
+    if ((best < 0) || (cost < best)) { best = cost; w0 = c; }
+  }
+  c = w0;
+  nb = 1 << (c-1);
+  nw = 256/c + 1;
+
+  e = (int16_t *)malloc((size_t)4*np*nw*sizeof(int16_t));
+  b = (ExtPoint *)aligned_alloc(32, (size_t)nb*sizeof(ExtPoint));
+  if ((e == NULL) || (b == NULL)) { free(e); free(b); return -1; }
+  for (i = 0; i < 4*np; i++) ted_conv_scalar2window(e + i*nw, k[i], c, nw);
+
+  ted_point_init_ext_avx2(r);
+  for (w = nw-1; w >= 0; w--) {
+    for (i = 0; (w < nw-1) && (i < c); i++) ted_point_dbl_avx2(r, r);
+
+    for (j = 0; j < nb; j++) ted_point_init_ext_avx2(&b[j]);
+    for (t = 0, l = 0; t < np; t++) {
+      int16_t d[4] = { e[(4*t)*nw+w], e[(4*t+1)*nw+w], e[(4*t+2)*nw+w], 
+        e[(4*t+3)*nw+w] };
+      if ((d[0] | d[1] | d[2] | d[3]) == 0) continue;
+      ted_bucket_add_avx2(b, &p[t], d);
+      l = 1;
+    }
+    if (!l) continue;
+
+    // sum of (j+1)*b[j]
+    run = sum = b[nb-1];
+    for (j = nb-2; j >= 0; j--) {
+      ted_point_add_ext_avx2(&run, &run, &b[j]);
+      ted_point_add_ext_avx2(&sum, &sum, &run);
+    }
+    ted_point_add_ext_avx2(r, r, &sum);
+  }
+
+  // add the sums of the lanes
+  MPI29_PERM(u.x, r->x, 0xB1); MPI29_PERM(u.y, r->y, 0xB1); 
+  MPI29_PERM(u.z, r->z, 0xB1); MPI29_PERM(u.e, r->e, 0xB1); 
+  MPI29_PERM(u.h, r->h, 0xB1);
+  ted_point_add_ext_avx2(r, r, &u);
+  MPI29_PERM(u.x, r->x, 0x4E); MPI29_PERM(u.y, r->y, 0x4E); 
+  MPI29_PERM(u.z, r->z, 0x4E); MPI29_PERM(u.e, r->e, 0x4E); 
+  MPI29_PERM(u.h, r->h, 0x4E);
+  ted_point_add_ext_avx2(r, r, &u);
+
+  free(e);
+  free(b);
+  return 0;
+}
+
+
+/**
+ * @brief Point decoding.
+ *
+ * @details
+ * Decode four 32-byte strings to points (RFC 8032, 5.1.3): the x-coordinate 
+ * is x = u*v^3*(u*v^7)^((p-5)/8) with u = y^2-1 and v = d*y^2+1, multiplied 
+ * by sqrt(-1) if v*x^2 = -u, and negated if its parity differs from bit 255. 
+ * A string is rejected if y >= p, if u/v is not a square, or if x = 0 and 
+ * bit 255 is set. Not constant-time (for public points only).
+ *
+ * @param r Points in extended projective coordinates (z = 1)
+ * @param a Encoded points
+ * @return Bit l is set if the l-th string is a valid encoding
+ */
+int ted_point_decode_vartime_avx2(ExtPoint *r, const uint8_t (*a)[32])
+{
+  __m256i u[NWORDS], v[NWORDS], t[NWORDS], w[NWORDS], c[NWORDS];
+  __m256i zero, one;
+  uint8_t xb[4][32];
+  int64_t lane[4];
+  int i, l, sign, valid = 0;
+
+  // y < p (only bit 255, 0xFF or 0xED and above in bit 0 to 7 can exceed p)
+  for (l = 0; l < 4; l++) {
+    for (i = 1; (i < 31) && (a[l][i] == 0xFF); i++);
+    if ((i < 31) || ((a[l][31] & 0x7F) != 0x7F) || (a[l][0] < 0xED)) valid |= 1 << l;
+  }
+
+  one = VSET164(1);
+  zero = VZERO;
+  mpi29_conv_bytes2mpi29_avx2(r->y, a);
+  for (i = 0; i < NWORDS; i++) { c[i] = VSET164(cond29[i]); w[i] = zero; }
+  w[0] = one;
+
+  // u = y^2-1, v = d*y^2+1
+  mpi29_gfp_sqr_avx2(t, r->y);
+  mpi29_gfp_sbc_avx2(u, t, w);
+  mpi29_gfp_mul_avx2(v, t, c);
+  mpi29_gfp_add_avx2(v, v, w);
+  // x = sqrt(u/v)
+  VSTOREU(lane, mpi29_gfp_sqrt_ratio_avx2(r->x, u, v));
+  for (l = 0; l < 4; l++) if (lane[l] == 0) valid &= ~(1 << l);
+
+  // the parity of x, x = 0 is only valid with bit 255 = 0
+  mpi29_conv_mpi292bytes_avx2(xb, r->x);
+  for (l = 0; l < 4; l++) {
+    sign = a[l][31] >> 7;
+    for (i = 0; (i < 32) && (xb[l][i] == 0); i++);
+    if ((i == 32) && sign) valid &= ~(1 << l);
+    lane[l] = (xb[l][0] & 1) ^ sign;
+  }
+  for (i = 0; i < NWORDS; i++) t[i] = zero;
+  mpi29_gfp_sbc_avx2(t, t, r->x);
+  mpi29_cswap_avx2(r->x, t, VLOADU(lane));
+
+  // z = 1, t = x*y
+  for (i = 0; i < NWORDS; i++) r->z[i] = zero;
+  r->z[0] = one;
+  mpi29_copy_avx2(r->e, r->x);
+  mpi29_copy_avx2(r->h, r->y);
+
+  return valid;
+}
+
+
+/**
+ * @brief Convert a scalar to its width-w NAF.
+ *
+ * @details
+ * Digits e[i] are zero or odd in [-(2^(W-1)-1), 2^(W-1)-1], W = TED_WNAF_W, 
+ * such that k = sum e[i]*2^i and every W consecutive digits contain at most 
+ * one nonzero digit. The scalar must be less than 2^255.
+ *
+ * @param e Digits (256)
+ * @param k Scalar (32 bytes)
+ */
+static void ted_conv_scalar2wnaf(int8_t *e, const uint8_t *k)
+{
+  const int half = 1 << (TED_WNAF_W-1);
+  int i, j, w, carry = 0;
+
+  for (i = 0; i < 256; i++) e[i] = 0;
+  for (i = 0; i < 256; i++) {
+    if (((k[i >> 3] >> (i & 7)) & 1) == carry) continue;
+    // the W bits from i (shifted across bytes) plus the carry, made odd
+    for (w = 0, j = TED_WNAF_W-1; j >= 0; j--) 
+      w = (w << 1) | ((i+j < 256) ? ((k[(i+j) >> 3] >> ((i+j) & 7)) & 1) : 0);
+    w = (w + carry) & ((half << 1) - 1);
+    if (w >= half) { w -= half << 1; carry = 1; }
+    else carry = 0;
+    e[i] = (int8_t)w;
+    i += TED_WNAF_W-1;
+  }
+}
+
+
+/**
+ * @brief Variable-base scalar multiplication on twisted Edwards curve 
+ * (variable-time).
+ *
+ * @details
+ * R = k * P.
+ * Scalar multiplication of four different points by four public scalars with 
+ * the width-w NAF: the odd multiples P, 3P, ..., (2^(W-1)-1)P are computed on 
+ * the fly, and every nonzero digit adds the multiple of its lane (loaded with 
+ * blends, negated if the digit is negative). Four zero digits only cost a 
+ * doubling. Not constant-time (for public scalars and points only).
+ *
+ * @param r Point in extended projective coordinates
+ * @param p Point in extended projective coordinates
+ * @param k Scalars (four, k < 2^255)
+ */
+void ted_mul_varbase_vartime_avx2(ExtPoint *r, const ExtPoint *p, const uint8_t (*k)[32])
+{
+  ExtPoint t[1 << (TED_WNAF_W-2)], p2, q;
+  const ExtPoint *tl[4];
+  int8_t e[4][256];
+  int16_t d[4];
+  int i, l, top = -1;
+
+  for (l = 0; l < 4; l++) {
+    ted_conv_scalar2wnaf(e[l], k[l]);
+    for (i = 255; i > top; i--) if (e[l][i]) { top = i; break; }
+  }
+
+  // odd multiples, the coordinate e of P (e.g. a difference without carry) is 
+  // carried such that it can be negated
+  t[0] = *p;
+  for (i = 0; i < NWORDS; i++) q.e[i] = VZERO;
+  mpi29_gfp_sbc_avx2(t[0].e, p->e, q.e);
+  p2 = *p;
+  ted_point_dbl_avx2(&p2, &p2);
+  for (i = 1; i < (1 << (TED_WNAF_W-2)); i++) ted_point_add_ext_avx2(&t[i], &t[i-1], &p2);
+
+  ted_point_init_ext_avx2(r);
+  for (i = top; i >= 0; i--) {
+    if (i < top) ted_point_dbl_avx2(r, r);
+    for (l = 0; l < 4; l++) {
+      d[l] = e[l][i];
+      tl[l] = &t[(d[l] == 0) ? 0 : (abs(d[l])-1)/2];
+    }
+    if ((d[0] | d[1] | d[2] | d[3]) == 0) continue;
+    ted_point_gather_avx2(&q, tl);
+    ted_point_sign_avx2(&q, &q, d);
+    ted_point_add_ext_avx2(r, r, &q);
+  }
+}
+
+
+/**
+ * @brief (1*4)-way point addition.
+ *
+ * @details
+ * Unified mixed addition R = P + Q with two (1*4)-way multiplications, first 
+ * [A, B, C, D] = [y-x, y+x, t, z] * Q and then [E, G, F, E] * [F, H, G, H] with
+ * E = B-A, F = D-C, G = D+C and H = B+A.
+ *
+ * @param r Point in extended projective coordinates [x, y, z, t]
+ * @param p Point in extended projective coordinates [x, y, z, t]
+ * @param q Point in Duif representation [(y-x)/2, (y+x)/2, d*x*y, 1]
+ */
+void ted_point_add_1x4_avx2(__m256i *r, const __m256i *p, const __m256i *q)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS];
+  int i;
+
+  // [A, B, C, D] = [y-x, y+x, t, z] * Q
+  MPI29_PERM(t0, p, 0xB5);                // [y, y, t, z]
+  for (i = 0; i < NWORDS; i++) t1[i] = VBLEND32(VZERO, VPERM64(p[i], 0), 0x0F);
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(t2, t2, t0, 0x03);
+  mpi29_gfp_mul_avx2(t2, t2, q);
+  // [E, F, G, H] = [B-A, D-C, D+C, B+A]
+  MPI29_PERM(t0, t2, 0x7D);               // [B, D, D, B]
+  MPI29_PERM(t1, t2, 0x28);               // [A, C, C, A]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(t2, t0, t2, 0xF0);
+  // [x, y, z, t] = [E*F, G*H, F*G, E*H]
+  MPI29_PERM(t0, t2, 0x18);
+  MPI29_PERM(t1, t2, 0xED);
+  mpi29_gfp_mul_avx2(r, t0, t1);
+}
+
+
+/**
+ * @brief (1*4)-way point doubling.
+ *
+ * @details
+ * Doubling R = 2*P, the squaring [x^2, y^2, z^2, (x+y)^2] is followed by the
+ * same multiplication as in the (1*4)-way point addition.
+ *
+ * @param r Point in extended projective coordinates [x, y, z, t]
+ * @param p Point in extended projective coordinates [x, y, z, t]
+ */
+void ted_point_dbl_1x4_avx2(__m256i *r, const __m256i *p)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS];
+  int i;
+
+  // [A, B, z^2, (x+y)^2]
+  MPI29_PERM(t0, p, 0x64);                // [x, y, z, y]
+  for (i = 0; i < NWORDS; i++) t1[i] = VBLEND32(VZERO, VPERM64(p[i], 0), 0xC0);
+  mpi29_gfp_add_avx2(t0, t0, t1);
+  mpi29_gfp_sqr_avx2(t3, t0);
+  // [E, F, G, H] = [H-(x+y)^2, G+2*z^2, A-B, A+B]
+  MPI29_PERM(t0, t3, 0x00);
+  MPI29_PERM(t1, t3, 0x55);
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(t2, t2, t0, 0x3C);          // [H, G, G, H]
+  MPI29_PERM(t0, t3, 0xAA);
+  mpi29_gfp_add_avx2(t0, t0, t0);
+  for (i = 0; i < NWORDS; i++) t0[i] = VBLEND32(VZERO, t0[i], 0x0C);
+  mpi29_gfp_add_avx2(t0, t2, t0);
+  MPI29_PERM(t1, t3, 0xFF);
+  mpi29_gfp_sbc_avx2(t1, t2, t1);
+  MPI29_BLEND(t2, t0, t1, 0x03);
+  // [x, y, z, t] = [E*F, G*H, F*G, E*H]
+  MPI29_PERM(t0, t2, 0x18);
+  MPI29_PERM(t1, t2, 0xED);
+  mpi29_gfp_mul_avx2(r, t0, t1);
+}
+
+
+/**
+ * @brief (1*4)-way table query.
+ *
+ * @details
+ * Look up the table in constant time and return the multiple of base point as
+ * a (1*4)-way field element [(y-x)/2, (y+x)/2, d*x*y, 1].
+ *
+ * @param r Point in Duif representation [(y-x)/2, (y+x)/2, d*x*y, 1]
+ * @param pos Position of the table
+ * @param b Scalar (a signed digit)
+ */
+void ted_point_query_table_1x4_avx2(__m256i *r, const int pos, const int b)
+{
+  const uint32_t bsign = (uint32_t)b >> 31;
+  const uint32_t babs = (b ^ -bsign) + bsign;
+  const LutPoint *const tab = fixbase[pos];
+  __m256i xP, yP, zP, mask, t0, t1, t2, t3, w[4], n[NWORDS], t[NWORDS];
+  int j;
+
+  xP = yP = VLOADU(one_half);
+  zP = VZERO;
+  for (j = 0; j < FIXBASE_K; j++) {
+    mask = VSET164(-(int64_t)(((babs ^ (j+1)) - 1) >> 31));
+    xP = VXOR(xP, VAND(mask, VXOR(xP, VLOADU(tab[j].x))));
+    yP = VXOR(yP, VAND(mask, VXOR(yP, VLOADU(tab[j].y))));
+    zP = VXOR(zP, VAND(mask, VXOR(zP, VLOADU(tab[j].z))));
+  }
+
+  // transpose the rows [(y-x)/2, (y+x)/2, d*x*y, 1] to 64-bit words
+  t2 = VSET64(0, 0, 0, 1);
+  t0 = _mm256_unpacklo_epi64(yP, xP);
+  t1 = _mm256_unpackhi_epi64(yP, xP);
+  t3 = _mm256_unpackhi_epi64(zP, t2);
+  t2 = _mm256_unpacklo_epi64(zP, t2);
+  w[0] = _mm256_permute2x128_si256(t0, t2, 0x20);
+  w[1] = _mm256_permute2x128_si256(t1, t3, 0x20);
+  w[2] = _mm256_permute2x128_si256(t0, t2, 0x31);
+  w[3] = _mm256_permute2x128_si256(t1, t3, 0x31);
+  lut_conv_coor2mpi29_avx2(r, w);
+
+  // -Q = [(y+x)/2, (y-x)/2, -d*x*y, 1] if b < 0
+  MPI29_PERM(n, r, 0xE1);
+  for (j = 0; j < NWORDS; j++) t[j] = VZERO;
+  mpi29_gfp_sub_avx2(t, t, n);
+  MPI29_BLEND(n, n, t, 0x30);
+  mpi29_cswap_avx2(r, n, VSET164(bsign));
+}
+
+
+/**
+ * @brief (1*4)-way fixed-base scalar multiplication on twisted Edwards curve.
+ *
+ * @details
+ * R = k * B.
+ * Single-instance version of ted_mul_fixbase_avx2 with the (1*4)-way point 
+ * operations, the scalar is converted to signed digits in constant time.
+ * 
+ * @param r Point in extended projective coordinates [x, y, z, t]
+ * @param k Scalar (32 bytes)
+ */
+void ted_mul_fixbase_1x4_avx2(__m256i *r, const uint8_t *k)
+{
+  __m256i q[NWORDS];
+  uint8_t kp[33];
+  int e[FIXBASE_D], carry = 0, i, j, b;
+
+  // prune scalar k and convert it to unsigned digits
+  for (i = 0; i < 32; i++) kp[i] = k[i];
+  kp[0] &= 0xF8;
+  kp[31] &= 0x7F;
+  kp[31] |= 0x40;
+  kp[32] = 0;
+  for (i = 0; i < FIXBASE_D; i++) {
+    b = FIXBASE_W*i;
+    e[i] = (kp[b>>3] | (kp[(b>>3)+1] << 8)) >> (b&7);
+    e[i] &= (1 << FIXBASE_W) - 1;
+  }
+
+  // convert unsigned digits to signed
+  for (i = 0; i < FIXBASE_D-1; i++) {
+    e[i] += carry;
+    carry = (e[i] + (1 << (FIXBASE_W-1))) >> FIXBASE_W;
+    e[i] -= carry << FIXBASE_W;
+  }
+  e[FIXBASE_D-1] += carry;
+
+  // P is [0, 1, 1, 0] now
+  for (i = 1; i < NWORDS; i++) r[i] = VZERO;
+  r[0] = VSET64(0, 1, 1, 0);
+
+  for (j = FIXBASE_S-1; j >= 0; j--) {
+    if (j < FIXBASE_S-1) 
+      for (i = 0; i < FIXBASE_W; i++) ted_point_dbl_1x4_avx2(r, r);
+    for (i = j; i < FIXBASE_D; i += FIXBASE_S) {
+      ted_point_query_table_1x4_avx2(q, i/FIXBASE_S, e[i]);
+      ted_point_add_1x4_avx2(r, r, q);
+    }
+  }
+}
+
+
+/**
+ * @brief The last multiplications of the (2*2)-way point operations.
+ *
+ * @details
+ * [x, y] = [E, G] * [F, H] and [z, t] = [F, E] * [G, H].
+ *
+ * @param r Point in extended projective coordinates [x, y] and [z, t]
+ * @param eh Field element [E, H]
+ * @param fg Field element [F, G]
+ */
+static void ted_point_efgh_2x2_avx2(__m256i *r, const __m256i *eh, 
+  const __m256i *fg)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS];
+
+  MPI29_BLEND(t0, eh, fg, 0xCC);          // [E, G]
+  MPI29_BLEND(t1, fg, eh, 0xCC);          // [F, H]
+  mpi29_gfp_mul_avx2(r, t0, t1);
+  MPI29_SHUF(t2, eh, 0x44);               // [E, E]
+  MPI29_BLEND(t0, fg, t2, 0xCC);          // [F, E]
+  MPI29_SHUF(t2, fg, 0xEE);               // [G, G]
+  MPI29_BLEND(t1, t2, eh, 0xCC);          // [G, H]
+  mpi29_gfp_mul_avx2(r+NWORDS, t0, t1);
+}
+
+
+/**
+ * @brief (2*2)-way point addition.
+ *
+ * @details
+ * Unified mixed addition R = P + Q of two instances, each of them in one 
+ * 128-bit half, with four (2*2)-way multiplications: [A, B] = [y-x, y+x] * 
+ * [(y-x)/2, (y+x)/2], [C, D] = [t, z] * [d*x*y, 1], and the products of E = 
+ * B-A, F = D-C, G = D+C and H = B+A as in the (1*4)-way point addition.
+ *
+ * @param r Point in extended projective coordinates [x, y] and [z, t]
+ * @param p Point in extended projective coordinates [x, y] and [z, t]
+ * @param q Point in Duif representation [(y-x)/2, (y+x)/2] and [d*x*y, 1]
+ */
+void ted_point_add_2x2_avx2(__m256i *r, const __m256i *p, const __m256i *q)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS];
+
+  // [A, B] = [y-x, y+x] * [(y-x)/2, (y+x)/2] and [C, D] = [t, z] * [d*x*y, 1]
+  MPI29_SHUF(t0, p, 0xEE);                // [y, y]
+  MPI29_SHUF(t1, p, 0x44);                // [x, x]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  mpi29_gfp_sbc_avx2(t0, t0, t1);
+  MPI29_BLEND(t0, t0, t2, 0xCC);
+  mpi29_gfp_mul_avx2(t0, t0, q);
+  MPI29_SHUF(t1, p+NWORDS, 0x4E);         // [t, z]
+  mpi29_gfp_mul_avx2(t1, t1, q+NWORDS);
+  // [E, H] = [B-A, B+A] and [F, G] = [D-C, D+C]
+  MPI29_SHUF(t2, t0, 0xEE);               // [B, B]
+  MPI29_SHUF(t3, t0, 0x44);               // [A, A]
+  mpi29_gfp_add_avx2(t0, t2, t3);
+  mpi29_gfp_sbc_avx2(t2, t2, t3);
+  MPI29_BLEND(t0, t2, t0, 0xCC);
+  MPI29_SHUF(t2, t1, 0xEE);               // [D, D]
+  MPI29_SHUF(t3, t1, 0x44);               // [C, C]
+  mpi29_gfp_add_avx2(t1, t2, t3);
+  mpi29_gfp_sbc_avx2(t2, t2, t3);
+  MPI29_BLEND(t1, t2, t1, 0xCC);
+  ted_point_efgh_2x2_avx2(r, t0, t1);
+}
+
+
+/**
+ * @brief (2*2)-way point doubling.
+ *
+ * @details
+ * Doubling R = 2*P of two instances, the squarings [x^2, y^2] = [A, B] and 
+ * [z^2, (x+y)^2] are followed by the same multiplications as in the (2*2)-way
+ * point addition with E = H-(x+y)^2, F = G+2*z^2, G = A-B and H = A+B.
+ *
+ * @param r Point in extended projective coordinates [x, y] and [z, t]
+ * @param p Point in extended projective coordinates [x, y] and [z, t]
+ */
+void ted_point_dbl_2x2_avx2(__m256i *r, const __m256i *p)
+{
+  __m256i t0[NWORDS], t1[NWORDS], t2[NWORDS], t3[NWORDS];
+
+  // [z^2, (x+y)^2] and [A, B]
+  MPI29_SHUF(t0, p, 0x44);                // [x, x]
+  MPI29_SHUF(t1, p, 0xEE);                // [y, y]
+  mpi29_gfp_add_avx2(t2, t0, t1);
+  MPI29_SHUF(t0, p+NWORDS, 0x44);         // [z, z]
+  MPI29_BLEND(t0, t0, t2, 0xCC);
+  mpi29_gfp_sqr_avx2(t0, t0);
+  mpi29_gfp_sqr_avx2(t1, p);
+  // [E, H] and [F, G]
+  MPI29_SHUF(t2, t1, 0x44);               // [A, A]
+  MPI29_SHUF(t3, t1, 0xEE);               // [B, B]
+  mpi29_gfp_add_avx2(t1, t2, t3);         // [H, H]
+  mpi29_gfp_sbc_avx2(t2, t2, t3);         // [G, G]
+  MPI29_SHUF(t3, t0, 0xEE);
+  mpi29_gfp_sbc_avx2(t3, t1, t3);         // [E, E]
+  MPI29_BLEND(t3, t3, t1, 0xCC);
+  MPI29_SHUF(t0, t0, 0x44);
+  mpi29_gfp_add_avx2(t0, t0, t0);
+  mpi29_gfp_add_avx2(t0, t0, t2);         // [F, F]
+  MPI29_BLEND(t0, t0, t2, 0xCC);
+  ted_point_efgh_2x2_avx2(r, t3, t0);
+}
+
+
+/**
+ * @brief (2*2)-way fixed-base scalar multiplication on twisted Edwards curve.
+ *
+ * @details
+ * R = k * B.
+ * Two instances of ted_mul_fixbase_avx2 with the (2*2)-way point operations.
+ * The table is queried with ted_point_query_table_avx2, whose lanes 0, 1 and 
+ * 2, 3 get the same entry since they hold the same digit.
+ * 
+ * @param r Point in extended projective coordinates [x, y] and [z, t]
+ * @param k Scalars in the lanes [k0, k0, k1, k1]
+ */
+void ted_mul_fixbase_2x2_avx2(__m256i *r, const __m256i *k)
+{
+  ProPoint h;
+  __m256i q[2*NWORDS], e[FIXBASE_D], kp[8];
   const __m256i t0 = VSET164(0xFFFFFFF8U);
   const __m256i t1 = VSET164(0x7FFFFFFFU);
   const __m256i t2 = VSET164(0x40000000U);
-  int i;
+  int i, j, l;
 
   // prune scalar k
   for (i = 0; i < 8; i++) kp[i] = k[i];
   kp[0] = VAND(kp[0], t0);
   kp[7] = VAND(kp[7], t1);
   kp[7] = VOR(kp[7], t2);
+  ted_conv_scalar2digit_avx2(e, kp);
 
-  ted_conv_scalar2nibble_avx2(e, kp);
-
-  ted_point_init_ext_avx2(&h);
-
-  for (i = 1; i < 64; i += 2) {
-    ted_point_query_table_avx2(r, i>>1, e[i]);
-    ted_point_add_avx2(&h, &h, r);
-  }
-
-  ted_point_dbl_avx2(&h, &h);
-  ted_point_dbl_avx2(&h, &h);
-  ted_point_dbl_avx2(&h, &h);
-  ted_point_dbl_avx2(&h, &h);
+  // P is [0, 1] and [1, 0] now
+  for (i = 0; i < 2*NWORDS; i++) r[i] = VZERO;
+  r[0] = VSET64(1, 0, 1, 0);
+  r[NWORDS] = VSET64(0, 1, 0, 1);
 
-  for (i = 0; i < 64; i += 2) {
-    ted_point_query_table_avx2(r, i>>1, e[i]);
-    ted_point_add_avx2(&h, &h, r);
+  for (j = FIXBASE_S-1; j >= 0; j--) {
+    if (j < FIXBASE_S-1) 
+      for (i = 0; i < FIXBASE_W; i++) ted_point_dbl_2x2_avx2(r, r);
+    for (i = j; i < FIXBASE_D; i += FIXBASE_S) {
+      ted_point_query_table_avx2(&h, i/FIXBASE_S, e[i]);
+      if (i + FIXBASE_S < FIXBASE_D) ted_prefetch_table(i/FIXBASE_S + 1);
+      MPI29_BLEND(q, h.y, h.x, 0xCC);
+      for (l = 0; l < NWORDS; l++) q[NWORDS+l] = VBLEND32(h.z[l], VZERO, 0xCC);
+      q[NWORDS] = VOR(q[NWORDS], VSET64(1, 0, 1, 0));
+      ted_point_add_2x2_avx2(r, r, q);
+    }
   }
-
-  // mpi29_copy_avx2(r->x, h.x);
-  mpi29_copy_avx2(r->y, h.y);
-  mpi29_copy_avx2(r->z, h.z);
 }
@@ -28,12 +28,114 @@ typedef struct extended_point {
   __m256i h[NWORDS];  // extended h coordinate (e*h = t)
 } ExtPoint;
 
+// Point of look-up table in Duif representation [(y+x)/2, (y-x)/2, d*x*y] 
+typedef struct lut_point {
+  uint64_t x[4];  // Duif (y+x)/2 coordinate
+  uint64_t y[4];  // Duif (y-x)/2 coordinate
+  uint64_t z[4];  // Duif d*x*y coordinate
+} LutPoint;
+
+// geometry of the fixed-base comb (chosen at compile time): the scalar is 
+// recoded to FIXBASE_D signed digits of FIXBASE_W bits (4 <= W <= 7), and the 
+// digits FIXBASE_S*j + s of the same tooth s share the doublings
+#ifndef FIXBASE_W
+#define FIXBASE_W 4
+#endif
+#ifndef FIXBASE_S
+#define FIXBASE_S 2
+#endif
+#define FIXBASE_D ((256 + FIXBASE_W - 1) / FIXBASE_W)
+#define FIXBASE_P ((FIXBASE_D + FIXBASE_S - 1) / FIXBASE_S)
+#define FIXBASE_K (1 << (FIXBASE_W - 1))
+
+#if (FIXBASE_W < 4) || (FIXBASE_W > 7) || (FIXBASE_S < 1)
+#error "unsupported geometry of the fixed-base comb"
+#endif
+
+// look-up table of the multiples of base point, base[j][k] = (k+1) * 2^(W*S*j)
+// * B (defined in base.c, generated by tools/gentable at build time)
+extern const LutPoint base[FIXBASE_P][FIXBASE_K];
+// the same table pre-split into 29-bit limbs for the AVX2 lookup: limb l of 
+// coordinate c of base[j][k] is base29[j][c][l][k] (32-byte aligned rows)
+extern const uint32_t base29[FIXBASE_P][3][NWORDS][FIXBASE_K];
+// the tables that the calling thread reads: base and base29, or their replicas
+// on the NUMA node of the thread (see src/numa.h), read once per query
+extern __thread const LutPoint (*fixbase)[FIXBASE_K] 
+  __attribute__((tls_model("initial-exec")));
+extern __thread const uint32_t (*fixbase29)[3][NWORDS][FIXBASE_K]
+  __attribute__((tls_model("initial-exec")));
+
+/**
+ * @brief Prefetch the limb table of a position into L1.
+ *
+ * @details
+ * The comb reads the FIXBASE_P positions of the table in a fixed order, so
+ * the block of the next position (108*FIXBASE_K bytes) is requested while the
+ * point addition of the current one runs. The order depends on the position
+ * only, not on the scalar.
+ *
+ * @param pos Position in the table
+ */
+static inline void ted_prefetch_table(const int pos)
+{
+  const char *p = (const char *)fixbase29[pos];
+  unsigned int i;
+
+  for (i = 0; i < sizeof(fixbase29[0]); i += 64) _mm_prefetch(p + i, _MM_HINT_T0);
+}
+
+// geometry of the tables of other points than B (e.g. the public keys of 
+// peers): 64 signed 4-bit digits, the digits TED_PEER_S*j + s of tooth s share
+// the doublings, the table of a point takes TED_PEER_P*864 bytes
+#ifndef TED_PEER_S
+#define TED_PEER_S 4
+#endif
+#define TED_PEER_D 64
+#define TED_PEER_P ((TED_PEER_D + TED_PEER_S - 1) / TED_PEER_S)
+
+// table of the multiples of a point P in the layout of base29: limb l of 
+// coordinate c of (k+1) * 2^(4*TED_PEER_S*j) * P (Duif) is t[j][c][l][k]
+typedef struct peer_table {
+  uint32_t t[TED_PEER_P][3][NWORDS][8] __attribute__((aligned(32)));
+} PeerTable;
+
+// width of the NAF of the variable-base scalar multiplication (variable-time), 
+// 2^(W-2) odd multiples are computed on the fly
+#ifndef TED_WNAF_W
+#define TED_WNAF_W 5
+#endif
+
 // function prototypes
 
 void ted_point_add_avx2(ExtPoint *r, ExtPoint *p, ProPoint *q);
+void ted_point_add_ext_avx2(ExtPoint *r, const ExtPoint *p, const ExtPoint *q);
 void ted_point_dbl_avx2(ExtPoint *r, ExtPoint *p);
 void ted_point_query_table_avx2(ProPoint *r, const int pos, const __m256i b);
+void ted_point_query_table_duif_avx2(ProPoint *r, const int pos, const __m256i b);
+void ted_mul_fixbase_ext_avx2(ExtPoint *h, const __m256i *k);
 void ted_mul_fixbase_avx2(ProPoint *r, const __m256i *k);
+void ted_mul_fixbase_dirty_avx2(ProPoint *r, const __m256i *k, const __m256i c);
+int ted_peer_table_avx2(PeerTable *const *t, const ExtPoint *p);
+void ted_point_query_peer_avx2(ProPoint *r, const PeerTable *const *t, const int pos, 
+  const __m256i b);
+void ted_mul_peer_avx2(ExtPoint *h, const PeerTable *const *t, const __m256i *k);
+void ted_point_add_1x4_avx2(__m256i *r, const __m256i *p, const __m256i *q);
+void ted_point_dbl_1x4_avx2(__m256i *r, const __m256i *p);
+void ted_point_query_table_1x4_avx2(__m256i *r, const int pos, const int b);
+void ted_mul_fixbase_1x4_avx2(__m256i *r, const uint8_t *k);
+void ted_point_add_2x2_avx2(__m256i *r, const __m256i *p, const __m256i *q);
+void ted_point_dbl_2x2_avx2(__m256i *r, const __m256i *p);
+void ted_mul_fixbase_2x2_avx2(__m256i *r, const __m256i *k);
+
+// variable-time functions: the running time and the memory addresses depend 
+// on the scalars and points, only use them for public data (e.g. verification)
+
+void ted_point_query_table_vartime_avx2(ProPoint *r, const int pos, const __m256i b);
+void ted_mul_fixbase_vartime_avx2(ExtPoint *h, const __m256i *k);
+void ted_mul_varbase_vartime_avx2(ExtPoint *r, const ExtPoint *p, const uint8_t (*k)[32]);
+int ted_point_decode_vartime_avx2(ExtPoint *r, const uint8_t (*a)[32]);
+int ted_msm_vartime_avx2(ExtPoint *r, const ExtPoint *p, const uint8_t (*k)[32], 
+  const int np);
 
 #endif
 
@@ -0,0 +1,319 @@
+/**
+ *******************************************************************************
+ * @file tedcurve448.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of point arithmetic on the Edwards curve Ed448.
+ *
+ * @details
+ * This file contains (4*1)-way parallel point operations on Ed448 and the
+ * fixed-base comb of the X448 key generation. There is no generator of the
+ * 448-bit table at build time, the table is computed at the first use (once,
+ * from the base point of RFC 8032) with the same 4-way field arithmetic; the
+ * base point is public, so this needs not be constant-time.
+ *******************************************************************************
+ */
+
+#include "tedcurve448.h"
+#include <pthread.h>
+
+// base point of Ed448 (RFC 8032), the 4-isogeny maps it to u = 5
+static const uint32_t ed448_bx[NWORDS448] = {
+  0x70CC05E, 0x26A82BC, 0x0938E26, 0x80E18B0, 0x511433B, 0xF72AB66,
+  0x412AE1A, 0xA3D3A46, 0xA6DE324, 0x0F1767E, 0x4657047, 0x36DA9E1,
+  0x5A622BF, 0xED221D1, 0x66BED0D, 0x4F1970C };
+static const uint32_t ed448_by[NWORDS448] = {
+  0x230FA14, 0x08795BF, 0x7C8AD98, 0x132C4ED, 0x9C4FDBD, 0x1CE67C3,
+  0x73AD3FF, 0x05A0C2D, 0x7789C1E, 0xA398408, 0xA73736C, 0xC7624BE,
+  0x03756C9, 0x2488762, 0x16EB6BC, 0x693F467 };
+
+// look-up table in the layout of base29: limb l of coordinate c (x, y, d*x*y)
+// of (k+1) * 2^(8*j) * B is base28_448[j][c][l][k] (32-byte aligned rows)
+static uint32_t base28_448[TED448_P][3][NWORDS448][8] __attribute__((aligned(32)));
+static pthread_once_t base28_448_once = PTHREAD_ONCE_INIT;
+
+
+/**
+ * @brief Point doubling.
+ *
+ * @details
+ * R = 2 * P (dbl-2008-hwcd with a = 1, 4 squarings and 4 multiplications).
+ *
+ * @param r Extended point
+ * @param p Extended point
+ */
+void ted448_point_dbl_avx2(ExtPoint448 *r, const ExtPoint448 *p)
+{
+  __m256i a[NWORDS448], b[NWORDS448], c[NWORDS448], e[NWORDS448];
+  __m256i f[NWORDS448], g[NWORDS448], h[NWORDS448];
+
+  mpi28_gfp448_sqr_avx2(a, p->x);
+  mpi28_gfp448_sqr_avx2(b, p->y);
+  mpi28_gfp448_sqr_avx2(c, p->z);
+  mpi28_gfp448_add_avx2(c, c, c);
+  mpi28_gfp448_add_avx2(e, p->x, p->y);
+  mpi28_gfp448_sqr_avx2(e, e);
+  mpi28_gfp448_add_avx2(g, a, b);
+  mpi28_gfp448_sub_avx2(e, e, g);
+  mpi28_gfp448_sub_avx2(f, g, c);
+  mpi28_gfp448_sub_avx2(h, a, b);
+  mpi28_gfp448_mul_avx2(r->x, e, f);
+  mpi28_gfp448_mul_avx2(r->y, g, h);
+  mpi28_gfp448_mul_avx2(r->t, e, h);
+  mpi28_gfp448_mul_avx2(r->z, f, g);
+}
+
+
+/**
+ * @brief Point addition.
+ *
+ * @details
+ * R = P + Q (add-2008-hwcd with a = 1, 9 multiplications), used to compute
+ * the table.
+ *
+ * @param r Extended point
+ * @param p Extended point
+ * @param q Extended point
+ */
+void ted448_point_add_avx2(ExtPoint448 *r, const ExtPoint448 *p, const ExtPoint448 *q)
+{
+  __m256i a[NWORDS448], b[NWORDS448], c[NWORDS448], d[NWORDS448];
+  __m256i e[NWORDS448], f[NWORDS448], g[NWORDS448], h[NWORDS448];
+
+  mpi28_gfp448_mul_avx2(a, p->x, q->x);
+  mpi28_gfp448_mul_avx2(b, p->y, q->y);
+  mpi28_gfp448_mul_avx2(c, p->t, q->t);
+  mpi28_gfp448_mul28_avx2(c, c, CONSTD448);   // -C = 39081*T1*T2
+  mpi28_gfp448_mul_avx2(d, p->z, q->z);
+  mpi28_gfp448_add_avx2(e, p->x, p->y);
+  mpi28_gfp448_add_avx2(f, q->x, q->y);
+  mpi28_gfp448_mul_avx2(e, e, f);
+  mpi28_gfp448_add_avx2(g, a, b);
+  mpi28_gfp448_sub_avx2(e, e, g);
+  mpi28_gfp448_add_avx2(f, d, c);
+  mpi28_gfp448_sub_avx2(g, d, c);
+  mpi28_gfp448_sub_avx2(h, b, a);
+  mpi28_gfp448_mul_avx2(r->x, e, f);
+  mpi28_gfp448_mul_avx2(r->y, g, h);
+  mpi28_gfp448_mul_avx2(r->t, e, h);
+  mpi28_gfp448_mul_avx2(r->z, f, g);
+}
+
+
+/**
+ * @brief Mixed point addition.
+ *
+ * @details
+ * R = P + Q for an affine Q [x, y, d*x*y] of the table (8 multiplications).
+ *
+ * @param r Extended point
+ * @param p Extended point
+ * @param q Affine point
+ */
+void ted448_point_madd_avx2(ExtPoint448 *r, const ExtPoint448 *p, const AffPoint448 *q)
+{
+  __m256i a[NWORDS448], b[NWORDS448], c[NWORDS448];
+  __m256i e[NWORDS448], f[NWORDS448], g[NWORDS448], h[NWORDS448];
+
+  mpi28_gfp448_mul_avx2(a, p->x, q->x);
+  mpi28_gfp448_mul_avx2(b, p->y, q->y);
+  mpi28_gfp448_mul_avx2(c, p->t, q->t);
+  mpi28_gfp448_add_avx2(e, p->x, p->y);
+  mpi28_gfp448_add_avx2(f, q->x, q->y);
+  mpi28_gfp448_mul_avx2(e, e, f);
+  mpi28_gfp448_add_avx2(g, a, b);
+  mpi28_gfp448_sub_avx2(e, e, g);
+  mpi28_gfp448_sub_avx2(f, p->z, c);
+  mpi28_gfp448_add_avx2(g, p->z, c);
+  mpi28_gfp448_sub_avx2(h, b, a);
+  mpi28_gfp448_mul_avx2(r->x, e, f);
+  mpi28_gfp448_mul_avx2(r->y, g, h);
+  mpi28_gfp448_mul_avx2(r->t, e, h);
+  mpi28_gfp448_mul_avx2(r->z, f, g);
+}
+
+
+/**
+ * @brief Computation of the look-up table.
+ *
+ * @details
+ * The multiples (k+1) * P_j of P_j = 2^(8*j) * B are computed in extended
+ * coordinates (all lanes hold the same point), the eight of a position are
+ * then gathered into the lanes of two field elements, which share a single
+ * inversion, and stored in 28-bit limbs.
+ */
+static void ted448_init_table(void)
+{
+  ExtPoint448 p, q[8];
+  __m256i x[2][NWORDS448], y[2][NWORDS448], z[2][NWORDS448];
+  __m256i t[NWORDS448], u[NWORDS448];
+  const __m256i lane[4] = { VSET64(0, 0, 0, -1), VSET64(0, 0, -1, 0),
+    VSET64(0, -1, 0, 0), VSET64(-1, 0, 0, 0) };
+  uint64_t w[4];
+  int i, j, k, l;
+
+  for (i = 0; i < NWORDS448; i++) {
+    p.x[i] = VSET164(ed448_bx[i]);
+    p.y[i] = VSET164(ed448_by[i]);
+    p.z[i] = VZERO;
+  }
+  p.z[0] = VSET164(1);
+  mpi28_gfp448_mul_avx2(p.t, p.x, p.y);
+
+  for (j = 0; j < TED448_P; j++) {
+    q[0] = p;
+    for (k = 1; k < 8; k++) ted448_point_add_avx2(&q[k], &q[k-1], &p);
+
+    // lane l of the element k holds the multiple 4*k+l+1
+    for (k = 0; k < 2; k++)
+      for (i = 0; i < NWORDS448; i++) {
+        x[k][i] = y[k][i] = z[k][i] = VZERO;
+        for (l = 0; l < 4; l++) {
+          x[k][i] = VOR(x[k][i], VAND(q[4*k+l].x[i], lane[l]));
+          y[k][i] = VOR(y[k][i], VAND(q[4*k+l].y[i], lane[l]));
+          z[k][i] = VOR(z[k][i], VAND(q[4*k+l].z[i], lane[l]));
+        }
+      }
+    mpi28_gfp448_mul_avx2(t, z[0], z[1]);
+    mpi28_gfp448_inv_avx2(t, t);
+    mpi28_gfp448_mul_avx2(u, t, z[1]);
+    mpi28_gfp448_mul_avx2(z[1], t, z[0]);
+    mpi28_copy448_avx2(z[0], u);
+
+    for (k = 0; k < 2; k++) {
+      mpi28_gfp448_mul_avx2(x[k], x[k], z[k]);
+      mpi28_gfp448_mul_avx2(y[k], y[k], z[k]);
+      mpi28_gfp448_mul_avx2(t, x[k], y[k]);
+      mpi28_gfp448_mul28_avx2(t, t, CONSTD448);
+      for (i = 0; i < NWORDS448; i++) u[i] = VZERO;
+      mpi28_gfp448_sub_avx2(z[k], u, t);      // d*x*y
+      mpi28_gfp448_final_avx2(x[k]);
+      mpi28_gfp448_final_avx2(y[k]);
+      mpi28_gfp448_final_avx2(z[k]);
+      for (i = 0; i < NWORDS448; i++) {
+        VSTOREU(w, x[k][i]);
+        for (l = 0; l < 4; l++) base28_448[j][0][i][4*k+l] = (uint32_t)w[l];
+        VSTOREU(w, y[k][i]);
+        for (l = 0; l < 4; l++) base28_448[j][1][i][4*k+l] = (uint32_t)w[l];
+        VSTOREU(w, z[k][i]);
+        for (l = 0; l < 4; l++) base28_448[j][2][i][4*k+l] = (uint32_t)w[l];
+      }
+    }
+
+    for (k = 0; k < 2*TED448_W; k++) ted448_point_dbl_avx2(&p, &p);
+  }
+}
+
+
+/**
+ * @brief Point multiplication based on the look-up table.
+ *
+ * @details
+ * Look up the table with specifying the position to obtain the multiple |b|
+ * of the base point of the position, constant-time as the query of the
+ * X25519 table (one aligned load holds a limb of the eight entries and a
+ * vpermd moves the limb of the entry |b|-1 into the lane), and negate it if
+ * b < 0.
+ *
+ * @param r Affine point [x, y, d*x*y]
+ * @param pos Position of the table
+ * @param b Scalar (a signed digit)
+ */
+void ted448_point_query_table_avx2(AffPoint448 *r, const int pos, const __m256i b)
+{
+  const __m256i lo32 = VSET164(0xFFFFFFFFU);
+  const __m256i one = VSET164(1);
+  const __m256i babs = VABS8(b);
+  const __m256i index = VSUB(babs, one);
+  __m256i nzmask, bsign, t[NWORDS448], v;
+  __m256i *coor[3];
+  int c, i;
+
+  // the lanes with b = 0 get the neutral element [0, 1, 0]
+  nzmask = _mm256_andnot_si256(_mm256_cmpeq_epi64(babs, VZERO), lo32);
+  coor[0] = r->x; coor[1] = r->y; coor[2] = r->t;
+  for (c = 0; c < 3; c++)
+    for (i = 0; i < NWORDS448; i++) {
+      v = _mm256_load_si256((__m256i *)&base28_448[pos][c][i][0]);
+      v = _mm256_permutevar8x32_epi32(v, index);
+      coor[c][i] = VAND(nzmask, v);
+    }
+  r->y[0] = VOR(r->y[0], _mm256_andnot_si256(nzmask, one));
+
+  // if b < 0, negate x and d*x*y
+  bsign = VSHR(b, 7);
+  for (i = 0; i < NWORDS448; i++) t[i] = VZERO;
+  mpi28_gfp448_sub_avx2(t, t, r->x);
+  mpi28_cswap448_avx2(r->x, t, bsign);
+  for (i = 0; i < NWORDS448; i++) t[i] = VZERO;
+  mpi28_gfp448_sub_avx2(t, t, r->t);
+  mpi28_cswap448_avx2(r->t, t, bsign);
+}
+
+
+/**
+ * @brief Convert a scalar to signed digits.
+ *
+ * @details
+ * Convert the 448-bit scalar to TED448_D digits of 4 bits in the range [-8,
+ * 8) (the last one is 0 or 1) and store them (as 8-bit integers) in an array.
+ *
+ * @param e Digits
+ * @param k Scalar
+ */
+static void ted448_conv_scalar2digit_avx2(__m256i *e, const __m256i *k)
+{
+  const __m256i half  = VSET164(8);
+  const __m256i mask4 = VSET164(0xF);
+  const __m256i mask8 = VSET164(0xFF);
+  __m256i carry = VZERO;
+  int i;
+
+  for (i = 0; i < TED448_D-1; i++) {
+    e[i] = VAND(VSHR(k[i>>3], 4*(i&7)), mask4);
+    e[i] = VADD(e[i], carry);
+    carry = VSHR(VADD(e[i], half), 4);
+    e[i] = VSUB(e[i], VSHL(carry, 4));
+    e[i] = VAND(e[i], mask8);
+  }
+  e[TED448_D-1] = carry;
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication on Ed448.
+ *
+ * @details
+ * H = k * B.
+ * The comb with two teeth: the odd digits are added first, then four
+ * doublings multiply their sum by 16, and the even digits are added.
+ *
+ * @param h Point in extended projective coordinates
+ * @param k Scalar (14 32-bit words per lane)
+ */
+void ted448_mul_fixbase_avx2(ExtPoint448 *h, const __m256i *k)
+{
+  AffPoint448 p;
+  __m256i e[TED448_D];
+  int i, j;
+
+  pthread_once(&base28_448_once, ted448_init_table);
+
+  ted448_conv_scalar2digit_avx2(e, k);
+
+  // the neutral element [0, 1, 1, 0]
+  for (i = 0; i < NWORDS448; i++) h->x[i] = h->y[i] = h->z[i] = h->t[i] = VZERO;
+  h->y[0] = h->z[0] = VSET164(1);
+
+  for (j = 1; j >= 0; j--) {
+    if (j == 0)
+      for (i = 0; i < TED448_W; i++) ted448_point_dbl_avx2(h, h);
+    for (i = j; i < TED448_D; i += 2) {
+      ted448_point_query_table_avx2(&p, i/2, e[i]);
+      ted448_point_madd_avx2(h, h, &p);
+    }
+  }
+}
@@ -0,0 +1,54 @@
+/**
+ *******************************************************************************
+ * @file tedcurve448.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of point arithmetic on the Edwards curve Ed448.
+ *
+ * @details
+ * This file defines the structs of extended and table points and contains
+ * the function prototypes of the point arithmetic on Ed448 (x^2 + y^2 = 1 +
+ * d*x^2*y^2, d = -39081), which is used for the fixed-base X448 keygen.
+ *******************************************************************************
+ */
+
+#ifndef _TEDCURVE448_H
+#define _TEDCURVE448_H
+
+#include "gfparith448.h"
+
+#define CONSTD448 39081   // -d of Ed448
+
+// Point in extended projective coordinates [x, y, z, t], t = x*y/z
+typedef struct extended_point448 {
+  __m256i x[NWORDS448];  // extended x coordinate
+  __m256i y[NWORDS448];  // extended y coordinate
+  __m256i z[NWORDS448];  // extended z coordinate
+  __m256i t[NWORDS448];  // extended t coordinate
+} ExtPoint448;
+
+// Point of the look-up table in affine coordinates [x, y, d*x*y]
+typedef struct affine_point448 {
+  __m256i x[NWORDS448];  // affine x coordinate
+  __m256i y[NWORDS448];  // affine y coordinate
+  __m256i t[NWORDS448];  // d*x*y
+} AffPoint448;
+
+// geometry of the fixed-base comb: 113 signed 4-bit digits (the last one is
+// the carry of the recoding), the digits 2*j and 2*j+1 share the position j
+// of the table, whose entry k is (k+1) * 2^(8*j) * B
+#define TED448_W 4
+#define TED448_D 113
+#define TED448_P 57
+
+// function prototypes
+void ted448_point_dbl_avx2(ExtPoint448 *r, const ExtPoint448 *p);
+void ted448_point_add_avx2(ExtPoint448 *r, const ExtPoint448 *p, const ExtPoint448 *q);
+void ted448_point_madd_avx2(ExtPoint448 *r, const ExtPoint448 *p, const AffPoint448 *q);
+void ted448_point_query_table_avx2(AffPoint448 *r, const int pos, const __m256i b);
+void ted448_mul_fixbase_avx2(ExtPoint448 *h, const __m256i *k);
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ *******************************************************************************
+ * @file tedcurve512.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of AVX-512IFMA point arithmetic on twisted Edward curve.
+ *
+ * @details 
+ * This file contains (8*1)-way parallel point operations on twisted Edwards 
+ * curve. It shares the look-up table of the base point with the AVX2 version.
+ *******************************************************************************
+ */
+
+#if defined(__AVX512F__) && defined(__AVX512IFMA__)
+
+#include "tedcurve.h"
+#include "tedcurve512.h"
+
+// "1/2" in the field
+static const uint64_t one_half[4] = { 0xFFFFFFFFFFFFFFF7, 0xFFFFFFFFFFFFFFFF, 
+  0xFFFFFFFFFFFFFFFF, 0x3FFFFFFFFFFFFFFF };
+
+
+/**
+ * @brief Convert the coordinates of LUT point to mpi52 format.
+ *
+ * @details
+ * Convert the coordinate of a LUT point (4*64-bit) to 5*52-bit.
+ *
+ * @param r Mpi52 integer 
+ * @param a LUT coordinate
+ */
+static void lut_conv_coor2mpi52_avx512(__m512i *r, const __m512i *a)
+{
+  const __m512i mask = ZSET164(MASK52);
+
+  r[0] = ZAND(a[0], mask);
+  r[1] = ZAND(ZOR(ZSHR(a[0], 52), ZSHL(a[1], 12)), mask);
+  r[2] = ZAND(ZOR(ZSHR(a[1], 40), ZSHL(a[2], 24)), mask);
+  r[3] = ZAND(ZOR(ZSHR(a[2], 28), ZSHL(a[3], 36)), mask);
+  r[4] = ZSHR(a[3], 16);
+}
+
+
+/**
+ * @brief Point addition.
+ *
+ * @details
+ * Unified mixed addition R = P + Q on a twisted Edwards curve with a = -1.
+ *
+ * @param r Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ * @param p Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ * @param q Point in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
+ */
+void ted_point_add_avx512(ExtPoint512 *r, ExtPoint512 *p, ProPoint512 *q)
+{
+  __m512i t[NWORDS52];
+
+  mpi52_gfp_mul_avx512(t, p->e, p->h);
+  mpi52_gfp_sub_avx512(r->e, p->y, p->x);
+  mpi52_gfp_add_avx512(r->h, p->y, p->x);
+  mpi52_gfp_mul_avx512(r->x, r->e, q->y);
+  mpi52_gfp_mul_avx512(r->y, r->h, q->x);
+  mpi52_gfp_sub_avx512(r->e, r->y, r->x);
+  mpi52_gfp_add_avx512(r->h, r->y, r->x);
+  mpi52_gfp_mul_avx512(r->x, t, q->z);
+  mpi52_gfp_sub_avx512(t, p->z, r->x);
+  mpi52_gfp_add_avx512(r->x, p->z, r->x);
+  mpi52_gfp_mul_avx512(r->z, t, r->x);
+  mpi52_gfp_mul_avx512(r->y, r->x, r->h);
+  mpi52_gfp_mul_avx512(r->x, r->e, t);
+}
+
+
+/**
+ * @brief Point doubling.
+ *
+ * @details
+ * Doubling R = 2*P on a twisted Edwards curve with a = -1.
+ *
+ * @param r Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ * @param p Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+ */
+void ted_point_dbl_avx512(ExtPoint512 *r, ExtPoint512 *p)
+{
+  __m512i t[NWORDS52];
+
+  mpi52_gfp_sqr_avx512(r->e, p->x);
+  mpi52_gfp_sqr_avx512(r->h, p->y);
+  mpi52_gfp_sub_avx512(t, r->e, r->h);
+  mpi52_gfp_add_avx512(r->h, r->e, r->h);
+  mpi52_gfp_add_avx512(r->x, p->x, p->y);
+  mpi52_gfp_sqr_avx512(r->e, r->x);
+  mpi52_gfp_sub_avx512(r->e, r->h, r->e);
+  mpi52_gfp_sqr_avx512(r->y, p->z);
+  mpi52_gfp_add_avx512(r->y, r->y, r->y);
+  mpi52_gfp_add_avx512(r->y, t, r->y);
+  mpi52_gfp_mul_avx512(r->x, r->e, r->y);
+  mpi52_gfp_mul_avx512(r->z, r->y, t);
+  mpi52_gfp_mul_avx512(r->y, t, r->h);
+}
+
+
+/**
+ * @brief Initialize a point with extened projective coordinates.
+ *
+ * @details
+ * Initialize a point P to be [0, 1, 1, 0, 1].
+ * 
+ * @param p Extented projective point
+ */
+static void ted_point_init_ext_avx512(ExtPoint512 *p)
+{
+  const __m512i zero = ZZERO;
+  const __m512i one = ZSET164(1);
+  int i;
+
+  p->x[0] = p->e[0] = zero;
+  p->y[0] = p->z[0] = p->h[0] = one;
+  for (i = 1; i < NWORDS52; i++) {
+    p->x[i] = p->y[i] = p->z[i] = p->e[i] = p->h[i] = zero;
+  }
+}
+
+
+/**
+ * @brief Point multiplication based on the look-up table.
+ *
+ * @details
+ * Look up the table with specifying the position to obtain the multiple of base
+ * point (in Duif representation). All FIXBASE_K entries are scanned; the matching
+ * one is selected by a mask register, which keeps the query constant-time.
+ *
+ * @param r Point of the table in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
+ * @param pos Position of the table
+ * @param b Scalar (a signed digit)
+ */
+void ted_point_query_table_avx512(ProPoint512 *r, const int pos, const __m512i b)
+{
+  const __m512i zero  = ZZERO;
+  const __m512i mask8 = ZSET164(0xFF);
+  const LutPoint *const tab = fixbase[pos];
+  __m512i xP[4], yP[4], zP[4], t[NWORDS52];
+  __m512i babs, bsign, index, tmp;
+  __mmask8 mask;
+  int i, j;
+
+  // if b < 0, bsign is 1; if b >= 0, bsign is 0.
+  bsign = ZSHR(b, 7);
+  babs  = ZAND(ZADD(ZXOR(b, ZSUB(zero, bsign)), bsign), mask8);
+
+  // P is [1/2, 1/2, 0] now (neutral element in Duif representation)
+  for (i = 0; i < 4; i++) {
+    xP[i] = yP[i] = ZSET164(one_half[i]);
+    zP[i] = zero;
+  }
+
+  // query the table
+  for (j = 0; j < FIXBASE_K; j++) {
+    index = ZSET164(j+1);
+    mask  = ZCMPEQ(babs, index);
+    for (i = 0; i < 4; i++) {
+      xP[i] = ZMOV(xP[i], mask, ZSET164(tab[j].x[i]));
+      yP[i] = ZMOV(yP[i], mask, ZSET164(tab[j].y[i]));
+      zP[i] = ZMOV(zP[i], mask, ZSET164(tab[j].z[i]));
+    }
+  }
+
+  // -P is obtained by swapping the first two coordinates and negating d*x*y
+  mask = ZTEST(bsign, bsign);
+  for (i = 0; i < 4; i++) {
+    tmp   = xP[i];
+    xP[i] = ZBLEND(mask, xP[i], yP[i]);
+    yP[i] = ZBLEND(mask, yP[i], tmp);
+  }
+
+  lut_conv_coor2mpi52_avx512(r->x, xP);
+  lut_conv_coor2mpi52_avx512(r->y, yP);
+  lut_conv_coor2mpi52_avx512(r->z, zP);
+
+  for (i = 0; i < NWORDS52; i++) t[i] = zero;
+  mpi52_gfp_sub_avx512(t, t, r->z);
+  mpi52_cswap_avx512(r->z, t, bsign);
+}
+
+
+/**
+ * @brief Convert a scalar to signed digits.
+ *
+ * @details
+ * Convert the 256-bit scalar to FIXBASE_D digits of FIXBASE_W bits in the 
+ * range [-2^(W-1), 2^(W-1)] and store them (as 8-bit integers) in an array.
+ *
+ * @param e Digits
+ * @param k Scalar
+ */
+void ted_conv_scalar2digit_avx512(__m512i *e, const __m512i *k)
+{
+  int i, w, o;
+  const __m512i half  = ZSET164(1 << (FIXBASE_W-1));
+  const __m512i maskw = ZSET164((1 << FIXBASE_W) - 1);
+  const __m512i mask8 = ZSET164(0xFF);
+  __m512i carry = ZZERO;
+
+  // convert scalar to unsigned digits, a digit may span two 32-bit words
+  for (i = 0; i < FIXBASE_D; i++) {
+    w = (FIXBASE_W*i) >> 5;
+    o = (FIXBASE_W*i) & 31;
+    e[i] = ZSHR(k[w], o);
+    if ((o + FIXBASE_W > 32) && (w < 7)) e[i] = ZOR(e[i], ZSHL(k[w+1], 32-o));
+    e[i] = ZAND(e[i], maskw);
+  }
+
+  // convert unsigned digits to signed
+  for (i = 0; i < FIXBASE_D-1; i++) {
+    e[i] = ZADD(e[i], carry);
+    carry = ZADD(e[i], half);
+    carry = ZSHR(carry, FIXBASE_W);
+    e[i] = ZSUB(e[i], ZSHL(carry, FIXBASE_W));
+    e[i] = ZAND(e[i], mask8);
+  }
+  e[FIXBASE_D-1] = ZADD(e[FIXBASE_D-1], carry);
+  e[FIXBASE_D-1] = ZAND(e[FIXBASE_D-1], mask8);
+}
+
+
+/**
+ * @brief Fixed-base scalar multiplication on twisted Edwards curve.
+ *
+ * @details
+ * R = k * B.
+ * Compute a scalar multiplication R = k * B with a fixed base B (x, 4/5) on 
+ * twisted Edwards curve.
+ * 
+ * @param r Projective point 
+ * @param k Scalar 
+ */
+void ted_mul_fixbase_avx512(ProPoint512 *r, const __m512i *k)
+{
+  ExtPoint512 h;
+  __m512i e[FIXBASE_D], kp[8];
+  const __m512i t0 = ZSET164(0xFFFFFFF8U);
+  const __m512i t1 = ZSET164(0x7FFFFFFFU);
+  const __m512i t2 = ZSET164(0x40000000U);
+  int i, j;
+
+  // prune scalar k
+  for (i = 0; i < 8; i++) kp[i] = k[i];
+  kp[0] = ZAND(kp[0], t0);
+  kp[7] = ZAND(kp[7], t1);
+  kp[7] = ZOR(kp[7], t2);
+
+  ted_conv_scalar2digit_avx512(e, kp);
+
+  ted_point_init_ext_avx512(&h);
+
+  // the teeth from the most significant one, FIXBASE_W doublings in between
+  for (j = FIXBASE_S-1; j >= 0; j--) {
+    if (j < FIXBASE_S-1) 
+      for (i = 0; i < FIXBASE_W; i++) ted_point_dbl_avx512(&h, &h);
+    for (i = j; i < FIXBASE_D; i += FIXBASE_S) {
+      ted_point_query_table_avx512(r, i/FIXBASE_S, e[i]);
+      ted_point_add_avx512(&h, &h, r);
+    }
+  }
+
+  mpi52_copy_avx512(r->y, h.y);
+  mpi52_copy_avx512(r->z, h.z);
+}
+
+#endif
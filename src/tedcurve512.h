@@ -0,0 +1,38 @@
+/**
+ *******************************************************************************
+ * @file tedcurve512.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of AVX-512IFMA point arithmetic on twisted Edwards curve.
+ *
+ * @details 
+ * This file defines the struct of 8-way extended point and contains function 
+ * prototypes of points arithmetic on twisted Edwards curve. 
+ *******************************************************************************
+ */
+
+#ifndef _TEDCURVE512_H
+#define _TEDCURVE512_H
+
+#include "moncurve512.h"
+
+// Point in extended projective coordinates [x, y, z, e, h], e*h = t = x*y/z
+typedef struct extended_point512 {
+  __m512i x[NWORDS52];  // extended x coordinate
+  __m512i y[NWORDS52];  // extended y coordinate
+  __m512i z[NWORDS52];  // extended z coordinate
+  __m512i e[NWORDS52];  // extended e coordinate (e*h = t)
+  __m512i h[NWORDS52];  // extended h coordinate (e*h = t)
+} ExtPoint512;
+
+// function prototypes
+
+void ted_point_add_avx512(ExtPoint512 *r, ExtPoint512 *p, ProPoint512 *q);
+void ted_point_dbl_avx512(ExtPoint512 *r, ExtPoint512 *p);
+void ted_point_query_table_avx512(ProPoint512 *r, const int pos, const __m512i b);
+void ted_mul_fixbase_avx512(ProPoint512 *r, const __m512i *k);
+
+#endif
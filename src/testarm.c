@@ -0,0 +1,250 @@
+/**
+ *******************************************************************************
+ * @file testarm.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the tests of aarch64.
+ *
+ * @details
+ * The test program of builds without AVX2 (make on aarch64 builds it as
+ * test_bench in place of main.c): the implementations that the CPU supports
+ * (c64 and neon) are checked with the test vectors of RFC 7748 and against
+ * the portable implementation for random keys, and the batch functions of the
+ * dispatcher for every tail.
+ *******************************************************************************
+ */
+
+#include "x25519.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// RFC 7748, section 5.2: scalar, u-coordinate and result of the two vectors
+static const uint8_t rfc_k[2][32] = {
+  { 0xa5, 0x46, 0xe3, 0x6b, 0xf0, 0x52, 0x7c, 0x9d, 0x3b, 0x16, 0x15, 0x4b, 0x82, 0x46, 0x5e, 0xdd,
+    0x62, 0x14, 0x4c, 0x0a, 0xc1, 0xfc, 0x5a, 0x18, 0x50, 0x6a, 0x22, 0x44, 0xba, 0x44, 0x9a, 0xc4 },
+  { 0x4b, 0x66, 0xe9, 0xd4, 0xd1, 0xb4, 0x67, 0x3c, 0x5a, 0xd2, 0x26, 0x91, 0x95, 0x7d, 0x6a, 0xf5,
+    0xc1, 0x1b, 0x64, 0x21, 0xe0, 0xea, 0x01, 0xd4, 0x2c, 0xa4, 0x16, 0x9e, 0x79, 0x18, 0xba, 0x0d } };
+static const uint8_t rfc_u[2][32] = {
+  { 0xe6, 0xdb, 0x68, 0x67, 0x58, 0x30, 0x30, 0xdb, 0x35, 0x94, 0xc1, 0xa4, 0x24, 0xb1, 0x5f, 0x7c,
+    0x72, 0x66, 0x24, 0xec, 0x26, 0xb3, 0x35, 0x3b, 0x10, 0xa9, 0x03, 0xa6, 0xd0, 0xab, 0x1c, 0x4c },
+  { 0xe5, 0x21, 0x0f, 0x12, 0x78, 0x68, 0x11, 0xd3, 0xf4, 0xb7, 0x95, 0x9d, 0x05, 0x38, 0xae, 0x2c,
+    0x31, 0xdb, 0xe7, 0x10, 0x6f, 0xc0, 0x3c, 0x3e, 0xfc, 0x4c, 0xd5, 0x49, 0xc7, 0x15, 0xa4, 0x93 } };
+static const uint8_t rfc_r[2][32] = {
+  { 0xc3, 0xda, 0x55, 0x37, 0x9d, 0xe9, 0xc6, 0x90, 0x8e, 0x94, 0xea, 0x4d, 0xf2, 0x8d, 0x08, 0x4f,
+    0x32, 0xec, 0xcf, 0x03, 0x49, 0x1c, 0x71, 0xf7, 0x54, 0xb4, 0x07, 0x55, 0x77, 0xa2, 0x85, 0x52 },
+  { 0x95, 0xcb, 0xde, 0x94, 0x76, 0xe8, 0x90, 0x7d, 0x7a, 0xad, 0xe4, 0x5c, 0xb4, 0xb8, 0x73, 0xf8,
+    0x8b, 0x59, 0x5a, 0x68, 0x79, 0x9f, 0xa1, 0x52, 0xe6, 0xf8, 0xf7, 0x64, 0x7a, 0xac, 0x79, 0x57 } };
+// RFC 7748, section 5.2: k = u = 9 after 1 and 1000 iterations
+static const uint8_t rfc_it[2][32] = {
+  { 0x42, 0x2c, 0x8e, 0x7a, 0x62, 0x27, 0xd7, 0xbc, 0xa1, 0x35, 0x0b, 0x3e, 0x2b, 0xb7, 0x27, 0x9f,
+    0x78, 0x97, 0xb8, 0x7b, 0xb6, 0x85, 0x4b, 0x78, 0x3c, 0x60, 0xe8, 0x03, 0x11, 0xae, 0x30, 0x79 },
+  { 0x68, 0x4c, 0xf5, 0x9b, 0xa8, 0x33, 0x09, 0x55, 0x28, 0x00, 0xef, 0x56, 0x6f, 0x2f, 0x4d, 0x3c,
+    0x1c, 0x38, 0x87, 0xc4, 0x93, 0x60, 0xe3, 0x87, 0x5f, 0x2e, 0xb9, 0x4d, 0x99, 0x53, 0x2c, 0x51 } };
+// RFC 7748, section 6.1: Alice's and Bob's private and public keys, shared secret
+static const uint8_t rfc_sk[2][32] = {
+  { 0x77, 0x07, 0x6d, 0x0a, 0x73, 0x18, 0xa5, 0x7d, 0x3c, 0x16, 0xc1, 0x72, 0x51, 0xb2, 0x66, 0x45,
+    0xdf, 0x4c, 0x2f, 0x87, 0xeb, 0xc0, 0x99, 0x2a, 0xb1, 0x77, 0xfb, 0xa5, 0x1d, 0xb9, 0x2c, 0x2a },
+  { 0x5d, 0xab, 0x08, 0x7e, 0x62, 0x4a, 0x8a, 0x4b, 0x79, 0xe1, 0x7f, 0x8b, 0x83, 0x80, 0x0e, 0xe6,
+    0x6f, 0x3b, 0xb1, 0x29, 0x26, 0x18, 0xb6, 0xfd, 0x1c, 0x2f, 0x8b, 0x27, 0xff, 0x88, 0xe0, 0xeb } };
+static const uint8_t rfc_pk[2][32] = {
+  { 0x85, 0x20, 0xf0, 0x09, 0x89, 0x30, 0xa7, 0x54, 0x74, 0x8b, 0x7d, 0xdc, 0xb4, 0x3e, 0xf7, 0x5a,
+    0x0d, 0xbf, 0x3a, 0x0d, 0x26, 0x38, 0x1a, 0xf4, 0xeb, 0xa4, 0xa9, 0x8e, 0xaa, 0x9b, 0x4e, 0x6a },
+  { 0xde, 0x9e, 0xdb, 0x7d, 0x7b, 0x7d, 0xc1, 0xb4, 0xd3, 0x5b, 0x61, 0xc2, 0xec, 0xe4, 0x35, 0x37,
+    0x3f, 0x83, 0x43, 0xc8, 0x5b, 0x78, 0x67, 0x4d, 0xad, 0xfc, 0x7e, 0x14, 0x6f, 0x88, 0x2b, 0x4f } };
+static const uint8_t rfc_ss[32] = {
+  0x4a, 0x5d, 0x9d, 0x5b, 0xa4, 0xce, 0x2d, 0xe1, 0x72, 0x8e, 0x3b, 0xf4, 0x80, 0x35, 0x0f, 0x25,
+  0xe0, 0x7e, 0x21, 0xc9, 0x47, 0xd1, 0x9e, 0x33, 0x76, 0xf0, 0x9b, 0x3c, 0x1e, 0x16, 0x17, 0x42 };
+
+static int failures;
+
+
+static void report(const char *name, int wrong)
+{
+  if (wrong) {
+    printf("TEST (%s): \x1b[31mNOT PASS!\x1b[0m\n", name);
+    failures++;
+  } else {
+    printf("TEST (%s): \x1b[32mPASS!\x1b[0m\n", name);
+  }
+}
+
+
+/**
+ * @brief Test the vectors of RFC 7748 in every lane of an implementation.
+ *
+ * @param impl Implementation
+ * @return Nonzero if a result is wrong
+ */
+static int test_rfc7748(const X25519Impl *impl)
+{
+  uint8_t sk[8][32], pk[8][32], r[8][32], k[8][32];
+  int i, l, wrong = 0;
+
+  // the two scalar multiplications of section 5.2, alternating over the lanes
+  for (l = 0; l < impl->lanes; l++) {
+    memcpy(sk[l], rfc_k[l & 1], 32);
+    memcpy(pk[l], rfc_u[l & 1], 32);
+  }
+  impl->sharedsecret(r, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+  for (l = 0; l < impl->lanes; l++) wrong |= memcmp(r[l], rfc_r[l & 1], 32);
+
+  // the iterations k, u = X25519(k, u), k of section 5.2 (1 and 1000)
+  for (l = 0; l < impl->lanes; l++) {
+    memset(k[l], 0, 32); k[l][0] = 9;
+    memset(pk[l], 0, 32); pk[l][0] = 9;
+  }
+  for (i = 1; i <= 1000; i++) {
+    impl->sharedsecret(r, (const uint8_t (*)[32])k, (const uint8_t (*)[32])pk);
+    memcpy(pk, k, sizeof(k));
+    memcpy(k, r, sizeof(r));
+    for (l = 0; l < impl->lanes; l++) {
+      if (i == 1) wrong |= memcmp(k[l], rfc_it[0], 32);
+      if (i == 1000) wrong |= memcmp(k[l], rfc_it[1], 32);
+    }
+  }
+
+  // the Diffie-Hellman of section 6.1, Alice and Bob alternating
+  for (l = 0; l < impl->lanes; l++) {
+    memcpy(sk[l], rfc_sk[l & 1], 32);
+    memcpy(pk[l], rfc_pk[(l & 1) ^ 1], 32);
+  }
+  impl->keygen(r, (const uint8_t (*)[32])sk);
+  for (l = 0; l < impl->lanes; l++) wrong |= memcmp(r[l], rfc_pk[l & 1], 32);
+  impl->sharedsecret(r, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+  for (l = 0; l < impl->lanes; l++) wrong |= memcmp(r[l], rfc_ss, 32);
+
+  return wrong;
+}
+
+
+/**
+ * @brief Compare an implementation with the portable one for random keys.
+ *
+ * @details
+ * The public keys are random 32-byte strings (bit 255 set in half of them),
+ * and every few calls one lane gets an edge case: 0, 1, p-1, p or 2^255-1.
+ *
+ * @param impl Implementation
+ * @param iterations Number of calls
+ * @return Nonzero if a result is wrong
+ */
+static int test_random(const X25519Impl *impl, int iterations)
+{
+  const X25519Impl *ref = x25519_impl_by_id(X25519_C64);
+  uint8_t sk[8][32], pk[8][32], r[8][32], s[8][32], t[32];
+  int i, j, l, wrong = 0;
+
+  for (j = 0; j < iterations; j++) {
+    for (l = 0; l < impl->lanes; l++)
+      for (i = 0; i < 32; i++) {
+        sk[l][i] = (uint8_t)random();
+        pk[l][i] = (uint8_t)random();
+      }
+    l = j % impl->lanes;
+    switch (j % 10) {
+      case 0: memset(pk[l], 0, 32); break;
+      case 1: memset(pk[l], 0, 32); pk[l][0] = 1; break;
+      case 2: memset(pk[l], 0xFF, 32); pk[l][0] = 0xEC; pk[l][31] = 0x7F; break;
+      case 3: memset(pk[l], 0xFF, 32); pk[l][0] = 0xED; pk[l][31] = 0x7F; break;
+      case 4: memset(pk[l], 0xFF, 32); pk[l][31] = 0x7F; break;
+      default: break;
+    }
+    impl->keygen(r, (const uint8_t (*)[32])sk);
+    impl->sharedsecret(s, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk);
+    for (l = 0; l < impl->lanes; l++) {
+      ref->keygen((uint8_t (*)[32])t, (const uint8_t (*)[32])sk[l]);
+      wrong |= memcmp(r[l], t, 32);
+      ref->sharedsecret((uint8_t (*)[32])t, (const uint8_t (*)[32])sk[l],
+        (const uint8_t (*)[32])pk[l]);
+      wrong |= memcmp(s[l], t, 32);
+    }
+  }
+  return wrong;
+}
+
+
+/**
+ * @brief Test the batch functions of the dispatcher.
+ *
+ * @details
+ * Batches of all sizes up to 19 (every tail), in arrays of keys and in
+ * interleaved buffers, against the portable implementation.
+ *
+ * @return Nonzero if a result is wrong
+ */
+static int test_batch(void)
+{
+  const X25519Impl *ref = x25519_impl_by_id(X25519_C64);
+  uint8_t sk[19][32], pk[19][32], r[19][32], t[32];
+  X25519Group *gsk = x25519_soa_alloc(19), *gpk = x25519_soa_alloc(19);
+  X25519Group *gr = x25519_soa_alloc(19);
+  size_t n, l;
+  int i, wrong = (gsk == NULL) || (gpk == NULL) || (gr == NULL);
+
+  for (n = 0; (n <= 19) && !wrong; n++) {
+    for (l = 0; l < n; l++) {
+      for (i = 0; i < 32; i++) {
+        sk[l][i] = (uint8_t)random();
+        pk[l][i] = (uint8_t)random();
+      }
+      x25519_soa_put(gsk, l, sk[l]);
+      x25519_soa_put(gpk, l, pk[l]);
+    }
+    x25519_keygen_batch(r, (const uint8_t (*)[32])sk, n);
+    for (l = 0; l < n; l++) {
+      ref->keygen((uint8_t (*)[32])t, (const uint8_t (*)[32])sk[l]);
+      wrong |= memcmp(r[l], t, 32);
+    }
+    x25519_keygen_soa(gr, gsk, n);
+    for (l = 0; l < n; l++) {
+      x25519_soa_get(t, gr, l);
+      wrong |= memcmp(r[l], t, 32);
+    }
+    x25519_sharedsecret_batch(r, (const uint8_t (*)[32])sk, (const uint8_t (*)[32])pk, n);
+    for (l = 0; l < n; l++) {
+      ref->sharedsecret((uint8_t (*)[32])t, (const uint8_t (*)[32])sk[l],
+        (const uint8_t (*)[32])pk[l]);
+      wrong |= memcmp(r[l], t, 32);
+    }
+    x25519_sharedsecret_soa(gr, gsk, gpk, n);
+    for (l = 0; l < n; l++) {
+      x25519_soa_get(t, gr, l);
+      wrong |= memcmp(r[l], t, 32);
+    }
+  }
+
+  x25519_soa_free(gsk); x25519_soa_free(gpk); x25519_soa_free(gr);
+  return wrong;
+}
+
+
+int main(void)
+{
+  const X25519Impl *impl;
+  char name[64];
+  int id;
+
+  puts("\n*******************************************************************");
+  printf("CORRECTNESS TEST (dispatcher, selected: %s):\n", x25519_impl()->name);
+  puts("-------------------------------------------------------------------");
+
+  for (id = 0; id < X25519_NIMPLS; id++) {
+    if ((impl = x25519_impl_by_id(id)) == NULL) continue;
+    snprintf(name, sizeof(name), "%s, %d-way, RFC 7748", impl->name, impl->lanes);
+    report(name, test_rfc7748(impl));
+    snprintf(name, sizeof(name), "%s, %d-way, random keys", impl->name, impl->lanes);
+    report(name, test_random(impl, 1000));
+  }
+  report("batches", test_batch());
+#if defined(__aarch64__)
+  // AArch64 always has NEON, the dispatcher must not fall back to c64
+  report("neon supported", x25519_impl_by_id(X25519_NEON) == NULL);
+#endif
+
+  puts("*******************************************************************");
+  return failures != 0;
+}
@@ -34,7 +34,7 @@ extern uint64_t read_tsc(void);
  * @param rlen Length of r
  * @param alen Length of a
  */
-void mpi29_conv_32to29(uint32_t *r, const uint32_t *a, int rlen, int alen)
+static inline void mpi29_conv_32to29(uint32_t *r, const uint32_t *a, int rlen, int alen)
 {
   int i, j, shr_pos, shl_pos;
   uint32_t word, temp;
@@ -70,7 +70,7 @@ void mpi29_conv_32to29(uint32_t *r, const uint32_t *a, int rlen, int alen)
  * @param rlen Length of r
  * @param alen Length of a
  */
-void mpi29_conv_29to32(uint32_t *r, const uint32_t *a, int rlen, int alen)
+static inline void mpi29_conv_29to32(uint32_t *r, const uint32_t *a, int rlen, int alen)
 {
   int i, j, bits_in_word, bits_to_shift;
   uint32_t word;
@@ -93,6 +93,31 @@ void mpi29_conv_29to32(uint32_t *r, const uint32_t *a, int rlen, int alen)
   for (; i < rlen; i++) r[i] = 0;
 }
 
+/**
+ * @brief Conversion from mpi52 to mpi32.
+ *
+ * @details
+ * Convert a field element that is given as an array of five 52-bit words to
+ * an array of eight 32-bit words.
+ *
+ * @param r Mpi32 integer
+ * @param a Mpi52 integer
+ */
+static inline void mpi52_conv_52to32(uint32_t *r, const uint64_t *a)
+{
+  uint64_t w[4];
+  int i;
+
+  w[0] = (a[0]      ) | (a[1] << 52);
+  w[1] = (a[1] >> 12) | (a[2] << 40);
+  w[2] = (a[2] >> 24) | (a[3] << 28);
+  w[3] = (a[3] >> 36) | (a[4] << 16);
+  for (i = 0; i < 4; i++) {
+    r[2*i]   = (uint32_t)w[i];
+    r[2*i+1] = (uint32_t)(w[i] >> 32);
+  }
+}
+
 /**
  * @brief Print a multiprecision integer.
  *
@@ -103,7 +128,7 @@ void mpi29_conv_29to32(uint32_t *r, const uint32_t *a, int rlen, int alen)
  * @param a Multiprecision integer
  * @param len Length of a
  */
-void mpi29_print(const char *c, const uint32_t *a, int len)
+static inline void mpi29_print(const char *c, const uint32_t *a, int len)
 {
   int i;
 
@@ -0,0 +1,616 @@
+/**
+ *******************************************************************************
+ * @file x25519.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief C source file of the X25519 dispatcher.
+ *
+ * @details 
+ * This file detects the vector extensions of the CPU (and whether the OS saves 
+ * the corresponding registers) and resolves the function pointers once. It is
+ * compiled without any vector extension so that it runs on every x86-64 CPU.
+ * On aarch64 only c64 and neon are built (NEON is part of the base ISA).
+ * The environment variable AVXECC_IMPL (c64, avx2-1x4, avx2-2x2, avx2, avx512
+ * or neon) can be used to force a (supported) implementation.
+ *******************************************************************************
+ */
+
+#include "x25519.h"
+#include "ecdh.h"
+#include "numa.h"
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <cpuid.h>
+// the kernels of the other architecture are not built, their entries are 
+// never supported
+#define X86(f) f
+#define ARM(f) NULL
+#else
+#define X86(f) NULL
+#define ARM(f) f
+#endif
+
+// all implementations, indexed by identifier (the costs are measured on an 
+// AVX-512IFMA capable CPU, only their ratios matter; those of neon are 
+// relative to c64 on the same ARM core)
+static const X25519Impl impls[X25519_NIMPLS] = {
+  { "c64",      1,  95, 107, x25519_keygen_c64,      x25519_sharedsecret_c64, 
+    NULL, NULL },
+  { "avx2-1x4", 1,  53, 142, X86(x25519_keygen_1x4_avx2), 
+    X86(x25519_sharedsecret_1x4_avx2), NULL, NULL },
+  { "avx2",     4,  80, 215, X86(x25519_keygen_avx2), X86(x25519_sharedsecret_avx2), 
+    X86(x25519_keygen_n_avx2), X86(x25519_sharedsecret_n_avx2) },
+  { "avx512",   8,  48, 155, X86(x25519_keygen_avx512), X86(x25519_sharedsecret_avx512),
+    X86(x25519_keygen_n_avx512), X86(x25519_sharedsecret_n_avx512) },
+  { "avx2-2x2", 2,  74, 185, X86(x25519_keygen_2x2_avx2), 
+    X86(x25519_sharedsecret_2x2_avx2), NULL, NULL },
+  { "neon",     2, 160, 160, ARM(x25519_keygen_neon), ARM(x25519_sharedsecret_neon),
+    NULL, NULL },
+};
+
+// the kernels with in-vector validation of the implementations (NULL if the
+// results of a call are checked as byte strings), kept out of X25519Impl so
+// that its layout does not change
+static int (*const checked_n[X25519_NIMPLS])(uint8_t (*ss)[32], uint8_t *ok, 
+  const uint8_t (*ska)[32], const uint8_t (*pkb)[32], int m) = {
+  NULL, NULL, X86(x25519_sharedsecret_checked_n_avx2), 
+  X86(x25519_sharedsecret_checked_n_avx512), NULL, NULL
+};
+
+// the kernels of m calls with one shared inversion on interleaved buffers of
+// m*lanes/4 groups (NULL if not available, the outputs may be the inputs), 
+// kept out of X25519Impl as well
+static void (*const keygen_soa_n[X25519_NIMPLS])(X25519Group *pk, 
+  const X25519Group *sk, int m) = {
+  NULL, NULL, X86(x25519_keygen_soa_n_avx2), X86(x25519_keygen_soa_n_avx512), 
+  NULL, NULL
+};
+static void (*const sharedsecret_soa_n[X25519_NIMPLS])(X25519Group *ss, 
+  const X25519Group *ska, const X25519Group *pkb, int m) = {
+  NULL, NULL, X86(x25519_sharedsecret_soa_n_avx2), 
+  X86(x25519_sharedsecret_soa_n_avx512), NULL, NULL
+};
+
+// the identifiers ordered by throughput (not by identifier, which are fixed
+// by the ABI), the dispatcher selects the last supported one
+static const int order[X25519_NIMPLS] = { X25519_C64, X25519_AVX2_1X4, 
+  X25519_AVX2_2X2, X25519_AVX2, X25519_AVX512, X25519_NEON };
+
+// maximum number of lanes of an implementation
+#define MAXLANES 8
+
+// resolved state, written once by x25519_init()
+static int supported[X25519_NIMPLS];
+static const X25519Impl *best = NULL;
+// number of calls that share one inversion
+static int batchinv = 8;
+// BMI2 and ADX for the hybrid ladder
+static int mulx = 0;
+
+#if defined(__x86_64__)
+
+/**
+ * @brief Read the extended control register XCR0.
+ *
+ * @details
+ * It must only be called when CPUID reports OSXSAVE.
+ * 
+ * @return Value of XCR0
+ */
+static uint64_t read_xcr0(void)
+{
+  uint32_t eax, edx;
+
+  __asm__ __volatile__ ("xgetbv" : "=a" (eax), "=d" (edx) : "c" (0));
+  return ((uint64_t)edx << 32) | eax;
+}
+
+
+/**
+ * @brief Detect the CPU features.
+ *
+ * @details
+ * Set the flags of the supported implementations. AVX2 needs the OS to save 
+ * the ymm registers (XCR0 bits 1,2); AVX-512 needs additionally the opmask 
+ * and zmm registers (XCR0 bits 5,6,7).
+ */
+static void detect_cpu(void)
+{
+  uint32_t eax, ebx, ecx, edx, ebx7 = 0;
+  uint64_t xcr0 = 0;
+
+  supported[X25519_C64] = 1;
+  if (!__get_cpuid(1, &eax, &ebx, &ecx, &edx)) return;
+  // OSXSAVE (bit 27) and AVX (bit 28)
+  if ((ecx & (1U << 27)) && (ecx & (1U << 28))) xcr0 = read_xcr0();
+  if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx)) ebx7 = ebx;
+
+  // AVX2 is bit 5 of leaf 7
+  if (((xcr0 & 0x06) == 0x06) && (ebx7 & (1U << 5)))
+    supported[X25519_AVX2] = supported[X25519_AVX2_1X4] = 
+      supported[X25519_AVX2_2X2] = 1;
+  // AVX-512F is bit 16 and AVX-512IFMA is bit 21 of leaf 7
+  if (supported[X25519_AVX2] && ((xcr0 & 0xE6) == 0xE6) && 
+      (ebx7 & (1U << 16)) && (ebx7 & (1U << 21)))
+    supported[X25519_AVX512] = 1;
+  // BMI2 is bit 8 and ADX is bit 19 of leaf 7
+  mulx = (ebx7 & (1U << 8)) && (ebx7 & (1U << 19));
+}
+
+#else
+
+/**
+ * @brief Detect the CPU features.
+ *
+ * @details
+ * AArch64 always has NEON (ASIMD), there is nothing to query.
+ */
+static void detect_cpu(void)
+{
+  supported[X25519_C64] = 1;
+#if defined(__ARM_NEON)
+  supported[X25519_NEON] = 1;
+#endif
+}
+
+#endif
+
+
+/**
+ * @brief Initialize the dispatcher.
+ *
+ * @details
+ * Detect the CPU and select the fastest supported implementation, unless 
+ * another one is requested with AVXECC_IMPL. With AVXECC_NUMA=1 the tables 
+ * of the fixed-base comb are replicated on the NUMA nodes. This function is 
+ * called automatically at load time, calling it again has no effect.
+ */
+__attribute__((constructor)) 
+void x25519_init(void)
+{
+  const char *env;
+  int i, k;
+
+  if (best != NULL) return;
+  detect_cpu();
+  for (k = X25519_NIMPLS-1; !supported[order[k]]; k--);
+  i = order[k];
+
+  env = getenv("AVXECC_IMPL");
+  if (env != NULL) {
+    int j;
+    for (j = 0; j < X25519_NIMPLS; j++) 
+      if (!strcmp(env, impls[j].name) && supported[j]) i = j;
+  }
+  best = &impls[i];
+
+  env = getenv("AVXECC_NUMA");
+  if ((env != NULL) && !strcmp(env, "1")) x25519_numa_tables();
+}
+
+
+/**
+ * @brief Selected implementation.
+ *
+ * @return Function table of the fastest supported implementation
+ */
+const X25519Impl *x25519_impl(void)
+{
+  if (best == NULL) x25519_init();
+  return best;
+}
+
+
+/**
+ * @brief Implementation by identifier.
+ *
+ * @param id Identifier (X25519_C64, X25519_AVX2_1X4, X25519_AVX2_2X2, X25519_AVX2,
+ * X25519_AVX512 or X25519_NEON)
+ * @return Function table, or NULL if it is not supported by the CPU
+ */
+const X25519Impl *x25519_impl_by_id(int id)
+{
+  if (best == NULL) x25519_init();
+  if ((id < 0) || (id >= X25519_NIMPLS) || !supported[id]) return NULL;
+  return &impls[id];
+}
+
+
+/**
+ * @brief Support of the hybrid ladder.
+ *
+ * @return Nonzero if the CPU has AVX2, BMI2 and ADX, i.e. if the kernel 
+ * x25519_sharedsecret_hybrid_avx2 can be called
+ */
+int x25519_has_hybrid(void)
+{
+  if (best == NULL) x25519_init();
+  return supported[X25519_AVX2] && mulx;
+}
+
+
+/**
+ * @brief Plan of the tail of a batch.
+ *
+ * @details
+ * Find the cheapest sequence of calls (with padded lanes) of the supported 
+ * implementations that do not come after "top" in the order by throughput 
+ * (e.g. only c64 if c64 is forced) to process t < MAXLANES 
+ * instances, e.g. a tail of 1 or 2 shared secrets is computed by the 
+ * portable implementation instead of a full (4*1)-way call.
+ * 
+ * @param plan Identifier of the implementation for each call (-1 terminated)
+ * @param t Number of instances
+ * @param top Identifier of the widest implementation
+ * @param ss Plan for shared secret (1) or key generation (0)
+ */
+static void plan_tail(int *plan, int t, int top, int ss)
+{
+  int cost[MAXLANES+1], first[MAXLANES+1];
+  int i, j, id, c, k = 0;
+
+  // cost[i] is the cost to process i instances, first[i] its first call
+  cost[0] = 0;
+  for (i = 1; i <= t; i++) {
+    cost[i] = -1;
+    for (j = 0; (j == 0) || (order[j-1] != top); j++) {
+      id = order[j];
+      if (!supported[id]) continue;
+      c = ss ? impls[id].sharedsecret_cost : impls[id].keygen_cost;
+      c += cost[(i > impls[id].lanes) ? i-impls[id].lanes : 0];
+      if ((cost[i] < 0) || (c < cost[i])) { cost[i] = c; first[i] = id; }
+    }
+  }
+  for (i = t; i > 0; i -= impls[first[i]].lanes) {
+    plan[k++] = first[i];
+    if (i < impls[first[i]].lanes) break;
+  }
+  plan[k] = -1;
+}
+
+
+/**
+ * @brief Non-zero test of a 32-byte string.
+ *
+ * @details
+ * Constant-time (the bytes are ORed), for the results that are not validated
+ * by a kernel.
+ * 
+ * @param a String
+ * @return 1 if a is not all-zero, 0 otherwise
+ */
+static uint8_t nonzero(const uint8_t *a)
+{
+  uint32_t t = 0;
+  int i;
+
+  for (i = 0; i < 32; i++) t |= a[i];
+  return (uint8_t)((t + 0xFF) >> 8);
+}
+
+
+/**
+ * @brief Batch computation.
+ *
+ * @details
+ * Process full groups with the selected implementation and the tail with 
+ * the plan of plan_tail(). Up to "batchinv" full groups share one inversion.
+ * Padded lanes reuse the first instance of the call and their results are 
+ * discarded. With ok != NULL the shared secrets are validated: the full 
+ * groups by the kernel of checked_n[] if the implementation has one, all 
+ * other results by a non-zero test of the strings.
+ * 
+ * @param r Results
+ * @param ok Flags of the valid shared secrets (NULL for no validation)
+ * @param sk Private keys
+ * @param pk Public keys (NULL for key generation)
+ * @param n Number of instances
+ * @return Number of valid results (n without validation)
+ */
+static size_t batch(uint8_t (*r)[32], uint8_t *ok, const uint8_t (*sk)[32], 
+  const uint8_t (*pk)[32], size_t n)
+{
+  const X25519Impl *impl = x25519_impl();
+  const size_t lanes = (size_t)impl->lanes;
+  int (*const check)(uint8_t (*)[32], uint8_t *, const uint8_t (*)[32], 
+    const uint8_t (*)[32], int) = (ok != NULL) ? checked_n[impl-impls] : NULL;
+  uint8_t tr[MAXLANES][32], tsk[MAXLANES][32], tpk[MAXLANES][32];
+  int plan[MAXLANES+1];
+  size_t i = 0, j, m, cnt = n;
+  int k;
+
+  for (; i + lanes <= n; i += lanes*m) {
+    m = (n-i) / lanes;
+    if (m > (size_t)batchinv) m = (size_t)batchinv;
+    if (check != NULL) {
+      cnt -= lanes*m - (size_t)check(r+i, ok+i, sk+i, pk+i, (int)m);
+      continue;
+    }
+    if ((m == 1) || (impl->keygen_n == NULL)) {
+      m = 1;
+      if (pk == NULL) impl->keygen(r+i, sk+i);
+      else impl->sharedsecret(r+i, sk+i, pk+i);
+    } 
+    else if (pk == NULL) impl->keygen_n(r+i, sk+i, (int)m);
+    else impl->sharedsecret_n(r+i, sk+i, pk+i, (int)m);
+    if (ok != NULL)
+      for (j = i; j < i + lanes*m; j++) { ok[j] = nonzero(r[j]); cnt -= !ok[j]; }
+  }
+  if (i == n) return cnt;
+
+  plan_tail(plan, (int)(n-i), (int)(impl-impls), pk != NULL);
+  for (k = 0; plan[k] >= 0; k++) {
+    const X25519Impl *t = &impls[plan[k]];
+    m = (n-i < (size_t)t->lanes) ? n-i : (size_t)t->lanes;
+    for (j = 0; j < (size_t)t->lanes; j++) {
+      memcpy(tsk[j], sk[i + (j < m ? j : 0)], 32);
+      if (pk != NULL) memcpy(tpk[j], pk[i + (j < m ? j : 0)], 32);
+    }
+    if (pk == NULL) t->keygen(tr, (const uint8_t (*)[32])tsk);
+    else t->sharedsecret(tr, (const uint8_t (*)[32])tsk, (const uint8_t (*)[32])tpk);
+    memcpy(r[i], tr[0], 32*m);
+    if (ok != NULL)
+      for (j = i; j < i + m; j++) { ok[j] = nonzero(r[j]); cnt -= !ok[j]; }
+    i += m;
+  }
+
+  return cnt;
+}
+
+
+/**
+ * @brief Key generation of a batch.
+ *
+ * @details
+ * Generate n public keys based on the given private keys. 
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ * @param n Number of keys
+ */
+void x25519_keygen_batch(uint8_t pk[][32], const uint8_t sk[][32], size_t n)
+{
+  batch(pk, NULL, sk, NULL, n);
+}
+
+
+/**
+ * @brief Shared secret computation of a batch.
+ *
+ * @details
+ * Generate n shared secrets based on own private keys and the public keys of 
+ * the other sides.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param n Number of keys
+ */
+void x25519_sharedsecret_batch(uint8_t ss[][32], const uint8_t ska[][32], 
+  const uint8_t pkb[][32], size_t n)
+{
+  batch(ss, NULL, ska, pkb, n);
+}
+
+
+/**
+ * @brief Shared secret computation of a batch with validation.
+ *
+ * @details
+ * The same as x25519_sharedsecret_batch, and each shared secret is checked: 
+ * ok[i] = 0 if the i-th one is all-zero, i.e. if the i-th public key is a 
+ * point of small order (RFC 7748, section 6.1), and ok[i] = 1 otherwise. The
+ * AVX2 and AVX-512 kernels test the field elements in the vector registers,
+ * the other implementations and the tail of the batch test the strings.
+ * 
+ * @param ss  Shared secrets
+ * @param ok  Flags of the valid shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param n Number of keys
+ * @return Number of valid shared secrets
+ */
+size_t x25519_sharedsecret_batch_checked(uint8_t ss[][32], uint8_t ok[], 
+  const uint8_t ska[][32], const uint8_t pkb[][32], size_t n)
+{
+  return batch(ss, ok, ska, pkb, n);
+}
+
+
+/**
+ * @brief Number of computed lanes of a batch.
+ *
+ * @details
+ * Return the number of lanes (including the padded ones) that the kernel 
+ * calls of a batch of n instances compute, the ratio n / lanes is the lane 
+ * fill of the batch.
+ * 
+ * @param n Number of instances
+ * @param ss Shared secret (1) or key generation (0)
+ * @return Number of lanes
+ */
+size_t x25519_batch_lanes(size_t n, int ss)
+{
+  const X25519Impl *impl = x25519_impl();
+  const size_t lanes = (size_t)impl->lanes;
+  size_t r = n - n % lanes;
+  int plan[MAXLANES+1], k;
+
+  if (r == n) return r;
+  plan_tail(plan, (int)(n-r), (int)(impl-impls), ss);
+  for (k = 0; plan[k] >= 0; k++) r += (size_t)impls[plan[k]].lanes;
+  return r;
+}
+
+
+/**
+ * @brief Replicate the fixed-base tables on the NUMA nodes.
+ *
+ * @details
+ * Copy the tables of the comb (key generation) into one region of 2 MB pages
+ * per node, see numa_replicate_tables. Call it before the threads that use 
+ * the replicas bind to them; the threads that do not bind keep reading the 
+ * global tables.
+ * 
+ * @return Number of nodes with a replica (0 if none could be made)
+ */
+int x25519_numa_tables(void)
+{
+  return numa_replicate_tables();
+}
+
+
+/**
+ * @brief Bind the calling thread to the tables of its NUMA node.
+ *
+ * @details
+ * Point the table queries of the calling thread at the replica of the node 
+ * it runs on, the thread should be pinned to a CPU (or a node) before. It has 
+ * no effect without replicas.
+ */
+void x25519_numa_bind(void)
+{
+  numa_bind_thread();
+}
+
+
+/**
+ * @brief Set the batched inversion.
+ *
+ * @details
+ * Set the number of full groups of a batch whose z-coordinates are inverted 
+ * at once with Montgomery's trick (three multiplications per group instead of
+ * an inversion), m <= 1 computes every group with its own inversion.
+ * 
+ * @param m Number of groups (clamped to [1, X25519_MAXGROUPS])
+ */
+void x25519_set_batchinv(int m)
+{
+  if (m < 1) m = 1;
+  if (m > X25519_MAXGROUPS) m = X25519_MAXGROUPS;
+  batchinv = m;
+}
+
+
+/**
+ * @brief Allocation of an interleaved buffer.
+ *
+ * @details
+ * The buffer holds (n+3)/4 groups (64-byte aligned) and is zeroed.
+ * 
+ * @param n Number of 32-byte strings
+ * @return Buffer (free it with x25519_soa_free), or NULL if out of memory
+ */
+X25519Group *x25519_soa_alloc(size_t n)
+{
+  const size_t size = ((n+3)/4) * sizeof(X25519Group);
+  X25519Group *b = (X25519Group *)aligned_alloc(64, (size > 0) ? size : sizeof(X25519Group));
+
+  if (b != NULL) memset(b, 0, (size > 0) ? size : sizeof(X25519Group));
+  return b;
+}
+
+
+/**
+ * @brief Release of an interleaved buffer.
+ *
+ * @param b Buffer
+ */
+void x25519_soa_free(X25519Group *b)
+{
+  free(b);
+}
+
+
+/**
+ * @brief Batch computation on interleaved buffers.
+ *
+ * @details
+ * Up to "batchinv" calls of the selected implementation share one inversion,
+ * a single group that is left over by the (8*1)-way implementation is 
+ * computed with the (4*1)-way one. The implementations without kernels on 
+ * interleaved buffers (c64, avx2-1x4, avx2-2x2 and neon) compute chunks of the 
+ * byte strings with batch().
+ * 
+ * @param r Results
+ * @param sk Private keys
+ * @param pk Public keys (NULL for key generation)
+ * @param n Number of instances
+ */
+static void batch_soa(X25519Group *r, const X25519Group *sk, 
+  const X25519Group *pk, size_t n)
+{
+  const X25519Impl *impl = x25519_impl();
+  const int id = (int)(impl - impls);
+  const size_t ng = (n+3)/4;
+  uint8_t tr[4*X25519_MAXGROUPS][32], tsk[4*X25519_MAXGROUPS][32];
+  uint8_t tpk[4*X25519_MAXGROUPS][32];
+  size_t per, i, j, m;
+
+  if (keygen_soa_n[id] == NULL) {
+    for (i = 0; i < ng; i += m) {
+      m = (ng-i < X25519_MAXGROUPS) ? ng-i : X25519_MAXGROUPS;
+      for (j = 0; j < 4*m; j++) {
+        x25519_soa_get(tsk[j], sk + i, j);
+        if (pk != NULL) x25519_soa_get(tpk[j], pk + i, j);
+      }
+      batch(tr, NULL, (const uint8_t (*)[32])tsk, 
+        (pk != NULL) ? (const uint8_t (*)[32])tpk : NULL, 4*m);
+      for (j = 0; j < 4*m; j++) x25519_soa_put(r + i, j, tr[j]);
+    }
+    return;
+  }
+
+  per = (size_t)impl->lanes / 4;
+  for (i = 0; i + per <= ng; i += per*m) {
+    m = (ng-i) / per;
+    if (m > (size_t)batchinv) m = (size_t)batchinv;
+    if (pk == NULL) keygen_soa_n[id](r+i, sk+i, (int)m);
+    else sharedsecret_soa_n[id](r+i, sk+i, pk+i, (int)m);
+  }
+  if (i < ng) {
+    if (pk == NULL) keygen_soa_n[X25519_AVX2](r+i, sk+i, 1);
+    else sharedsecret_soa_n[X25519_AVX2](r+i, sk+i, pk+i, 1);
+  }
+}
+
+
+/**
+ * @brief Key generation of a batch on interleaved buffers.
+ *
+ * @details
+ * Generate the public keys of the n private keys in sk into pk (pk may be 
+ * sk), both buffers hold (n+3)/4 groups.
+ * 
+ * @param pk Public keys
+ * @param sk Private keys
+ * @param n Number of keys
+ */
+void x25519_keygen_soa(X25519Group *pk, const X25519Group *sk, size_t n)
+{
+  batch_soa(pk, sk, NULL, n);
+}
+
+
+/**
+ * @brief Shared secret computation of a batch on interleaved buffers.
+ *
+ * @details
+ * Generate n shared secrets into ss (ss may be ska or pkb), all buffers hold 
+ * (n+3)/4 groups.
+ * 
+ * @param ss  Shared secrets
+ * @param ska Own private keys
+ * @param pkb Public keys of the other sides
+ * @param n Number of keys
+ */
+void x25519_sharedsecret_soa(X25519Group *ss, const X25519Group *ska, 
+  const X25519Group *pkb, size_t n)
+{
+  batch_soa(ss, ska, pkb, n);
+}
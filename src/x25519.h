@@ -0,0 +1,126 @@
+/**
+ *******************************************************************************
+ * @file x25519.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the X25519 dispatcher.
+ *
+ * @details 
+ * This file defines the table of function pointers of an implementation and 
+ * contains prototypes to select the best implementation for the running CPU. 
+ * The selection is done once, all later calls go through the resolved table.
+ *******************************************************************************
+ */
+
+#ifndef _X25519_H
+#define _X25519_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+// identifiers of the implementations, part of the ABI: new implementations 
+// take the next free identifier and the existing ones keep theirs (the order
+// by throughput is a list in x25519.c); AVX2_1X4 is the single-instance 
+// (1*4)-way implementation with the lowest latency on AVX2, AVX2_2X2 the 
+// (2*2)-way one for pairs of instances; NEON is the (2*1)-way implementation
+// of aarch64, where only C64 and NEON are built
+#define X25519_C64      0
+#define X25519_AVX2_1X4 1
+#define X25519_AVX2     2
+#define X25519_AVX512   3
+#define X25519_AVX2_2X2 4
+#define X25519_NEON     5
+#define X25519_NIMPLS   6
+
+// interleaved (structure-of-arrays) buffer of 32-byte strings: a group holds 
+// four strings, w[j][i] is the j-th little-endian 64-bit word (bytes 8j to 
+// 8j+7) of the i-th string, so string k of a buffer b starts in b[k/4].w[0]
+// [k%4]; this is the layout that the vector kernels load and store without 
+// transposing (AVX-512 takes two groups per call)
+typedef struct x25519_group {
+  uint64_t w[4][4];
+} __attribute__((aligned(64))) X25519Group;
+
+// table of an implementation, a call processes "lanes" instances
+typedef struct x25519_impl {
+  const char *name;  // "c64", "avx2-1x4", "avx2-2x2", "avx2", "avx512" or "neon"
+  int lanes;         // number of instances of each call
+  // approximate cost of one call (kilo cycles), only used to plan the tails
+  int keygen_cost, sharedsecret_cost;
+  void (*keygen)(uint8_t (*pk)[32], const uint8_t (*sk)[32]);
+  void (*sharedsecret)(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+    const uint8_t (*pkb)[32]);
+  // m calls with one shared inversion (NULL if not available)
+  void (*keygen_n)(uint8_t (*pk)[32], const uint8_t (*sk)[32], int m);
+  void (*sharedsecret_n)(uint8_t (*ss)[32], const uint8_t (*ska)[32], 
+    const uint8_t (*pkb)[32], int m);
+} X25519Impl;
+
+// function prototypes
+
+void x25519_init(void);
+const X25519Impl *x25519_impl(void);
+const X25519Impl *x25519_impl_by_id(int id);
+
+// batches of arbitrary size n, the i-th result corresponds to the i-th key
+void x25519_keygen_batch(uint8_t pk[][32], const uint8_t sk[][32], size_t n);
+void x25519_sharedsecret_batch(uint8_t ss[][32], const uint8_t ska[][32], 
+  const uint8_t pkb[][32], size_t n);
+// the same with validation, ok[i] = 0 if the i-th shared secret is all-zero
+// (a public key of small order), returns the number of valid shared secrets
+size_t x25519_sharedsecret_batch_checked(uint8_t ss[][32], uint8_t ok[], 
+  const uint8_t ska[][32], const uint8_t pkb[][32], size_t n);
+size_t x25519_batch_lanes(size_t n, int ss);
+// number of calls (at most 16) of a batch that share one inversion, 1 disables
+// the batched inversion; set it before batches are computed in other threads
+void x25519_set_batchinv(int m);
+// replicate the fixed-base tables on every NUMA node in 2 MB pages (also done 
+// at load time with AVXECC_NUMA=1), returns the number of nodes with a replica;
+// x25519_numa_bind points the calling thread at the replica of the node it 
+// runs on (pin it first), the pinned workers of the engine do that themselves
+int x25519_numa_tables(void);
+void x25519_numa_bind(void);
+
+// batches of n strings in interleaved buffers of (n+3)/4 groups, which the 
+// producers and consumers write and read in place; the results overwrite the
+// output buffer (which may be one of the inputs), the unused lanes of the last
+// group are computed as well
+X25519Group *x25519_soa_alloc(size_t n);
+void x25519_soa_free(X25519Group *b);
+void x25519_keygen_soa(X25519Group *pk, const X25519Group *sk, size_t n);
+void x25519_sharedsecret_soa(X25519Group *ss, const X25519Group *ska, 
+  const X25519Group *pkb, size_t n);
+
+/**
+ * @brief Store a 32-byte string in an interleaved buffer.
+ *
+ * @param b Buffer
+ * @param k Index of the string
+ * @param s String (32 bytes)
+ */
+static inline void x25519_soa_put(X25519Group *b, size_t k, const uint8_t *s)
+{
+  int j;
+
+  for (j = 0; j < 4; j++) memcpy(&b[k/4].w[j][k%4], s + 8*j, 8);
+}
+
+/**
+ * @brief Load a 32-byte string from an interleaved buffer.
+ *
+ * @param s String (32 bytes)
+ * @param b Buffer
+ * @param k Index of the string
+ */
+static inline void x25519_soa_get(uint8_t *s, const X25519Group *b, size_t k)
+{
+  int j;
+
+  for (j = 0; j < 4; j++) memcpy(s + 8*j, &b[k/4].w[j][k%4], 8);
+}
+
+#endif
@@ -0,0 +1,38 @@
+/**
+ *******************************************************************************
+ * @file x448.h
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Header file of the X448 API on byte strings.
+ *
+ * @details
+ * This file contains the function prototypes of the X448 (RFC 7748) key
+ * generation and shared secret on 56-byte strings: the 4-way kernels and the
+ * batches of arbitrary size. The functions require AVX2.
+ *******************************************************************************
+ */
+
+#ifndef _X448_H
+#define _X448_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define X448_BYTES 56
+
+// function prototypes
+
+// kernels on 56-byte strings, each call computes four instances
+void x448_keygen_avx2(uint8_t (*pk)[X448_BYTES], const uint8_t (*sk)[X448_BYTES]);
+void x448_sharedsecret_avx2(uint8_t (*ss)[X448_BYTES],
+  const uint8_t (*ska)[X448_BYTES], const uint8_t (*pkb)[X448_BYTES]);
+// batches of arbitrary size n, the i-th result corresponds to the i-th key
+void x448_keygen_batch(uint8_t (*pk)[X448_BYTES], const uint8_t (*sk)[X448_BYTES],
+  size_t n);
+void x448_sharedsecret_batch(uint8_t (*ss)[X448_BYTES],
+  const uint8_t (*ska)[X448_BYTES], const uint8_t (*pkb)[X448_BYTES], size_t n);
+
+#endif
@@ -0,0 +1,264 @@
+/**
+ *******************************************************************************
+ * @file gentable.c
+ * @version 1.0.1
+ * @date 2020-09-01
+ * @copyright Copyright © 2020 by University of Luxembourg.
+ * @author Developed at SnT APSIA by: Hao Cheng, Johann Groszschaedl and Jiaqi Tian.
+ *
+ * @brief Generator of the look-up tables of the fixed-base comb.
+ *
+ * @details
+ * This program is run at build time and prints the table of the multiples of 
+ * the base point B for a window width w and s teeth positions, i.e. the entry
+ * [j][k] is (k+1) * 2^(w*s*j) * B in Duif representation [(y+x)/2, (y-x)/2, 
+ * d*x*y]. It only needs the portable radix-2^51 field arithmetic.
+ * With the option "limbs", the coordinates are printed as 29-bit limbs in the
+ * layout of the AVX2 lookup: [j][c][l][k] is limb l of coordinate c of entry 
+ * k, so one aligned 256-bit load holds a limb of eight entries.
+ * With the option "size", only the geometry and the sizes of both tables in
+ * bytes are printed, to choose a geometry that fits the caches of a CPU.
+ *
+ * Usage: gentable <w> <s> [limbs | size]
+ *******************************************************************************
+ */
+
+#include "../src/gfparith51.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// point in extended coordinates [x, y, z, t], t = x*y/z
+typedef struct { uint64_t x[NWORDS51], y[NWORDS51], z[NWORDS51], t[NWORDS51]; } Point;
+
+// d = -121665/121666 and the base point (x, 4/5) of edwards25519 (big-endian)
+static const char *hex_d  = "52036CEE2B6FFE738CC740797779E89800700A4D4141D8AB75EB4DCA135978A3";
+static const char *hex_bx = "216936D3CD6E53FEC0A4E231FDD6DC5C692CC7609525A7B2C9562D608F25D51A";
+static const char *hex_by = "6666666666666666666666666666666666666666666666666666666666666658";
+
+static uint64_t d[NWORDS51], d2[NWORDS51];
+
+
+// field element from a big-endian hex string
+static void from_hex(uint64_t *r, const char *h)
+{
+  uint8_t b[32];
+  unsigned int v;
+  int i;
+
+  for (i = 0; i < 32; i++) {
+    sscanf(h + 2*i, "%2x", &v);
+    b[31-i] = (uint8_t)v;
+  }
+  mpi51_from_bytes_c64(r, b);
+}
+
+// fully reduce r (the generator does not care about the bounds of the limbs)
+static void reduce(uint64_t *r)
+{
+  uint8_t b[32];
+
+  mpi51_to_bytes_c64(b, r);
+  mpi51_from_bytes_c64(r, b);
+}
+
+static void add(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  mpi51_gfp_add_c64(r, a, b);
+  reduce(r);
+}
+
+static void sub(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  mpi51_gfp_sub_c64(r, a, b);
+  reduce(r);
+}
+
+static void mul(uint64_t *r, const uint64_t *a, const uint64_t *b)
+{
+  mpi51_gfp_mul_c64(r, a, b);
+  reduce(r);
+}
+
+// unified addition R = P + Q on the twisted Edwards curve with a = -1
+static void point_add(Point *r, const Point *p, const Point *q)
+{
+  uint64_t a[NWORDS51], b[NWORDS51], c[NWORDS51], e[NWORDS51];
+  uint64_t f[NWORDS51], g[NWORDS51], h[NWORDS51], t[NWORDS51];
+
+  sub(a, p->y, p->x);
+  sub(t, q->y, q->x);
+  mul(a, a, t);
+  add(b, p->y, p->x);
+  add(t, q->y, q->x);
+  mul(b, b, t);
+  mul(c, p->t, q->t);
+  mul(c, c, d2);
+  mul(t, p->z, q->z);
+  add(t, t, t);
+  sub(e, b, a);
+  sub(f, t, c);
+  add(g, t, c);
+  add(h, b, a);
+  mul(r->x, e, f);
+  mul(r->y, g, h);
+  mul(r->t, e, h);
+  mul(r->z, f, g);
+}
+
+// print mode: 64-bit words of LutPoint or 29-bit limbs
+static int limbs = 0;
+
+// print a coordinate as four 64-bit words (least significant first)
+static void print_coor(const uint64_t *a)
+{
+  uint8_t b[32];
+  uint64_t w;
+  int i, j;
+
+  mpi51_to_bytes_c64(b, a);
+  printf("      {");
+  for (i = 0; i < 4; i++) {
+    for (w = 0, j = 7; j >= 0; j--) w = (w << 8) | b[8*i+j];
+    printf(" 0x%016llX%s", (unsigned long long)w, (i < 3) ? "," : " },\n");
+  }
+}
+
+// affine Duif coordinates [(y+x)/2, (y-x)/2, d*x*y] of a point
+static void duif(uint64_t *u, uint64_t *v, uint64_t *w, const Point *p)
+{
+  uint64_t zi[NWORDS51], x[NWORDS51], y[NWORDS51], half[NWORDS51];
+
+  memset(half, 0, sizeof(half));
+  half[0] = 2;
+  mpi51_gfp_inv_c64(half, half);
+  reduce(half);
+  mpi51_gfp_inv_c64(zi, p->z);
+  reduce(zi);
+  mul(x, p->x, zi);
+  mul(y, p->y, zi);
+  add(u, y, x); mul(u, u, half);
+  sub(v, y, x); mul(v, v, half);
+  mul(w, x, y); mul(w, w, d);
+}
+
+// print a point in Duif representation [(y+x)/2, (y-x)/2, d*x*y]
+static void print_duif(const Point *p)
+{
+  uint64_t u[NWORDS51], v[NWORDS51], w[NWORDS51];
+
+  duif(u, v, w, p);
+  printf("    {\n");
+  print_coor(u);
+  print_coor(v);
+  print_coor(w);
+  printf("    },\n");
+}
+
+// coordinate c of the entries k of a position as 29-bit limbs
+static void print_limbs(uint64_t (*c)[NWORDS51], int nk)
+{
+  uint8_t b[32];
+  uint32_t v;
+  int i, j, k;
+
+  for (i = 0; i < 9; i++) {
+    printf("      {");
+    for (k = 0; k < nk; k++) {
+      mpi51_to_bytes_c64(b, c[k]);
+      for (v = 0, j = 0; (j < 29) && (29*i+j < 256); j++) 
+        v |= (uint32_t)((b[(29*i+j) >> 3] >> ((29*i+j) & 7)) & 1) << j;
+      printf("%s0x%08X%s", ((k & 7) == 0 && k) ? "\n       " : " ", v, 
+        (k < nk-1) ? "," : " },\n");
+    }
+  }
+}
+
+int main(int argc, char **argv)
+{
+  Point b, p, q;
+  uint64_t l[NWORDS51], r[NWORDS51], t[NWORDS51], one[NWORDS51];
+  static uint64_t cu[64][NWORDS51], cv[64][NWORDS51], cw[64][NWORDS51];
+  uint8_t lb[32], rb[32];
+  int w, s, nd, np, nk, i, j, k;
+
+  if ((argc < 3) || (argc > 4) || 
+      ((argc == 4) && strcmp(argv[3], "limbs") && strcmp(argv[3], "size"))) {
+    fprintf(stderr, "usage: %s <w> <s> [limbs | size]\n", argv[0]);
+    return 1;
+  }
+  limbs = (argc == 4) && !strcmp(argv[3], "limbs");
+  w = atoi(argv[1]);
+  s = atoi(argv[2]);
+  if ((w < 2) || (w > 7) || (s < 1)) {
+    fprintf(stderr, "%s: need 2 <= w <= 7 and s >= 1\n", argv[0]);
+    return 1;
+  }
+  nd = (256 + w - 1) / w;  // signed digits of a (pruned) scalar
+  np = (nd + s - 1) / s;   // positions of the table
+  nk = 1 << (w - 1);       // multiples per position
+
+  // a LutPoint has three coordinates of four 64-bit words, the limb table 
+  // three coordinates of nine 32-bit limbs
+  if ((argc == 4) && !strcmp(argv[3], "size")) {
+    printf("w = %d, s = %d: %d positions of %d points, %d bytes (64-bit words), "
+      "%d bytes (29-bit limbs)\n", w, s, np, nk, np*nk*96, np*nk*108);
+    return 0;
+  }
+
+  from_hex(d, hex_d);
+  add(d2, d, d);
+  memset(&b, 0, sizeof(b));
+  from_hex(b.x, hex_bx);
+  from_hex(b.y, hex_by);
+  b.z[0] = 1;
+  mul(b.t, b.x, b.y);
+
+  // check -x^2 + y^2 = 1 + d*x^2*y^2
+  memset(one, 0, sizeof(one));
+  one[0] = 1;
+  mul(l, b.x, b.x);
+  mul(r, b.y, b.y);
+  mul(t, l, r);
+  sub(l, r, l);
+  mul(t, t, d);
+  add(r, one, t);
+  mpi51_to_bytes_c64(lb, l);
+  mpi51_to_bytes_c64(rb, r);
+  if (memcmp(lb, rb, 32)) {
+    fprintf(stderr, "%s: base point is not on the curve\n", argv[0]);
+    return 1;
+  }
+
+  printf("// generated by tools/gentable for FIXBASE_W = %d and FIXBASE_S = %d\n", w, s);
+  printf("// entry [j][k] is (k+1) * 2^(%d*j) * B, %d bytes\n", w*s, 
+    np*nk*(limbs ? 108 : 96));
+  if (limbs) 
+    printf("const uint32_t base29[%d][3][9][%d] __attribute__((aligned(32))) = \n{\n", 
+      np, nk);
+  else 
+    printf("const LutPoint base[%d][%d] = \n{\n", np, nk);
+  for (j = 0; j < np; j++) {
+    printf("  { // base[%d][0] - base[%d][%d]\n", j, j, nk-1);
+    q = b;
+    for (k = 0; k < nk; k++) {
+      if (limbs) duif(cu[k], cv[k], cw[k], &q);
+      else print_duif(&q);
+      point_add(&q, &q, &b);
+    }
+    if (limbs) {
+      printf("    {\n"); print_limbs(cu, nk); printf("    },\n");
+      printf("    {\n"); print_limbs(cv, nk); printf("    },\n");
+      printf("    {\n"); print_limbs(cw, nk); printf("    },\n");
+    }
+    printf("  },\n");
+    // B = 2^(w*s) * B
+    for (i = 0; i < w*s; i++) {
+      p = b;
+      point_add(&b, &p, &p);
+    }
+  }
+  printf("};\n");
+
+  return 0;
+}